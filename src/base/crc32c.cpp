@@ -0,0 +1,203 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * crc32c.cpp - CRC-32C (Castagnoli) checksums
+ *
+ * On x86-64 the SSE4.2 crc32 instruction is used when the CPU has it; it is detected once at run time, so the binary
+ * stays portable. Otherwise a table driven (slicing-by-8) implementation is used.
+ */
+
+#include "crc32c.hpp"
+
+#include <cstring>
+
+#if defined (__x86_64__) || defined (_M_X64)
+#define CRC32C_HAVE_SSE42
+#if defined (_MSC_VER)
+#include <intrin.h>
+#endif
+#include <nmmintrin.h>
+#endif
+
+namespace cubbase
+{
+  static const std::uint32_t CRC32C_POLYNOMIAL = 0x82F63B78;	// reflected Castagnoli polynomial
+
+  using crc32c_extend_func = std::uint32_t (*) (std::uint32_t, const unsigned char *, std::size_t);
+
+  //  crc32c_tables - lookup tables for slicing-by-8
+  //
+  struct crc32c_tables
+  {
+    std::uint32_t m_table[8][256];
+
+    crc32c_tables ()
+    {
+      for (std::uint32_t i = 0; i < 256; i++)
+	{
+	  std::uint32_t crc = i;
+	  for (int bit = 0; bit < 8; bit++)
+	    {
+	      crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLYNOMIAL : crc >> 1;
+	    }
+	  m_table[0][i] = crc;
+	}
+      for (std::uint32_t i = 0; i < 256; i++)
+	{
+	  for (int slice = 1; slice < 8; slice++)
+	    {
+	      m_table[slice][i] = (m_table[slice - 1][i] >> 8) ^ m_table[0][m_table[slice - 1][i] & 0xFF];
+	    }
+	}
+    }
+  };
+
+  static const crc32c_tables &
+  crc32c_get_tables ()
+  {
+    static const crc32c_tables tables;
+    return tables;
+  }
+
+  static std::uint32_t
+  crc32c_extend_portable_internal (std::uint32_t crc, const unsigned char *data, std::size_t size)
+  {
+    const crc32c_tables &tables = crc32c_get_tables ();
+    const std::uint32_t (*t)[256] = tables.m_table;
+
+    while (size >= 8)
+      {
+	std::uint32_t low;
+	std::uint32_t high;
+
+	// little endian load
+	low = (std::uint32_t) data[0] | ((std::uint32_t) data[1] << 8) | ((std::uint32_t) data[2] << 16)
+	      | ((std::uint32_t) data[3] << 24);
+	high = (std::uint32_t) data[4] | ((std::uint32_t) data[5] << 8) | ((std::uint32_t) data[6] << 16)
+	       | ((std::uint32_t) data[7] << 24);
+	low ^= crc;
+
+	crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24]
+	      ^ t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+
+	data += 8;
+	size -= 8;
+      }
+    while (size > 0)
+      {
+	crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+	data++;
+	size--;
+      }
+    return crc;
+  }
+
+#if defined (CRC32C_HAVE_SSE42)
+#if defined (__GNUC__)
+  __attribute__ ((target ("sse4.2")))
+#endif
+  static std::uint32_t
+  crc32c_extend_sse42_internal (std::uint32_t crc, const unsigned char *data, std::size_t size)
+  {
+    std::uint64_t crc64 = crc;
+    std::uint64_t word;
+
+    // align data to eight bytes
+    while (size > 0 && ((std::uintptr_t) data & 7) != 0)
+      {
+	crc64 = _mm_crc32_u8 ((std::uint32_t) crc64, *data);
+	data++;
+	size--;
+      }
+    while (size >= 8)
+      {
+	std::memcpy (&word, data, sizeof (word));
+	crc64 = _mm_crc32_u64 (crc64, word);
+	data += 8;
+	size -= 8;
+      }
+    while (size > 0)
+      {
+	crc64 = _mm_crc32_u8 ((std::uint32_t) crc64, *data);
+	data++;
+	size--;
+      }
+    return (std::uint32_t) crc64;
+  }
+
+  static bool
+  crc32c_cpu_has_sse42 ()
+  {
+#if defined (_MSC_VER)
+    int cpu_info[4];
+
+    __cpuid (cpu_info, 1);
+    return (cpu_info[2] & (1 << 20)) != 0;
+#elif defined (__GNUC__)
+    __builtin_cpu_init ();
+    return __builtin_cpu_supports ("sse4.2") != 0;
+#else
+    return false;
+#endif
+  }
+#endif // CRC32C_HAVE_SSE42
+
+  static crc32c_extend_func
+  crc32c_select_implementation ()
+  {
+#if defined (CRC32C_HAVE_SSE42)
+    if (crc32c_cpu_has_sse42 ())
+      {
+	return crc32c_extend_sse42_internal;
+      }
+#endif // CRC32C_HAVE_SSE42
+    return crc32c_extend_portable_internal;
+  }
+
+  static crc32c_extend_func
+  crc32c_get_implementation ()
+  {
+    static const crc32c_extend_func implementation = crc32c_select_implementation ();
+    return implementation;
+  }
+
+  std::uint32_t
+  crc32c (const void *data, std::size_t size)
+  {
+    return crc32c_extend (0, data, size);
+  }
+
+  std::uint32_t
+  crc32c_extend (std::uint32_t crc, const void *data, std::size_t size)
+  {
+    return ~crc32c_get_implementation () (~crc, (const unsigned char *) data, size);
+  }
+
+  std::uint32_t
+  crc32c_portable_extend (std::uint32_t crc, const void *data, std::size_t size)
+  {
+    return ~crc32c_extend_portable_internal (~crc, (const unsigned char *) data, size);
+  }
+
+  bool
+  crc32c_is_accelerated ()
+  {
+    return crc32c_get_implementation () != crc32c_extend_portable_internal;
+  }
+} // namespace cubbase
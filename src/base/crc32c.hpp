@@ -0,0 +1,45 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * crc32c.hpp - CRC-32C (Castagnoli) checksums, hardware accelerated when the CPU supports it
+ */
+
+#ifndef _CRC32C_HPP_
+#define _CRC32C_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cubbase
+{
+  // crc32c - compute the CRC-32C of given data.
+  std::uint32_t crc32c (const void *data, std::size_t size);
+
+  // crc32c_extend - extend crc (as returned by crc32c or by crc32c_extend) with more data. computing the CRC of some
+  //                 data in pieces gives the same result as computing it at once.
+  std::uint32_t crc32c_extend (std::uint32_t crc, const void *data, std::size_t size);
+
+  // crc32c_portable_extend - same as crc32c_extend, but never uses CPU instructions.
+  std::uint32_t crc32c_portable_extend (std::uint32_t crc, const void *data, std::size_t size);
+
+  // crc32c_is_accelerated - does crc32c use CPU instructions on this machine?
+  bool crc32c_is_accelerated ();
+} // namespace cubbase
+
+#endif // _CRC32C_HPP_
@@ -1643,7 +1643,11 @@
 #define ER_SCALABILITY_DEV_RESERVED_ERROR19         -1282
 #define ER_SCALABILITY_DEV_RESERVED_ERROR20         -1283
 
-#define ER_LAST_ERROR                               -1284
+#define ER_PB_PAGE_CHECKSUM_MISMATCH                -1284
+
+#define ER_IO_DIRECT_IO_NOT_SUPPORTED               -1285
+
+#define ER_LAST_ERROR                               -1286
 
 /*
  * CAUTION!
@@ -63,6 +63,7 @@ typedef enum
   FI_TEST_DISK_MANAGER_VOLUME_EXPAND = 100002,
   FI_TEST_FILE_IO_WRITE_PARTS1 = 100003,
   FI_TEST_FILE_IO_WRITE_PARTS2 = 100004,
+  FI_TEST_FILE_IO_WRITE_PARTS3 = 100005,
 
   /* FILE MANAGER */
   FI_TEST_FILE_MANAGER_UNDO_TRACKER_REGISTER = 200000,	/* unused */
@@ -198,6 +198,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_IOREADS, "Num_file_ioreads"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_IOWRITES, "Num_file_iowrites"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_IOSYNCHES, "Num_file_iosynches"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_ASYNC_IO_BATCHES, "Num_file_async_io_batches"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_FILE_IOSYNC_ALL, "file_iosync_all"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_PAGE_ALLOCS, "Num_file_page_allocs"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_PAGE_DEALLOCS, "Num_file_page_deallocs"),
@@ -209,6 +210,17 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_IOREADS, "Num_data_page_ioreads"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_IOWRITES, "Num_data_page_iowrites"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_FLUSHED, "Num_data_page_flushed"),
+  /* read-ahead */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_PREFETCH_REQUESTS, "Num_data_page_prefetch_requests"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_PREFETCH_IOREADS, "Num_data_page_prefetch_ioreads"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_PREFETCH_HITS, "Num_data_page_prefetch_hits"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_PREFETCH_WASTED, "Num_data_page_prefetch_wasted"),
+  /* warmup */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_WARMUP_PAGES_DUMPED, "Num_data_page_warmup_dumped"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_WARMUP_PAGES_LOADED, "Num_data_page_warmup_loaded"),
+  /* optimistic reads */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_OPTIMISTIC_READS, "Num_data_page_optimistic_reads"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_OPTIMISTIC_READ_FAILS, "Num_data_page_optimistic_read_fails"),
   /* peeked stats */
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_PRIVATE_QUOTA, "Num_data_page_private_quota"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_PRIVATE_COUNT, "Num_data_page_private_count"),
@@ -218,6 +230,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_LRU2_CNT, "Num_data_page_lru2"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_LRU3_CNT, "Num_data_page_lru3"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_VICT_CAND, "Num_data_page_victim_candidate"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_MEMORY_PAGE_SIZE, "Num_data_page_memory_page_kbytes"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_NUMA_NODES, "Num_data_page_numa_nodes"),
 
   /* Execution statistics for the log manager */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_FETCHES, "Num_log_page_fetches"),
@@ -260,6 +274,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_INSERTS, "Num_btree_inserts"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_DELETES, "Num_btree_deletes"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_UPDATES, "Num_btree_updates"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_UPDATE_SKIPS, "Num_btree_update_skips"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_COVERED, "Num_btree_covered"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_NONCOVERED, "Num_btree_noncovered"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_RESUMES, "Num_btree_resumes"),
@@ -267,6 +282,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_SPLITS, "Num_btree_splits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_MERGES, "Num_btree_merges"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_GET_STATS, "Num_btree_get_stats"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_LOAD_ROWS, "Num_btree_load_rows"),
 
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_BT_ONLINE_LOAD, "btree_online_load"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_BT_ONLINE_INSERT_TASK, "btree_online_insert_task"),
@@ -359,6 +375,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_REL_VACUUMS, "Num_heap_rel_vacuums"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_INSID_VACUUMS, "Num_heap_insid_vacuums"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_REMOVE_VACUUMS, "Num_heap_remove_vacuums"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_BIG_COMPRESSED_INPUT_BYTES, "Num_heap_big_compressed_input_bytes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_BIG_COMPRESSED_OUTPUT_BYTES, "Num_heap_big_compressed_output_bytes"),
 
   /* Track heap modify timers. */
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_HEAP_INSERT_PREPARE, "heap_insert_prepare"),
@@ -384,6 +402,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_HF_BEST_SPACE_FIND, "bestspace_find"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_HF_HEAP_FIND_PAGE_BEST_SPACE, "heap_find_page_bestspace"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_HF_HEAP_FIND_BEST_PAGE, "heap_find_best_page"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_HF_HEAP_HDR_FIX_FOR_INSERT, "heap_hdr_fix_for_insert"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HF_NUM_INSERT_AFFINITY_HITS, "Num_heap_insert_affinity_hits"),
 
   /* B-tree detailed statistics. */
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_BT_FIX_OVF_OIDS, "bt_fix_ovf_oids"),
@@ -553,6 +573,10 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_LZ4_COMPRESS_TIME_COUNTERS, "Log_LZ4_compress"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_LZ4_DECOMPRESS_TIME_COUNTERS, "Log_LZ4_decompress"),
 
+  /* Heap record LZ4 compression statistics */
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_HEAP_LZ4_COMPRESS_TIME_COUNTERS, "Heap_LZ4_compress"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_HEAP_LZ4_DECOMPRESS_TIME_COUNTERS, "Heap_LZ4_decompress"),
+
   /* peeked stats */
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_WAIT_THREADS_HIGH_PRIO, "Num_alloc_bcb_wait_threads_high_priority"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_WAIT_THREADS_LOW_PRIO, "Num_alloc_bcb_wait_threads_low_priority"),
@@ -1795,6 +1819,8 @@ perfmon_server_calc_stats (UINT64 * stats)
 		    &(stats[pstat_Metadata[PSTAT_PB_LFCQ_BIG_PRV_NUM].start_offset]),
 		    &(stats[pstat_Metadata[PSTAT_PB_LFCQ_PRV_NUM].start_offset]),
 		    &(stats[pstat_Metadata[PSTAT_PB_LFCQ_SHR_NUM].start_offset]));
+  pgbuf_peek_memory_stats (&(stats[pstat_Metadata[PSTAT_PB_MEMORY_PAGE_SIZE].start_offset]),
+			   &(stats[pstat_Metadata[PSTAT_PB_NUMA_NODES].start_offset]));
 
   css_get_thread_stats (&stats[pstat_Metadata[PSTAT_THREAD_STATS].start_offset]);
   perfmon_peek_thread_daemon_stats (stats);
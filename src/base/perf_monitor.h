@@ -275,6 +275,7 @@ typedef enum
   PSTAT_FILE_NUM_IOREADS,
   PSTAT_FILE_NUM_IOWRITES,
   PSTAT_FILE_NUM_IOSYNCHES,
+  PSTAT_FILE_NUM_ASYNC_IO_BATCHES,
   PSTAT_FILE_IOSYNC_ALL,
   PSTAT_FILE_NUM_PAGE_ALLOCS,
   PSTAT_FILE_NUM_PAGE_DEALLOCS,
@@ -286,6 +287,17 @@ typedef enum
   PSTAT_PB_NUM_IOREADS,
   PSTAT_PB_NUM_IOWRITES,
   PSTAT_PB_NUM_FLUSHED,
+  /* read-ahead */
+  PSTAT_PB_NUM_PREFETCH_REQUESTS,
+  PSTAT_PB_NUM_PREFETCH_IOREADS,
+  PSTAT_PB_NUM_PREFETCH_HITS,
+  PSTAT_PB_NUM_PREFETCH_WASTED,
+  /* warmup */
+  PSTAT_PB_NUM_WARMUP_PAGES_DUMPED,
+  PSTAT_PB_NUM_WARMUP_PAGES_LOADED,
+  /* optimistic reads */
+  PSTAT_PB_NUM_OPTIMISTIC_READS,
+  PSTAT_PB_NUM_OPTIMISTIC_READ_FAILS,
   /* peeked stats */
   PSTAT_PB_PRIVATE_QUOTA,
   PSTAT_PB_PRIVATE_COUNT,
@@ -295,6 +307,8 @@ typedef enum
   PSTAT_PB_LRU2_CNT,
   PSTAT_PB_LRU3_CNT,
   PSTAT_PB_VICT_CAND,
+  PSTAT_PB_MEMORY_PAGE_SIZE,
+  PSTAT_PB_NUMA_NODES,
 
   /* Execution statistics for the log manager */
   PSTAT_LOG_NUM_FETCHES,
@@ -336,6 +350,7 @@ typedef enum
   PSTAT_BT_NUM_INSERTS,
   PSTAT_BT_NUM_DELETES,
   PSTAT_BT_NUM_UPDATES,
+  PSTAT_BT_NUM_UPDATE_SKIPS,
   PSTAT_BT_NUM_COVERED,
   PSTAT_BT_NUM_NONCOVERED,
   PSTAT_BT_NUM_RESUMES,
@@ -343,6 +358,7 @@ typedef enum
   PSTAT_BT_NUM_SPLITS,
   PSTAT_BT_NUM_MERGES,
   PSTAT_BT_NUM_GET_STATS,
+  PSTAT_BT_NUM_LOAD_ROWS,
 
   PSTAT_BT_ONLINE_LOAD,
   PSTAT_BT_ONLINE_INSERT_TASK,
@@ -432,6 +448,8 @@ typedef enum
   PSTAT_HEAP_REL_VACUUMS,
   PSTAT_HEAP_INSID_VACUUMS,
   PSTAT_HEAP_REMOVE_VACUUMS,
+  PSTAT_HEAP_BIG_COMPRESSED_INPUT_BYTES,
+  PSTAT_HEAP_BIG_COMPRESSED_OUTPUT_BYTES,
 
   /* Track heap modify timers. */
   PSTAT_HEAP_INSERT_PREPARE,
@@ -457,6 +475,8 @@ typedef enum
   PSTAT_HF_BEST_SPACE_FIND,
   PSTAT_HF_HEAP_FIND_PAGE_BEST_SPACE,
   PSTAT_HF_HEAP_FIND_BEST_PAGE,
+  PSTAT_HF_HEAP_HDR_FIX_FOR_INSERT,
+  PSTAT_HF_NUM_INSERT_AFFINITY_HITS,
 
   /* B-tree ops detailed statistics. */
   PSTAT_BT_FIX_OVF_OIDS,
@@ -624,6 +644,10 @@ typedef enum
   PSTAT_LOG_LZ4_COMPRESS_TIME_COUNTERS,
   PSTAT_LOG_LZ4_DECOMPRESS_TIME_COUNTERS,
 
+  /* Heap record LZ4 compress statistics */
+  PSTAT_HEAP_LZ4_COMPRESS_TIME_COUNTERS,
+  PSTAT_HEAP_LZ4_DECOMPRESS_TIME_COUNTERS,
+
   /* peeked stats */
   PSTAT_PB_WAIT_THREADS_HIGH_PRIO,
   PSTAT_PB_WAIT_THREADS_LOW_PRIO,
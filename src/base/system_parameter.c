@@ -691,6 +691,26 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_DDL_AUDIT_LOG "ddl_audit_log"
 #define PRM_NAME_DDL_AUDIT_LOG_SIZE "ddl_audit_log_size"
+#define PRM_NAME_PB_READ_AHEAD_MAX_PAGES "data_buffer_read_ahead_max_pages"
+#define PRM_NAME_IO_ASYNC_ENABLE "io_async_enable"
+#define PRM_NAME_PB_WARMUP_PAGES "data_buffer_warmup_pages"
+#define PRM_NAME_PB_WARMUP_DUMP_INTERVAL "data_buffer_warmup_dump_interval_in_secs"
+#define PRM_NAME_PB_HUGE_PAGES "data_buffer_huge_pages"
+#define PRM_NAME_PB_NUMA_POLICY "data_buffer_numa_policy"
+#define PRM_NAME_BT_OPTIMISTIC_TRAVERSAL "btree_optimistic_traversal"
+#define PRM_NAME_PB_PAGE_CHECKSUM "data_page_checksum"
+#define PRM_NAME_IO_BACKUP_CHANGED_PAGE_TRACKING "backup_changed_page_tracking"
+#define PRM_NAME_DWB_ATOMIC_WRITE "double_write_buffer_atomic_write"
+#define PRM_NAME_DATA_VOLUME_DIRECT_IO "data_volume_direct_io"
+#define PRM_NAME_PARALLEL_HEAP_SCAN_THREADS "parallel_heap_scan_threads"
+#define PRM_NAME_PARALLEL_HEAP_SCAN_MIN_PAGES "parallel_heap_scan_min_pages"
+#define PRM_NAME_HEAP_RECORD_COMPRESSION "heap_record_compression"
+#define PRM_NAME_HEAP_INSERT_PAGE_AFFINITY "heap_insert_page_affinity"
+#define PRM_NAME_PARALLEL_INDEX_BUILD_THREADS "parallel_index_build_threads"
+#define PRM_NAME_INDEX_SCAN_PREFETCH_MAX_PAGES "index_scan_prefetch_max_pages"
+#define PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN "optimizer_enable_hash_join"
+#define PRM_NAME_PARALLEL_QUERY_DEGREE "parallel_query_degree"
+#define PRM_NAME_SORT_PARALLEL_THREADS "sort_parallel_threads"
 
 #define PRM_VALUE_DEFAULT "DEFAULT"
 #define PRM_VALUE_MAX "MAX"
@@ -1869,7 +1889,7 @@ static unsigned int prm_max_recursion_sql_depth_flag = 0;
 UINT64 PRM_MAX_AGG_HASH_SIZE = 2 * 1024 * 1024;	/* 2 MB */
 static UINT64 prm_max_agg_hash_size_default = 2 * 1024 * 1024;	/* 2 MB */
 static UINT64 prm_max_agg_hash_size_lower = 32 * 1024;	/* 32 KB */
-static UINT64 prm_max_agg_hash_size_upper = 128 * 1024 * 1024;	/* 128 MB */
+static UINT64 prm_max_agg_hash_size_upper = 1024 * 1024 * 1024;	/* 1 GB */
 static unsigned int prm_max_agg_hash_size_flag = 0;
 
 bool PRM_AGG_HASH_RESPECT_ORDER = true;
@@ -2344,6 +2364,106 @@ static UINT64 prm_ddl_audit_log_size_lower = 10485760ULL;	/* 10M */
 static UINT64 prm_ddl_audit_log_size_upper = 2147483648ULL;	/* 2G */
 static unsigned int prm_ddl_audit_log_size_flag = 0;
 
+int PRM_PB_READ_AHEAD_MAX_PAGES = 32;
+static int prm_pb_read_ahead_max_pages_default = 32;
+static int prm_pb_read_ahead_max_pages_lower = 0;
+static int prm_pb_read_ahead_max_pages_upper = DISK_SECTOR_NPAGES;
+static unsigned int prm_pb_read_ahead_max_pages_flag = 0;
+
+bool PRM_IO_ASYNC_ENABLE = false;
+static bool prm_io_async_enable_default = false;
+static unsigned int prm_io_async_enable_flag = 0;
+
+int PRM_PB_WARMUP_PAGES = 0;
+static int prm_pb_warmup_pages_default = 0;
+static int prm_pb_warmup_pages_lower = 0;
+static int prm_pb_warmup_pages_upper = INT_MAX;
+static unsigned int prm_pb_warmup_pages_flag = 0;
+
+int PRM_PB_WARMUP_DUMP_INTERVAL = 0;
+static int prm_pb_warmup_dump_interval_default = 0;
+static int prm_pb_warmup_dump_interval_lower = 0;
+static int prm_pb_warmup_dump_interval_upper = 86400;
+static unsigned int prm_pb_warmup_dump_interval_flag = 0;
+
+int PRM_PB_HUGE_PAGES = PGBUF_HUGE_PAGES_NONE;
+static int prm_pb_huge_pages_default = PGBUF_HUGE_PAGES_NONE;
+static unsigned int prm_pb_huge_pages_flag = 0;
+
+int PRM_PB_NUMA_POLICY = PGBUF_NUMA_NONE;
+static int prm_pb_numa_policy_default = PGBUF_NUMA_NONE;
+static unsigned int prm_pb_numa_policy_flag = 0;
+
+bool PRM_BT_OPTIMISTIC_TRAVERSAL = false;
+static bool prm_bt_optimistic_traversal_default = false;
+static unsigned int prm_bt_optimistic_traversal_flag = 0;
+
+bool PRM_PB_PAGE_CHECKSUM = true;
+static bool prm_pb_page_checksum_default = true;
+static unsigned int prm_pb_page_checksum_flag = 0;
+
+bool PRM_IO_BACKUP_CHANGED_PAGE_TRACKING = true;
+static bool prm_io_backup_changed_page_tracking_default = true;
+static unsigned int prm_io_backup_changed_page_tracking_flag = 0;
+
+int PRM_DWB_ATOMIC_WRITE = 0;
+static int prm_dwb_atomic_write_default = 0;
+static int prm_dwb_atomic_write_lower = 0;
+static int prm_dwb_atomic_write_upper = 2;
+static unsigned int prm_dwb_atomic_write_flag = 0;
+
+bool PRM_DATA_VOLUME_DIRECT_IO = false;
+static bool prm_data_volume_direct_io_default = false;
+static unsigned int prm_data_volume_direct_io_flag = 0;
+
+int PRM_PARALLEL_HEAP_SCAN_THREADS = 0;
+static int prm_parallel_heap_scan_threads_default = 0;
+static int prm_parallel_heap_scan_threads_lower = 0;
+static int prm_parallel_heap_scan_threads_upper = 32;
+static unsigned int prm_parallel_heap_scan_threads_flag = 0;
+
+int PRM_PARALLEL_HEAP_SCAN_MIN_PAGES = 1024;
+static int prm_parallel_heap_scan_min_pages_default = 1024;
+static int prm_parallel_heap_scan_min_pages_lower = 1;
+static int prm_parallel_heap_scan_min_pages_upper = INT_MAX;
+static unsigned int prm_parallel_heap_scan_min_pages_flag = 0;
+
+bool PRM_HEAP_RECORD_COMPRESSION = false;
+static bool prm_heap_record_compression_default = false;
+static unsigned int prm_heap_record_compression_flag = 0;
+
+bool PRM_HEAP_INSERT_PAGE_AFFINITY = false;
+static bool prm_heap_insert_page_affinity_default = false;
+static unsigned int prm_heap_insert_page_affinity_flag = 0;
+
+int PRM_PARALLEL_INDEX_BUILD_THREADS = 0;
+static int prm_parallel_index_build_threads_default = 0;
+static int prm_parallel_index_build_threads_lower = 0;
+static int prm_parallel_index_build_threads_upper = 32;
+static unsigned int prm_parallel_index_build_threads_flag = 0;
+
+int PRM_INDEX_SCAN_PREFETCH_MAX_PAGES = 16;
+static int prm_index_scan_prefetch_max_pages_default = 16;
+static int prm_index_scan_prefetch_max_pages_lower = 0;
+static int prm_index_scan_prefetch_max_pages_upper = 256;
+static unsigned int prm_index_scan_prefetch_max_pages_flag = 0;
+
+bool PRM_OPTIMIZER_ENABLE_HASH_JOIN = true;
+static bool prm_optimizer_enable_hash_join_default = true;
+static unsigned int prm_optimizer_enable_hash_join_flag = 0;
+
+int PRM_PARALLEL_QUERY_DEGREE = 0;
+static int prm_parallel_query_degree_default = 0;
+static int prm_parallel_query_degree_lower = 0;
+static int prm_parallel_query_degree_upper = 32;
+static unsigned int prm_parallel_query_degree_flag = 0;
+
+int PRM_SORT_PARALLEL_THREADS = 0;
+static int prm_sort_parallel_threads_default = 0;
+static int prm_sort_parallel_threads_lower = 0;
+static int prm_sort_parallel_threads_upper = 31;
+static unsigned int prm_sort_parallel_threads_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -6036,6 +6156,226 @@ static SYSPRM_PARAM prm_Def[] = {
    (void *) &prm_ddl_audit_log_size_lower,
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_READ_AHEAD_MAX_PAGES,
+   PRM_NAME_PB_READ_AHEAD_MAX_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_pb_read_ahead_max_pages_flag,
+   (void *) &prm_pb_read_ahead_max_pages_default,
+   (void *) &PRM_PB_READ_AHEAD_MAX_PAGES,
+   (void *) &prm_pb_read_ahead_max_pages_upper, (void *) &prm_pb_read_ahead_max_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_IO_ASYNC_ENABLE,
+   PRM_NAME_IO_ASYNC_ENABLE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_io_async_enable_flag,
+   (void *) &prm_io_async_enable_default,
+   (void *) &PRM_IO_ASYNC_ENABLE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_WARMUP_PAGES,
+   PRM_NAME_PB_WARMUP_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_warmup_pages_flag,
+   (void *) &prm_pb_warmup_pages_default,
+   (void *) &PRM_PB_WARMUP_PAGES,
+   (void *) &prm_pb_warmup_pages_upper, (void *) &prm_pb_warmup_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_WARMUP_DUMP_INTERVAL,
+   PRM_NAME_PB_WARMUP_DUMP_INTERVAL,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_pb_warmup_dump_interval_flag,
+   (void *) &prm_pb_warmup_dump_interval_default,
+   (void *) &PRM_PB_WARMUP_DUMP_INTERVAL,
+   (void *) &prm_pb_warmup_dump_interval_upper, (void *) &prm_pb_warmup_dump_interval_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_HUGE_PAGES,
+   PRM_NAME_PB_HUGE_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_KEYWORD,
+   &prm_pb_huge_pages_flag,
+   (void *) &prm_pb_huge_pages_default,
+   (void *) &PRM_PB_HUGE_PAGES,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_NUMA_POLICY,
+   PRM_NAME_PB_NUMA_POLICY,
+   (PRM_FOR_SERVER),
+   PRM_KEYWORD,
+   &prm_pb_numa_policy_flag,
+   (void *) &prm_pb_numa_policy_default,
+   (void *) &PRM_PB_NUMA_POLICY,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BT_OPTIMISTIC_TRAVERSAL,
+   PRM_NAME_BT_OPTIMISTIC_TRAVERSAL,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_bt_optimistic_traversal_flag,
+   (void *) &prm_bt_optimistic_traversal_default,
+   (void *) &PRM_BT_OPTIMISTIC_TRAVERSAL,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_PAGE_CHECKSUM,
+   PRM_NAME_PB_PAGE_CHECKSUM,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_pb_page_checksum_flag,
+   (void *) &prm_pb_page_checksum_default,
+   (void *) &PRM_PB_PAGE_CHECKSUM,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_IO_BACKUP_CHANGED_PAGE_TRACKING,
+   PRM_NAME_IO_BACKUP_CHANGED_PAGE_TRACKING,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_io_backup_changed_page_tracking_flag,
+   (void *) &prm_io_backup_changed_page_tracking_default,
+   (void *) &PRM_IO_BACKUP_CHANGED_PAGE_TRACKING,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DWB_ATOMIC_WRITE,
+   PRM_NAME_DWB_ATOMIC_WRITE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_dwb_atomic_write_flag,
+   (void *) &prm_dwb_atomic_write_default,
+   (void *) &PRM_DWB_ATOMIC_WRITE,
+   (void *) &prm_dwb_atomic_write_upper, (void *) &prm_dwb_atomic_write_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DATA_VOLUME_DIRECT_IO,
+   PRM_NAME_DATA_VOLUME_DIRECT_IO,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_data_volume_direct_io_flag,
+   (void *) &prm_data_volume_direct_io_default,
+   (void *) &PRM_DATA_VOLUME_DIRECT_IO,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARALLEL_HEAP_SCAN_THREADS,
+   PRM_NAME_PARALLEL_HEAP_SCAN_THREADS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_parallel_heap_scan_threads_flag,
+   (void *) &prm_parallel_heap_scan_threads_default,
+   (void *) &PRM_PARALLEL_HEAP_SCAN_THREADS,
+   (void *) &prm_parallel_heap_scan_threads_upper, (void *) &prm_parallel_heap_scan_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARALLEL_HEAP_SCAN_MIN_PAGES,
+   PRM_NAME_PARALLEL_HEAP_SCAN_MIN_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_parallel_heap_scan_min_pages_flag,
+   (void *) &prm_parallel_heap_scan_min_pages_default,
+   (void *) &PRM_PARALLEL_HEAP_SCAN_MIN_PAGES,
+   (void *) &prm_parallel_heap_scan_min_pages_upper, (void *) &prm_parallel_heap_scan_min_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAP_RECORD_COMPRESSION,
+   PRM_NAME_HEAP_RECORD_COMPRESSION,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_FOR_SESSION | PRM_FOR_HA_CONTEXT),
+   PRM_BOOLEAN,
+   &prm_heap_record_compression_flag,
+   (void *) &prm_heap_record_compression_default,
+   (void *) &PRM_HEAP_RECORD_COMPRESSION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAP_INSERT_PAGE_AFFINITY,
+   PRM_NAME_HEAP_INSERT_PAGE_AFFINITY,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_heap_insert_page_affinity_flag,
+   (void *) &prm_heap_insert_page_affinity_default,
+   (void *) &PRM_HEAP_INSERT_PAGE_AFFINITY,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARALLEL_INDEX_BUILD_THREADS,
+   PRM_NAME_PARALLEL_INDEX_BUILD_THREADS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_parallel_index_build_threads_flag,
+   (void *) &prm_parallel_index_build_threads_default,
+   (void *) &PRM_PARALLEL_INDEX_BUILD_THREADS,
+   (void *) &prm_parallel_index_build_threads_upper, (void *) &prm_parallel_index_build_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_INDEX_SCAN_PREFETCH_MAX_PAGES,
+   PRM_NAME_INDEX_SCAN_PREFETCH_MAX_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_index_scan_prefetch_max_pages_flag,
+   (void *) &prm_index_scan_prefetch_max_pages_default,
+   (void *) &PRM_INDEX_SCAN_PREFETCH_MAX_PAGES,
+   (void *) &prm_index_scan_prefetch_max_pages_upper, (void *) &prm_index_scan_prefetch_max_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN,
+   PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_optimizer_enable_hash_join_flag,
+   (void *) &prm_optimizer_enable_hash_join_default,
+   (void *) &PRM_OPTIMIZER_ENABLE_HASH_JOIN,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARALLEL_QUERY_DEGREE,
+   PRM_NAME_PARALLEL_QUERY_DEGREE,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_parallel_query_degree_flag,
+   (void *) &prm_parallel_query_degree_default,
+   (void *) &PRM_PARALLEL_QUERY_DEGREE,
+   (void *) &prm_parallel_query_degree_upper, (void *) &prm_parallel_query_degree_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SORT_PARALLEL_THREADS,
+   PRM_NAME_SORT_PARALLEL_THREADS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_sort_parallel_threads_flag,
+   (void *) &prm_sort_parallel_threads_default,
+   (void *) &PRM_SORT_PARALLEL_THREADS,
+   (void *) &prm_sort_parallel_threads_upper, (void *) &prm_sort_parallel_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL}
 };
 
@@ -6210,6 +6550,19 @@ static KEYVAL tde_algorithm_words[] = {
   {"aria", TDE_ALGORITHM_ARIA}
 };
 
+static KEYVAL pb_huge_pages_words[] = {
+  {"none", PGBUF_HUGE_PAGES_NONE},
+  {"transparent", PGBUF_HUGE_PAGES_TRANSPARENT},
+  {"2m", PGBUF_HUGE_PAGES_2M},
+  {"1g", PGBUF_HUGE_PAGES_1G}
+};
+
+static KEYVAL pb_numa_policy_words[] = {
+  {"none", PGBUF_NUMA_NONE},
+  {"interleave", PGBUF_NUMA_INTERLEAVE},
+  {"partition", PGBUF_NUMA_PARTITION}
+};
+
 static const char *compat_mode_values_PRM_ANSI_QUOTES[COMPAT_ORACLE + 2] = {
   NULL,				/* COMPAT_CUBRID */
   "no",				/* COMPAT_MYSQL */
@@ -8156,6 +8509,14 @@ prm_print (const SYSPRM_PARAM * prm, char *buf, size_t len, PRM_PRINT_MODE print
 	{
 	  keyvalp = prm_keyword (PRM_GET_INT (prm->value), NULL, tde_algorithm_words, DIM (tde_algorithm_words));
 	}
+      else if (intl_mbs_casecmp (prm->name, PRM_NAME_PB_HUGE_PAGES) == 0)
+	{
+	  keyvalp = prm_keyword (PRM_GET_INT (prm->value), NULL, pb_huge_pages_words, DIM (pb_huge_pages_words));
+	}
+      else if (intl_mbs_casecmp (prm->name, PRM_NAME_PB_NUMA_POLICY) == 0)
+	{
+	  keyvalp = prm_keyword (PRM_GET_INT (prm->value), NULL, pb_numa_policy_words, DIM (pb_numa_policy_words));
+	}
       else
 	{
 	  assert (false);
@@ -8456,6 +8817,14 @@ sysprm_print_sysprm_value (PARAM_ID prm_id, SYSPRM_VALUE value, char *buf, size_
 	{
 	  keyvalp = prm_keyword (value.i, NULL, tde_algorithm_words, DIM (tde_algorithm_words));
 	}
+      else if (intl_mbs_casecmp (prm->name, PRM_NAME_PB_HUGE_PAGES) == 0)
+	{
+	  keyvalp = prm_keyword (value.i, NULL, pb_huge_pages_words, DIM (pb_huge_pages_words));
+	}
+      else if (intl_mbs_casecmp (prm->name, PRM_NAME_PB_NUMA_POLICY) == 0)
+	{
+	  keyvalp = prm_keyword (value.i, NULL, pb_numa_policy_words, DIM (pb_numa_policy_words));
+	}
       else
 	{
 	  assert (false);
@@ -9668,6 +10037,14 @@ sysprm_generate_new_value (SYSPRM_PARAM * prm, const char *value, bool check, SY
 	  {
 	    keyvalp = prm_keyword (-1, value, tde_algorithm_words, DIM (tde_algorithm_words));
 	  }
+	else if (intl_mbs_casecmp (prm->name, PRM_NAME_PB_HUGE_PAGES) == 0)
+	  {
+	    keyvalp = prm_keyword (-1, value, pb_huge_pages_words, DIM (pb_huge_pages_words));
+	  }
+	else if (intl_mbs_casecmp (prm->name, PRM_NAME_PB_NUMA_POLICY) == 0)
+	  {
+	    keyvalp = prm_keyword (-1, value, pb_numa_policy_words, DIM (pb_numa_policy_words));
+	  }
 	else
 	  {
 	    assert (false);
@@ -452,8 +452,28 @@ enum param_id
   PRM_ID_IGNORE_TRAILING_SPACE,
   PRM_ID_DDL_AUDIT_LOG,
   PRM_ID_DDL_AUDIT_LOG_SIZE,
+  PRM_ID_PB_READ_AHEAD_MAX_PAGES,
+  PRM_ID_IO_ASYNC_ENABLE,
+  PRM_ID_PB_WARMUP_PAGES,
+  PRM_ID_PB_WARMUP_DUMP_INTERVAL,
+  PRM_ID_PB_HUGE_PAGES,
+  PRM_ID_PB_NUMA_POLICY,
+  PRM_ID_BT_OPTIMISTIC_TRAVERSAL,
+  PRM_ID_PB_PAGE_CHECKSUM,
+  PRM_ID_IO_BACKUP_CHANGED_PAGE_TRACKING,
+  PRM_ID_DWB_ATOMIC_WRITE,
+  PRM_ID_DATA_VOLUME_DIRECT_IO,
+  PRM_ID_PARALLEL_HEAP_SCAN_THREADS,
+  PRM_ID_PARALLEL_HEAP_SCAN_MIN_PAGES,
+  PRM_ID_HEAP_RECORD_COMPRESSION,
+  PRM_ID_HEAP_INSERT_PAGE_AFFINITY,
+  PRM_ID_PARALLEL_INDEX_BUILD_THREADS,
+  PRM_ID_INDEX_SCAN_PREFETCH_MAX_PAGES,
+  PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN,
+  PRM_ID_PARALLEL_QUERY_DEGREE,
+  PRM_ID_SORT_PARALLEL_THREADS,
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_DDL_AUDIT_LOG_SIZE
+  PRM_LAST_ID = PRM_ID_SORT_PARALLEL_THREADS
 };
 typedef enum param_id PARAM_ID;
 
@@ -59,6 +59,7 @@ static XASL_NODE *add_subqueries (QO_ENV * env, XASL_NODE * xasl, BITSET *);
 static XASL_NODE *add_sort_spec (QO_ENV *, XASL_NODE *, QO_PLAN *, DB_VALUE *, bool);
 static XASL_NODE *add_if_predicate (QO_ENV *, XASL_NODE *, PT_NODE *);
 static XASL_NODE *add_after_join_predicate (QO_ENV *, XASL_NODE *, PT_NODE *);
+static XASL_NODE *add_hash_join_keys (QO_ENV * env, XASL_NODE * xasl, QO_PLAN * plan);
 
 static PT_NODE *make_pred_from_bitset (QO_ENV * env, BITSET * predset, ELIGIBILITY_FN safe);
 static void make_pred_from_plan (QO_ENV * env, QO_PLAN * plan, PT_NODE ** key_access_pred, PT_NODE ** access_pred,
@@ -1024,6 +1025,88 @@ add_after_join_predicate (QO_ENV * env, XASL_NODE * xasl, PT_NODE * pred)
   return xasl;
 }
 
+/*
+ * add_hash_join_keys () - split the hash terms of a hash join into the keys
+ *			   of the inner list file and the keys of the outer
+ *   return: XASL_NODE *
+ *   env(in): The optimizer environment
+ *   xasl(in): The list scan proc of the inner
+ *   plan(in): The hash join plan
+ */
+static XASL_NODE *
+add_hash_join_keys (QO_ENV * env, XASL_NODE * xasl, QO_PLAN * plan)
+{
+  PARSER_CONTEXT *parser;
+  QO_PLAN *inner;
+  QO_TERM *term;
+  PT_NODE *pt_expr, *build, *probe, *tmp;
+  PT_NODE *build_list = NULL, *probe_list = NULL;
+  BITSET build_segs, probe_segs;
+  BITSET_ITERATOR bi;
+  int i;
+
+  parser = QO_ENV_PARSER (env);
+  inner = plan->plan_un.join.inner;
+
+  bitset_init (&build_segs, env);
+  bitset_init (&probe_segs, env);
+
+  for (i = bitset_iterate (&(plan->plan_un.join.hash_terms), &bi); i != -1; i = bitset_next_member (&bi))
+    {
+      term = QO_ENV_TERM (env, i);
+      pt_expr = QO_TERM_PT_EXPR (term);
+      if (pt_expr == NULL || pt_expr->node_type != PT_EXPR)
+	{
+	  continue;
+	}
+
+      build = pt_left_part (pt_expr);
+      probe = pt_right_part (pt_expr);
+      if (pt_expr->info.expr.op == PT_RANGE && probe != NULL)
+	{
+	  probe = probe->info.expr.arg1;
+	}
+      if (build == NULL || probe == NULL)
+	{
+	  continue;
+	}
+
+      BITSET_CLEAR (build_segs);
+      BITSET_CLEAR (probe_segs);
+      qo_expr_segs (env, build, &build_segs);
+      qo_expr_segs (env, probe, &probe_segs);
+
+      if (!bitset_intersects (&build_segs, &((inner->info)->projected_segs)))
+	{
+	  tmp = build;
+	  build = probe;
+	  probe = tmp;
+	  bitset_assign (&build_segs, &probe_segs);
+	  BITSET_CLEAR (probe_segs);
+	  qo_expr_segs (env, probe, &probe_segs);
+	}
+
+      /* the build key must be computed from the list file alone, the probe key from the outer alone */
+      if (bitset_is_empty (&build_segs) || !bitset_subset (&((inner->info)->projected_segs), &build_segs)
+	  || bitset_intersects (&probe_segs, &((inner->info)->projected_segs)))
+	{
+	  continue;
+	}
+
+      build_list = parser_append_node (parser_copy_tree (parser, build), build_list);
+      probe_list = parser_append_node (parser_copy_tree (parser, probe), probe_list);
+    }
+
+  xasl = ptqo_add_list_scan_hash_keys (parser, xasl, build_list, probe_list);
+
+  parser_free_tree (parser, build_list);
+  parser_free_tree (parser, probe_list);
+  bitset_delset (&build_segs);
+  bitset_delset (&probe_segs);
+
+  return xasl;
+}
+
 /*
  * path_access_term () -
  *   return:
@@ -1731,6 +1814,7 @@ gen_outer (QO_ENV * env, QO_PLAN * plan, BITSET * subqueries, XASL_NODE * inner_
 	    }
 	  /* FALLTHRU */
 	case QO_JOINMETHOD_IDX_JOIN:
+	case QO_JOINMETHOD_HASH_JOIN:
 	  for (i = bitset_iterate (&(plan->plan_un.join.join_terms), &bi); i != -1; i = bitset_next_member (&bi))
 	    {
 	      term = QO_ENV_TERM (env, i);
@@ -1808,6 +1892,11 @@ gen_outer (QO_ENV * env, QO_PLAN * plan, BITSET * subqueries, XASL_NODE * inner_
 	   * by scan_handle_single_scan. It might lead to making a wrong result.
 	   */
 	  scan = gen_inner (env, inner, &predset, &new_subqueries, inner_scans, fetches);
+	  if (scan && plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN)
+	    {
+	      /* the list scan of the temp inner builds its hash table once and probes it for each outer row */
+	      scan = add_hash_join_keys (env, scan, plan);
+	    }
 	  if (scan)
 	    {
 	      if (IS_OUTER_JOIN_TYPE (join_type))
@@ -2463,6 +2552,76 @@ qo_plan_skip_groupby (QO_PLAN * plan)
 	  && plan->plan_un.scan.index->head->groupby_skip) ? true : false;
 }
 
+/*
+ * qo_plan_iscan_oid_order () - check if the outermost scan of the plan fetches objects in oid order
+ *   return: true/false
+ *   plan(in): QO_PLAN
+ */
+bool
+qo_plan_iscan_oid_order (QO_PLAN * plan)
+{
+  while (plan != NULL)
+    {
+      switch (plan->plan_type)
+	{
+	case QO_PLANTYPE_SCAN:
+	  return (qo_is_iscan (plan) && plan->plan_un.scan.index_oid_order) ? true : false;
+
+	case QO_PLANTYPE_SORT:
+	  plan = plan->plan_un.sort.subplan;
+	  break;
+
+	case QO_PLANTYPE_JOIN:
+	  plan = plan->plan_un.join.outer;
+	  break;
+
+	case QO_PLANTYPE_FOLLOW:
+	  plan = plan->plan_un.follow.head;
+	  break;
+
+	default:
+	  return false;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * qo_plan_parallel_degree () - get the degree of parallelism of the outermost scan of the plan
+ *   return: degree of parallelism, 0 if the server decides
+ *   plan(in): QO_PLAN
+ */
+int
+qo_plan_parallel_degree (QO_PLAN * plan)
+{
+  while (plan != NULL)
+    {
+      switch (plan->plan_type)
+	{
+	case QO_PLANTYPE_SCAN:
+	  return plan->plan_un.scan.parallel_degree;
+
+	case QO_PLANTYPE_SORT:
+	  plan = plan->plan_un.sort.subplan;
+	  break;
+
+	case QO_PLANTYPE_JOIN:
+	  plan = plan->plan_un.join.outer;
+	  break;
+
+	case QO_PLANTYPE_FOLLOW:
+	  plan = plan->plan_un.follow.head;
+	  break;
+
+	default:
+	  return 0;
+	}
+    }
+
+  return 0;
+}
+
 /*
  * qo_is_index_covering_scan () - check the plan info for covering index scan
  *   return: true/false
@@ -4220,7 +4379,8 @@ qo_check_join_for_multi_range_opt (QO_PLAN * plan)
 
   /* verify that this is a valid join for multi range optimization */
   if (plan == NULL || plan->plan_type != QO_PLANTYPE_JOIN || plan->plan_un.join.join_type != JOIN_INNER
-      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN)
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN)
     {
       return false;
     }
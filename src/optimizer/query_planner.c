@@ -72,6 +72,12 @@
 #define TEMP_SETUP_COST 5.0
 #define NONGROUPED_SCAN_COST 0.1
 
+/* bytes of one hash list scan entry kept in memory for a tuple of the list file (HENTRY_HLS + QFILE_TUPLE_SIMPLE_POS) */
+#define QO_HASH_JOIN_ENTRY_SIZE 36
+
+/* highest degree of parallelism of a scan, the query thread included; see parallel_query_degree */
+#define QO_MAX_PARALLEL_DEGREE 32
+
 #define	qo_scan_walk	qo_generic_walk
 #define	qo_worst_walk	qo_generic_walk
 
@@ -141,6 +147,7 @@ static void qo_sscan_cost (QO_PLAN *);
 static void qo_iscan_cost (QO_PLAN *);
 static void qo_sort_cost (QO_PLAN *);
 static void qo_mjoin_cost (QO_PLAN *);
+static void qo_hjoin_cost (QO_PLAN *);
 static void qo_follow_cost (QO_PLAN *);
 static void qo_worst_cost (QO_PLAN *);
 static void qo_zero_cost (QO_PLAN *);
@@ -178,6 +185,8 @@ static int qo_examine_nl_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSE
 			       BITSET *, int, BITSET *);
 static int qo_examine_merge_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *, BITSET *,
 				  BITSET *);
+static int qo_examine_hash_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *, BITSET *,
+				 BITSET *, BITSET *);
 static int qo_examine_correlated_index (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *);
 static int qo_examine_follow (QO_INFO *, QO_TERM *, QO_INFO *, BITSET *, BITSET *);
 static void qo_compute_projected_segs (QO_PLANNER *, BITSET *, BITSET *, BITSET *);
@@ -189,6 +198,7 @@ static void qo_clean_planner (QO_PLANNER *);
 static QO_INFO *qo_search_partition_join (QO_PLANNER *, QO_PARTITION *, BITSET *);
 static QO_PLAN *qo_search_partition (QO_PLANNER *, QO_PARTITION *, QO_EQCLASS *, BITSET *);
 static QO_PLAN *qo_search_planner (QO_PLANNER *);
+static void qo_set_parallel_degree (QO_ENV *, QO_PLAN *);
 static void sort_partitions (QO_PLANNER *);
 static QO_PLAN *qo_combine_partitions (QO_PLANNER *, BITSET *);
 static int qo_generate_join_index_scan (QO_INFO *, JOIN_TYPE, QO_PLAN *, QO_INFO *, QO_NODE *, QO_NODE_INDEX_ENTRY *,
@@ -322,6 +332,17 @@ static QO_PLAN_VTBL qo_merge_join_plan_vtbl = {
   "Merge join"
 };
 
+static QO_PLAN_VTBL qo_hash_join_plan_vtbl = {
+  "hash-join",
+  qo_join_fprint,
+  qo_join_walk,
+  qo_join_free,
+  qo_hjoin_cost,
+  qo_hjoin_cost,
+  qo_join_info,
+  "Hash join"
+};
+
 static QO_PLAN_VTBL qo_follow_plan_vtbl = {
   "follow",
   qo_follow_fprint,
@@ -362,6 +383,7 @@ QO_PLAN_VTBL *all_vtbls[] = {
   &qo_nl_join_plan_vtbl,
   &qo_idx_join_plan_vtbl,
   &qo_merge_join_plan_vtbl,
+  &qo_hash_join_plan_vtbl,
   &qo_follow_plan_vtbl,
   &qo_set_follow_plan_vtbl,
   &qo_worst_plan_vtbl
@@ -1405,6 +1427,8 @@ qo_scan_new (QO_INFO * info, QO_NODE * node, QO_SCANMETHOD scan_method)
   plan->plan_un.scan.index_cover = false;
   plan->plan_un.scan.index_iss = false;
   plan->plan_un.scan.index_loose = false;
+  plan->plan_un.scan.index_oid_order = false;
+  plan->plan_un.scan.parallel_degree = 0;
   plan->plan_un.scan.index = NULL;
 
   plan->multi_range_opt_use = PLAN_MULTI_RANGE_OPT_NO;
@@ -1827,6 +1851,7 @@ qo_iscan_cost (QO_PLAN * planp)
   double sel, sel_limit, objects, height, leaves, opages;
   bool is_null_sel;
   double object_IO, index_IO;
+  double batch, batch_pages, oid_order_IO, oid_order_cpu, hit_ratio;
   QO_TERM *termp;
   BITSET_ITERATOR iter;
   int i, t, n, pkeys_num;
@@ -2036,8 +2061,25 @@ qo_iscan_cost (QO_PLAN * planp)
     }
   else if ((double) prm_get_integer_value (PRM_ID_PB_NBUFFERS) - index_IO < object_IO)
     {
-      object_IO =
-	objects * (1.0 - (((double) prm_get_integer_value (PRM_ID_PB_NBUFFERS) - index_IO) / (double) opages));
+      hit_ratio = ((double) prm_get_integer_value (PRM_ID_PB_NBUFFERS) - index_IO) / (double) opages;
+      object_IO = objects * (1.0 - hit_ratio);
+
+      /* Objects do not fit the buffer and each one is fetched with a random read. Reading a batch of oids from the
+       * index and fetching them in oid order reads every page of the batch once, at the price of sorting the oids. */
+      planp->plan_un.scan.index_oid_order = false;
+      if (!planp->plan_un.scan.index_cover && planp->multi_range_opt_use != PLAN_MULTI_RANGE_OPT_USE && opages > 1.0)
+	{
+	  batch = MIN (objects, (double) ISCAN_OID_BUFFER_COUNT);
+	  /* expected number of distinct pages of a batch */
+	  batch_pages = opages * (1.0 - pow (1.0 - 1.0 / opages, batch));
+	  oid_order_IO = ceil (objects / batch) * batch_pages * (1.0 - hit_ratio);
+	  oid_order_cpu = objects * log2 (MAX (batch, 2.0)) * (double) QO_CPU_WEIGHT;
+	  if (oid_order_IO + oid_order_cpu < object_IO)
+	    {
+	      planp->plan_un.scan.index_oid_order = true;
+	      object_IO = oid_order_IO;
+	    }
+	}
     }
 
   if (sel < 1.0)
@@ -2051,6 +2093,10 @@ qo_iscan_cost (QO_PLAN * planp)
   planp->fixed_cpu_cost = 0.0;
   planp->fixed_io_cost = index_IO;
   planp->variable_cpu_cost = objects * (double) QO_CPU_WEIGHT *ISCAN_OVERHEAD_FACTOR;
+  if (planp->plan_un.scan.index_oid_order)
+    {
+      planp->variable_cpu_cost += oid_order_cpu;
+    }
   planp->variable_io_cost = object_IO;
 
   /* one page heap file; reconfig iscan cost */
@@ -2088,6 +2134,11 @@ qo_scan_fprint (QO_PLAN * plan, FILE * f, int howfar)
 
   qo_node_fprint (plan->plan_un.scan.node, f);
 
+  if (plan->plan_un.scan.parallel_degree > 1)
+    {
+      fprintf (f, " (parallel %d)", plan->plan_un.scan.parallel_degree);
+    }
+
   if (qo_is_interesting_order_scan (plan))
     {
       fprintf (f, "\n" INDENTED_TITLE_FMT, (int) howfar, ' ', "index: ");
@@ -2143,6 +2194,11 @@ qo_scan_fprint (QO_PLAN * plan, FILE * f, int howfar)
 	  fprintf (f, " (multi_range_opt)");
 	}
 
+      if (plan->plan_un.scan.index_oid_order)
+	{
+	  fprintf (f, " (oid order)");
+	}
+
       if (plan->plan_un.scan.index && plan->plan_un.scan.index->head->use_descending)
 	{
 	  fprintf (f, " (desc_index)");
@@ -2267,6 +2323,11 @@ qo_scan_info (QO_PLAN * plan, FILE * f, int howfar)
 	  fprintf (f, " (multi_range_opt)");
 	}
 
+      if (plan->plan_un.scan.index_oid_order)
+	{
+	  fprintf (f, " (oid order)");
+	}
+
       if (plan->plan_un.scan.index && plan->plan_un.scan.index->head->use_descending)
 	{
 	  fprintf (f, " (desc_index)");
@@ -2279,6 +2340,11 @@ qo_scan_info (QO_PLAN * plan, FILE * f, int howfar)
 	}
     }
 
+  if (plan->plan_un.scan.parallel_degree > 1)
+    {
+      fprintf (f, " (parallel %d)", plan->plan_un.scan.parallel_degree);
+    }
+
   fprintf (f, ")");
 }
 
@@ -2713,6 +2779,20 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
 	}
 
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+
+      plan->vtbl = &qo_hash_join_plan_vtbl;
+      plan->order = QO_UNORDERED;
+
+      /* The hash table is built by the list scan of the inner, so the inner is always materialized into a list file.
+       */
+      if (inner->plan_type != QO_PLANTYPE_SORT)
+	{
+	  inner = qo_sort_new (inner, QO_UNORDERED, SORT_TEMP);
+	}
+
+      break;
     }
 
   assert (inner != NULL && outer != NULL);
@@ -3211,6 +3291,70 @@ qo_mjoin_cost (QO_PLAN * planp)
   planp->variable_io_cost = outer->variable_io_cost + inner->variable_io_cost;
 }
 
+/*
+ * qo_hjoin_cost () -
+ *   return:
+ *   planp(in):
+ */
+static void
+qo_hjoin_cost (QO_PLAN * planp)
+{
+  QO_PLAN *inner, *outer;
+  double outer_cardinality, result_cardinality, pages;
+
+  inner = planp->plan_un.join.inner;
+
+  /* for worst cost */
+  if (inner->fixed_cpu_cost == QO_INFINITY || inner->fixed_io_cost == QO_INFINITY
+      || inner->variable_cpu_cost == QO_INFINITY || inner->variable_io_cost == QO_INFINITY)
+    {
+      qo_worst_cost (planp);
+      return;
+    }
+
+  outer = planp->plan_un.join.outer;
+
+  /* for worst cost */
+  if (outer->fixed_cpu_cost == QO_INFINITY || outer->fixed_io_cost == QO_INFINITY
+      || outer->variable_cpu_cost == QO_INFINITY || outer->variable_io_cost == QO_INFINITY)
+    {
+      qo_worst_cost (planp);
+      return;
+    }
+
+  if (outer->plan_type == QO_PLANTYPE_SORT && outer->plan_un.sort.sort_type == SORT_LIMIT)
+    {
+      /* cardinality of a SORT_LIMIT plan is given by the value of the query limit */
+      outer_cardinality = (double) db_get_bigint (&QO_ENV_LIMIT_VALUE (outer->info->env));
+    }
+  else
+    {
+      outer_cardinality = (outer->info)->cardinality;
+    }
+  result_cardinality = (planp->info)->cardinality;
+
+  /* The inner is materialized into a list file and hashed once, before the first outer row is probed. Reading the
+   * list file to build the hash table is the only pass over the inner, so it is a fixed cost of the join.
+   */
+  planp->fixed_cpu_cost = outer->fixed_cpu_cost + inner->fixed_cpu_cost + inner->variable_cpu_cost;
+  planp->fixed_io_cost = outer->fixed_io_cost + inner->fixed_io_cost + inner->variable_io_cost;
+
+  /* each outer row probes the hash table once, and each candidate found there is checked against the join terms */
+  planp->variable_cpu_cost = outer->variable_cpu_cost;
+  planp->variable_cpu_cost += MAX (1.0, outer_cardinality) * (double) QO_CPU_WEIGHT;
+  planp->variable_cpu_cost += result_cardinality * (double) QO_CPU_WEIGHT;
+  planp->variable_io_cost = outer->variable_io_cost;
+
+  /* If the list file does not fit in memory, the hash table keeps only tuple positions and the matched tuples are
+   * read back from the list file. Buffering limits this to the number of pages of the list file.
+   */
+  pages = ((inner->info)->cardinality * (inner->info)->projected_size) / IO_PAGESIZE;
+  if (pages * IO_PAGESIZE > (double) prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE))
+    {
+      planp->variable_io_cost += MIN (result_cardinality, pages);
+    }
+}
+
 /*
  * qo_follow_new () -
  *   return:
@@ -5954,6 +6098,141 @@ exit:
   return n;
 }
 
+/*
+ * qo_examine_hash_join () -
+ *   return:
+ *   info(in):
+ *   join_type(in):
+ *   outer(in):
+ *   inner(in):
+ *   nl_join_terms(in):
+ *   duj_terms(in):
+ *   afj_terms(in):
+ *   sarged_terms(in):
+ *   pinned_subqueries(in):
+ *   sm_join_terms(in): equi-join terms usable as hash keys
+ */
+static int
+qo_examine_hash_join (QO_INFO * info, JOIN_TYPE join_type, QO_INFO * outer, QO_INFO * inner, BITSET * nl_join_terms,
+		      BITSET * duj_terms, BITSET * afj_terms, BITSET * sarged_terms, BITSET * pinned_subqueries,
+		      BITSET * sm_join_terms)
+{
+  int n = 0;
+  QO_PLAN *outer_plan, *inner_plan;
+  QO_NODE *inner_node;
+  PT_NODE *spec;
+  int t;
+  BITSET_ITERATOR iter;
+  QO_TERM *term;
+  BITSET hash_terms;
+  double build_size;
+
+  bitset_init (&hash_terms, info->env);
+
+  /* the fake terms need nested loops to be evaluated at the right time */
+  if (bitset_intersects (sarged_terms, &(info->env->fake_terms)))
+    {
+      goto exit;
+    }
+
+  /* The inner is the build side; a right outer join would have to return the unmatched build rows. Those joins are
+   * examined with the converse join order instead.
+   */
+  if (join_type != JOIN_INNER && join_type != JOIN_LEFT)
+    {
+      goto exit;
+    }
+
+  if (!prm_get_bool_value (PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN))
+    {
+      /* optimizer prm: keep out hash-join; */
+      goto exit;
+    }
+
+  if (PT_IS_SELECT (info->env->pt_tree) && (info->env->pt_tree->info.query.q.select.hint & PT_HINT_NO_HASH_LIST_SCAN))
+    {
+      /* the hash table is built by the hash list scan */
+      goto exit;
+    }
+
+  /* At here, inner is single class spec */
+  inner_node = QO_ENV_NODE (inner->env, bitset_first_member (&(inner->nodes)));
+
+  if (QO_NODE_HINT (inner_node) & (PT_HINT_USE_NL | PT_HINT_USE_IDX | PT_HINT_USE_MERGE))
+    {
+      /* join hint: force nl-join, idx-join, m-join; */
+      goto exit;
+    }
+
+  /* the inner is materialized only once, so it must not depend on the outer */
+  if (!bitset_is_empty (&(QO_NODE_DEP_SET (inner_node))))
+    {
+      goto exit;
+    }
+
+  spec = QO_NODE_ENTITY_SPEC (inner_node);
+  if (spec && spec->info.spec.flat_entity_list == NULL && spec->info.spec.derived_table_type == PT_IS_CSELECT)
+    {
+      goto exit;
+    }
+
+  for (t = bitset_iterate (nl_join_terms, &iter); t != -1; t = bitset_next_member (&iter))
+    {
+      term = QO_ENV_TERM (info->env, t);
+      if (QO_TERM_CLASS (term) == QO_TC_DEP_LINK || QO_TERM_CLASS (term) == QO_TC_DEP_JOIN)
+	{
+	  goto exit;
+	}
+    }
+
+  /* path terms are evaluated by object fetches, not by comparing values */
+  for (t = bitset_iterate (sm_join_terms, &iter); t != -1; t = bitset_next_member (&iter))
+    {
+      term = QO_ENV_TERM (info->env, t);
+      if (QO_TERM_CLASS (term) == QO_TC_JOIN)
+	{
+	  bitset_add (&hash_terms, t);
+	}
+    }
+
+  if (bitset_is_empty (&hash_terms))
+    {
+      goto exit;
+    }
+
+  /* If the hash table of the inner does not fit in max_hash_list_scan_size, the list scan falls back to scanning the
+   * whole list file for every outer row, which is what a nl-join with a temp inner already costs.
+   */
+  build_size = (inner->cardinality) * (double) QO_HASH_JOIN_ENTRY_SIZE;
+  if (build_size > (double) prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE))
+    {
+      goto exit;
+    }
+
+  outer_plan = qo_find_best_plan_on_info (outer, QO_UNORDERED, 1.0);
+  if (outer_plan == NULL)
+    {
+      goto exit;
+    }
+
+  inner_plan = qo_find_best_plan_on_info (inner, QO_UNORDERED, 1.0);
+  if (inner_plan == NULL)
+    {
+      goto exit;
+    }
+
+  n =
+    qo_check_plan_on_info (info,
+			   qo_join_new (info, join_type, QO_JOINMETHOD_HASH_JOIN, outer_plan, inner_plan, nl_join_terms,
+					duj_terms, afj_terms, sarged_terms, pinned_subqueries, &hash_terms));
+
+exit:
+
+  bitset_delset (&hash_terms);
+
+  return n;
+}
+
 /*
  * qo_examine_correlated_index () -
  *   return: int
@@ -7080,6 +7359,14 @@ planner_visit_node (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
 				     &sarged_terms, &pinned_subqueries);
 	  }
 #endif /* MERGE_JOINS */
+
+	/* STEP 5-5: examine hash-join */
+	if (!bitset_is_empty (&sm_join_terms))
+	  {
+	    kept +=
+	      qo_examine_hash_join (new_info, join_type, head_info, tail_info, &nl_join_terms, &duj_terms, &afj_terms,
+				    &sarged_terms, &pinned_subqueries, &sm_join_terms);
+	  }
       }
 
     /* At this point, kept indicates the number of worthwhile plans generated by examine_joins (i.e., plans that where
@@ -7460,9 +7747,88 @@ qo_planner_search (QO_ENV * env)
   plan = qo_search_planner (planner);
   qo_clean_planner (planner);
 
+  if (plan != NULL)
+    {
+      qo_set_parallel_degree (env, plan);
+    }
+
   return plan;
 }
 
+/*
+ * qo_set_parallel_degree () - set the degree of parallelism of the driving scan of the plan
+ *   return:
+ *   env(in): optimizer environment
+ *   plan(in): final plan of the query
+ *
+ * Note: Only the outermost sequential scan of a class is read in parallel. Its workers gather visible rows into an
+ *       exchange consumed by the query thread, which still evaluates the rest of the plan. The degree comes from
+ *       the PARALLEL hint of the query or from parallel_query_degree; 0 leaves the decision to the server.
+ */
+static void
+qo_set_parallel_degree (QO_ENV * env, QO_PLAN * plan)
+{
+  PT_NODE *tree = QO_ENV_PT_TREE (env);
+  PT_NODE *hint_arg;
+  PT_NODE *spec;
+  QO_NODE *node;
+  int degree;
+
+  degree = prm_get_integer_value (PRM_ID_PARALLEL_QUERY_DEGREE);
+  if (tree != NULL && PT_IS_SELECT (tree) && (tree->info.query.q.select.hint & PT_HINT_PARALLEL))
+    {
+      hint_arg = tree->info.query.q.select.parallel_hint;
+      if (PT_IS_HINT_NODE (hint_arg))
+	{
+	  degree = atoi (hint_arg->info.name.original);
+	}
+    }
+
+  if (degree <= 0)
+    {
+      return;
+    }
+  degree = MIN (degree, QO_MAX_PARALLEL_DEGREE);
+
+  /* find the driving scan */
+  while (plan != NULL && plan->plan_type != QO_PLANTYPE_SCAN)
+    {
+      switch (plan->plan_type)
+	{
+	case QO_PLANTYPE_SORT:
+	  plan = plan->plan_un.sort.subplan;
+	  break;
+
+	case QO_PLANTYPE_JOIN:
+	  plan = plan->plan_un.join.outer;
+	  break;
+
+	case QO_PLANTYPE_FOLLOW:
+	  plan = plan->plan_un.follow.head;
+	  break;
+
+	default:
+	  return;
+	}
+    }
+
+  if (plan == NULL || plan->plan_un.scan.scan_method != QO_SCANMETHOD_SEQ_SCAN)
+    {
+      return;
+    }
+
+  node = plan->plan_un.scan.node;
+  spec = QO_NODE_ENTITY_SPEC (node);
+  if (QO_NODE_INFO (node) == NULL || QO_NODE_INFO_N (node) != 1 || spec == NULL || PT_SPEC_IS_DERIVED (spec)
+      || PT_SPEC_IS_CTE (spec))
+    {
+      /* class hierarchies, derived tables and CTEs are not read from a single heap */
+      return;
+    }
+
+  plan->plan_un.scan.parallel_degree = degree;
+}
+
 /*
  * qo_generate_join_index_scan () -
  *   return:
@@ -10774,7 +11140,8 @@ qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_i
 
 	case QO_PLANTYPE_JOIN:
 	  if (plan->plan_un.join.join_method == QO_JOINMETHOD_NL_JOIN
-	      || plan->plan_un.join.join_method == QO_JOINMETHOD_IDX_JOIN)
+	      || plan->plan_un.join.join_method == QO_JOINMETHOD_IDX_JOIN
+	      || plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN)
 	    {
 	      plan = plan->plan_un.join.outer;
 	    }
@@ -11191,6 +11558,10 @@ qo_plan_scan_print_json (QO_PLAN * plan)
     {
     case QO_SCANMETHOD_SEQ_SCAN:
       scan_string = "TABLE SCAN";
+      if (plan->plan_un.scan.parallel_degree > 1)
+	{
+	  json_object_set_new (scan, "parallel", json_integer (plan->plan_un.scan.parallel_degree));
+	}
       break;
 
     case QO_SCANMETHOD_INDEX_SCAN:
@@ -11324,6 +11695,10 @@ qo_plan_join_print_json (QO_PLAN * plan)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
@@ -11509,6 +11884,10 @@ qo_plan_scan_print_text (FILE * fp, QO_PLAN * plan, int indent)
     {
     case QO_SCANMETHOD_SEQ_SCAN:
       fprintf (fp, "TABLE SCAN (%s)", class_name);
+      if (plan->plan_un.scan.parallel_degree > 1)
+	{
+	  fprintf (fp, " (parallel: %d)", plan->plan_un.scan.parallel_degree);
+	}
       break;
 
     case QO_SCANMETHOD_INDEX_SCAN:
@@ -11635,6 +12014,10 @@ qo_plan_join_print_text (FILE * fp, QO_PLAN * plan, int indent)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
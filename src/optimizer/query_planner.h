@@ -64,7 +64,8 @@ typedef enum
 {
   QO_JOINMETHOD_NL_JOIN,
   QO_JOINMETHOD_IDX_JOIN,
-  QO_JOINMETHOD_MERGE_JOIN
+  QO_JOINMETHOD_MERGE_JOIN,
+  QO_JOINMETHOD_HASH_JOIN
 } QO_JOINMETHOD;
 
 typedef struct qo_plan_vtbl QO_PLAN_VTBL;
@@ -153,6 +154,8 @@ struct qo_plan
       bool index_cover;		/* covered index scan flag */
       bool index_iss;		/* index skip scan flag */
       bool index_loose;		/* loose index scan flag */
+      bool index_oid_order;	/* fetch objects in oid order flag */
+      int parallel_degree;	/* degree of parallelism of a sequential scan, 0 if not decided */
       QO_NODE_INDEX_ENTRY *index;
       BITSET multi_col_range_segs;	/* range condition segs for multi_col_term */
       BITSET hash_terms;	/* hash_terms for hash list scan */
@@ -179,7 +182,7 @@ struct qo_plan
     struct
     {
       JOIN_TYPE join_type;	/* JOIN_INNER, _LEFT, _RIGHT, _OUTER */
-      QO_JOINMETHOD join_method;	/* NL_JOIN, MERGE_JOIN */
+      QO_JOINMETHOD join_method;	/* NL_JOIN, MERGE_JOIN, HASH_JOIN */
       QO_PLAN *outer;
       QO_PLAN *inner;
       BITSET join_terms;	/* all join edges */
@@ -26012,6 +26012,8 @@ PT_HINT parser_hint_table[] = {
   ,
   {"LOCK_TIMEOUT", NULL, PT_HINT_LK_TIMEOUT}
   ,
+  {"PARALLEL", NULL, PT_HINT_PARALLEL}
+  ,
   {"NO_LOGGING", NULL, PT_HINT_NO_LOGGING}
   ,
   {"QUERY_CACHE", NULL, PT_HINT_QUERY_CACHE}
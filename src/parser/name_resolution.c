@@ -6825,12 +6825,6 @@ pt_resolve_hint (PARSER_CONTEXT * parser, PT_NODE * node)
 	}
     }
 
-#if 0
-  if (hint & PT_HINT_USE_HASH)
-    {				/* not used */
-    }
-#endif /* 0 */
-
   return NO_ERROR;
 exit_on_error:
 
@@ -1187,7 +1187,8 @@ typedef enum
   PT_HINT_USE_NL = 0x10,	/* 0001 0000 *//* force nl-join */
   PT_HINT_USE_IDX = 0x20,	/* 0010 0000 *//* force idx-join */
   PT_HINT_USE_MERGE = 0x40,	/* 0100 0000 *//* force m-join */
-  PT_HINT_USE_HASH = 0x80,	/* 1000 0000 -- not used */
+  PT_HINT_PARALLEL = 0x80,	/* temporarily use the unused hint PT_HINT_USE_HASH */
+  /* degree of parallelism of the query */
   PT_HINT_RECOMPILE = 0x0100,	/* 0000 0001 0000 0000 *//* recompile */
   PT_HINT_LK_TIMEOUT = 0x0200,	/* 0000 0010 0000 0000 *//* lock_timeout */
   PT_HINT_NO_LOGGING = 0x0400,	/* 0000 0100 0000 0000 *//* no_logging */
@@ -2728,6 +2729,7 @@ struct pt_select_info
   PT_NODE *index_ls;		/* PT_NAME (list) */
   PT_NODE *use_merge;		/* PT_NAME (list) */
   PT_NODE *waitsecs_hint;	/* lock timeout in seconds */
+  PT_NODE *parallel_hint;	/* degree of parallelism */
   PT_NODE *jdbc_life_time;	/* jdbc cache life time */
   struct qo_summary *qo_summary;
   PT_NODE *check_where;		/* with check option predicate */
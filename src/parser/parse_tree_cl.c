@@ -14192,6 +14192,7 @@ pt_apply_select (PARSER_CONTEXT * parser, PT_NODE * p, PT_NODE_FUNCTION g, void
   p->info.query.q.select.index_ls = g (parser, p->info.query.q.select.index_ls, arg);
   p->info.query.q.select.use_merge = g (parser, p->info.query.q.select.use_merge, arg);
   p->info.query.q.select.waitsecs_hint = g (parser, p->info.query.q.select.waitsecs_hint, arg);
+  p->info.query.q.select.parallel_hint = g (parser, p->info.query.q.select.parallel_hint, arg);
   p->info.query.into_list = g (parser, p->info.query.into_list, arg);
   p->info.query.order_by = g (parser, p->info.query.order_by, arg);
   p->info.query.orderby_for = g (parser, p->info.query.orderby_for, arg);
@@ -14229,6 +14230,7 @@ pt_init_select (PT_NODE * p)
   p->info.query.q.select.index_ls = NULL;
   p->info.query.q.select.use_merge = NULL;
   p->info.query.q.select.waitsecs_hint = NULL;
+  p->info.query.q.select.parallel_hint = NULL;
   p->info.query.q.select.jdbc_life_time = NULL;
   p->info.query.q.select.qo_summary = NULL;
   p->info.query.q.select.check_where = NULL;
@@ -14507,13 +14509,14 @@ pt_print_select (PARSER_CONTEXT * parser, PT_NODE * p)
 		}
 	    }
 
-#if 0
-	  if (p->info.query.q.select.hint & PT_HINT_USE_HASH)
+	  if (p->info.query.q.select.hint & PT_HINT_PARALLEL && p->info.query.q.select.parallel_hint)
 	    {
-	      /* -- not used */
-	      q = pt_append_nulstring (parser, q, "USE_HASH ");
+	      /* degree of parallelism */
+	      q = pt_append_nulstring (parser, q, "PARALLEL(");
+	      r1 = pt_print_bytes (parser, p->info.query.q.select.parallel_hint);
+	      q = pt_append_varchar (parser, q, r1);
+	      q = pt_append_nulstring (parser, q, ") ");
 	    }
-#endif /* 0 */
 	  if (p->info.query.q.select.hint & PT_HINT_LK_TIMEOUT && p->info.query.q.select.waitsecs_hint)
 	    {
 	      /* lock timeout */
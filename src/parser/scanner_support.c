@@ -276,10 +276,14 @@ pt_get_hint (const char *text, PT_HINT hint_table[], PT_NODE * node)
 		  hint_table[i].arg_list = NULL;
 		}
 	      break;
-#if 0
-	    case PT_HINT_USE_HASH:	/* not used */
+	    case PT_HINT_PARALLEL:	/* degree of parallelism */
+	      if (node->node_type == PT_SELECT)
+		{
+		  node->info.query.q.select.hint = (PT_HINT_ENUM) (node->info.query.q.select.hint | hint_table[i].hint);
+		  node->info.query.q.select.parallel_hint = hint_table[i].arg_list;
+		}
+	      hint_table[i].arg_list = NULL;
 	      break;
-#endif /* 0 */
 	    case PT_HINT_RECOMPILE:	/* recompile */
 	      node->recompile = 1;
 	      break;
@@ -14154,6 +14154,54 @@ ptqo_to_list_scan_proc (PARSER_CONTEXT * parser, XASL_NODE * xasl, PROC_TYPE pro
   return xasl;
 }
 
+/*
+ * ptqo_add_list_scan_hash_keys () - set the keys used to build and probe
+ *                                   the hash table of a list scan
+ *   return: xasl, or NULL on error
+ *   parser(in):
+ *   xasl(in): scan proc of a list file
+ *   build_list(in): key expressions over the columns of the list file
+ *   probe_list(in): matching key expressions over the outer scans
+ */
+XASL_NODE *
+ptqo_add_list_scan_hash_keys (PARSER_CONTEXT * parser, XASL_NODE * xasl, PT_NODE * build_list, PT_NODE * probe_list)
+{
+  ACCESS_SPEC_TYPE *spec;
+  PT_NODE *saved_current_class;
+  REGU_VARIABLE_LIST regu_build, regu_probe;
+
+  if (xasl == NULL || build_list == NULL || probe_list == NULL)
+    {
+      return xasl;
+    }
+
+  spec = xasl->spec_list;
+  if (spec == NULL || spec->type != TARGET_LIST)
+    {
+      return xasl;
+    }
+
+  /* The keys are evaluated after the val list has been fetched, like the scan predicate. See
+   * ptqo_to_list_scan_proc(). */
+  parser->symbols->listfile_unbox = UNBOX_AS_VALUE;
+  parser->symbols->current_listfile = NULL;
+  saved_current_class = parser->symbols->current_class;
+  parser->symbols->current_class = NULL;
+  regu_build = pt_to_regu_variable_list (parser, build_list, UNBOX_AS_VALUE, NULL, NULL);
+  regu_probe = pt_to_regu_variable_list (parser, probe_list, UNBOX_AS_VALUE, NULL, NULL);
+  parser->symbols->current_class = saved_current_class;
+
+  if (pt_has_error (parser))
+    {
+      return NULL;
+    }
+
+  spec->s.list_node.list_regu_list_build = regu_build;
+  spec->s.list_node.list_regu_list_probe = regu_probe;
+
+  return xasl;
+}
+
 
 /*
  * ptqo_to_merge_list_proc () - Make a MERGELIST_PROC to merge an inner
@@ -16496,8 +16544,23 @@ pt_to_buildlist_proc (PARSER_CONTEXT * parser, PT_NODE * select_node, QO_PLAN *
 	  buildlist->g_with_rollup = 0;
 	}
 
-      /* set index scan order */
-      xasl->iscan_oid_order = ((orderby_skip) ? false : prm_get_bool_value (PRM_ID_BT_INDEX_SCAN_OID_ORDER));
+      /* set index scan order; the index must return keys in order when it is used to skip order by or group by */
+      if (orderby_skip || groupby_skip)
+	{
+	  xasl->iscan_oid_order = false;
+	}
+      else
+	{
+	  xasl->iscan_oid_order = (prm_get_bool_value (PRM_ID_BT_INDEX_SCAN_OID_ORDER)
+				   || (qo_plan != NULL && qo_plan_iscan_oid_order (qo_plan)));
+	}
+
+      /* set the degree of parallelism of the driving heap scan */
+      if (qo_plan != NULL && xasl->spec_list != NULL && xasl->spec_list->type == TARGET_CLASS
+	  && xasl->spec_list->access == ACCESS_METHOD_SEQUENTIAL)
+	{
+	  ACCESS_SPEC_CLS_SPEC (xasl->spec_list).parallel_degree = qo_plan_parallel_degree (qo_plan);
+	}
 
       /* save single tuple info */
       if (select_node->info.query.single_tuple == 1)
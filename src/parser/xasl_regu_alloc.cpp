@@ -171,6 +171,7 @@ regu_spec_target_init (access_spec_node &spec, TARGET_TYPE type)
       spec.s.cls_node.attrids_range = NULL;
       spec.s.cls_node.cache_range = NULL;
       spec.s.cls_node.num_attrs_range = 0;
+      spec.s.cls_node.parallel_degree = 0;
       break;
     case TARGET_LIST:
       spec.s.list_node.list_regu_list_pred = NULL;
@@ -3795,6 +3795,15 @@ fetch_peek_dbval (THREAD_ENTRY * thread_p, REGU_VARIABLE * regu_var, val_descr *
       if (*peek_dbval != NULL)
 	{
 	  /* we have a cached pointer already */
+	  if (HEAP_ATTRVALUE_OF_DBVALUE (*peek_dbval)->state == HEAP_UNREAD_ATTRVALUE)
+	    {
+	      /* the instance was read lazily; decode the value on first use */
+	      if (heap_attrinfo_read_unread_dbvalue (HEAP_ATTRVALUE_OF_DBVALUE (*peek_dbval),
+						     regu_var->value.attr_descr.cache_attrinfo) != NO_ERROR)
+		{
+		  goto exit_on_error;
+		}
+	    }
 	  break;
 	}
       else
@@ -31,7 +31,8 @@ typedef enum
   HEAP_READ_ATTRVALUE,
   HEAP_WRITTEN_ATTRVALUE,
   HEAP_UNINIT_ATTRVALUE,
-  HEAP_WRITTEN_LOB_ATTRVALUE
+  HEAP_WRITTEN_LOB_ATTRVALUE,
+  HEAP_UNREAD_ATTRVALUE		/* bound to the record of the attribute info, decoded on first access */
 } HEAP_ATTRVALUE_STATE;
 
 typedef enum
@@ -54,6 +55,10 @@ struct heap_attrvalue
   DB_VALUE dbvalue;		/* DB values of the attribute in memory */
 };
 
+/* attribute value of a DB_VALUE returned by heap_attrinfo_access () */
+#define HEAP_ATTRVALUE_OF_DBVALUE(dbvalp) \
+  ((HEAP_ATTRVALUE *) ((char *) (dbvalp) - offsetof (HEAP_ATTRVALUE, dbvalue)))
+
 typedef struct heap_cache_attrinfo HEAP_CACHE_ATTRINFO;
 struct heap_cache_attrinfo
 {
@@ -68,6 +73,7 @@ struct heap_cache_attrinfo
   int inst_chn;			/* Current chn of instance object */
   int num_values;		/* Number of desired attribute values */
   HEAP_ATTRVALUE *values;	/* Value for the attributes */
+  RECDES unread_recdes;		/* Record of the values in HEAP_UNREAD_ATTRVALUE state */
 };
 
 #else /* !defined (SERVER_MODE) && !defined (SA_MODE) */
@@ -37,6 +37,7 @@
 #include "db_value_printer.hpp"
 #include "dbtype.h"
 #include "error_manager.h"
+#include "language_support.h"
 #include "log_append.hpp"
 #include "object_primitive.h"
 #include "object_representation.h"
@@ -63,6 +64,11 @@ static int rv;
 
 #define QFILE_DEFAULT_PAGES 4
 
+/* order preserving binary prefix of the first key of a sort record; see qfile_make_sort_key_prefix */
+#define QFILE_SORT_KEY_PREFIX_SIZE ((int) sizeof (UINT64))
+#define QFILE_SORT_KEY_PREFIX_SIGN ((UINT64) 1 << 63)
+#define QFILE_GET_SORT_KEY_PREFIX(ptr) (*(UINT64 *) (ptr))
+
 #if defined (SERVER_MODE)
 #define LS_PUT_NEXT_VPID(ptr) \
   do \
@@ -286,6 +292,11 @@ static int *qfile_get_list_cache_entry_tran_index_array (QFILE_LIST_CACHE_ENTRY
 #endif /* SERVER_MODE */
 static DB_VALUE *qfile_get_list_cache_entry_param_values (QFILE_LIST_CACHE_ENTRY * ent);
 static int qfile_compare_with_null_value (int o0, int o1, SUBKEY_INFO key_info);
+static void qfile_initialize_sort_key_prefix (SORTKEY_INFO * key_info_p);
+static int qfile_make_sort_key_prefix (THREAD_ENTRY * thread_p, SORTKEY_INFO * key_info_p, char *field_p,
+				       UINT64 * prefix_p);
+static int qfile_get_string_sort_key_prefix (THREAD_ENTRY * thread_p, const unsigned int *weights, char *data_p,
+					     UINT64 * prefix_p);
 static int qfile_compare_with_interpolation_domain (char *fp0, char *fp1, SUBKEY_INFO * subkey,
 						    SORTKEY_INFO * key_info);
 
@@ -3100,6 +3111,8 @@ qfile_make_sort_key (THREAD_ENTRY * thread_p, SORTKEY_INFO * key_info_p, RECDES
   SCAN_CODE scan_status;
   char *field_data;
   int field_length, offset;
+  char *prefix_data = NULL;
+  UINT64 prefix;
   SORT_STATUS status;
 
   scan_status = qfile_scan_list_next (thread_p, input_scan_p, tuple_record_p, PEEK);
@@ -3122,6 +3135,14 @@ qfile_make_sort_key (THREAD_ENTRY * thread_p, SORTKEY_INFO * key_info_p, RECDES
 
       length = CAST_BUFLEN (data - key_record_p->data);	/* i.e, 12 */
 
+      if (key_info_p->use_prefix)
+	{
+	  /* reserve the prefix of the first key; it is built once the record fits */
+	  prefix_data = data;
+	  data += QFILE_SORT_KEY_PREFIX_SIZE;
+	  length += QFILE_SORT_KEY_PREFIX_SIZE;
+	}
+
       /* STEP 1: build header(tuple_ID) */
       if (length <= key_record_p->area_size)
 	{
@@ -3163,6 +3184,14 @@ qfile_make_sort_key (THREAD_ENTRY * thread_p, SORTKEY_INFO * key_info_p, RECDES
 
       length = CAST_BUFLEN (data - key_record_p->data);	/* i.e, 4 + 4 * (n - 1) */
 
+      if (key_info_p->use_prefix)
+	{
+	  /* reserve the prefix of the first key, right before its field; it is built once the record fits */
+	  prefix_data = data;
+	  data += QFILE_SORT_KEY_PREFIX_SIZE;
+	  length += QFILE_SORT_KEY_PREFIX_SIZE;
+	}
+
       /* STEP 1: build header(offset_MAP) - go on with STEP 2 */
 
       /* STEP 2: build body */
@@ -3210,6 +3239,16 @@ qfile_make_sort_key (THREAD_ENTRY * thread_p, SORTKEY_INFO * key_info_p, RECDES
   if (key_record_p->length <= key_record_p->area_size)
     {
       status = SORT_SUCCESS;
+
+      if (key_info_p->use_prefix)
+	{
+	  QFILE_GET_TUPLE_VALUE_HEADER_POSITION (tuple_record_p->tpl, key_info_p->key[0].col, field_data);
+	  if (qfile_make_sort_key_prefix (thread_p, key_info_p, field_data, &prefix) != NO_ERROR)
+	    {
+	      return SORT_ERROR_OCCURRED;
+	    }
+	  QFILE_GET_SORT_KEY_PREFIX (prefix_data) = prefix;
+	}
     }
   else
     {
@@ -3518,10 +3557,12 @@ qfile_compare_partial_sort_record (const void *pk0, const void *pk1, void *arg)
   int order;
   char *d0, *d1;
   char *fp0, *fp1;		/* sort_key field pointer */
+  UINT64 p0, p1;
 
   key_info_p = (SORTKEY_INFO *) arg;
   n = key_info_p->nkeys;
   order = 0;
+  i = 0;
 
   k0 = *(SORT_REC **) pk0;
   k1 = *(SORT_REC **) pk1;
@@ -3533,7 +3574,33 @@ qfile_compare_partial_sort_record (const void *pk0, const void *pk1, void *arg)
   fp1 = &(k1->s.original.body[0]);
   fp1 = PTR_ALIGN (fp1, MAX_ALIGNMENT);
 
-  for (i = 0; i < n; i++)
+  if (key_info_p->use_prefix)
+    {
+      p0 = QFILE_GET_SORT_KEY_PREFIX (fp0);
+      p1 = QFILE_GET_SORT_KEY_PREFIX (fp1);
+
+      fp0 += QFILE_SORT_KEY_PREFIX_SIZE;
+      fp1 += QFILE_SORT_KEY_PREFIX_SIZE;
+
+      if (n > 0 && !key_info_p->key[0].use_cmp_dom && QFILE_GET_TUPLE_VALUE_FLAG (fp0) == V_BOUND
+	  && QFILE_GET_TUPLE_VALUE_FLAG (fp1) == V_BOUND)
+	{
+	  if (p0 != p1)
+	    {
+	      return (p0 < p1) ? -1 : 1;
+	    }
+
+	  if (key_info_p->is_prefix_exact)
+	    {
+	      /* the first keys are equal */
+	      fp0 += QFILE_TUPLE_VALUE_HEADER_LENGTH + QFILE_GET_TUPLE_VALUE_LENGTH (fp0);
+	      fp1 += QFILE_TUPLE_VALUE_HEADER_LENGTH + QFILE_GET_TUPLE_VALUE_LENGTH (fp1);
+	      i = 1;
+	    }
+	}
+    }
+
+  for (; i < n; i++)
     {
       if (QFILE_GET_TUPLE_VALUE_FLAG (fp0) == V_BOUND)
 	{
@@ -3595,15 +3662,36 @@ qfile_compare_all_sort_record (const void *pk0, const void *pk1, void *arg)
   int order;
   int o0, o1;
   char *d0, *d1;
+  UINT64 p0, p1;
 
   key_info_p = (SORTKEY_INFO *) arg;
   n = key_info_p->nkeys;
   order = 0;
+  i = 0;
 
   k0 = *(SORT_REC **) pk0;
   k1 = *(SORT_REC **) pk1;
 
-  for (i = 0; i < n; i++)
+  if (key_info_p->use_prefix && n > 0 && k0->s.offset[0] != 0 && k1->s.offset[0] != 0)
+    {
+      /* the prefix is right before the field of the first key */
+      p0 = QFILE_GET_SORT_KEY_PREFIX ((char *) k0 + k0->s.offset[0] - QFILE_TUPLE_VALUE_HEADER_SIZE
+				      - QFILE_SORT_KEY_PREFIX_SIZE);
+      p1 = QFILE_GET_SORT_KEY_PREFIX ((char *) k1 + k1->s.offset[0] - QFILE_TUPLE_VALUE_HEADER_SIZE
+				      - QFILE_SORT_KEY_PREFIX_SIZE);
+      if (p0 != p1)
+	{
+	  return (p0 < p1) ? -1 : 1;
+	}
+
+      if (key_info_p->is_prefix_exact)
+	{
+	  /* the first keys are equal */
+	  i = 1;
+	}
+    }
+
+  for (; i < n; i++)
     {
       o0 = k0->s.offset[i];
       o1 = k1->s.offset[i];
@@ -3679,6 +3767,189 @@ qfile_compare_with_null_value (int o0, int o1, SUBKEY_INFO key_info)
     }
 }
 
+/*
+ * qfile_make_sort_key_prefix () - build the prefix of the first key of a sort record
+ *   return: NO_ERROR, or error code
+ *   thread_p(in):
+ *   key_info_p(in): Sort key info
+ *   field_p(in): The field of the first key, with its value header
+ *   prefix_p(out): The prefix
+ *
+ * Note: The prefix of a value is not greater than the prefix of a greater value, so two records whose prefixes
+ *       differ are ordered by the prefixes.  Descending keys have their prefix inverted.  NULLs are not ordered by
+ *       their prefix.
+ */
+static int
+qfile_make_sort_key_prefix (THREAD_ENTRY * thread_p, SORTKEY_INFO * key_info_p, char *field_p, UINT64 * prefix_p)
+{
+  SUBKEY_INFO *subkey = &key_info_p->key[0];
+  char *data_p;
+  UINT64 prefix;
+  DB_BIGINT bigint;
+  DB_DATETIME datetime;
+  float f;
+  double d;
+  int error;
+
+  *prefix_p = 0;
+
+  if (QFILE_GET_TUPLE_VALUE_FLAG (field_p) != V_BOUND)
+    {
+      return NO_ERROR;
+    }
+
+  data_p = field_p + QFILE_TUPLE_VALUE_HEADER_SIZE;
+
+  switch (TP_DOMAIN_TYPE (subkey->col_dom))
+    {
+    case DB_TYPE_SHORT:
+      prefix = ((UINT64) (INT64) OR_GET_SHORT (data_p)) ^ QFILE_SORT_KEY_PREFIX_SIGN;
+      break;
+
+    case DB_TYPE_INTEGER:
+      prefix = ((UINT64) (INT64) OR_GET_INT (data_p)) ^ QFILE_SORT_KEY_PREFIX_SIGN;
+      break;
+
+    case DB_TYPE_BIGINT:
+      OR_GET_BIGINT (data_p, &bigint);
+      prefix = ((UINT64) bigint) ^ QFILE_SORT_KEY_PREFIX_SIGN;
+      break;
+
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+      if (TP_DOMAIN_TYPE (subkey->col_dom) == DB_TYPE_FLOAT)
+	{
+	  OR_GET_FLOAT (data_p, &f);
+	  d = f;
+	}
+      else
+	{
+	  OR_GET_DOUBLE (data_p, &d);
+	}
+
+      if (d == 0.0)
+	{
+	  /* -0.0 is equal to 0.0 */
+	  d = 0.0;
+	}
+
+      memcpy (&prefix, &d, sizeof (prefix));
+      prefix = (prefix & QFILE_SORT_KEY_PREFIX_SIGN) ? ~prefix : (prefix | QFILE_SORT_KEY_PREFIX_SIGN);
+      break;
+
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+      prefix = (UINT64) (unsigned int) OR_GET_INT (data_p);
+      break;
+
+    case DB_TYPE_DATETIME:
+      OR_GET_DATETIME (data_p, &datetime);
+      prefix = (((UINT64) datetime.date) << 32) | datetime.time;
+      break;
+
+    case DB_TYPE_STRING:
+      error = qfile_get_string_sort_key_prefix (thread_p, key_info_p->prefix_weights, data_p, &prefix);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      break;
+
+    default:
+      assert (false);
+      prefix = 0;
+      break;
+    }
+
+  *prefix_p = subkey->is_desc ? ~prefix : prefix;
+
+  return NO_ERROR;
+}
+
+/*
+ * qfile_get_string_sort_key_prefix () - build the prefix of a string from the weights of its first bytes
+ *   return: NO_ERROR, or error code
+ *   thread_p(in):
+ *   weights(in): Byte weights of the collation; NULL to compare bytes as they are
+ *   data_p(in): The string in disk format
+ *   prefix_p(out): The prefix
+ *
+ * Note: A space weighs as zero and shorter strings are padded with zero, like lang_fastcmp_byte does.
+ */
+static int
+qfile_get_string_sort_key_prefix (THREAD_ENTRY * thread_p, const unsigned int *weights, char *data_p,
+				  UINT64 * prefix_p)
+{
+  OR_BUF buf;
+  char *string;
+  char *alloced_string = NULL;
+  int size, compressed_size, decompressed_size;
+  unsigned int c;
+  int i;
+  int error = NO_ERROR;
+
+  size = OR_GET_BYTE (data_p);
+  if (size < OR_MINIMUM_STRING_LENGTH_FOR_COMPRESSION)
+    {
+      string = data_p + OR_BYTE_SIZE;
+    }
+  else
+    {
+      or_init (&buf, data_p, 0);
+      error = or_get_varchar_compression_lengths (&buf, &compressed_size, &decompressed_size);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      if (compressed_size > 0)
+	{
+	  alloced_string = (char *) db_private_alloc (thread_p, decompressed_size + 1);
+	  if (alloced_string == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) decompressed_size + 1);
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+
+	  error = pr_get_compressed_data_from_buffer (&buf, alloced_string, compressed_size, decompressed_size);
+	  if (error != NO_ERROR)
+	    {
+	      db_private_free_and_init (thread_p, alloced_string);
+	      return error;
+	    }
+	  string = alloced_string;
+	}
+      else
+	{
+	  string = buf.ptr;
+	}
+      size = decompressed_size;
+    }
+
+  *prefix_p = 0;
+  for (i = 0; i < QFILE_SORT_KEY_PREFIX_SIZE; i++)
+    {
+      c = 0;
+      if (i < size)
+	{
+	  c = (unsigned char) string[i];
+	  if (weights != NULL)
+	    {
+	      c = (c == ' ') ? 0 : weights[c];
+	    }
+	}
+      *prefix_p = (*prefix_p << 8) | c;
+    }
+
+  if (alloced_string != NULL)
+    {
+      db_private_free_and_init (thread_p, alloced_string);
+    }
+
+  return NO_ERROR;
+}
+
 /* qfile_get_estimated_pages_for_sorting () -
  *   return:
  *   listid(in):
@@ -3704,6 +3975,10 @@ qfile_get_estimated_pages_for_sorting (QFILE_LIST_ID * list_id_p, SORTKEY_INFO *
        * per field in the key (for the offset vector).
        */
       sort_key_size = (int) offsetof (SORT_REC, s.original.body[0]);
+      if (key_info_p->use_prefix)
+	{
+	  sort_key_size += QFILE_SORT_KEY_PREFIX_SIZE;
+	}
       sort_key_overhead = (int) ceil (((double) (list_id_p->tuple_cnt * sort_key_size)) / DB_PAGESIZE);
     }
   else
@@ -3716,6 +3991,10 @@ qfile_get_estimated_pages_for_sorting (QFILE_LIST_ID * list_id_p, SORTKEY_INFO *
        */
       sort_key_size =
 	(int) offsetof (SORT_REC, s.offset[0]) + sizeof (((SORT_REC *) 0)->s.offset[0]) * key_info_p->nkeys;
+      if (key_info_p->use_prefix)
+	{
+	  sort_key_size += QFILE_SORT_KEY_PREFIX_SIZE;
+	}
       sort_key_overhead = (int) ceil (((double) (list_id_p->tuple_cnt * sort_key_size)) / DB_PAGESIZE);
     }
 
@@ -3819,9 +4098,109 @@ qfile_initialize_sort_key_info (SORTKEY_INFO * key_info_p, SORT_LIST * list_p, Q
 	}
     }
 
+  qfile_initialize_sort_key_prefix (key_info_p);
+
   return key_info_p;
 }
 
+/* qfile_initialize_sort_key_prefix () - decide whether sort records keep a prefix of the first key
+ *   return:
+ *   key_info_p(in/out):
+ *
+ * Note: The prefix is used only for types whose disk order can be mapped to an unsigned integer: the numeric and
+ *       date/time types, whose values fit entirely, and strings of the collations compared byte by byte, whose
+ *       first bytes are kept.
+ */
+static void
+qfile_initialize_sort_key_prefix (SORTKEY_INFO * key_info_p)
+{
+  TP_DOMAIN *domain_p;
+  LANG_COLLATION *lang_coll;
+  const unsigned int *weights;
+  int c;
+
+  key_info_p->use_prefix = 0;
+  key_info_p->is_prefix_exact = 0;
+  key_info_p->prefix_weights = NULL;
+
+  if (key_info_p->nkeys <= 0)
+    {
+      return;
+    }
+
+  domain_p = key_info_p->key[0].col_dom;
+
+  switch (TP_DOMAIN_TYPE (domain_p))
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+      key_info_p->use_prefix = 1;
+      key_info_p->is_prefix_exact = 1;
+      break;
+
+    case DB_TYPE_STRING:
+      if (TP_DOMAIN_COLLATION_FLAG (domain_p) != TP_DOMAIN_COLL_NORMAL)
+	{
+	  break;
+	}
+
+      lang_coll = lang_get_collation (TP_DOMAIN_COLLATION (domain_p));
+      if (lang_coll == NULL)
+	{
+	  break;
+	}
+
+      switch (lang_coll->coll.coll_id)
+	{
+	case LANG_COLL_BINARY:
+	  /* bytes are compared as they are */
+	  key_info_p->use_prefix = 1;
+	  break;
+
+	case LANG_COLL_ISO_BINARY:
+	case LANG_COLL_UTF8_BINARY:
+	case LANG_COLL_ISO_EN_CS:
+	case LANG_COLL_ISO_EN_CI:
+	case LANG_COLL_UTF8_EN_CS:
+	case LANG_COLL_UTF8_EN_CI:
+	  /* bytes are compared by their weights, see lang_fastcmp_byte */
+	  weights =
+	    prm_get_bool_value (PRM_ID_IGNORE_TRAILING_SPACE) ? lang_coll->coll.weights_ti : lang_coll->coll.weights;
+	  if (weights == NULL || lang_coll->coll.w_count < UCHAR_MAX + 1)
+	    {
+	      break;
+	    }
+
+	  for (c = 0; c <= UCHAR_MAX && weights[c] <= UCHAR_MAX; c++)
+	    {
+	      ;
+	    }
+
+	  if (c > UCHAR_MAX)
+	    {
+	      key_info_p->use_prefix = 1;
+	      key_info_p->prefix_weights = weights;
+	    }
+	  break;
+
+	default:
+	  /* multi-byte collations need the whole string */
+	  break;
+	}
+      break;
+
+    default:
+      break;
+    }
+}
+
 /* qfile_clear_sort_key_info () -
  *   return:
  *   info(in):
@@ -97,6 +97,10 @@ namespace cubquery
     aggregate_hash_value *curr_part_value;	/* current partial value */
     aggregate_hash_value *temp_part_value;	/* temporary partial value */
     int sorted_count;
+
+    /* spilled partitions stuff */
+    qfile_list_id **spill_list_ids;	/* partitions of tuples whose groups did not fit in the hash table */
+    QFILE_TUPLE_RECORD spill_tuple;	/* tuple being spilled */
   };
 
 
@@ -3005,6 +3005,10 @@ qdump_print_stats_json (xasl_node * xasl_p, json_t * parent)
 	{
 	  json_object_set_new (groupby, "hash", json_string ("partial"));
 	}
+      else if (gstats->groupby_hash == HS_SPILL)
+	{
+	  json_object_set_new (groupby, "hash", json_string ("spilled"));
+	}
       else
 	{
 	  json_object_set_new (groupby, "hash", json_false ());
@@ -3271,6 +3275,10 @@ qdump_print_stats_text (FILE * fp, xasl_node * xasl_p, int indent)
 	{
 	  fprintf (fp, ", hash: partial");
 	}
+      else if (gstats->groupby_hash == HS_SPILL)
+	{
+	  fprintf (fp, ", hash: spilled");
+	}
       else
 	{
 	  fprintf (fp, ", hash: false");
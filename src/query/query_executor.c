@@ -126,6 +126,15 @@ struct xasl_state
 /* maximum selectivity allowed for hash aggregate evaluation */
 #define HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD         0.5f
 
+/* number of partitions tuples of new groups are spilled to once the hash table is full */
+#define HASH_AGGREGATE_SPILL_PARTITIONS                 16
+
+/* bits of the key hash that choose the partition of a tuple at each depth */
+#define HASH_AGGREGATE_SPILL_PARTITION_BITS             4
+
+/* deepest partitioning of spilled tuples; partitions at this depth are aggregated in memory regardless of size */
+#define HASH_AGGREGATE_SPILL_MAX_DEPTH                  6
+
 
 #define QEXEC_CLEAR_AGG_LIST_VALUE(agg_list) \
   do \
@@ -438,6 +447,16 @@ static int qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl,
 				     BUILDLIST_PROC_NODE * proc, QFILE_TUPLE_RECORD * tplrec,
 				     QFILE_TUPLE_DESCRIPTOR * tpldesc, QFILE_LIST_ID * groupby_list,
 				     bool * output_tuple);
+static int qexec_hash_gby_spill_tuple (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, QFILE_LIST_ID ** parts,
+				       AGGREGATE_HASH_KEY * key, int depth, QFILE_TUPLE tpl,
+				       QFILE_TUPLE_VALUE_TYPE_LIST * type_list);
+static int qexec_hash_gby_output_htable (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate,
+					 QFILE_LIST_ID * groupby_list);
+static int qexec_hash_gby_agg_partition (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate,
+					 QFILE_LIST_ID * part_list_id, int depth, QFILE_LIST_ID * groupby_list);
+static int qexec_hash_gby_agg_partitions (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, QFILE_LIST_ID ** parts,
+					  int depth, QFILE_LIST_ID * groupby_list);
+static int qexec_hash_gby_agg_spilled (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, QFILE_LIST_ID * list_id);
 static void qexec_gby_start_group_dim (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, const RECDES * recdes);
 static void qexec_gby_start_group (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, const RECDES * recdes, int N);
 static void qexec_gby_finalize_group_val_list (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, int N);
@@ -3743,7 +3762,43 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 
   /* probe hash table */
   value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
-  if (value == NULL)
+  if (value == NULL && context->state == HS_SPILL)
+    {
+      int tuple_size = tpldesc->tpl_size;
+
+      /* hash table is full; keep the tuple in the partition of its group, it is aggregated after the scan */
+      if (context->spill_tuple.size < tuple_size)
+	{
+	  if (context->spill_tuple.tpl != NULL)
+	    {
+	      db_private_free_and_init (thread_p, context->spill_tuple.tpl);
+	    }
+	  context->spill_tuple.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, tuple_size);
+	  if (context->spill_tuple.tpl == NULL)
+	    {
+	      context->spill_tuple.size = 0;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) tuple_size);
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  context->spill_tuple.size = tuple_size;
+	}
+
+      if (qfile_save_tuple (tpldesc, T_NORMAL, context->spill_tuple.tpl, &tuple_size) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      rc = qexec_hash_gby_spill_tuple (thread_p, xasl_state, context->spill_list_ids, key, 0,
+				       context->spill_tuple.tpl, &groupby_list->type_list);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      *output_tuple = false;
+      context->tuple_count++;
+    }
+  else if (value == NULL)
     {
       AGGREGATE_HASH_KEY *new_key;
       AGGREGATE_HASH_VALUE *new_value;
@@ -3834,7 +3889,31 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
     }
 
   /* keep hash table within memory limit */
-  while (context->hash_size > (int) mem_limit)
+  if (context->state == HS_ACCEPT_ALL && context->hash_size > (int) mem_limit && !proc->g_output_first_tuple)
+    {
+      /* stop adding groups; tuples of new groups are spilled to partitions and aggregated after the scan, so the
+       * groups never need to be sorted. rollup groups are built during the sort and still evict entries below. */
+      if (context->spill_list_ids == NULL)
+	{
+	  context->spill_list_ids =
+	    (QFILE_LIST_ID **) db_private_alloc (thread_p, sizeof (QFILE_LIST_ID *) * HASH_AGGREGATE_SPILL_PARTITIONS);
+	  if (context->spill_list_ids == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		      sizeof (QFILE_LIST_ID *) * HASH_AGGREGATE_SPILL_PARTITIONS);
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  memset (context->spill_list_ids, 0, sizeof (QFILE_LIST_ID *) * HASH_AGGREGATE_SPILL_PARTITIONS);
+	}
+      context->state = HS_SPILL;
+
+#if !defined(NDEBUG)
+      er_log_debug (ARG_FILE_LINE, "hash aggregation overflow: spilling new groups after %d groups",
+		    context->group_count);
+#endif
+    }
+
+  while (context->state != HS_SPILL && context->hash_size > (int) mem_limit)
     {
       /* get least recently used entry */
       hentry = context->hash_table->lru_head;
@@ -3874,8 +3953,8 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
       mht_rem (context->hash_table, key, qdata_free_agg_hentry, NULL);
     }
 
-  /* check very high selectivity case */
-  if (context->tuple_count > HASH_AGGREGATE_VH_SELECTIVITY_TUPLE_THRESHOLD)
+  /* check very high selectivity case; without rollup, groups that do not fit are spilled instead */
+  if (proc->g_output_first_tuple && context->tuple_count > HASH_AGGREGATE_VH_SELECTIVITY_TUPLE_THRESHOLD)
     {
       float selectivity = (float) context->group_count / context->tuple_count;
       if (selectivity > HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD)
@@ -3905,6 +3984,351 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   return NO_ERROR;
 }
 
+/*
+ * qexec_hash_gby_spill_tuple () - write a tuple to the spill partition of its group
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   xasl_state(in): XASL state
+ *   parts(in/out): spill partitions, opened on first use
+ *   key(in): group key of the tuple
+ *   depth(in): depth of the partitions
+ *   tpl(in): tuple
+ *   type_list(in): type list of the tuple
+ *
+ * Note: Each depth uses other bits of the key hash, so the tuples of an oversized partition are spread again when it
+ *       is repartitioned.
+ */
+static int
+qexec_hash_gby_spill_tuple (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, QFILE_LIST_ID ** parts,
+			    AGGREGATE_HASH_KEY * key, int depth, QFILE_TUPLE tpl,
+			    QFILE_TUPLE_VALUE_TYPE_LIST * type_list)
+{
+  unsigned int hash_val;
+  int part, error_code = NO_ERROR;
+
+  assert (parts != NULL && depth <= HASH_AGGREGATE_SPILL_MAX_DEPTH);
+
+  hash_val = qdata_hash_agg_hkey (key, INT_MAX);
+  part = (int) ((hash_val >> (depth * HASH_AGGREGATE_SPILL_PARTITION_BITS)) % HASH_AGGREGATE_SPILL_PARTITIONS);
+
+  if (parts[part] == NULL)
+    {
+      parts[part] = qfile_open_list (thread_p, type_list, NULL, xasl_state->query_id, 0);
+      if (parts[part] == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+    }
+
+  return qfile_add_tuple_to_list (thread_p, parts[part], tpl);
+}
+
+/*
+ * qexec_hash_gby_output_htable () - complete the groups of the hash table
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   gbstate(in): group by state
+ *   groupby_list(in): list receiving the first tuple of each group when groups are sorted afterwards; NULL to output
+ *                     the groups directly
+ *
+ * Note: When the groups are sorted afterwards, their accumulators are saved to the partial list, which is merged by
+ *       the sort-based aggregation. The hash table is cleared either way.
+ */
+static int
+qexec_hash_gby_output_htable (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, QFILE_LIST_ID * groupby_list)
+{
+  AGGREGATE_HASH_CONTEXT *context = gbstate->agg_hash_context;
+  AGGREGATE_HASH_VALUE *value;
+  HENTRY_PTR head;
+  int rc;
+
+  if (groupby_list != NULL)
+    {
+      rc = qdata_save_agg_htable_to_list (thread_p, context->hash_table, groupby_list, context->part_list_id,
+					  context->temp_dbval_array);
+      context->hash_size = 0;
+      return rc;
+    }
+
+  for (head = context->hash_table->act_head; head != NULL; head = head->act_next)
+    {
+      /* load entry into aggregate list */
+      value = (AGGREGATE_HASH_VALUE *) head->data;
+      if (value == NULL || value->first_tuple.tpl == NULL)
+	{
+	  /* should not happen */
+	  assert (false);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+	  return ER_QPROC_INVALID_XASLNODE;
+	}
+
+      /* start new group and aggregate tuple; hashed groups have no rollup groups */
+      qexec_gby_start_group_dim (thread_p, gbstate, NULL);
+
+      /* load values in list and aggregate first tuple */
+      qdata_load_agg_hvalue_in_agg_list (value, gbstate->g_dim[0].d_agg_list, false);
+      qexec_gby_agg_tuple (thread_p, gbstate, value->first_tuple.tpl, PEEK);
+
+      /* finalize */
+      qexec_gby_finalize_group_dim (thread_p, gbstate, NULL);
+      if (gbstate->state == SORT_PUT_STOP)
+	{
+	  /* groupby_num () limit reached; no more groups are output */
+	  break;
+	}
+      else if (gbstate->state != NO_ERROR)
+	{
+	  return gbstate->state;
+	}
+
+      gbstate->input_recs += value->tuple_count + 1;
+    }
+
+  context->hash_size = 0;
+  return mht_clear (context->hash_table, qdata_free_agg_hentry, (void *) thread_p);
+}
+
+/*
+ * qexec_hash_gby_agg_partition () - aggregate the tuples of a spilled partition using the hash table
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   gbstate(in): group by state
+ *   part_list_id(in): closed spilled partition
+ *   depth(in): depth of the partition
+ *   groupby_list(in): see qexec_hash_gby_output_htable
+ *
+ * Note: The hash table is empty when called. Tuples of new groups that do not fit in the hash table are spilled
+ *       again to partitions of the next depth, which are aggregated once the groups of this partition are complete.
+ */
+static int
+qexec_hash_gby_agg_partition (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, QFILE_LIST_ID * part_list_id,
+			      int depth, QFILE_LIST_ID * groupby_list)
+{
+  XASL_STATE *xasl_state = gbstate->xasl_state;
+  BUILDLIST_PROC_NODE *proc = &gbstate->xasl->proc.buildlist;
+  AGGREGATE_HASH_CONTEXT *context = gbstate->agg_hash_context;
+  AGGREGATE_HASH_KEY *key = context->temp_key;
+  AGGREGATE_HASH_KEY *new_key;
+  AGGREGATE_HASH_VALUE *value;
+  QFILE_LIST_ID *sub_parts[HASH_AGGREGATE_SPILL_PARTITIONS];
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tuple_rec = { NULL, 0 };
+  SCAN_CODE scan_code;
+  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE);
+  bool spill = false;
+  int tuple_size, i;
+  int rc = NO_ERROR;
+
+  assert (mht_count (context->hash_table) == 0);
+
+  for (i = 0; i < HASH_AGGREGATE_SPILL_PARTITIONS; i++)
+    {
+      sub_parts[i] = NULL;
+    }
+
+  if (qfile_open_list_scan (part_list_id, &scan_id) != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (rc);
+      return rc;
+    }
+
+  while ((scan_code = qfile_scan_list_next (thread_p, &scan_id, &tuple_rec, PEEK)) == S_SUCCESS)
+    {
+      /* build key */
+      rc = qexec_build_agg_hkey (thread_p, xasl_state, gbstate->g_hk_regu_list, tuple_rec.tpl, key);
+      if (rc != NO_ERROR)
+	{
+	  goto exit;
+	}
+
+      value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
+      if (value != NULL)
+	{
+	  /* aggregate tuple */
+	  value->tuple_count++;
+	  rc = fetch_val_list (thread_p, gbstate->g_regu_list, &xasl_state->vd, NULL, NULL, tuple_rec.tpl, PEEK);
+	  if (rc == NO_ERROR)
+	    {
+	      rc = qdata_evaluate_aggregate_list (thread_p, proc->g_agg_list, &xasl_state->vd, value->accumulators);
+	    }
+	  if (rc != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+
+	  context->hash_size += qdata_get_agg_hvalue_size (value, true);
+	  continue;
+	}
+
+      if (spill)
+	{
+	  rc = qexec_hash_gby_spill_tuple (thread_p, xasl_state, sub_parts, key, depth + 1, tuple_rec.tpl,
+					   &part_list_id->type_list);
+	  if (rc != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+	  continue;
+	}
+
+      /* new group; the tuple is kept as first tuple of the group */
+      new_key = qdata_copy_agg_hkey (thread_p, key);
+      if (new_key == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (rc);
+	  goto exit;
+	}
+
+      value = qdata_alloc_agg_hvalue (thread_p, proc->g_func_count, proc->g_agg_list);
+      if (value == NULL)
+	{
+	  qdata_free_agg_hkey (thread_p, new_key);
+	  ASSERT_ERROR_AND_SET (rc);
+	  goto exit;
+	}
+
+      tuple_size = QFILE_GET_TUPLE_LENGTH (tuple_rec.tpl);
+      value->first_tuple.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, tuple_size);
+      if (value->first_tuple.tpl == NULL)
+	{
+	  qdata_free_agg_hkey (thread_p, new_key);
+	  qdata_free_agg_hvalue (thread_p, value);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) tuple_size);
+	  rc = ER_OUT_OF_VIRTUAL_MEMORY;
+	  goto exit;
+	}
+      memcpy (value->first_tuple.tpl, tuple_rec.tpl, tuple_size);
+      value->first_tuple.size = tuple_size;
+
+      mht_put (context->hash_table, (void *) new_key, (void *) value);
+      context->group_count++;
+      context->hash_size += qdata_get_agg_hkey_size (new_key);
+      context->hash_size += qdata_get_agg_hvalue_size (value, false);
+
+      if (context->hash_size > (int) mem_limit && depth < HASH_AGGREGATE_SPILL_MAX_DEPTH)
+	{
+	  /* hash table is full again; spill the tuples of new groups to the next depth */
+	  spill = true;
+	}
+    }
+
+  if (scan_code == S_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (rc);
+      goto exit;
+    }
+  qfile_close_scan (thread_p, &scan_id);
+
+  /* groups of the partition are complete */
+  rc = qexec_hash_gby_output_htable (thread_p, gbstate, groupby_list);
+  if (rc != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  if (spill)
+    {
+      rc = qexec_hash_gby_agg_partitions (thread_p, gbstate, sub_parts, depth + 1, groupby_list);
+    }
+
+exit:
+  qfile_close_scan (thread_p, &scan_id);
+  for (i = 0; i < HASH_AGGREGATE_SPILL_PARTITIONS; i++)
+    {
+      if (sub_parts[i] != NULL)
+	{
+	  qfile_close_list (thread_p, sub_parts[i]);
+	  qfile_destroy_list (thread_p, sub_parts[i]);
+	  qfile_free_list_id (sub_parts[i]);
+	}
+    }
+
+  return rc;
+}
+
+/*
+ * qexec_hash_gby_agg_partitions () - aggregate spilled partitions one by one
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   gbstate(in): group by state
+ *   parts(in/out): spilled partitions; destroyed as they are aggregated
+ *   depth(in): depth of the partitions
+ *   groupby_list(in): see qexec_hash_gby_output_htable
+ */
+static int
+qexec_hash_gby_agg_partitions (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, QFILE_LIST_ID ** parts, int depth,
+			       QFILE_LIST_ID * groupby_list)
+{
+  int i, rc = NO_ERROR;
+
+  for (i = 0; i < HASH_AGGREGATE_SPILL_PARTITIONS && rc == NO_ERROR; i++)
+    {
+      if (parts[i] == NULL)
+	{
+	  continue;
+	}
+
+      qfile_close_list (thread_p, parts[i]);
+      if (gbstate->state != SORT_PUT_STOP)
+	{
+	  rc = qexec_hash_gby_agg_partition (thread_p, gbstate, parts[i], depth, groupby_list);
+	}
+
+      /* partition is no longer necessary */
+      qfile_destroy_list (thread_p, parts[i]);
+      qfile_free_list_id (parts[i]);
+      parts[i] = NULL;
+    }
+
+  return rc;
+}
+
+/*
+ * qexec_hash_gby_agg_spilled () - complete hash aggregation after tuples were spilled
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   gbstate(in): group by state
+ *   list_id(in): closed list of tuples for sort-based aggregation
+ *
+ * Note: The groups kept in the hash table during the scan are complete, since tuples of other groups were spilled.
+ *       They are output, then each partition is aggregated in turn. When tuples were left for sort-based aggregation
+ *       or the output must follow group order, the groups are written to the unsorted and partial lists instead, so
+ *       that only one tuple per group is sorted.
+ */
+static int
+qexec_hash_gby_agg_spilled (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, QFILE_LIST_ID * list_id)
+{
+  AGGREGATE_HASH_CONTEXT *context = gbstate->agg_hash_context;
+  QFILE_LIST_ID *groupby_list = NULL;
+  int rc;
+
+  if (list_id->tuple_cnt > 0 || context->part_list_id->tuple_cnt > 0
+      || prm_get_bool_value (PRM_ID_AGG_HASH_RESPECT_ORDER))
+    {
+      /* reopen unsorted list to accept the first tuples of groups */
+      rc = qfile_reopen_list_as_append_mode (thread_p, list_id);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+      groupby_list = list_id;
+    }
+
+  rc = qexec_hash_gby_output_htable (thread_p, gbstate, groupby_list);
+  if (rc == NO_ERROR)
+    {
+      rc = qexec_hash_gby_agg_partitions (thread_p, gbstate, context->spill_list_ids, 0, groupby_list);
+    }
+
+  if (groupby_list != NULL)
+    {
+      qfile_close_list (thread_p, groupby_list);
+    }
+
+  return rc;
+}
+
 /*
  * qexec_hash_gby_get_next () - get next tuple in partial list
  *   return: sort status
@@ -4485,6 +4909,15 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
     gbstate.output_file = output_list_id;
   }
 
+  /* aggregate the tuples spilled by the hash table */
+  if (gbstate.hash_eligible && gbstate.agg_hash_context->state == HS_SPILL)
+    {
+      if (qexec_hash_gby_agg_spilled (thread_p, &gbstate, list_id) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
   /* check for quick finalization scenarios */
   if (list_id->tuple_cnt == 0)
     {
@@ -4501,39 +4934,10 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
       else if (gbstate.agg_hash_context->part_list_id->tuple_cnt == 0
 	       && !prm_get_bool_value (PRM_ID_AGG_HASH_RESPECT_ORDER))
 	{
-	  HENTRY_PTR head = gbstate.agg_hash_context->hash_table->act_head;
-	  AGGREGATE_HASH_VALUE *value = NULL;
-
 	  /* empty unsorted list and empty partial list; we can generate the output from the hash table */
-	  while (head)
+	  if (qexec_hash_gby_output_htable (thread_p, &gbstate, NULL) != NO_ERROR)
 	    {
-	      /* load entry into aggregate list */
-	      value = (AGGREGATE_HASH_VALUE *) head->data;
-	      if (value == NULL)
-		{
-		  /* should not happen */
-		  GOTO_EXIT_ON_ERROR;
-		}
-
-	      if (value->first_tuple.tpl == NULL)
-		{
-		  /* empty unsorted list and no first tuple? this should not happen ... */
-		  GOTO_EXIT_ON_ERROR;
-		}
-
-	      /* start new group and aggregate tuple; since unsorted list is empty we don't have rollup groups */
-	      qexec_gby_start_group_dim (thread_p, &gbstate, NULL);
-
-	      /* load values in list and aggregate first tuple */
-	      qdata_load_agg_hvalue_in_agg_list (value, gbstate.g_dim[0].d_agg_list, false);
-	      qexec_gby_agg_tuple (thread_p, &gbstate, value->first_tuple.tpl, PEEK);
-
-	      /* finalize */
-	      qexec_gby_finalize_group_dim (thread_p, &gbstate, NULL);
-
-	      /* next entry */
-	      head = head->act_next;
-	      gbstate.input_recs += value->tuple_count + 1;
+	      GOTO_EXIT_ON_ERROR;
 	    }
 
 	  /* output generated; finalize */
@@ -6537,7 +6941,8 @@ qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST
 					    curr_spec->s.cls_node.num_attrs_rest, curr_spec->s.cls_node.attrids_rest,
 					    curr_spec->s.cls_node.cache_rest, scan_type,
 					    curr_spec->s.cls_node.cache_reserved,
-					    curr_spec->s.cls_node.cls_regu_list_reserved);
+					    curr_spec->s.cls_node.cls_regu_list_reserved,
+					    curr_spec->s.cls_node.parallel_degree);
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
@@ -7668,7 +8073,8 @@ qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
 			     spec->s.cls_node.num_attrs_pred, spec->s.cls_node.attrids_pred,
 			     spec->s.cls_node.cache_pred, spec->s.cls_node.num_attrs_rest,
 			     spec->s.cls_node.attrids_rest, spec->s.cls_node.cache_rest,
-			     scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved);
+			     scan_type, spec->s.cls_node.cache_reserved, spec->s.cls_node.cls_regu_list_reserved,
+			     spec->s.cls_node.parallel_degree);
     }
   else if (spec->type == TARGET_CLASS && spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
     {
@@ -14159,6 +14565,13 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 			  specp->grouped_scan = false;
 			}
 
+		      /* inner scans are restarted for every outer row; starting the workers of a parallel heap scan
+		       * each time would cost more than it saves */
+		      if (level > 0 && specp->type == TARGET_CLASS)
+			{
+			  specp->s.cls_node.parallel_degree = 1;
+			}
+
 		      iscan_oid_order = xptr->iscan_oid_order;
 
 		      /* open the scan for this access specification node */
@@ -19686,6 +20099,9 @@ qexec_initialize_analytic_state (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analy
       analytic_state->key_info.use_original = 1;
       analytic_state->key_info.key = NULL;
       analytic_state->key_info.error = NO_ERROR;
+      analytic_state->key_info.use_prefix = 0;
+      analytic_state->key_info.is_prefix_exact = 0;
+      analytic_state->key_info.prefix_weights = NULL;
     }
 
   /* build function states */
@@ -24756,6 +25172,9 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context->curr_part_value = NULL;
   proc->agg_hash_context->sort_key.key = NULL;
   proc->agg_hash_context->sort_key.nkeys = 0;
+  proc->agg_hash_context->spill_list_ids = NULL;
+  proc->agg_hash_context->spill_tuple.tpl = NULL;
+  proc->agg_hash_context->spill_tuple.size = 0;
 
   /*
    * create temporary dbvalue array
@@ -25051,6 +25470,27 @@ qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc
       proc->agg_hash_context->sorted_part_list_id = NULL;
     }
 
+  /* free spilled partitions */
+  if (proc->agg_hash_context->spill_list_ids != NULL)
+    {
+      for (int i = 0; i < HASH_AGGREGATE_SPILL_PARTITIONS; i++)
+	{
+	  if (proc->agg_hash_context->spill_list_ids[i] != NULL)
+	    {
+	      qfile_close_list (thread_p, proc->agg_hash_context->spill_list_ids[i]);
+	      qfile_destroy_list (thread_p, proc->agg_hash_context->spill_list_ids[i]);
+	      qfile_free_list_id (proc->agg_hash_context->spill_list_ids[i]);
+	    }
+	}
+      db_private_free_and_init (thread_p, proc->agg_hash_context->spill_list_ids);
+    }
+
+  if (proc->agg_hash_context->spill_tuple.tpl != NULL)
+    {
+      db_private_free_and_init (thread_p, proc->agg_hash_context->spill_tuple.tpl);
+      proc->agg_hash_context->spill_tuple.size = 0;
+    }
+
   /* free temp keys and values */
   if (proc->agg_hash_context->temp_key != NULL)
     {
@@ -138,6 +138,9 @@ static int scan_Iscan_oid_buf_list_count = 0;
 
 #define SCAN_ISCAN_OID_BUF_LIST_DEFAULT_SIZE 10
 
+/* maximum number of records a heap scan gets from a page at once */
+#define SCAN_HEAP_BATCH_MAX_RECORDS 256
+
 static void scan_init_scan_pred (SCAN_PRED * scan_pred_p, regu_variable_list_node * regu_list, PRED_EXPR * pred_expr,
 				 PR_EVAL_FNC pr_eval_fnc);
 static void scan_init_scan_attrs (SCAN_ATTRS * scan_attrs_p, int num_attrs, ATTR_ID * attr_ids,
@@ -170,6 +173,11 @@ static int scan_init_index_key_limit (THREAD_ENTRY * thread_p, INDX_SCAN_ID * is
 				      VAL_DESCR * vd);
 static SCAN_CODE scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static int scan_get_parallel_heap_worker_count (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
+					       MVCC_SNAPSHOT * mvcc_snapshot);
+static void scan_end_parallel_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static SCAN_CODE scan_next_heap_batch_record (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp, RECDES * recdes,
+					      int ispeeking);
 static SCAN_CODE scan_next_heap_page_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_class_attr_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
@@ -177,6 +185,7 @@ static SCAN_CODE scan_next_index_key_info_scan (THREAD_ENTRY * thread_p, SCAN_ID
 static SCAN_CODE scan_next_index_node_info_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_index_lookup_heap (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, INDX_SCAN_ID * isidp,
 					      FILTER_INFO * data_filter, TRAN_ISOLATION isolation);
+static void scan_prefetch_index_heap_pages (THREAD_ENTRY * thread_p, INDX_SCAN_ID * isidp);
 static SCAN_CODE scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_showstmt_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_set_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
@@ -2791,6 +2800,7 @@ scan_init_scan_id (SCAN_ID * scan_id, bool mvcc_select_lock_needed, SCAN_OPERATI
  *   cache_rest(in):
  *   cache_recordinfo(in):
  *   regu_list_recordinfo(in):
+ *   parallel_degree(in): degree of parallelism of the scan, 0 to let the server decide
  *
  * Note: If you feel the need
  */
@@ -2804,7 +2814,7 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 		     regu_variable_list_node * regu_list_rest, int num_attrs_pred, ATTR_ID * attrids_pred,
 		     HEAP_CACHE_ATTRINFO * cache_pred, int num_attrs_rest, ATTR_ID * attrids_rest,
 		     HEAP_CACHE_ATTRINFO * cache_rest, SCAN_TYPE scan_type, DB_VALUE ** cache_recordinfo,
-		     regu_variable_list_node * regu_list_recordinfo)
+		     regu_variable_list_node * regu_list_recordinfo, int parallel_degree)
 {
   HEAP_SCAN_ID *hsidp;
   DB_TYPE single_node_type = DB_TYPE_NULL;
@@ -2848,6 +2858,9 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 
   hsidp->cache_recordinfo = cache_recordinfo;
   hsidp->recordinfo_regu_list = regu_list_recordinfo;
+  hsidp->parallel_scanner = NULL;
+  hsidp->parallel_degree = parallel_degree;
+  hsidp->batch_inited = false;
 
   return NO_ERROR;
 }
@@ -3132,6 +3145,8 @@ scan_open_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* initial values */
   isidp->curr_keyno = -1;
   isidp->curr_oidno = -1;
+  isidp->prefetch_oidno = -1;
+  isidp->prefetch_window = 0;
 
   /* OID buffer */
   if (coverage_enabled)
@@ -3996,6 +4011,7 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   regu_variable_list_node *list_node = NULL;
   MVCC_SNAPSHOT *mvcc_snapshot = NULL;
   JSON_TABLE_SCAN_ID *jtidp = NULL;
+  int num_workers;
 
   switch (scan_id->type)
     {
@@ -4031,6 +4047,33 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	      goto exit_on_error;
 	    }
 	  hsidp->scancache_inited = true;
+
+	  num_workers = scan_get_parallel_heap_worker_count (thread_p, scan_id, mvcc_snapshot);
+	  if (num_workers > 0)
+	    {
+	      /* *INDENT-OFF* */
+	      hsidp->parallel_scanner = new PARALLEL_HEAP_SCANNER (hsidp->hfid, hsidp->cls_oid, mvcc_snapshot,
+								    num_workers);
+	      /* *INDENT-ON* */
+	      if (scan_id->qualification == QPROC_QUALIFIED)
+		{
+		  /* let the workers drop the records that do not qualify, if the predicate can be copied for them */
+		  (void) hsidp->parallel_scanner->set_filter (hsidp->scan_pred.pred_expr, hsidp->pred_attrs.num_attrs,
+							      hsidp->pred_attrs.attr_ids, hsidp->pred_attrs.attr_cache,
+							      scan_id->vd);
+		}
+	    }
+	  else if (scan_id->type == S_HEAP_SCAN && !scan_id->mvcc_select_lock_needed
+		   && !mvcc_is_mvcc_disabled_class (&hsidp->cls_oid))
+	    {
+	      /* get the records of a page at once; locking and non-MVCC scans need the page of each object */
+	      ret = heap_scan_batch_start (thread_p, &hsidp->batch, SCAN_HEAP_BATCH_MAX_RECORDS);
+	      if (ret != NO_ERROR)
+		{
+		  goto exit_on_error;
+		}
+	      hsidp->batch_inited = true;
+	    }
 	}
       if (hsidp->caches_inited != true)
 	{
@@ -4178,6 +4221,8 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       isidp->oids_count = 0;
       isidp->curr_keyno = -1;
       isidp->curr_oidno = -1;
+      isidp->prefetch_oidno = -1;
+      isidp->prefetch_window = 0;
       isidp->one_range = false;
       break;
 
@@ -4304,6 +4349,15 @@ scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id)
 	{
 	  s_id->position = (s_id->direction == S_FORWARD) ? S_BEFORE : S_AFTER;
 	  OID_SET_NULL (&s_id->s.hsid.curr_oid);
+	  if (s_id->s.hsid.batch_inited)
+	    {
+	      heap_scan_batch_reset (&s_id->s.hsid.batch);
+	    }
+	  if (s_id->s.hsid.parallel_scanner != NULL)
+	    {
+	      /* the next scan restarts from the beginning */
+	      s_id->s.hsid.parallel_scanner->end (*thread_p);
+	    }
 	}
       break;
 
@@ -4604,6 +4658,18 @@ scan_end_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    {
 	      (void) heap_scancache_end (thread_p, &hsidp->scan_cache);
 	    }
+	  if (hsidp->batch_inited)
+	    {
+	      heap_scan_batch_end (thread_p, &hsidp->batch);
+	      hsidp->batch_inited = false;
+	    }
+	}
+
+      if (hsidp->parallel_scanner != NULL)
+	{
+	  /* parallel scans have no order; keep scanning forward */
+	  scan_end_parallel_heap_scan (thread_p, scan_id);
+	  break;
 	}
 
       /* switch scan direction for further iterations */
@@ -4702,6 +4768,18 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
     {
     case S_HEAP_SCAN:
     case S_HEAP_SCAN_RECORD_INFO:
+      if (scan_id->s.hsid.parallel_scanner != NULL)
+	{
+	  /* the scan was not ended (e.g. on error) */
+	  scan_end_parallel_heap_scan (thread_p, scan_id);
+	}
+      if (scan_id->s.hsid.batch_inited)
+	{
+	  heap_scan_batch_end (thread_p, &scan_id->s.hsid.batch);
+	  scan_id->s.hsid.batch_inited = false;
+	}
+      break;
+
     case S_HEAP_PAGE_SCAN:
     case S_CLASS_ATTR_SCAN:
     case S_VALUES_SCAN:
@@ -5066,6 +5144,104 @@ typedef enum
   OBJ_REPEAT_GET_WITH_LOCK = 1,
   OBJ_GET_WITH_LOCK_COMPLETE = 2
 } OBJECT_GET_STATUS;
+/*
+ * scan_get_parallel_heap_worker_count () - get the number of workers to scan the heap in parallel
+ *   return: number of workers besides the scan thread, 0 to scan serially
+ *   scan_id(in): heap scan identifier
+ *   mvcc_snapshot(in): snapshot of the scan
+ *
+ * Note: Only plain forward selects are scanned in parallel. Rows are returned in no particular order and are copies,
+ *       so grouped (fixed) scans, scans locking rows and scans of classes without MVCC keep the serial heap scan.
+ *       A degree of parallelism set by the optimizer (PARALLEL hint or parallel_query_degree) overrides
+ *       parallel_heap_scan_threads; degree 1 always scans serially.
+ */
+static int
+scan_get_parallel_heap_worker_count (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, MVCC_SNAPSHOT * mvcc_snapshot)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  int npages;
+
+  if (hsidp->parallel_degree == 1
+      || (hsidp->parallel_degree <= 0 && prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_THREADS) <= 0))
+    {
+      return 0;
+    }
+
+  if (scan_id->type != S_HEAP_SCAN || scan_id->grouped || scan_id->direction != S_FORWARD
+      || scan_id->scan_op_type != S_SELECT || scan_id->mvcc_select_lock_needed || mvcc_snapshot == NULL
+      || mvcc_is_mvcc_disabled_class (&hsidp->cls_oid))
+    {
+      return 0;
+    }
+
+  if (file_get_num_user_pages (thread_p, &hsidp->hfid.vfid, &npages) != NO_ERROR)
+    {
+      /* scan serially */
+      er_clear ();
+      return 0;
+    }
+
+  /* *INDENT-OFF* */
+  return cubscan::parallel_heap::get_worker_count (npages, hsidp->parallel_degree);
+  /* *INDENT-ON* */
+}
+
+/*
+ * scan_end_parallel_heap_scan () - stop the workers of a parallel heap scan and keep their statistics
+ *   return:
+ *   scan_id(in/out): heap scan identifier
+ */
+static void
+scan_end_parallel_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+
+  assert (hsidp->parallel_scanner != NULL);
+
+  hsidp->parallel_scanner->end (*thread_p);
+  scan_id->scan_stats.read_rows += hsidp->parallel_scanner->get_read_rows ();
+  hsidp->parallel_scanner->get_stats (scan_id->scan_stats.parallel_heap);
+
+  delete hsidp->parallel_scanner;
+  hsidp->parallel_scanner = NULL;
+}
+
+/*
+ * scan_next_heap_batch_record () - get the next record of the heap from the batch of the scan
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   hsidp(in/out): heap scan identifier
+ *   recdes(out): record of hsidp->curr_oid
+ *   ispeeking(in): PEEK or COPY
+ *
+ * Note: the batch is refilled with the next page once all its records are consumed. It is refilled from curr_oid
+ *       when the scan restarts the current record with a copy or its page is no longer fixed.
+ */
+static SCAN_CODE
+scan_next_heap_batch_record (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp, RECDES * recdes, int ispeeking)
+{
+  HEAP_SCAN_BATCH *batch = &hsidp->batch;
+  SCAN_CODE sp_scan;
+
+  /* the scan may have moved back to re-evaluate the current record, or the page of the peeked records was released */
+  (void) heap_scan_batch_resync (batch, &hsidp->curr_oid, &hsidp->scan_cache);
+
+  if (batch->current + 1 >= batch->n_records)
+    {
+      sp_scan = heap_next_batch (thread_p, &hsidp->hfid, &hsidp->cls_oid, batch, &hsidp->scan_cache, ispeeking);
+      if (sp_scan != S_SUCCESS)
+	{
+	  OID_SET_NULL (&hsidp->curr_oid);
+	  return sp_scan;
+	}
+    }
+
+  batch->current++;
+  COPY_OID (&hsidp->curr_oid, &batch->oids[batch->current]);
+  *recdes = batch->recdes[batch->current];
+
+  return S_SUCCESS;
+}
+
 /*
  * scan_next_heap_scan () - The scan is moved to the next heap scan item.
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
@@ -5078,6 +5254,7 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 {
   HEAP_SCAN_ID *hsidp;
   FILTER_INFO data_filter;
+  SCAN_PRED filtered_pred;
   RECDES recdes = RECDES_INITIALIZER;
   SCAN_CODE sp_scan;
   DB_LOGICAL ev_res;
@@ -5104,6 +5281,13 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   /* set data filter information */
   scan_init_filter_info (&data_filter, &hsidp->scan_pred, &hsidp->pred_attrs, scan_id->val_list, scan_id->vd,
 			 &hsidp->cls_oid, 0, NULL, NULL, NULL);
+  if (hsidp->parallel_scanner != NULL && hsidp->parallel_scanner->has_filter ())
+    {
+      /* the parallel scanner returns only qualified records; just read the values of the predicate */
+      assert (scan_id->qualification == QPROC_QUALIFIED);
+      scan_init_scan_pred (&filtered_pred, hsidp->scan_pred.regu_list, NULL, NULL);
+      data_filter.scan_pred = &filtered_pred;
+    }
 
   is_peeking = scan_id->fixed;
   if (scan_id->grouped)
@@ -5141,7 +5325,16 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  if (scan_id->direction == S_FORWARD)
 	    {
 	      /* move forward */
-	      if (scan_id->type == S_HEAP_SCAN)
+	      if (hsidp->parallel_scanner != NULL)
+		{
+		  /* records are copied by the scanner */
+		  sp_scan = hsidp->parallel_scanner->next (*thread_p, hsidp->curr_oid, recdes);
+		}
+	      else if (hsidp->batch_inited)
+		{
+		  sp_scan = scan_next_heap_batch_record (thread_p, hsidp, &recdes, is_peeking);
+		}
+	      else if (scan_id->type == S_HEAP_SCAN)
 		{
 		  sp_scan =
 		    heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes, &hsidp->scan_cache,
@@ -5186,7 +5379,11 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	}
 
       /* evaluate the predicates to see if the object qualifies */
-      scan_id->scan_stats.read_rows++;
+      if (hsidp->parallel_scanner == NULL)
+	{
+	  /* the rows read by a parallel scan are counted by its threads */
+	  scan_id->scan_stats.read_rows++;
+	}
 
       ev_res = eval_data_filter (thread_p, p_current_oid, &recdes, &hsidp->scan_cache, &data_filter);
       if (ev_res == V_ERROR)
@@ -5879,6 +6076,8 @@ scan_next_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  assert (isidp->curr_oidp != NULL);
 	  assert (HEAP_ISVALID_OID (thread_p, isidp->curr_oidp) != DISK_INVALID);
 
+	  scan_prefetch_index_heap_pages (thread_p, isidp);
+
 	  if (thread_is_on_trace (thread_p))
 	    {
 	      tsc_getticks (&start_tick);
@@ -5953,6 +6152,59 @@ scan_next_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
     }
 }
 
+/*
+ * scan_prefetch_index_heap_pages () - request the heap pages of the next oids of an index scan
+ *   return:
+ *   isidp(in/out): Index scan identifier
+ *
+ * Note: The number of oids looked ahead starts at one and grows with every oid read, up to
+ *       index_scan_prefetch_max_pages, so that short lookups do not load pages they never read. Consecutive oids of
+ *       the same page request it once.
+ */
+static void
+scan_prefetch_index_heap_pages (THREAD_ENTRY * thread_p, INDX_SCAN_ID * isidp)
+{
+  int max_window;
+  int last_oidno;
+  OID *oidp;
+  VPID vpid, prev_vpid;
+
+  max_window = prm_get_integer_value (PRM_ID_INDEX_SCAN_PREFETCH_MAX_PAGES);
+  if (max_window <= 0 || isidp->oid_list == NULL || isidp->oid_list->oidp == NULL || isidp->curr_oidno < 0)
+    {
+      return;
+    }
+
+  if (isidp->curr_oidno == 0 || isidp->prefetch_oidno < isidp->curr_oidno)
+    {
+      /* new oids were read from index or the scan went past the requested oids */
+      isidp->prefetch_oidno = isidp->curr_oidno;
+    }
+  if (isidp->prefetch_window < max_window)
+    {
+      isidp->prefetch_window++;
+    }
+  last_oidno = MIN (isidp->curr_oidno + isidp->prefetch_window, isidp->oids_count - 1);
+
+  oidp = GET_NTH_OID (isidp->oid_list->oidp, isidp->prefetch_oidno);
+  VPID_SET (&prev_vpid, oidp->volid, oidp->pageid);
+  while (isidp->prefetch_oidno < last_oidno)
+    {
+      oidp = GET_NTH_OID (isidp->oid_list->oidp, isidp->prefetch_oidno + 1);
+      VPID_SET (&vpid, oidp->volid, oidp->pageid);
+      if (!VPID_EQ (&vpid, &prev_vpid))
+	{
+	  if (!pgbuf_prefetch_page (thread_p, &vpid))
+	    {
+	      /* try again with next oid */
+	      break;
+	    }
+	  prev_vpid = vpid;
+	}
+      isidp->prefetch_oidno++;
+    }
+}
+
 /*
  * scan_next_index_lookup_heap () - fetch heap record and evaluate data filter
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR, S_DOESNT_EXIST)
@@ -7585,6 +7837,21 @@ scan_print_stats_json (SCAN_ID * scan_id, json_t * scan_stats)
 
       if (scan_id->type == S_HEAP_SCAN)
 	{
+	  if (scan_id->scan_stats.parallel_heap.num_workers > 0)
+	    {
+	      PARALLEL_HEAP_SCAN_STATS *parallel_stats = &scan_id->scan_stats.parallel_heap;
+	      json_t *parallel = json_array ();
+	      int i;
+
+	      for (i = 0; i < parallel_stats->num_workers; i++)
+		{
+		  json_array_append_new (parallel, json_pack ("{s:i, s:i, s:i}", "time",
+							      TO_MSEC (parallel_stats->workers[i].elapsed), "pages",
+							      parallel_stats->workers[i].read_pages, "readrows",
+							      parallel_stats->workers[i].read_rows));
+		}
+	      json_object_set_new (scan, "parallel", parallel);
+	    }
 	  json_object_set_new (scan_stats, "heap", scan);
 	}
       else
@@ -7715,7 +7982,20 @@ scan_print_stats_text (FILE * fp, SCAN_ID * scan_id)
     {
     case S_HEAP_SCAN:
     case S_LIST_SCAN:
-      fprintf (fp, ", readrows: %d, rows: %d)", scan_id->scan_stats.read_rows, scan_id->scan_stats.qualified_rows);
+      fprintf (fp, ", readrows: %d, rows: %d", scan_id->scan_stats.read_rows, scan_id->scan_stats.qualified_rows);
+      if (scan_id->type == S_HEAP_SCAN && scan_id->scan_stats.parallel_heap.num_workers > 0)
+	{
+	  PARALLEL_HEAP_SCAN_STATS *parallel_stats = &scan_id->scan_stats.parallel_heap;
+	  int i;
+
+	  fprintf (fp, ", parallel:");
+	  for (i = 0; i < parallel_stats->num_workers; i++)
+	    {
+	      fprintf (fp, " [%d] time: %d, pages: %d, readrows: %d", i, TO_MSEC (parallel_stats->workers[i].elapsed),
+		       parallel_stats->workers[i].read_pages, parallel_stats->workers[i].read_rows);
+	    }
+	}
+      fprintf (fp, ")");
       break;
 
     case S_INDX_SCAN:
@@ -43,6 +43,7 @@
 #include "query_list.h"
 #include "access_json_table.hpp"
 #include "scan_json_table.hpp"
+#include "scan_parallel_heap.hpp"
 #include "storage_common.h"	/* for PAGEID */
 #include "query_hash_scan.h"
 
@@ -105,8 +106,12 @@ struct heap_scan_id
   bool caches_inited;		/* are the caches initialized?? */
   bool scancache_inited;
   bool scanrange_inited;
+  bool batch_inited;
+  HEAP_SCAN_BATCH batch;	/* visible records of the current heap page */
   DB_VALUE **cache_recordinfo;	/* cache for record information */
   regu_variable_list_node *recordinfo_regu_list;	/* regulator variable list for record info */
+  PARALLEL_HEAP_SCANNER *parallel_scanner;	/* not NULL while the heap is scanned in parallel */
+  int parallel_degree;		/* degree of parallelism chosen by the optimizer, 0 if left to the server */
 };				/* Regular Heap File Scan Identifier */
 
 typedef struct heap_page_scan_id HEAP_PAGE_SCAN_ID;
@@ -197,6 +202,8 @@ struct indx_scan_id
   int curr_keyno;		/* current key number */
   int curr_oidno;		/* current oid number */
   OID *curr_oidp;		/* current oid pointer */
+  int prefetch_oidno;		/* heap pages of oids up to this number were requested */
+  int prefetch_window;		/* number of oids looked ahead for heap page prefetch */
   char *copy_buf;		/* index key copy_buf pointer info */
   BTREE_ISCAN_OID_LIST *oid_list;	/* list of object OID's */
   int oids_count;		/* Generic value of OID count that should be common for all index scan types. */
@@ -323,6 +330,9 @@ struct scan_stats
 
   /* hash list scan */
   struct timeval elapsed_hash_build;
+
+  /* parallel heap scan */
+  PARALLEL_HEAP_SCAN_STATS parallel_heap;	/* per thread statistics; num_workers is 0 for serial scans */
 };
 
 typedef struct scan_id_struct SCAN_ID;
@@ -384,7 +394,7 @@ extern int scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 				int num_attrs_pred, ATTR_ID * attrids_pred, HEAP_CACHE_ATTRINFO * cache_pred,
 				int num_attrs_rest, ATTR_ID * attrids_rest, HEAP_CACHE_ATTRINFO * cache_rest,
 				SCAN_TYPE scan_type, DB_VALUE ** cache_recordinfo,
-				regu_variable_list_node * regu_list_recordinfo);
+				regu_variable_list_node * regu_list_recordinfo, int parallel_degree);
 extern int scan_open_heap_page_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, val_list_node * val_list,
 				     val_descr * vd, OID * cls_oid, HFID * hfid, PRED_EXPR * pr, SCAN_TYPE scan_type,
 				     DB_VALUE ** cache_page_info, regu_variable_list_node * regu_list_page_info);
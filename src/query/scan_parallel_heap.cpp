@@ -0,0 +1,757 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// scan_parallel_heap.cpp - implementation of parallel heap scanning
+//
+
+#include "scan_parallel_heap.hpp"
+
+#include "dbtype.h"
+#include "error_manager.h"
+#include "memory_alloc.h"
+#include "object_domain.h"
+#include "object_primitive.h"
+#include "query_evaluator.h"
+#include "query_executor.h"
+#include "regu_var.hpp"
+#include "system_parameter.h"
+#include "thread_entry.hpp"
+#include "tsc_timer.h"
+#include "xasl_predicate.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace cubscan
+{
+  namespace parallel_heap
+  {
+    static bool can_copy_pred (const PRED_EXPR *pred, const HEAP_CACHE_ATTRINFO *attr_cache, const val_descr *vd);
+    static bool can_copy_regu (const REGU_VARIABLE *regu, const HEAP_CACHE_ATTRINFO *attr_cache, const val_descr *vd);
+
+    //
+    // scan_batch
+    //
+    struct scan_batch
+    {
+      std::vector<OID> m_oids;
+      std::vector<std::size_t> m_offsets;
+      std::vector<int> m_lengths;
+      std::vector<char> m_data;
+      std::size_t m_position;       // next record to consume
+
+      scan_batch ()
+	: m_oids ()
+	, m_offsets ()
+	, m_lengths ()
+	, m_data ()
+	, m_position (0)
+      {
+      }
+
+      void clear ()
+      {
+	m_oids.clear ();
+	m_offsets.clear ();
+	m_lengths.clear ();
+	m_data.clear ();
+	m_position = 0;
+      }
+
+      void append (const OID &oid, const RECDES &recdes)
+      {
+	// keep records aligned like in heap pages
+	std::size_t offset = DB_ALIGN (m_data.size (), MAX_ALIGNMENT);
+
+	m_data.resize (offset + recdes.length);
+	std::memcpy (m_data.data () + offset, recdes.data, recdes.length);
+	m_oids.push_back (oid);
+	m_offsets.push_back (offset);
+	m_lengths.push_back (recdes.length);
+      }
+
+      bool has_next () const
+      {
+	return m_position < m_oids.size ();
+      }
+
+      void get_next (OID &oid, RECDES &recdes)
+      {
+	oid = m_oids[m_position];
+	recdes.data = m_data.data () + m_offsets[m_position];
+	recdes.length = m_lengths[m_position];
+	recdes.area_size = m_lengths[m_position];
+	recdes.type = REC_HOME;
+	m_position++;
+      }
+    };
+
+    //
+    // filter
+    //
+    // the nodes of the copy are allocated on the heap, but the values read or computed by a thread are allocated by
+    // its private allocator; the thread using the filter must prepare and release it.
+    //
+    struct scanner::filter
+    {
+      PRED_EXPR *m_pred;
+      PR_EVAL_FNC m_eval_fnc;
+      HEAP_CACHE_ATTRINFO m_attr_cache;
+      bool m_attr_cache_inited;
+      std::vector<PRED_EXPR *> m_pred_nodes;
+      std::vector<REGU_VARIABLE *> m_regu_nodes;
+      std::vector<ARITH_TYPE *> m_arith_nodes;
+      std::vector<DB_VALUE *> m_values;           // results of arithmetic nodes
+
+      filter (const PRED_EXPR &pred)
+	: m_pred (NULL)
+	, m_eval_fnc (NULL)
+	, m_attr_cache ()
+	, m_attr_cache_inited (false)
+	, m_pred_nodes ()
+	, m_regu_nodes ()
+	, m_arith_nodes ()
+	, m_values ()
+      {
+	DB_TYPE single_node_type = DB_TYPE_NULL;
+
+	m_pred = copy_pred (&pred);
+	m_eval_fnc = eval_fnc (NULL, m_pred, &single_node_type);
+      }
+
+      ~filter ()
+      {
+	assert (!m_attr_cache_inited);
+
+	for (PRED_EXPR *node : m_pred_nodes)
+	  {
+	    delete node;
+	  }
+	for (REGU_VARIABLE *node : m_regu_nodes)
+	  {
+	    delete node;
+	  }
+	for (ARITH_TYPE *node : m_arith_nodes)
+	  {
+	    delete node;
+	  }
+	for (DB_VALUE *value : m_values)
+	  {
+	    delete value;
+	  }
+      }
+
+      int prepare (cubthread::entry &thread_ref, const OID &cls_oid, int num_attrs, const ATTR_ID *attr_ids)
+      {
+	int error_code;
+
+	error_code = heap_attrinfo_start (&thread_ref, &cls_oid, num_attrs, attr_ids, &m_attr_cache);
+	if (error_code != NO_ERROR)
+	  {
+	    ASSERT_ERROR ();
+	    return error_code;
+	  }
+	m_attr_cache_inited = true;
+	return NO_ERROR;
+      }
+
+      void release (cubthread::entry &thread_ref)
+      {
+	for (DB_VALUE *value : m_values)
+	  {
+	    pr_clear_value (value);
+	  }
+	if (m_attr_cache_inited)
+	  {
+	    heap_attrinfo_end (&thread_ref, &m_attr_cache);
+	    m_attr_cache_inited = false;
+	  }
+      }
+
+      DB_LOGICAL evaluate (cubthread::entry &thread_ref, OID &oid, RECDES &recdes, val_descr *vd)
+      {
+	assert (m_attr_cache_inited);
+
+	if (heap_attrinfo_read_dbvalues_lazy (&thread_ref, &oid, &recdes, &m_attr_cache) != NO_ERROR)
+	  {
+	    return V_ERROR;
+	  }
+	return (*m_eval_fnc) (&thread_ref, m_pred, vd, &oid);
+      }
+
+      // the copy functions expect nodes accepted by can_copy_pred
+      PRED_EXPR *copy_pred (const PRED_EXPR *src)
+      {
+	PRED_EXPR *dest;
+
+	if (src == NULL)
+	  {
+	    return NULL;
+	  }
+
+	dest = new PRED_EXPR (*src);
+	m_pred_nodes.push_back (dest);
+
+	switch (src->type)
+	  {
+	  case T_PRED:
+	    dest->pe.m_pred.lhs = copy_pred (src->pe.m_pred.lhs);
+	    dest->pe.m_pred.rhs = copy_pred (src->pe.m_pred.rhs);
+	    break;
+
+	  case T_NOT_TERM:
+	    dest->pe.m_not_term = copy_pred (src->pe.m_not_term);
+	    break;
+
+	  case T_EVAL_TERM:
+	    if (src->pe.m_eval_term.et_type == T_COMP_EVAL_TERM)
+	      {
+		dest->pe.m_eval_term.et.et_comp.lhs = copy_regu (src->pe.m_eval_term.et.et_comp.lhs);
+		dest->pe.m_eval_term.et.et_comp.rhs = copy_regu (src->pe.m_eval_term.et.et_comp.rhs);
+	      }
+	    else
+	      {
+		assert (src->pe.m_eval_term.et_type == T_LIKE_EVAL_TERM);
+		dest->pe.m_eval_term.et.et_like.src = copy_regu (src->pe.m_eval_term.et.et_like.src);
+		dest->pe.m_eval_term.et.et_like.pattern = copy_regu (src->pe.m_eval_term.et.et_like.pattern);
+		dest->pe.m_eval_term.et.et_like.esc_char = copy_regu (src->pe.m_eval_term.et.et_like.esc_char);
+	      }
+	    break;
+
+	  default:
+	    assert (false);
+	    break;
+	  }
+
+	return dest;
+      }
+
+      REGU_VARIABLE *copy_regu (const REGU_VARIABLE *src)
+      {
+	REGU_VARIABLE *dest;
+
+	if (src == NULL)
+	  {
+	    return NULL;
+	  }
+
+	dest = new REGU_VARIABLE (*src);
+	m_regu_nodes.push_back (dest);
+
+	// the first fetch of the copy finds out again whether it is constant
+	REGU_VARIABLE_CLEAR_FLAG (dest, REGU_VARIABLE_FETCH_ALL_CONST);
+	REGU_VARIABLE_CLEAR_FLAG (dest, REGU_VARIABLE_FETCH_NOT_CONST);
+	dest->vfetch_to = NULL;
+
+	switch (src->type)
+	  {
+	  case TYPE_ATTR_ID:
+	    dest->value.attr_descr.cache_attrinfo = &m_attr_cache;
+	    dest->value.attr_descr.cache_dbvalp = NULL;
+	    break;
+
+	  case TYPE_INARITH:
+	  case TYPE_OUTARITH:
+	    dest->value.arithptr = copy_arith (src->value.arithptr);
+	    break;
+
+	  default:
+	    // constants and host variables are only read
+	    break;
+	  }
+
+	return dest;
+      }
+
+      ARITH_TYPE *copy_arith (const ARITH_TYPE *src)
+      {
+	ARITH_TYPE *dest = new ARITH_TYPE (*src);
+
+	m_arith_nodes.push_back (dest);
+
+	dest->value = new DB_VALUE;
+	db_make_null (dest->value);
+	m_values.push_back (dest->value);
+
+	dest->leftptr = copy_regu (src->leftptr);
+	dest->rightptr = copy_regu (src->rightptr);
+	dest->thirdptr = copy_regu (src->thirdptr);
+	dest->pred = NULL;
+	dest->rand_seed = NULL;
+
+	return dest;
+      }
+    };
+
+    //
+    // scanner
+    //
+    scanner::scanner (const HFID &hfid, const OID &cls_oid, MVCC_SNAPSHOT *mvcc_snapshot, int worker_count)
+      : m_hfid (hfid)
+      , m_cls_oid (cls_oid)
+      , m_mvcc_snapshot (mvcc_snapshot)
+      , m_worker_count (std::min (worker_count, MAX_WORKERS))
+      , m_started (false)
+      , m_scan_cache ()
+      , m_scan_cache_inited (false)
+      , m_filter_pred (NULL)
+      , m_filter_num_attrs (0)
+      , m_filter_attr_ids (NULL)
+      , m_vd (NULL)
+      , m_filters ()
+      , m_batch (NULL)
+      , m_stats ()
+    {
+    }
+
+    scanner::~scanner ()
+    {
+      assert (!m_started);
+    }
+
+    bool
+    scanner::set_filter (PRED_EXPR *pred, int num_attrs, ATTR_ID *attr_ids, HEAP_CACHE_ATTRINFO *attr_cache,
+			 val_descr *vd)
+    {
+      assert (!m_started);
+
+      if (pred == NULL || !can_copy_pred (pred, attr_cache, vd))
+	{
+	  return false;
+	}
+
+      m_filter_pred = pred;
+      m_filter_num_attrs = num_attrs;
+      m_filter_attr_ids = attr_ids;
+      m_vd = vd;
+      return true;
+    }
+
+    bool
+    scanner::has_filter () const
+    {
+      return m_filter_pred != NULL;
+    }
+
+    int
+    scanner::start (cubthread::entry &thread_ref)
+    {
+      int worker_count;
+      int error_code;
+
+      assert (!m_started);
+
+      error_code = m_ranges.collect (thread_ref, &m_hfid, 1);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+
+      error_code = heap_scancache_start (&thread_ref, &m_scan_cache, &m_hfid, &m_cls_oid, true, false,
+					 m_mvcc_snapshot);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+      m_scan_cache_inited = true;
+
+      // the scan thread takes part in the scan
+      worker_count = get_worker_limit (m_worker_count);
+
+      if (m_filter_pred != NULL)
+	{
+	  // copy the filter for each thread before any worker runs; nobody else evaluates the original
+	  for (int i = 0; i <= worker_count; i++)
+	    {
+	      m_filters.push_back (new filter (*m_filter_pred));
+	    }
+	  error_code = m_filters[0]->prepare (thread_ref, m_cls_oid, m_filter_num_attrs, m_filter_attr_ids);
+	  if (error_code != NO_ERROR)
+	    {
+	      for (filter *filt : m_filters)
+		{
+		  delete filt;
+		}
+	      m_filters.clear ();
+	      (void) heap_scancache_end (&thread_ref, &m_scan_cache);
+	      m_scan_cache_inited = false;
+	      m_ranges.clear ();
+	      return error_code;
+	    }
+	}
+
+      m_started = true;
+      m_stats.num_workers = std::max (m_stats.num_workers, worker_count + 1);
+
+      // workers read as the transaction of the scan thread (MVCC checks of own changes)
+      (void) start_producers (thread_ref, worker_count, thread_ref.tran_index);
+
+      return NO_ERROR;
+    }
+
+    void
+    scanner::end (cubthread::entry &thread_ref)
+    {
+      if (!m_started)
+	{
+	  return;
+	}
+
+      end_producers ();
+      m_batch = NULL;
+
+      if (m_scan_cache_inited)
+	{
+	  (void) heap_scancache_end (&thread_ref, &m_scan_cache);
+	  m_scan_cache_inited = false;
+	}
+      if (!m_filters.empty ())
+	{
+	  // workers released their copies
+	  m_filters[0]->release (thread_ref);
+	  for (filter *filt : m_filters)
+	    {
+	      delete filt;
+	    }
+	  m_filters.clear ();
+	}
+      m_ranges.clear ();
+      m_started = false;
+    }
+
+    SCAN_CODE
+    scanner::next (cubthread::entry &thread_ref, OID &oid, RECDES &recdes)
+    {
+      filter *filt;
+
+      if (!m_started && start (thread_ref) != NO_ERROR)
+	{
+	  return S_ERROR;
+	}
+
+      filt = m_filters.empty () ? NULL : m_filters[0];
+      // when no batch is ready, a range is scanned on this thread
+      auto produce_range = [&] (const cubheap::page_ranges::range &range, scan_batch &records)
+      {
+	return scan_range (thread_ref, m_scan_cache, filt, range, records, m_stats.workers[0]);
+      };
+
+      while (m_batch == NULL || !m_batch->has_next ())
+	{
+	  if (next_batch (m_batch, produce_range) != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return S_ERROR;
+	    }
+	  if (m_batch == NULL)
+	    {
+	      return S_END;
+	    }
+	}
+
+      m_batch->get_next (oid, recdes);
+      return S_SUCCESS;
+    }
+
+    void
+    scanner::execute_worker (cubthread::entry &thread_ref, int worker_index)
+    {
+      HEAP_SCANCACHE scan_cache;
+      worker_stats &wstats = m_stats.workers[worker_index];
+      filter *filt = m_filters.empty () ? NULL : m_filters[worker_index];
+      auto produce_range = [&] (const cubheap::page_ranges::range &range, scan_batch &records)
+      {
+	return scan_range (thread_ref, scan_cache, filt, range, records, wstats);
+      };
+
+      if (filt != NULL && filt->prepare (thread_ref, m_cls_oid, m_filter_num_attrs, m_filter_attr_ids) != NO_ERROR)
+	{
+	  set_error ();
+	}
+      else if (heap_scancache_start (&thread_ref, &scan_cache, &m_hfid, &m_cls_oid, true, false, m_mvcc_snapshot)
+	       != NO_ERROR)
+	{
+	  set_error ();
+	}
+      else
+	{
+	  produce_batches (produce_range);
+	  (void) heap_scancache_end (&thread_ref, &scan_cache);
+	}
+      if (filt != NULL)
+	{
+	  filt->release (thread_ref);
+	}
+    }
+
+    int
+    scanner::scan_range (cubthread::entry &thread_ref, HEAP_SCANCACHE &scan_cache, filter *filt,
+			 const cubheap::page_ranges::range &range, scan_batch &records, worker_stats &wstats)
+    {
+      TSC_TICKS start_tick, end_tick;
+      TSCTIMEVAL tv_diff;
+      RECDES recdes;
+      OID oid;
+      SCAN_CODE sc;
+      DB_LOGICAL ev_res;
+      bool continue_checking = true;
+      int error_code = NO_ERROR;
+
+      tsc_getticks (&start_tick);
+
+      for (std::size_t i = range.first; i < range.last && !is_stopped (); i++)
+	{
+	  if (is_interrupted (thread_ref, continue_checking))
+	    {
+	      error_code = ER_INTERRUPTED;
+	      break;
+	    }
+
+	  const VPID &vpid = m_ranges.get_page (range.heap_index, i);
+
+	  oid.volid = vpid.volid;
+	  oid.pageid = vpid.pageid;
+	  oid.slotid = NULL_SLOTID;
+	  while (true)
+	    {
+	      recdes.data = NULL;
+	      sc = heap_next_in_page (&thread_ref, &vpid, &m_cls_oid, &oid, &recdes, &scan_cache, PEEK);
+	      if (sc != S_SUCCESS)
+		{
+		  break;
+		}
+	      wstats.read_rows++;
+
+	      if (filt != NULL)
+		{
+		  // the record is still peeked
+		  ev_res = filt->evaluate (thread_ref, oid, recdes, m_vd);
+		  if (ev_res == V_ERROR)
+		    {
+		      sc = S_ERROR;
+		      break;
+		    }
+		  if (ev_res != V_TRUE)
+		    {
+		      continue;
+		    }
+		}
+	      records.append (oid, recdes);
+	    }
+	  if (sc != S_END)
+	    {
+	      ASSERT_ERROR_AND_SET (error_code);
+	      break;
+	    }
+	  wstats.read_pages++;
+	}
+
+      tsc_getticks (&end_tick);
+      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+      TSC_ADD_TIMEVAL (wstats.elapsed, tv_diff);
+
+      return error_code;
+    }
+
+    int
+    scanner::get_read_rows () const
+    {
+      int read_rows = 0;
+
+      for (int i = 0; i < m_stats.num_workers; i++)
+	{
+	  read_rows += m_stats.workers[i].read_rows;
+	}
+      return read_rows;
+    }
+
+    void
+    scanner::get_stats (stats &stats_out) const
+    {
+      stats_out.num_workers = std::max (stats_out.num_workers, m_stats.num_workers);
+      for (int i = 0; i < m_stats.num_workers; i++)
+	{
+	  stats_out.workers[i].read_pages += m_stats.workers[i].read_pages;
+	  stats_out.workers[i].read_rows += m_stats.workers[i].read_rows;
+	  TSC_ADD_TIMEVAL (stats_out.workers[i].elapsed, m_stats.workers[i].elapsed);
+	}
+    }
+
+    int
+    get_worker_count (int npages, int degree)
+    {
+#if defined (SERVER_MODE)
+      int worker_count = prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_THREADS);
+
+      if (degree > 0)
+	{
+	  // the scan thread is one of the degree
+	  worker_count = degree - 1;
+	}
+
+      if (worker_count <= 0 || npages < prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_MIN_PAGES))
+	{
+	  return 0;
+	}
+      return std::min (worker_count, MAX_WORKERS);
+#else // not SERVER_MODE = SA_MODE
+      // workers would run on the scan thread
+      return 0;
+#endif // not SERVER_MODE = SA_MODE
+    }
+
+    //
+    // filter copies
+    //
+    // only predicates reading the attributes of the scanned class, constants and host variables are copied. terms
+    // on collections, subqueries, correlated values and functions depending on the session, the transaction or a
+    // random generator stay on the scan thread.
+    //
+    static bool
+    can_copy_pred (const PRED_EXPR *pred, const HEAP_CACHE_ATTRINFO *attr_cache, const val_descr *vd)
+    {
+      const EVAL_TERM *et;
+
+      if (pred == NULL)
+	{
+	  return true;
+	}
+
+      switch (pred->type)
+	{
+	case T_PRED:
+	  return (can_copy_pred (pred->pe.m_pred.lhs, attr_cache, vd)
+		  && can_copy_pred (pred->pe.m_pred.rhs, attr_cache, vd));
+
+	case T_NOT_TERM:
+	  return can_copy_pred (pred->pe.m_not_term, attr_cache, vd);
+
+	case T_EVAL_TERM:
+	  et = &pred->pe.m_eval_term;
+	  if (et->et_type == T_COMP_EVAL_TERM)
+	    {
+	      switch (et->et.et_comp.rel_op)
+		{
+		case R_EQ:
+		case R_NE:
+		case R_GT:
+		case R_GE:
+		case R_LT:
+		case R_LE:
+		case R_NULL:
+		case R_EQ_TORDER:
+		case R_NULLSAFE_EQ:
+		  return (can_copy_regu (et->et.et_comp.lhs, attr_cache, vd)
+			  && can_copy_regu (et->et.et_comp.rhs, attr_cache, vd));
+		default:
+		  return false;
+		}
+	    }
+	  else if (et->et_type == T_LIKE_EVAL_TERM)
+	    {
+	      return (can_copy_regu (et->et.et_like.src, attr_cache, vd)
+		      && can_copy_regu (et->et.et_like.pattern, attr_cache, vd)
+		      && can_copy_regu (et->et.et_like.esc_char, attr_cache, vd));
+	    }
+	  // collection terms and compiled regular expressions
+	  return false;
+
+	default:
+	  return false;
+	}
+    }
+
+    static bool
+    can_copy_regu (const REGU_VARIABLE *regu, const HEAP_CACHE_ATTRINFO *attr_cache, const val_descr *vd)
+    {
+      const ARITH_TYPE *arith;
+
+      if (regu == NULL)
+	{
+	  return true;
+	}
+
+      if (regu->xasl != NULL || (regu->domain != NULL && TP_IS_SET_TYPE (TP_DOMAIN_TYPE (regu->domain))))
+	{
+	  return false;
+	}
+
+      switch (regu->type)
+	{
+	case TYPE_ATTR_ID:
+	  return regu->value.attr_descr.cache_attrinfo == attr_cache;
+
+	case TYPE_DBVAL:
+	  return !TP_IS_SET_TYPE (DB_VALUE_TYPE (&regu->value.dbval));
+
+	case TYPE_POS_VALUE:
+	  return (vd != NULL && regu->value.val_pos >= 0 && regu->value.val_pos < vd->dbval_cnt
+		  && !TP_IS_SET_TYPE (DB_VALUE_TYPE (&vd->dbval_ptr[regu->value.val_pos])));
+
+	case TYPE_INARITH:
+	case TYPE_OUTARITH:
+	  arith = regu->value.arithptr;
+	  if (arith == NULL || arith->pred != NULL)
+	    {
+	      return false;
+	    }
+	  switch (arith->opcode)
+	    {
+	    case T_ADD:
+	    case T_SUB:
+	    case T_MUL:
+	    case T_DIV:
+	    case T_UNPLUS:
+	    case T_UNMINUS:
+	    case T_MOD:
+	    case T_ABS:
+	    case T_FLOOR:
+	    case T_CEIL:
+	    case T_ROUND:
+	    case T_TRUNC:
+	    case T_STRCAT:
+	    case T_CONCAT:
+	    case T_LOWER:
+	    case T_UPPER:
+	    case T_TRIM:
+	    case T_LTRIM:
+	    case T_RTRIM:
+	    case T_SUBSTRING:
+	    case T_POSITION:
+	    case T_CHAR_LENGTH:
+	    case T_OCTET_LENGTH:
+	    case T_BIT_LENGTH:
+	    case T_EXTRACT:
+	    case T_CAST:
+	    case T_CAST_NOFAIL:
+	      return (can_copy_regu (arith->leftptr, attr_cache, vd) && can_copy_regu (arith->rightptr, attr_cache, vd)
+		      && can_copy_regu (arith->thirdptr, attr_cache, vd));
+	    default:
+	      return false;
+	    }
+
+	default:
+	  return false;
+	}
+    }
+
+  } // namespace parallel_heap
+} // namespace cubscan
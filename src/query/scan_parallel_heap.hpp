@@ -0,0 +1,181 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// scan_parallel_heap.hpp - interface of parallel heap scanning
+//
+// Parallel Heap Scan explained
+//
+//  Behavior
+//
+//    A heap scan of a large table (at least parallel_heap_scan_min_pages pages) reads its pages with up to
+//    parallel_heap_scan_threads worker threads besides the scan thread. Rows are returned in no particular order.
+//
+//  Implementation
+//
+//    The user pages of the heap file are collected from the file table, without fixing them, and ordered by page
+//    identifier. Ranges of consecutive pages are claimed one by one by workers, see heap_range_workers.hpp. A worker
+//    scans the pages of its range with its own heap scan cache, under the transaction index and MVCC snapshot of the
+//    scan thread, and copies the visible records to a batch. Batches are handed to the scan thread through a bounded
+//    queue.
+//
+//    Regu variables and value lists of XASL are shared by the whole query and cannot be evaluated concurrently. When
+//    the data filter only compares attributes of the scanned class with constants and host variables, each thread
+//    evaluates its own copy of the predicate, bound to its own attribute cache, and only the qualified records are
+//    copied to batches. Other predicates are evaluated by the scan thread.
+//
+//    The scan thread consumes the batches record by record, and reads attributes like for a serial heap scan. When no
+//    batch is ready, the scan thread claims and scans a range itself, therefore the scan progresses even if no worker
+//    is available.
+//
+//    Inner scans of joins are restarted for each outer row and are never scanned in parallel.
+//
+//    Workers check interrupts once per page. The first error of a worker stops all workers and is raised again by the
+//    scan thread.
+//
+
+#ifndef _SCAN_PARALLEL_HEAP_HPP_
+#define _SCAN_PARALLEL_HEAP_HPP_
+
+#include "heap_file.h"
+#include "heap_range_workers.hpp"
+#include "porting.h"
+#include "storage_common.h"
+
+#include <vector>
+
+// forward definitions
+// thread_entry.hpp
+namespace cubthread
+{
+  class entry;
+}
+// xasl_predicate.hpp
+namespace cubxasl
+{
+  struct pred_expr;
+}
+// query_executor.h
+struct val_descr;
+
+namespace cubscan
+{
+  namespace parallel_heap
+  {
+    const int MAX_WORKERS = cubheap::MAX_RANGE_WORKERS;
+
+    // statistics of one thread of the scan
+    struct worker_stats
+    {
+      int read_pages;
+      int read_rows;
+      struct timeval elapsed;
+    };
+
+    // statistics of a parallel heap scan; the first entry is the scan thread
+    struct stats
+    {
+      int num_workers;
+      worker_stats workers[MAX_WORKERS + 1];
+    };
+
+    // records of a page range; implementation in cpp file
+    struct scan_batch;
+
+    class scanner : public cubheap::batch_producer<scan_batch>
+    {
+      public:
+	scanner (const HFID &hfid, const OID &cls_oid, MVCC_SNAPSHOT *mvcc_snapshot, int worker_count);
+	~scanner ();
+
+	scanner (const scanner &) = delete;
+	scanner &operator= (const scanner &) = delete;
+
+	// next - get next visible record
+	//
+	// returns S_SUCCESS, S_END or S_ERROR
+	//
+	// oid (out)    : record identifier
+	// recdes (out) : record; its data belongs to the scanner and stays valid until next call
+	SCAN_CODE next (cubthread::entry &thread_ref, OID &oid, RECDES &recdes);
+
+	// stop the workers and end the scan; a following call of next restarts the scan from the beginning
+	void end (cubthread::entry &thread_ref);
+
+	// set_filter - evaluate the data filter on the threads reading the records; must be called before next
+	//
+	// returns true if the filter can be copied for each thread; next then returns only the records that satisfy
+	// it. otherwise the scan thread has to evaluate it.
+	//
+	// pred (in)       : data filter
+	// num_attrs (in)  : number of attributes read by the filter
+	// attr_ids (in)   : attributes read by the filter
+	// attr_cache (in) : attribute cache the filter is bound to
+	// vd (in)         : host variables of the query
+	bool set_filter (cubxasl::pred_expr *pred, int num_attrs, ATTR_ID *attr_ids, HEAP_CACHE_ATTRINFO *attr_cache,
+			 val_descr *vd);
+	bool has_filter () const;
+
+	// get the number of records read by all threads, before filtering
+	int get_read_rows () const;
+	// cumulate the statistics of all scans into stats_out
+	void get_stats (stats &stats_out) const;
+
+	// scan page ranges on a worker thread
+	void execute_worker (cubthread::entry &thread_ref, int worker_index) override;
+
+      private:
+	// copy of the data filter used by one thread; implementation in cpp file
+	struct filter;
+
+	int start (cubthread::entry &thread_ref);
+	int scan_range (cubthread::entry &thread_ref, HEAP_SCANCACHE &scan_cache, filter *filt,
+			const cubheap::page_ranges::range &range, scan_batch &records, worker_stats &wstats);
+
+	HFID m_hfid;
+	OID m_cls_oid;
+	MVCC_SNAPSHOT *m_mvcc_snapshot;
+	int m_worker_count;                       // maximum number of workers besides the scan thread
+
+	bool m_started;
+	HEAP_SCANCACHE m_scan_cache;              // scan cache of the scan thread
+	bool m_scan_cache_inited;
+
+	cubxasl::pred_expr *m_filter_pred;        // data filter evaluated by the threads, see set_filter
+	int m_filter_num_attrs;
+	ATTR_ID *m_filter_attr_ids;
+	val_descr *m_vd;
+	std::vector<filter *> m_filters;          // copies of the data filter; the first one is for the scan thread
+
+	scan_batch *m_batch;                      // batch consumed by the scan thread
+
+	stats m_stats;
+    };
+
+    // get the number of workers to scan a heap of npages pages; zero if the heap should be scanned serially.
+    // degree is the degree of parallelism chosen by the optimizer (workers plus the scan thread), zero if the
+    // server decides
+    int get_worker_count (int npages, int degree);
+  } // namespace parallel_heap
+} // namespace cubscan
+
+// naming convention of SCAN_ID's
+using PARALLEL_HEAP_SCANNER = cubscan::parallel_heap::scanner;
+using PARALLEL_HEAP_SCAN_STATS = cubscan::parallel_heap::stats;
+
+#endif // _SCAN_PARALLEL_HEAP_HPP_
@@ -4789,6 +4789,8 @@ stx_build_cls_spec_type (THREAD_ENTRY * thread_p, char *ptr, CLS_SPEC_TYPE * cls
 	}
     }
 
+  ptr = or_unpack_int (ptr, &cls_spec->parallel_degree);
+
   return ptr;
 
 error:
@@ -741,6 +741,7 @@ struct cls_spec_node
   ATTR_ID *attrids_range;	/* array of attr ids from the range filter. Used only in reevaluation at index scan */
   HEAP_CACHE_ATTRINFO *cache_range;	/* cache for the range attributes. Used only in reevaluation at index scan */
   int num_attrs_range;		/* number of atts for the range filter. Used only in reevaluation at index scan */
+  int parallel_degree;		/* degree of parallelism of a sequential scan; 0 lets the server decide */
 };
 
 struct list_spec_node
@@ -4672,6 +4672,8 @@ xts_process_cls_spec_type (char *ptr, const CLS_SPEC_TYPE * cls_spec)
     }
   ptr = or_pack_int (ptr, offset);
 
+  ptr = or_pack_int (ptr, cls_spec->parallel_degree);
+
   return ptr;
 }
 
@@ -6642,7 +6644,8 @@ xts_sizeof_cls_spec_type (const CLS_SPEC_TYPE * cls_spec)
 	   + PTR_SIZE		/* cls_regu_list_reserved */
 	   + PTR_SIZE		/* atrtrids_range */
 	   + PTR_SIZE		/* cache_range */
-	   + OR_INT_SIZE);	/* num_attrs_range */
+	   + OR_INT_SIZE	/* num_attrs_range */
+	   + OR_INT_SIZE);	/* parallel_degree */
 
   return size;
 }
@@ -0,0 +1,500 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// async_io.cpp - batched asynchronous file I/O
+//
+
+#include "config.h"
+
+#include "async_io.hpp"
+
+#include <atomic>
+#include <vector>
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+#if !defined (WINDOWS)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#endif // !WINDOWS
+
+#if defined (HAVE_LINUX_IO_URING_H)
+#include <linux/io_uring.h>
+#endif // HAVE_LINUX_IO_URING_H
+
+#if defined (HAVE_LINUX_IO_URING_H) && defined (__NR_io_uring_setup) && defined (__NR_io_uring_enter)
+#define ASYNC_IO_HAVE_URING
+#endif
+
+namespace cubio
+{
+  // queue depth of per-thread rings
+  static const unsigned URING_QUEUE_DEPTH = 64;
+
+  // io_uring support is checked once for the entire process
+  enum class support_state
+  {
+    UNKNOWN,
+    SUPPORTED,
+    UNSUPPORTED
+  };
+  static std::atomic<support_state> s_support { support_state::UNKNOWN };
+
+  //
+  // request
+  //
+
+  void
+  request::set_read (int fd_arg, void *buffer_arg, std::size_t count_arg, off_t offset_arg)
+  {
+    fd = fd_arg;
+    buffer = buffer_arg;
+    count = count_arg;
+    offset = offset_arg;
+    is_write = false;
+    result = 0;
+  }
+
+  void
+  request::set_write (int fd_arg, const void *buffer_arg, std::size_t count_arg, off_t offset_arg)
+  {
+    fd = fd_arg;
+    buffer = const_cast<void *> (buffer_arg);
+    count = count_arg;
+    offset = offset_arg;
+    is_write = true;
+    result = 0;
+  }
+
+  bool
+  request::is_completed () const
+  {
+    return result >= 0 && (std::size_t) result == count;
+  }
+
+  //
+  // synchronous execution
+  //
+
+  static void
+  execute_one_sync (request &req)
+  {
+#if defined (WINDOWS)
+    // not used on windows; file_io keeps its own read/write path
+    req.result = -ENOSYS;
+#else // !WINDOWS
+    char *ptr = (char *) req.buffer + req.result;
+    std::size_t done = (std::size_t) req.result;
+    ssize_t nbytes;
+
+    while (done < req.count)
+      {
+	if (req.is_write)
+	  {
+	    nbytes = pwrite (req.fd, ptr, req.count - done, req.offset + (off_t) done);
+	  }
+	else
+	  {
+	    nbytes = pread (req.fd, ptr, req.count - done, req.offset + (off_t) done);
+	  }
+	if (nbytes < 0)
+	  {
+	    if (errno == EINTR || errno == EAGAIN)
+	      {
+		continue;
+	      }
+	    req.result = -errno;
+	    return;
+	  }
+	if (nbytes == 0)
+	  {
+	    // end of file for reads; a write that makes no progress is an error
+	    req.result = req.is_write ? -EIO : (ssize_t) done;
+	    return;
+	  }
+	done += (std::size_t) nbytes;
+	ptr += nbytes;
+      }
+    req.result = (ssize_t) done;
+#endif // !WINDOWS
+  }
+
+  bool
+  execute_sync (request *requests, std::size_t count)
+  {
+    bool success = true;
+
+    for (std::size_t i = 0; i < count; i++)
+      {
+	requests[i].result = 0;
+	execute_one_sync (requests[i]);
+	success = success && requests[i].is_completed ();
+      }
+    return success;
+  }
+
+  //
+  // uring
+  //
+
+  uring::uring ()
+    : m_fd (-1)
+    , m_sq_head (NULL)
+    , m_sq_tail (NULL)
+    , m_sq_mask (NULL)
+    , m_sq_array (NULL)
+    , m_sq_entries (0)
+    , m_sqes (NULL)
+    , m_cq_head (NULL)
+    , m_cq_tail (NULL)
+    , m_cq_mask (NULL)
+    , m_cqes (NULL)
+    , m_sq_ring_ptr (NULL)
+    , m_sq_ring_size (0)
+    , m_cq_ring_ptr (NULL)
+    , m_cq_ring_size (0)
+    , m_sqes_size (0)
+  {
+  }
+
+  uring::~uring ()
+  {
+    destroy ();
+  }
+
+  bool
+  uring::is_initialized () const
+  {
+    return m_fd >= 0;
+  }
+
+  int
+  uring::init (unsigned entries)
+  {
+#if defined (ASYNC_IO_HAVE_URING)
+    io_uring_params params;
+    char *sq_ptr;
+    char *cq_ptr;
+
+    assert (!is_initialized ());
+
+    std::memset (&params, 0, sizeof (params));
+    m_fd = (int) syscall (__NR_io_uring_setup, entries, &params);
+    if (m_fd < 0)
+      {
+	m_fd = -1;
+	return -errno;
+      }
+
+    m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof (unsigned);
+    m_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof (io_uring_cqe);
+    m_sqes_size = params.sq_entries * sizeof (io_uring_sqe);
+
+    m_sq_ring_ptr = mmap (NULL, m_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd,
+			  IORING_OFF_SQ_RING);
+    m_cq_ring_ptr = mmap (NULL, m_cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd,
+			  IORING_OFF_CQ_RING);
+    m_sqes = mmap (NULL, m_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+    if (m_sq_ring_ptr == MAP_FAILED || m_cq_ring_ptr == MAP_FAILED || m_sqes == MAP_FAILED)
+      {
+	int error = errno;
+
+	destroy ();
+	return -error;
+      }
+
+    sq_ptr = (char *) m_sq_ring_ptr;
+    m_sq_head = (unsigned *) (sq_ptr + params.sq_off.head);
+    m_sq_tail = (unsigned *) (sq_ptr + params.sq_off.tail);
+    m_sq_mask = (unsigned *) (sq_ptr + params.sq_off.ring_mask);
+    m_sq_array = (unsigned *) (sq_ptr + params.sq_off.array);
+    m_sq_entries = params.sq_entries;
+
+    cq_ptr = (char *) m_cq_ring_ptr;
+    m_cq_head = (unsigned *) (cq_ptr + params.cq_off.head);
+    m_cq_tail = (unsigned *) (cq_ptr + params.cq_off.tail);
+    m_cq_mask = (unsigned *) (cq_ptr + params.cq_off.ring_mask);
+    m_cqes = cq_ptr + params.cq_off.cqes;
+
+    return 0;
+#else // !ASYNC_IO_HAVE_URING
+    (void) entries;
+    return -ENOSYS;
+#endif // !ASYNC_IO_HAVE_URING
+  }
+
+  void
+  uring::destroy ()
+  {
+#if defined (ASYNC_IO_HAVE_URING)
+    if (m_sqes != NULL && m_sqes != MAP_FAILED)
+      {
+	munmap (m_sqes, m_sqes_size);
+      }
+    if (m_cq_ring_ptr != NULL && m_cq_ring_ptr != MAP_FAILED)
+      {
+	munmap (m_cq_ring_ptr, m_cq_ring_size);
+      }
+    if (m_sq_ring_ptr != NULL && m_sq_ring_ptr != MAP_FAILED)
+      {
+	munmap (m_sq_ring_ptr, m_sq_ring_size);
+      }
+    if (m_fd >= 0)
+      {
+	close (m_fd);
+      }
+#endif // ASYNC_IO_HAVE_URING
+
+    m_fd = -1;
+    m_sqes = NULL;
+    m_cq_ring_ptr = NULL;
+    m_sq_ring_ptr = NULL;
+    m_sq_entries = 0;
+  }
+
+  int
+  uring::enter (unsigned to_submit, unsigned min_complete)
+  {
+#if defined (ASYNC_IO_HAVE_URING)
+    int rc = (int) syscall (__NR_io_uring_enter, m_fd, to_submit, min_complete,
+			    min_complete > 0 ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+    return rc < 0 ? -errno : rc;
+#else // !ASYNC_IO_HAVE_URING
+    (void) to_submit;
+    (void) min_complete;
+    return -ENOSYS;
+#endif // !ASYNC_IO_HAVE_URING
+  }
+
+  bool
+  uring::queue_request (request &req, std::size_t index)
+  {
+#if defined (ASYNC_IO_HAVE_URING)
+    unsigned tail = *m_sq_tail;
+    unsigned slot = tail & *m_sq_mask;
+    io_uring_sqe *sqe = ((io_uring_sqe *) m_sqes) + slot;
+    std::size_t done = (std::size_t) req.result;
+
+    if (tail - __atomic_load_n (m_sq_head, __ATOMIC_ACQUIRE) >= m_sq_entries)
+      {
+	// submission queue is full
+	return false;
+      }
+
+    std::memset (sqe, 0, sizeof (*sqe));
+    sqe->opcode = req.is_write ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe->fd = req.fd;
+    sqe->off = (unsigned long long) (req.offset + (off_t) done);
+    sqe->addr = (unsigned long long) ((char *) req.buffer + done);
+    sqe->len = (unsigned) (req.count - done);
+    sqe->user_data = (unsigned long long) index;
+
+    m_sq_array[slot] = slot;
+    __atomic_store_n (m_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+#else // !ASYNC_IO_HAVE_URING
+    (void) req;
+    (void) index;
+    return false;
+#endif // !ASYNC_IO_HAVE_URING
+  }
+
+  bool
+  uring::execute (request *requests, std::size_t count)
+  {
+#if defined (ASYNC_IO_HAVE_URING)
+    std::vector<std::size_t> resubmit;
+    std::size_t next = 0;
+    std::size_t completed = 0;
+    unsigned in_flight = 0;	// queued or submitted, but not reaped
+    unsigned unsubmitted = 0;	// queued, but not yet consumed by kernel
+    bool success = true;
+    int rc;
+
+    assert (is_initialized ());
+
+    for (std::size_t i = 0; i < count; i++)
+      {
+	requests[i].result = 0;
+      }
+
+    while (completed < count)
+      {
+	// fill the submission queue; keeping in_flight under queue depth also guarantees completion queue never
+	// overflows (it is twice as large)
+	while (in_flight < m_sq_entries)
+	  {
+	    std::size_t index;
+
+	    if (!resubmit.empty ())
+	      {
+		index = resubmit.back ();
+		resubmit.pop_back ();
+	      }
+	    else if (next < count)
+	      {
+		index = next++;
+	      }
+	    else
+	      {
+		break;
+	      }
+
+	    if (!queue_request (requests[index], index))
+	      {
+		resubmit.push_back (index);
+		break;
+	      }
+	    in_flight++;
+	    unsubmitted++;
+	  }
+
+	rc = enter (unsubmitted, in_flight > 0 ? 1 : 0);
+	if (rc < 0)
+	  {
+	    if (rc == -EINTR || rc == -EAGAIN || rc == -EBUSY)
+	      {
+		// try again; reap whatever completed meanwhile
+	      }
+	    else
+	      {
+		// the ring is unusable; tear it down and redo the unfinished transfers synchronously. transfers are
+		// idempotent, so a late completion of a request already in flight moves the same bytes.
+		destroy ();
+		for (std::size_t i = 0; i < count; i++)
+		  {
+		    if (requests[i].result >= 0 && !requests[i].is_completed ())
+		      {
+			execute_one_sync (requests[i]);
+		      }
+		    success = success && requests[i].is_completed ();
+		  }
+		return success;
+	      }
+	  }
+	else
+	  {
+	    assert ((unsigned) rc <= unsubmitted);
+	    unsubmitted -= (unsigned) rc;
+	  }
+
+	// reap completions
+	unsigned head = *m_cq_head;
+	unsigned tail = __atomic_load_n (m_cq_tail, __ATOMIC_ACQUIRE);
+
+	for (; head != tail; head++)
+	  {
+	    io_uring_cqe *cqe = ((io_uring_cqe *) m_cqes) + (head & *m_cq_mask);
+	    request &req = requests[(std::size_t) cqe->user_data];
+	    int res = cqe->res;
+
+	    in_flight--;
+	    if (res < 0)
+	      {
+		if (res == -EINTR || res == -EAGAIN)
+		  {
+		    resubmit.push_back ((std::size_t) cqe->user_data);
+		    continue;
+		  }
+		if (res == -EINVAL || res == -EOPNOTSUPP)
+		  {
+		    // opcode not supported by this kernel (IORING_OP_READ/WRITE appeared in 5.6)
+		    execute_one_sync (req);
+		  }
+		else
+		  {
+		    req.result = res;
+		  }
+	      }
+	    else if (res == 0)
+	      {
+		// end of file for reads; a write that makes no progress is an error
+		if (req.is_write)
+		  {
+		    req.result = -EIO;
+		  }
+	      }
+	    else
+	      {
+		req.result += res;
+		if ((std::size_t) req.result < req.count)
+		  {
+		    // short transfer; submit remainder
+		    resubmit.push_back ((std::size_t) cqe->user_data);
+		    continue;
+		  }
+	      }
+
+	    completed++;
+	    success = success && req.is_completed ();
+	  }
+	__atomic_store_n (m_cq_head, head, __ATOMIC_RELEASE);
+      }
+
+    return success;
+#else // !ASYNC_IO_HAVE_URING
+    return execute_sync (requests, count);
+#endif // !ASYNC_IO_HAVE_URING
+  }
+
+  //
+  // batch execution
+  //
+
+  bool
+  is_async_supported ()
+  {
+    if (s_support == support_state::UNKNOWN)
+      {
+	uring probe;
+
+	s_support = (probe.init (1) == 0) ? support_state::SUPPORTED : support_state::UNSUPPORTED;
+      }
+    return s_support == support_state::SUPPORTED;
+  }
+
+  bool
+  execute_batch (request *requests, std::size_t count, bool use_async)
+  {
+    // each thread owns its ring; no synchronization is needed between threads submitting I/O
+    static thread_local uring tl_ring;
+
+    if (count == 0)
+      {
+	return true;
+      }
+    if (!use_async || count == 1 || !is_async_supported ())
+      {
+	return execute_sync (requests, count);
+      }
+
+    if (!tl_ring.is_initialized ())
+      {
+	if (tl_ring.init (URING_QUEUE_DEPTH) != 0)
+	  {
+	    // e.g. out of locked memory; fall back for this batch
+	    return execute_sync (requests, count);
+	  }
+      }
+    return tl_ring.execute (requests, count);
+  }
+} // namespace cubio
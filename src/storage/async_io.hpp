@@ -0,0 +1,123 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// async_io.hpp - batched asynchronous file I/O (io_uring on Linux, pread/pwrite elsewhere)
+//
+
+#ifndef _ASYNC_IO_HPP_
+#define _ASYNC_IO_HPP_
+
+#include <cstddef>
+
+#include <sys/types.h>
+
+namespace cubio
+{
+  //  request - one read or write of a contiguous file range
+  //
+  //  result is output: the number of bytes transferred when the request was completed fully, or -errno when it
+  //  failed. a read that reaches end of file is considered failed and result keeps the bytes that were read.
+  //
+  struct request
+  {
+    int fd;
+    void *buffer;
+    std::size_t count;
+    off_t offset;
+    bool is_write;
+
+    ssize_t result;
+
+    void set_read (int fd_arg, void *buffer_arg, std::size_t count_arg, off_t offset_arg);
+    void set_write (int fd_arg, const void *buffer_arg, std::size_t count_arg, off_t offset_arg);
+    bool is_completed () const;
+  };
+
+  //  uring - a minimal io_uring instance, driven through raw system calls so there is no dependency on liburing
+  //
+  //  How to use:
+  //
+  //      uring ring;
+  //      if (ring.init (64) == 0)
+  //        {
+  //          ring.execute (requests, count);
+  //        }
+  //
+  //  An instance is not thread safe; each thread should use its own (see execute_batch).
+  //
+  class uring
+  {
+    public:
+      uring ();
+      ~uring ();
+
+      uring (const uring &) = delete;
+      uring &operator= (const uring &) = delete;
+
+      // create the ring with given queue depth. returns 0 or -errno (e.g. -ENOSYS when kernel lacks io_uring).
+      int init (unsigned entries);
+      bool is_initialized () const;
+
+      // submit all requests (queue depth at a time) and wait until all are completed. short transfers are
+      // resubmitted for the remainder. returns true if all requests were fully transferred.
+      bool execute (request *requests, std::size_t count);
+
+    private:
+      void destroy ();
+
+      bool queue_request (request &req, std::size_t index);
+      int enter (unsigned to_submit, unsigned min_complete);
+
+      int m_fd;
+
+      // submission queue
+      unsigned *m_sq_head;
+      unsigned *m_sq_tail;
+      unsigned *m_sq_mask;
+      unsigned *m_sq_array;
+      unsigned m_sq_entries;
+      void *m_sqes;
+
+      // completion queue
+      unsigned *m_cq_head;
+      unsigned *m_cq_tail;
+      unsigned *m_cq_mask;
+      void *m_cqes;
+
+      // mappings
+      void *m_sq_ring_ptr;
+      std::size_t m_sq_ring_size;
+      void *m_cq_ring_ptr;
+      std::size_t m_cq_ring_size;
+      std::size_t m_sqes_size;
+  };
+
+  // execute requests one by one with pread/pwrite. returns true if all requests were fully transferred.
+  bool execute_sync (request *requests, std::size_t count);
+
+  // execute requests as one batch. when use_async is true and io_uring is supported, requests are submitted on a
+  // per-thread ring and reaped together; otherwise execute_sync is used. returns true if all requests were fully
+  // transferred.
+  bool execute_batch (request *requests, std::size_t count, bool use_async);
+
+  // is io_uring supported by this build and kernel?
+  bool is_async_supported ();
+} // namespace cubio
+
+#endif // _ASYNC_IO_HPP_
@@ -1510,6 +1510,8 @@ static int btree_advance_and_find_key (THREAD_ENTRY * thread_p, BTID_INT * btid_
 				       PAGE_PTR * crt_page, PAGE_PTR * advance_to_page, bool * is_leaf,
 				       BTREE_SEARCH_KEY_HELPER * search_key, bool * stop, bool * restart,
 				       void *other_args);
+static int btree_optimistic_fix_leaf (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
+				      bool reuse_btid_int, PAGE_PTR * leaf_page);
 static int btree_key_find_unique_version_oid (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 					      PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key,
 					      bool * restart, void *other_args);
@@ -2062,7 +2064,7 @@ btree_store_overflow_key (THREAD_ENTRY * thread_p, BTID_INT * btid, DB_VALUE * k
 
   rec.length = (int) (buf.ptr - buf.buffer);
 
-  if (overflow_insert (thread_p, &overflow_file_vfid, first_overflow_page_vpid, &rec, FILE_BTREE_OVERFLOW_KEY)
+  if (overflow_insert (thread_p, &overflow_file_vfid, first_overflow_page_vpid, &rec, FILE_BTREE_OVERFLOW_KEY, false)
       != NO_ERROR)
     {
       ASSERT_ERROR ();
@@ -22559,6 +22561,33 @@ start_btree_traversal:
        * (btree_get_root_with_key). */
       root_function = btree_get_root_with_key;
     }
+
+  if (root_function == btree_get_root_with_key && advance_function == btree_advance_and_find_key
+      && prm_get_bool_value (PRM_ID_BT_OPTIMISTIC_TRAVERSAL))
+    {
+      /* Read-only search. Try to reach leaf without latching root and non-leaf nodes. */
+      error_code =
+	btree_optimistic_fix_leaf (thread_p, btid, btid_int, key, root_args ? *((bool *) root_args) : false,
+				   &crt_page);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto error;
+	}
+      if (crt_page != NULL)
+	{
+	  is_leaf = true;
+	  error_code = btree_search_leaf_page (thread_p, btid_int, crt_page, key, search_key);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto error;
+	    }
+	  goto leaf_reached;
+	}
+      /* Fall back to regular traversal. */
+    }
+
   /* Call root function. */
   error_code =
     root_function (thread_p, btid, btid_int, key, &crt_page, &is_leaf, search_key, &stop, &restart, root_args);
@@ -22623,6 +22652,7 @@ start_btree_traversal:
     }
 
   /* Leaf page is reached. */
+leaf_reached:
 
   assert (is_leaf && !stop && !restart);
   assert (crt_page != NULL);
@@ -22832,6 +22862,153 @@ btree_advance_and_find_key (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VAL
   return NO_ERROR;
 }
 
+/*
+ * btree_optimistic_fix_leaf () - Find and fix the leaf node following key, without latching root and non-leaf nodes.
+ *
+ * return	       : Error code.
+ * thread_p (in)       : Thread entry.
+ * btid (in)	       : B-tree identifier.
+ * btid_int (in/out)   : B-tree data. It is read from root header unless reuse_btid_int is true.
+ * key (in)	       : Search key value.
+ * reuse_btid_int (in) : True if btid_int is already known.
+ * leaf_page (out)     : Leaf page fixed with read latch, or NULL if regular traversal must be used instead.
+ *
+ * Note: Root and non-leaf nodes are copied, one at a time, with pgbuf_optimistic_read_page and searched in the
+ *	 copy. A child is trusted only after parent is validated as unchanged since it was copied; node splits and
+ *	 merges always change the parent. If validation fails, traversal is retried a few times, then abandoned.
+ *
+ *	 Indexes with overflow keys are not traversed this way, since reading their keys requires fixing other pages.
+ */
+static int
+btree_optimistic_fix_leaf (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
+			   bool reuse_btid_int, PAGE_PTR * leaf_page)
+{
+#define BTREE_OPTIMISTIC_MAX_TRIES 3
+
+  /* *INDENT-OFF* */
+  pgbuf_optimistic_buffer copy_buffer;
+  /* *INDENT-ON* */
+  PGBUF_OPTIMISTIC_READ parent_read, crt_read;
+  PAGE_PTR crt_page;
+  BTREE_ROOT_HEADER *root_header;
+  BTREE_NODE_HEADER *node_header;
+  VPID vpid, child_vpid;
+  INT16 slotid;
+  int node_level;
+  int try_count;
+  int error_code = NO_ERROR;
+
+  assert (btid != NULL && btid_int != NULL && key != NULL);
+  assert (leaf_page != NULL && *leaf_page == NULL);
+
+  for (try_count = 0; try_count < BTREE_OPTIMISTIC_MAX_TRIES; try_count++)
+    {
+      /* Copy root. */
+      vpid.volid = btid->vfid.volid;
+      vpid.pageid = btid->root_pageid;
+      crt_page = pgbuf_optimistic_read_page (thread_p, &vpid, copy_buffer, &crt_read);
+      if (crt_page == NULL)
+	{
+	  continue;
+	}
+
+      root_header = btree_get_root_header (thread_p, crt_page);
+      if (root_header == NULL || root_header->node.node_level <= 1)
+	{
+	  /* Root is leaf. Regular traversal latches it anyway. */
+	  return NO_ERROR;
+	}
+      node_level = root_header->node.node_level;
+
+      if (!reuse_btid_int)
+	{
+	  btid_int->sys_btid = btid;
+	  error_code = btree_glean_root_header_info (thread_p, root_header, btid_int);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return error_code;
+	    }
+	}
+      if (!VFID_ISNULL (&btid_int->ovfid))
+	{
+	  /* Has overflow keys. */
+	  return NO_ERROR;
+	}
+      if (DB_VALUE_TYPE (key) == DB_TYPE_MIDXKEY && key->data.midxkey.domain == NULL)
+	{
+	  /* Use domain from b-tree info. */
+	  key->data.midxkey.domain = btid_int->key_type;
+	}
+
+      /* Advance through non-leaf nodes. */
+      while (true)
+	{
+	  error_code = btree_search_nonleaf_page (thread_p, btid_int, crt_page, key, &slotid, &child_vpid, NULL);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      if (pgbuf_optimistic_validate (thread_p, &crt_read))
+		{
+		  /* Real error. */
+		  return error_code;
+		}
+	      /* Copy is outdated. */
+	      er_clear ();
+	      error_code = NO_ERROR;
+	      break;
+	    }
+	  assert (!VPID_ISNULL (&child_vpid));
+
+	  if (node_level == 2)
+	    {
+	      /* Child is leaf. Latch it, then make sure parent did not change meanwhile. */
+	      *leaf_page = pgbuf_fix (thread_p, &child_vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ,
+				      PGBUF_UNCONDITIONAL_LATCH);
+	      if (*leaf_page == NULL)
+		{
+		  if (pgbuf_optimistic_validate (thread_p, &crt_read))
+		    {
+		      /* Real error. */
+		      ASSERT_ERROR_AND_SET (error_code);
+		      return error_code;
+		    }
+		  /* Leaf was probably deallocated. */
+		  er_clear ();
+		  break;
+		}
+	      if (!pgbuf_optimistic_validate (thread_p, &crt_read))
+		{
+		  pgbuf_unfix_and_init (thread_p, *leaf_page);
+		  break;
+		}
+	      return NO_ERROR;
+	    }
+
+	  /* Copy child non-leaf node over parent, then make sure parent did not change meanwhile. Only the parent's
+	   * read state is needed from now on. */
+	  parent_read = crt_read;
+	  crt_page = pgbuf_optimistic_read_page (thread_p, &child_vpid, copy_buffer, &crt_read);
+	  if (crt_page == NULL || !pgbuf_optimistic_validate (thread_p, &parent_read) || crt_read.ptype != PAGE_BTREE)
+	    {
+	      break;
+	    }
+	  node_header = btree_get_node_header (thread_p, crt_page);
+	  if (node_header == NULL || node_header->node_level != node_level - 1)
+	    {
+	      break;
+	    }
+	  node_level--;
+	}
+    }
+
+  /* Give up; use regular traversal. */
+  assert (*leaf_page == NULL);
+  return NO_ERROR;
+
+#undef BTREE_OPTIMISTIC_MAX_TRIES
+}
+
 /*
  * btree_key_find_unique_version_oid () - Find the visible object version from key. Since the index is unique,
  *					  there must be at most one visible version.
@@ -24616,6 +24793,12 @@ btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN
 	      bts->slot_id = 1;
 	      next_vpid = node_header->next_vpid;
 	    }
+
+	  /* The scan crosses leaves; load the leaf after this one while this one is processed. */
+	  if (!VPID_ISNULL (&next_vpid) && prm_get_integer_value (PRM_ID_INDEX_SCAN_PREFETCH_MAX_PAGES) > 0)
+	    {
+	      (void) pgbuf_prefetch_page (thread_p, &next_vpid);
+	    }
 	}
 
       /* Get current key. */
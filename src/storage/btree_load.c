@@ -34,6 +34,7 @@
 #include "dbtype.h"
 #include "external_sort.h"
 #include "heap_file.h"
+#include "heap_range_workers.hpp"
 #include "log_append.hpp"
 #include "log_manager.h"
 #include "memory_alloc.h"
@@ -54,6 +55,16 @@
 #include "xasl.h"
 #include "xasl_unpack_info.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// *INDENT-OFF*
+class index_key_producer;
+// *INDENT-ON*
+
 typedef struct sort_args SORT_ARGS;
 struct sort_args
 {				/* Collection of information required for "sr_index_sort" */
@@ -86,6 +97,8 @@ struct sort_args
   FUNCTION_INDEX_INFO *func_index_info;
 
   MVCCID oldest_visible_mvccid;
+
+  index_key_producer *key_producer;	/* produces the sort items with several threads; NULL if serial */
 };
 
 typedef struct btree_page BTREE_PAGE;
@@ -216,6 +229,88 @@ class index_builder_loader_task: public cubthread::entry_task
     void clear_keys ();
 };
 
+// sort items of a page range; implementation below
+class index_key_batch;
+
+// produces the sort items of an index load with several threads
+//
+// The user pages of the heaps are split into ranges, see heap_range_workers.hpp. Workers build the sort items of the
+// records of a range and hand them in batches to the sort thread. When no batch is ready, the sort thread builds the
+// items of a range itself. The order of the items does not matter, the sort orders equal keys by OID.
+//
+// Filter predicates and function index expressions are XASL trees that cannot be evaluated by several threads, so
+// these indexes are loaded serially.
+class index_key_producer : public cubheap::batch_producer<index_key_batch>
+{
+  public:
+    index_key_producer (SORT_ARGS &sort_args, int worker_count);
+    ~index_key_producer ();
+
+    // collect heap pages and start workers
+    int start (cubthread::entry &thread_ref);
+    // get next sort item like btree_sort_get_next
+    SORT_STATUS get_next (cubthread::entry &thread_ref, RECDES &temp_recdes);
+    // stop workers and add their object and null counters to sort arguments
+    void end (cubthread::entry &thread_ref);
+
+    void execute_worker (cubthread::entry &thread_ref, int worker_index) override;
+
+  private:
+    // scan cache and attribute info of a thread; implementation below
+    struct producer_state;
+
+    int produce_range (cubthread::entry &thread_ref, producer_state &state, const cubheap::page_ranges::range &range,
+                       index_key_batch &items);
+
+    SORT_ARGS &m_sort_args;
+    int m_worker_count;
+    bool m_started;
+
+    producer_state *m_own_state;              // state of the sort thread
+    index_key_batch *m_batch;                 // batch consumed by the sort thread
+
+    std::atomic<int> m_n_oids;
+    std::atomic<int> m_n_nulls;
+};
+
+// scans the heap of an index built online and inserts the keys of the records, with the index builder thread and
+// workers
+//
+// The keys are collected in a loader task that is executed on the same thread when it is full; its keys are sorted and
+// inserted leaf by leaf. Keys are only inserted between pages, when no heap page is fixed.
+class index_builder_scan : public cubheap::range_workers
+{
+  public:
+    index_builder_scan (const BTID_INT *btid_int, const HFID *hfid, const OID *class_oid, int *attrids, int n_attrs,
+			int *attrs_prefix_length, int unique_pk, MVCC_SNAPSHOT *snapshot,
+			index_builder_loader_context &load_context, std::atomic<int> &num_keys,
+			std::atomic<int> &num_oids, std::atomic<int> &num_nulls);
+
+    // scan the heap with up to thread_count threads, the index builder thread included
+    int run (cubthread::entry &thread_ref, int thread_count);
+
+    void execute_worker (cubthread::entry &thread_ref, int worker_index) override;
+
+  private:
+    int scan_range (cubthread::entry &thread_ref, const cubheap::page_ranges::range &range,
+		    HEAP_SCANCACHE &scan_cache, HEAP_CACHE_ATTRINFO &attr_info,
+		    std::unique_ptr<index_builder_loader_task> &load_task);
+
+    BTID m_btid;
+    HFID m_hfid;
+    OID m_class_oid;
+    int *m_attrids;
+    int m_n_attrs;
+    int *m_attrs_prefix_length;
+    int m_unique_pk;
+    MVCC_SNAPSHOT *m_snapshot;
+    index_builder_loader_context &m_load_context;
+
+    std::atomic<int> &m_num_keys;
+    std::atomic<int> &m_num_oids;
+    std::atomic<int> &m_num_nulls;
+};
+
 // *INDENT-ON*
 
 
@@ -238,6 +333,9 @@ static int btree_dump_sort_output (const RECDES * recdes, LOAD_ARGS * load_args)
 #endif /* defined(CUBRID_DEBUG) */
 static int btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC * out_func, void *out_args);
 static SORT_STATUS btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg);
+static SORT_STATUS btree_sort_make_item (THREAD_ENTRY * thread_p, const SORT_ARGS * sort_args, int cur_class,
+					 OID * oid, RECDES * in_recdes, HEAP_CACHE_ATTRINFO * attr_info,
+					 RECDES * temp_recdes, int *n_oids, int *n_nulls);
 static int compare_driver (const void *first, const void *second, void *arg);
 static int list_add (BTREE_NODE ** list, VPID * pageid);
 static void list_remove_first (BTREE_NODE ** list);
@@ -812,6 +910,7 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
   sort_args->fk_refcls_oid = fk_refcls_oid;
   sort_args->fk_refcls_pk_btid = fk_refcls_pk_btid;
   sort_args->fk_name = fk_name;
+  sort_args->key_producer = NULL;
   if (pred_stream && pred_stream_size > 0)
     {
       if (stx_map_stream_to_filter_pred (thread_p, &filter_pred, pred_stream, pred_stream_size) != NO_ERROR)
@@ -2930,6 +3029,8 @@ btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC
   int i;
   bool includes_tde_class = false;
   TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
+  int worker_count = 0;
+  int error_code;
 
   for (i = 0; i < sort_args->n_classes; i++)
     {
@@ -2944,9 +3045,42 @@ btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC
 	}
     }
 
-  return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
-			&btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
-			NO_SORT_LIMIT, includes_tde_class);
+#if defined (SERVER_MODE)
+  if (sort_args->filter == NULL && sort_args->func_index_info == NULL)
+    {
+      worker_count = prm_get_integer_value (PRM_ID_PARALLEL_INDEX_BUILD_THREADS);
+    }
+#endif /* SERVER_MODE */
+
+  if (worker_count > 0)
+    {
+      // *INDENT-OFF*
+      sort_args->key_producer = new index_key_producer (*sort_args, worker_count);
+      // *INDENT-ON*
+      error_code = sort_args->key_producer->start (*thread_p);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  sort_args->key_producer->end (*thread_p);
+	  delete sort_args->key_producer;
+	  sort_args->key_producer = NULL;
+	  return error_code;
+	}
+    }
+
+  error_code =
+    sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
+		   &btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
+		   NO_SORT_LIMIT, includes_tde_class);
+
+  if (sort_args->key_producer != NULL)
+    {
+      sort_args->key_producer->end (*thread_p);
+      delete sort_args->key_producer;
+      sort_args->key_producer = NULL;
+    }
+
+  return error_code;
 }
 
 /*
@@ -2966,44 +3100,23 @@ static SORT_STATUS
 btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 {
   SCAN_CODE scan_result;
-  DB_VALUE dbvalue;
-  DB_VALUE *dbvalue_ptr;
-  int key_len;
   OID prev_oid;
   SORT_ARGS *sort_args;
-  OR_BUF buf;
-  int value_has_null;
-  int next_size;
-  int record_size;
-  int oid_size;
-  char midxkey_buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_midxkey_buf;
-  int *prefix_lengthp;
-  int result;
-  MVCC_REC_HEADER mvcc_header = MVCC_REC_HEADER_INITIALIZER;
-  MVCC_SNAPSHOT mvcc_snapshot_dirty;
-  MVCC_SATISFIES_SNAPSHOT_RESULT snapshot_dirty_satisfied;
-
-  db_make_null (&dbvalue);
-
-  aligned_midxkey_buf = PTR_ALIGN (midxkey_buf, MAX_ALIGNMENT);
+  SORT_STATUS status;
 
   sort_args = (SORT_ARGS *) arg;
-  prev_oid = sort_args->cur_oid;
 
-  if (BTREE_IS_UNIQUE (sort_args->unique_pk))
-    {
-      oid_size = 2 * OR_OID_SIZE;
-    }
-  else
+  if (sort_args->key_producer != NULL)
     {
-      oid_size = OR_OID_SIZE;
+      /* sort items are produced by several threads */
+      return sort_args->key_producer->get_next (*thread_p, *temp_recdes);
     }
 
-  mvcc_snapshot_dirty.snapshot_fnc = mvcc_satisfies_dirty;
+  prev_oid = sort_args->cur_oid;
 
   do
     {				/* Infinite loop */
-      int cur_class, attr_offset;
+      int cur_class;
       bool save_cache_last_fix_page;
 
       /*
@@ -3018,7 +3131,6 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
        */
 
       cur_class = sort_args->cur_class;
-      attr_offset = cur_class * sort_args->n_attrs;
       sort_args->in_recdes.data = NULL;
       scan_result =
 	heap_next (thread_p, &sort_args->hfids[cur_class], &sort_args->class_ids[cur_class], &sort_args->cur_oid,
@@ -3066,7 +3178,6 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 	    {
 	      /* start up the next scan */
 	      cur_class = sort_args->cur_class;
-	      attr_offset = cur_class * sort_args->n_attrs;
 
 	      if (heap_scancache_start (thread_p, &sort_args->hfscan_cache, &sort_args->hfids[cur_class],
 					&sort_args->class_ids[cur_class], save_cache_last_fix_page, false,
@@ -3077,7 +3188,8 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 	      sort_args->scancache_inited = 1;
 
 	      if (heap_attrinfo_start (thread_p, &sort_args->class_ids[cur_class], sort_args->n_attrs,
-				       &sort_args->attr_ids[attr_offset], &sort_args->attr_info) != NO_ERROR)
+				       &sort_args->attr_ids[cur_class * sort_args->n_attrs],
+				       &sort_args->attr_info) != NO_ERROR)
 		{
 		  return SORT_ERROR_OCCURRED;
 		}
@@ -3109,257 +3221,312 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 	  break;
 	}
 
+      perfmon_inc_stat (thread_p, PSTAT_BT_NUM_LOAD_ROWS);
+
       /*
        * Produce the sort item for this object
        */
-
-      /* filter out dead records before any more checks */
-      if (or_mvcc_get_header (&sort_args->in_recdes, &mvcc_header) != NO_ERROR)
-	{
-	  return SORT_ERROR_OCCURRED;
-	}
-      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header) && MVCC_GET_DELID (&mvcc_header) < sort_args->oldest_visible_mvccid)
+      status =
+	btree_sort_make_item (thread_p, sort_args, cur_class, &sort_args->cur_oid, &sort_args->in_recdes,
+			      &sort_args->attr_info, temp_recdes, &sort_args->n_oids, &sort_args->n_nulls);
+      if (status == SORT_REC_DOESNT_FIT)
 	{
-	  continue;
+	  /* Record is too big to fit into temp_recdes area; so backtrack this iteration */
+	  sort_args->cur_oid = prev_oid;
+	  return status;
 	}
-      if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header)
-	  && MVCC_GET_INSID (&mvcc_header) < sort_args->oldest_visible_mvccid)
+      else if (status != SORT_SUCCESS || temp_recdes->length > 0)
 	{
-	  /* Insert MVCCID is now visible to everyone. Clear it to avoid unnecessary vacuuming. */
-	  MVCC_CLEAR_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_INSID);
+	  return status;
 	}
+      prev_oid = sort_args->cur_oid;
+    }
+  while (true);
+}
 
-      snapshot_dirty_satisfied = mvcc_snapshot_dirty.snapshot_fnc (thread_p, &mvcc_header, &mvcc_snapshot_dirty);
+/*
+ * btree_sort_make_item () - Produce the sort item of an object
+ *   return: SORT_SUCCESS, SORT_REC_DOESNT_FIT or SORT_ERROR_OCCURRED
+ *   sort_args(in): sort arguments
+ *   cur_class(in): index of the class of object
+ *   oid(in): object identifier
+ *   in_recdes(in): object record
+ *   attr_info(in): attribute information of the index attributes of class
+ *   temp_recdes(out): sort item; its length is set to zero if the object has no item
+ *   n_oids(in/out): number of objects, incremented for a live object
+ *   n_nulls(in/out): number of null keys, incremented for a live object with null key
+ *
+ * Note: When the item does not fit, the needed length may be set in temp_recdes. The filter predicate and the function
+ *       of the index are evaluated using sort_args, so this must run on the sort thread when they exist. Otherwise,
+ *       it may run on several threads with their own attr_info.
+ */
+static SORT_STATUS
+btree_sort_make_item (THREAD_ENTRY * thread_p, const SORT_ARGS * sort_args, int cur_class, OID * oid,
+		      RECDES * in_recdes, HEAP_CACHE_ATTRINFO * attr_info, RECDES * temp_recdes, int *n_oids,
+		      int *n_nulls)
+{
+  DB_VALUE dbvalue;
+  DB_VALUE *dbvalue_ptr;
+  int key_len;
+  OR_BUF buf;
+  int value_has_null;
+  int next_size;
+  int record_size;
+  int oid_size;
+  char midxkey_buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_midxkey_buf;
+  int *prefix_lengthp;
+  int result;
+  int attr_offset;
+  MVCC_REC_HEADER mvcc_header = MVCC_REC_HEADER_INITIALIZER;
+  MVCC_SNAPSHOT mvcc_snapshot_dirty;
+  MVCC_SATISFIES_SNAPSHOT_RESULT snapshot_dirty_satisfied;
 
-      if (sort_args->filter)
-	{
-	  if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
-					   sort_args->filter->cache_pred) != NO_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
+  db_make_null (&dbvalue);
 
-	  result = (*sort_args->filter_eval_func) (thread_p, sort_args->filter->pred, NULL, &sort_args->cur_oid);
-	  if (result == V_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
-	  else if (result != V_TRUE)
-	    {
-	      continue;
-	    }
-	}
+  aligned_midxkey_buf = PTR_ALIGN (midxkey_buf, MAX_ALIGNMENT);
+  attr_offset = cur_class * sort_args->n_attrs;
+  temp_recdes->length = 0;
 
-      if (sort_args->func_index_info && sort_args->func_index_info->expr)
-	{
-	  if (snapshot_dirty_satisfied != SNAPSHOT_SATISFIED)
-	    {
-	      /* Check snapshot before key generation. Key generation may leads to errors when a function is involved. */
-	      continue;
-	    }
+  if (BTREE_IS_UNIQUE (sort_args->unique_pk))
+    {
+      oid_size = 2 * OR_OID_SIZE;
+    }
+  else
+    {
+      oid_size = OR_OID_SIZE;
+    }
 
-	  if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
-					   sort_args->func_index_info->expr->cache_attrinfo) != NO_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
-	}
+  mvcc_snapshot_dirty.snapshot_fnc = mvcc_satisfies_dirty;
 
-      if (sort_args->n_attrs == 1)
-	{			/* single-column index */
-	  if (heap_attrinfo_read_dbvalues (thread_p, &sort_args->cur_oid, &sort_args->in_recdes, NULL,
-					   &sort_args->attr_info) != NO_ERROR)
-	    {
-	      return SORT_ERROR_OCCURRED;
-	    }
-	}
+  /* filter out dead records before any more checks */
+  if (or_mvcc_get_header (in_recdes, &mvcc_header) != NO_ERROR)
+    {
+      return SORT_ERROR_OCCURRED;
+    }
+  if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header) && MVCC_GET_DELID (&mvcc_header) < sort_args->oldest_visible_mvccid)
+    {
+      return SORT_SUCCESS;
+    }
+  if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header)
+      && MVCC_GET_INSID (&mvcc_header) < sort_args->oldest_visible_mvccid)
+    {
+      /* Insert MVCCID is now visible to everyone. Clear it to avoid unnecessary vacuuming. */
+      MVCC_CLEAR_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_INSID);
+    }
+
+  snapshot_dirty_satisfied = mvcc_snapshot_dirty.snapshot_fnc (thread_p, &mvcc_header, &mvcc_snapshot_dirty);
 
-      prefix_lengthp = NULL;
-      if (sort_args->attrs_prefix_length)
+  if (sort_args->filter)
+    {
+      if (heap_attrinfo_read_dbvalues (thread_p, oid, in_recdes, NULL, sort_args->filter->cache_pred) != NO_ERROR)
 	{
-	  prefix_lengthp = &(sort_args->attrs_prefix_length[0]);
+	  return SORT_ERROR_OCCURRED;
 	}
 
-      dbvalue_ptr =
-	heap_attrinfo_generate_key (thread_p, sort_args->n_attrs, &sort_args->attr_ids[attr_offset], prefix_lengthp,
-				    &sort_args->attr_info, &sort_args->in_recdes, &dbvalue, aligned_midxkey_buf,
-				    sort_args->func_index_info, NULL);
-      if (dbvalue_ptr == NULL)
+      result = (*sort_args->filter_eval_func) (thread_p, sort_args->filter->pred, NULL, oid);
+      if (result == V_ERROR)
 	{
 	  return SORT_ERROR_OCCURRED;
 	}
+      else if (result != V_TRUE)
+	{
+	  return SORT_SUCCESS;
+	}
+    }
 
-      value_has_null = 0;	/* init */
-      if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_has_null (dbvalue_ptr))
+  if (sort_args->func_index_info && sort_args->func_index_info->expr)
+    {
+      if (snapshot_dirty_satisfied != SNAPSHOT_SATISFIED)
 	{
-	  value_has_null = 1;	/* found null columns */
+	  /* Check snapshot before key generation. Key generation may leads to errors when a function is involved. */
+	  return SORT_SUCCESS;
 	}
 
-      if (sort_args->not_null_flag && value_has_null && snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+      if (heap_attrinfo_read_dbvalues (thread_p, oid, in_recdes, NULL,
+				       sort_args->func_index_info->expr->cache_attrinfo) != NO_ERROR)
 	{
-	  if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
-	    {
-	      pr_clear_value (dbvalue_ptr);
-	    }
+	  return SORT_ERROR_OCCURRED;
+	}
+    }
 
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NOT_NULL_DOES_NOT_ALLOW_NULL_VALUE, 0);
+  if (sort_args->n_attrs == 1)
+    {				/* single-column index */
+      if (heap_attrinfo_read_dbvalues (thread_p, oid, in_recdes, NULL, attr_info) != NO_ERROR)
+	{
 	  return SORT_ERROR_OCCURRED;
 	}
+    }
+
+  prefix_lengthp = NULL;
+  if (sort_args->attrs_prefix_length)
+    {
+      prefix_lengthp = &(sort_args->attrs_prefix_length[0]);
+    }
+
+  dbvalue_ptr =
+    heap_attrinfo_generate_key (thread_p, sort_args->n_attrs, &sort_args->attr_ids[attr_offset], prefix_lengthp,
+				attr_info, in_recdes, &dbvalue, aligned_midxkey_buf, sort_args->func_index_info, NULL);
+  if (dbvalue_ptr == NULL)
+    {
+      return SORT_ERROR_OCCURRED;
+    }
+
+  value_has_null = 0;		/* init */
+  if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_has_null (dbvalue_ptr))
+    {
+      value_has_null = 1;	/* found null columns */
+    }
 
-      if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_is_null (dbvalue_ptr))
+  if (sort_args->not_null_flag && value_has_null && snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+    {
+      if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
 	{
-	  if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
-	    {
-	      /* All objects that were not candidates for vacuum are loaded, but statistics should only care for
-	       * objects that have not been deleted and committed at the time of load. */
-	      sort_args->n_oids++;	/* Increment the OID counter */
-	      sort_args->n_nulls++;	/* Increment the NULL counter */
-	    }
-	  if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
-	    {
-	      pr_clear_value (dbvalue_ptr);
-	    }
-	  if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
-	    {
-	      _er_log_debug (ARG_FILE_LINE,
-			     "DEBUG_BTREE: load sort found null at oid(%d, %d, %d)"
-			     ", class_oid(%d, %d, %d), btid(%d, (%d, %d).", sort_args->cur_oid.volid,
-			     sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
-			     sort_args->class_ids[sort_args->cur_class].volid,
-			     sort_args->class_ids[sort_args->cur_class].pageid,
-			     sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
-			     sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid);
-	    }
-	  continue;
+	  pr_clear_value (dbvalue_ptr);
 	}
 
-      key_len = sort_args->key_type->type->get_disk_size_of_value (dbvalue_ptr);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NOT_NULL_DOES_NOT_ALLOW_NULL_VALUE, 0);
+      return SORT_ERROR_OCCURRED;
+    }
 
-      if (key_len > 0)
+  if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_is_null (dbvalue_ptr))
+    {
+      if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+	{
+	  /* All objects that were not candidates for vacuum are loaded, but statistics should only care for
+	   * objects that have not been deleted and committed at the time of load. */
+	  (*n_oids)++;		/* Increment the OID counter */
+	  (*n_nulls)++;		/* Increment the NULL counter */
+	}
+      if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
+	{
+	  pr_clear_value (dbvalue_ptr);
+	}
+      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
 	{
-	  next_size = sizeof (char *);
-	  record_size = (next_size	/* Pointer to next */
-			 + OR_INT_SIZE	/* Has null */
-			 + oid_size	/* OID, Class OID */
-			 + 2 * OR_MVCCID_SIZE	/* Insert and delete MVCCID */
-			 + key_len	/* Key length */
-			 + (int) MAX_ALIGNMENT /* Alignment */ );
+	  _er_log_debug (ARG_FILE_LINE,
+			 "DEBUG_BTREE: load sort found null at oid(%d, %d, %d)"
+			 ", class_oid(%d, %d, %d), btid(%d, (%d, %d).", oid->volid, oid->pageid, oid->slotid,
+			 sort_args->class_ids[cur_class].volid, sort_args->class_ids[cur_class].pageid,
+			 sort_args->class_ids[cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
+			 sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid);
+	}
+      return SORT_SUCCESS;
+    }
 
-	  if (temp_recdes->area_size < record_size)
-	    {
-	      /*
-	       * Record is too big to fit into temp_recdes area; so
-	       * backtrack this iteration
-	       */
-	      sort_args->cur_oid = prev_oid;
-	      temp_recdes->length = record_size;
-	      goto nofit;
-	    }
+  key_len = sort_args->key_type->type->get_disk_size_of_value (dbvalue_ptr);
 
-	  assert (PTR_ALIGN (temp_recdes->data, MAX_ALIGNMENT) == temp_recdes->data);
-	  or_init (&buf, temp_recdes->data, 0);
+  if (key_len > 0)
+    {
+      next_size = sizeof (char *);
+      record_size = (next_size	/* Pointer to next */
+		     + OR_INT_SIZE	/* Has null */
+		     + oid_size	/* OID, Class OID */
+		     + 2 * OR_MVCCID_SIZE	/* Insert and delete MVCCID */
+		     + key_len	/* Key length */
+		     + (int) MAX_ALIGNMENT /* Alignment */ );
 
-	  or_pad (&buf, next_size);	/* init as NULL */
+      if (temp_recdes->area_size < record_size)
+	{
+	  /* Record is too big to fit into temp_recdes area */
+	  temp_recdes->length = record_size;
+	  goto nofit;
+	}
 
-	  /* save has_null */
-	  if (or_put_byte (&buf, value_has_null) != NO_ERROR)
-	    {
-	      goto nofit;
-	    }
+      assert (PTR_ALIGN (temp_recdes->data, MAX_ALIGNMENT) == temp_recdes->data);
+      or_init (&buf, temp_recdes->data, 0);
 
-	  or_advance (&buf, (OR_INT_SIZE - OR_BYTE_SIZE));
-	  assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+      or_pad (&buf, next_size);	/* init as NULL */
 
-	  if (BTREE_IS_UNIQUE (sort_args->unique_pk))
-	    {
-	      if (or_put_oid (&buf, &sort_args->class_ids[cur_class]) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
+      /* save has_null */
+      if (or_put_byte (&buf, value_has_null) != NO_ERROR)
+	{
+	  goto nofit;
+	}
 
-	  if (or_put_oid (&buf, &sort_args->cur_oid) != NO_ERROR)
+      or_advance (&buf, (OR_INT_SIZE - OR_BYTE_SIZE));
+      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+
+      if (BTREE_IS_UNIQUE (sort_args->unique_pk))
+	{
+	  if (or_put_oid (&buf, &sort_args->class_ids[cur_class]) != NO_ERROR)
 	    {
 	      goto nofit;
 	    }
+	}
 
-	  /* Pack insert and delete MVCCID's */
-	  if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header))
-	    {
-	      if (or_put_mvccid (&buf, MVCC_GET_INSID (&mvcc_header)) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
-	  else
-	    {
-	      if (or_put_mvccid (&buf, MVCCID_ALL_VISIBLE) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
+      if (or_put_oid (&buf, oid) != NO_ERROR)
+	{
+	  goto nofit;
+	}
 
-	  if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
-	    {
-	      if (or_put_mvccid (&buf, MVCC_GET_DELID (&mvcc_header)) != NO_ERROR)
-		{
-		  goto nofit;
-		}
-	    }
-	  else
+      /* Pack insert and delete MVCCID's */
+      if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header))
+	{
+	  if (or_put_mvccid (&buf, MVCC_GET_INSID (&mvcc_header)) != NO_ERROR)
 	    {
-	      if (or_put_mvccid (&buf, MVCCID_NULL) != NO_ERROR)
-		{
-		  goto nofit;
-		}
+	      goto nofit;
 	    }
-
-	  if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+	}
+      else
+	{
+	  if (or_put_mvccid (&buf, MVCCID_ALL_VISIBLE) != NO_ERROR)
 	    {
-	      _er_log_debug (ARG_FILE_LINE,
-			     "DEBUG_BTREE: load sort found oid(%d, %d, %d)"
-			     ", class_oid(%d, %d, %d), btid(%d, (%d, %d), mvcc_info=%llu | %llu.",
-			     sort_args->cur_oid.volid, sort_args->cur_oid.pageid, sort_args->cur_oid.slotid,
-			     sort_args->class_ids[sort_args->cur_class].volid,
-			     sort_args->class_ids[sort_args->cur_class].pageid,
-			     sort_args->class_ids[sort_args->cur_class].slotid, sort_args->btid->sys_btid->root_pageid,
-			     sort_args->btid->sys_btid->vfid.volid, sort_args->btid->sys_btid->vfid.fileid,
-			     MVCC_IS_FLAG_SET (&mvcc_header,
-					       OR_MVCC_FLAG_VALID_INSID) ? MVCC_GET_INSID (&mvcc_header) :
-			     MVCCID_ALL_VISIBLE, MVCC_IS_FLAG_SET (&mvcc_header,
-								   OR_MVCC_FLAG_VALID_DELID) ?
-			     MVCC_GET_DELID (&mvcc_header) : MVCCID_NULL);
+	      goto nofit;
 	    }
+	}
 
-	  assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
-
-	  if (sort_args->key_type->type->data_writeval (&buf, dbvalue_ptr) != NO_ERROR)
+      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	{
+	  if (or_put_mvccid (&buf, MVCC_GET_DELID (&mvcc_header)) != NO_ERROR)
 	    {
 	      goto nofit;
 	    }
-
-	  temp_recdes->length = CAST_STRLEN (buf.ptr - buf.buffer);
-
-	  if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
+	}
+      else
+	{
+	  if (or_put_mvccid (&buf, MVCCID_NULL) != NO_ERROR)
 	    {
-	      pr_clear_value (dbvalue_ptr);
+	      goto nofit;
 	    }
 	}
 
-      if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
 	{
-	  /* All objects that were not candidates for vacuum are loaded, but statistics should only care for objects
-	   * that have not been deleted and committed at the time of load. */
-	  sort_args->n_oids++;	/* Increment the OID counter */
+	  _er_log_debug (ARG_FILE_LINE,
+			 "DEBUG_BTREE: load sort found oid(%d, %d, %d)"
+			 ", class_oid(%d, %d, %d), btid(%d, (%d, %d), mvcc_info=%llu | %llu.",
+			 oid->volid, oid->pageid, oid->slotid, sort_args->class_ids[cur_class].volid,
+			 sort_args->class_ids[cur_class].pageid, sort_args->class_ids[cur_class].slotid,
+			 sort_args->btid->sys_btid->root_pageid, sort_args->btid->sys_btid->vfid.volid,
+			 sort_args->btid->sys_btid->vfid.fileid,
+			 MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_INSID) ? MVCC_GET_INSID (&mvcc_header) :
+			 MVCCID_ALL_VISIBLE, MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_DELID) ?
+			 MVCC_GET_DELID (&mvcc_header) : MVCCID_NULL);
 	}
 
-      if (key_len > 0)
+      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+
+      if (sort_args->key_type->type->data_writeval (&buf, dbvalue_ptr) != NO_ERROR)
 	{
-	  return SORT_SUCCESS;
+	  goto nofit;
 	}
 
-    }
-  while (true);
+      temp_recdes->length = CAST_STRLEN (buf.ptr - buf.buffer);
+
+      if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
+	{
+	  pr_clear_value (dbvalue_ptr);
+	}
+    }
+
+  if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
+    {
+      /* All objects that were not candidates for vacuum are loaded, but statistics should only care for objects
+       * that have not been deleted and committed at the time of load. */
+      (*n_oids)++;		/* Increment the OID counter */
+    }
+
+  return SORT_SUCCESS;
 
 nofit:
 
@@ -4852,9 +5019,13 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
 
   std::unique_ptr<index_builder_loader_task> load_task = NULL;
 
+  /* The heap is scanned by several threads too; filter and function index expressions cannot be evaluated
+   * concurrently. */
+  bool is_parallel_scan = is_parallel && filter_pred == NULL && func_idx_info.expr == NULL;
+
   // a worker pool is built only of loading is done in parallel
   cubthread::entry_workpool *ib_workpool =
-    is_parallel ?
+    is_parallel && !is_parallel_scan ?
     thread_get_manager()->create_worker_pool (ib_thread_count, 32, "Online index loader pool", &load_context, 1,
                                               btree_is_worker_pool_logging_true ())
     : NULL;
@@ -4881,6 +5052,15 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
 
   PERF_UTIME_TRACKER_START (thread_p, &time_online_index);
 
+  if (is_parallel_scan)
+    {
+      index_builder_scan parallel_scan (btid_int, hfids, class_oids, attrids, n_attrs, attrs_prefix_length, unique_pk,
+					scancache->mvcc_snapshot, load_context, num_keys, num_oids, num_nulls);
+
+      ret = parallel_scan.run (*thread_p, ib_thread_count);
+      goto end;
+    }
+
   /* Start extracting from heap. */
   for (;;)
     {
@@ -4962,6 +5142,7 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
 	  ret = ER_FAILED;
 	  break;
 	}
+      perfmon_inc_stat (thread_p, PSTAT_BT_NUM_LOAD_ROWS);
 
       /* Dispatch the insert operation */
       if (load_task == NULL)
@@ -5027,6 +5208,7 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
       while (load_context.m_tasks_executed != tasks_started);
     }
 
+end:
   PERF_UTIME_TRACKER_TIME (thread_p, &time_online_index, PSTAT_BT_ONLINE_LOAD);
 
   thread_get_manager ()->destroy_worker_pool (ib_workpool);
@@ -5078,7 +5260,6 @@ index_builder_loader_task::index_builder_loader_task (const BTID *btid, const OI
   BTID_COPY (&m_btid, btid);
   COPY_OID (&m_class_oid, class_oid);
   m_unique_pk = unique_pk;
-  m_load_context.m_has_error = false;
   m_memsize = 0;
 }
 
@@ -5188,3 +5369,533 @@ index_builder_loader_task::execute (cubthread::entry &thread_ref)
   m_load_context.m_tasks_executed++;
 }
 // *INDENT-ON*
+
+// *INDENT-OFF*
+//
+// index_key_batch
+//
+
+class index_key_batch
+{
+  public:
+    std::vector<char> m_data;
+    std::vector<std::size_t> m_offsets;
+    std::vector<int> m_lengths;
+    std::size_t m_position;       // next item to consume
+
+    index_key_batch ()
+      : m_data ()
+      , m_offsets ()
+      , m_lengths ()
+      , m_position (0)
+    {
+    }
+
+    void clear ()
+    {
+      m_data.clear ();
+      m_offsets.clear ();
+      m_lengths.clear ();
+      m_position = 0;
+    }
+
+    void append (const RECDES &item)
+    {
+      std::size_t offset = m_data.size ();
+
+      m_data.resize (offset + item.length);
+      std::memcpy (m_data.data () + offset, item.data, item.length);
+      m_offsets.push_back (offset);
+      m_lengths.push_back (item.length);
+    }
+
+    bool has_next () const
+    {
+      return m_position < m_offsets.size ();
+    }
+};
+
+//
+// index_key_producer
+//
+
+struct index_key_producer::producer_state
+{
+  HEAP_SCANCACHE m_scan_cache;
+  bool m_scan_cache_inited;
+  HEAP_CACHE_ATTRINFO m_attr_info;
+  bool m_attrinfo_inited;
+  int m_cur_class;
+  std::vector<char> m_item_area;        // sort item being built
+  int m_n_oids;
+  int m_n_nulls;
+
+  producer_state ()
+    : m_scan_cache ()
+    , m_scan_cache_inited (false)
+    , m_attr_info ()
+    , m_attrinfo_inited (false)
+    , m_cur_class (-1)
+    , m_item_area (DB_PAGESIZE + MAX_ALIGNMENT)
+    , m_n_oids (0)
+    , m_n_nulls (0)
+  {
+  }
+
+  // prepare to read the heap of class cur_class
+  int switch_class (cubthread::entry &thread_ref, SORT_ARGS &sort_args, int cur_class)
+  {
+    int error_code;
+
+    if (m_cur_class == cur_class)
+      {
+	return NO_ERROR;
+      }
+    clear (thread_ref);
+
+    error_code = heap_scancache_start (&thread_ref, &m_scan_cache, &sort_args.hfids[cur_class],
+				       &sort_args.class_ids[cur_class], true, false, NULL);
+    if (error_code != NO_ERROR)
+      {
+	return error_code;
+      }
+    m_scan_cache_inited = true;
+
+    error_code = heap_attrinfo_start (&thread_ref, &sort_args.class_ids[cur_class], sort_args.n_attrs,
+				      &sort_args.attr_ids[cur_class * sort_args.n_attrs], &m_attr_info);
+    if (error_code != NO_ERROR)
+      {
+	return error_code;
+      }
+    m_attrinfo_inited = true;
+    m_cur_class = cur_class;
+
+    return NO_ERROR;
+  }
+
+  void clear (cubthread::entry &thread_ref)
+  {
+    if (m_attrinfo_inited)
+      {
+	heap_attrinfo_end (&thread_ref, &m_attr_info);
+	m_attrinfo_inited = false;
+      }
+    if (m_scan_cache_inited)
+      {
+	(void) heap_scancache_end (&thread_ref, &m_scan_cache);
+	m_scan_cache_inited = false;
+      }
+    m_cur_class = -1;
+  }
+};
+
+index_key_producer::index_key_producer (SORT_ARGS &sort_args, int worker_count)
+  : cubheap::batch_producer<index_key_batch> ()
+  , m_sort_args (sort_args)
+  , m_worker_count (worker_count)
+  , m_started (false)
+  , m_own_state (NULL)
+  , m_batch (NULL)
+  , m_n_oids (0)
+  , m_n_nulls (0)
+{
+}
+
+index_key_producer::~index_key_producer ()
+{
+  assert (!m_started);
+
+  delete m_own_state;
+}
+
+int
+index_key_producer::start (cubthread::entry &thread_ref)
+{
+  int error_code;
+
+  assert (!m_started);
+
+  error_code = m_ranges.collect (thread_ref, m_sort_args.hfids, m_sort_args.n_classes);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  m_own_state = new producer_state ();
+  m_started = true;
+
+  // the sort thread takes part in the load
+  m_worker_count = get_worker_limit (m_worker_count);
+  // workers read as the transaction of the load (own inserts, interrupts)
+  (void) start_producers (thread_ref, m_worker_count, thread_ref.tran_index);
+
+  return NO_ERROR;
+}
+
+void
+index_key_producer::end (cubthread::entry &thread_ref)
+{
+  if (!m_started)
+    {
+      return;
+    }
+
+  end_producers ();
+  m_batch = NULL;
+
+  m_own_state->clear (thread_ref);
+  m_n_oids += m_own_state->m_n_oids;
+  m_n_nulls += m_own_state->m_n_nulls;
+
+  m_sort_args.n_oids += m_n_oids;
+  m_sort_args.n_nulls += m_n_nulls;
+
+  m_ranges.clear ();
+  m_started = false;
+}
+
+SORT_STATUS
+index_key_producer::get_next (cubthread::entry &thread_ref, RECDES &temp_recdes)
+{
+  int length;
+
+  // when no batch is ready, the items of a range are produced on this thread
+  auto produce_own_range = [&] (const cubheap::page_ranges::range &range, index_key_batch &items)
+  {
+    return produce_range (thread_ref, *m_own_state, range, items);
+  };
+
+  while (m_batch == NULL || !m_batch->has_next ())
+    {
+      if (next_batch (m_batch, produce_own_range) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return SORT_ERROR_OCCURRED;
+	}
+      if (m_batch == NULL)
+	{
+	  return SORT_NOMORE_RECS;
+	}
+    }
+
+  length = m_batch->m_lengths[m_batch->m_position];
+  if (temp_recdes.area_size < length)
+    {
+      temp_recdes.length = length;
+      return SORT_REC_DOESNT_FIT;
+    }
+  std::memcpy (temp_recdes.data, m_batch->m_data.data () + m_batch->m_offsets[m_batch->m_position], length);
+  temp_recdes.length = length;
+  m_batch->m_position++;
+  return SORT_SUCCESS;
+}
+
+void
+index_key_producer::execute_worker (cubthread::entry &thread_ref, int worker_index)
+{
+  producer_state state;
+  auto produce_worker_range = [&] (const cubheap::page_ranges::range &range, index_key_batch &items)
+  {
+    return produce_range (thread_ref, state, range, items);
+  };
+
+  produce_batches (produce_worker_range);
+  state.clear (thread_ref);
+
+  m_n_oids += state.m_n_oids;
+  m_n_nulls += state.m_n_nulls;
+}
+
+int
+index_key_producer::produce_range (cubthread::entry &thread_ref, producer_state &state,
+				   const cubheap::page_ranges::range &range, index_key_batch &items)
+{
+  OID *class_oid = &m_sort_args.class_ids[range.heap_index];
+  RECDES recdes, item;
+  OID oid;
+  SCAN_CODE sc;
+  SORT_STATUS status;
+  bool continue_checking = true;
+  int n_rows = 0;
+  int error_code = NO_ERROR;
+
+  error_code = state.switch_class (thread_ref, m_sort_args, range.heap_index);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  for (std::size_t i = range.first; i < range.last && !is_stopped (); i++)
+    {
+      if (is_interrupted (thread_ref, continue_checking))
+	{
+	  error_code = ER_INTERRUPTED;
+	  break;
+	}
+
+      const VPID &vpid = m_ranges.get_page (range.heap_index, i);
+
+      oid.volid = vpid.volid;
+      oid.pageid = vpid.pageid;
+      oid.slotid = NULL_SLOTID;
+      while (true)
+	{
+	  recdes.data = NULL;
+	  sc = heap_next_in_page (&thread_ref, &vpid, class_oid, &oid, &recdes, &state.m_scan_cache, PEEK);
+	  if (sc != S_SUCCESS)
+	    {
+	      break;
+	    }
+	  n_rows++;
+
+	  do
+	    {
+	      item.data = PTR_ALIGN (state.m_item_area.data (), MAX_ALIGNMENT);
+	      item.area_size = (int) state.m_item_area.size () - MAX_ALIGNMENT;
+	      status = btree_sort_make_item (&thread_ref, &m_sort_args, range.heap_index, &oid, &recdes,
+					     &state.m_attr_info, &item, &state.m_n_oids, &state.m_n_nulls);
+	      if (status == SORT_REC_DOESNT_FIT)
+		{
+		  // make room for the item and build it again
+		  state.m_item_area.resize (std::max (state.m_item_area.size () * 2,
+						      (std::size_t) item.length + MAX_ALIGNMENT));
+		}
+	    }
+	  while (status == SORT_REC_DOESNT_FIT);
+
+	  if (status != SORT_SUCCESS)
+	    {
+	      ASSERT_ERROR_AND_SET (error_code);
+	      break;
+	    }
+	  if (item.length > 0)
+	    {
+	      items.append (item);
+	    }
+	}
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+      if (sc != S_END)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  break;
+	}
+    }
+
+  perfmon_add_stat (&thread_ref, PSTAT_BT_NUM_LOAD_ROWS, n_rows);
+
+  return error_code;
+}
+// *INDENT-ON*
+
+// *INDENT-OFF*
+//
+// index_builder_scan
+//
+
+index_builder_scan::index_builder_scan (const BTID_INT *btid_int, const HFID *hfid, const OID *class_oid, int *attrids,
+					int n_attrs, int *attrs_prefix_length, int unique_pk, MVCC_SNAPSHOT *snapshot,
+					index_builder_loader_context &load_context, std::atomic<int> &num_keys,
+					std::atomic<int> &num_oids, std::atomic<int> &num_nulls)
+  : cubheap::range_workers ()
+  , m_attrids (attrids)
+  , m_n_attrs (n_attrs)
+  , m_attrs_prefix_length (attrs_prefix_length)
+  , m_unique_pk (unique_pk)
+  , m_snapshot (snapshot)
+  , m_load_context (load_context)
+  , m_num_keys (num_keys)
+  , m_num_oids (num_oids)
+  , m_num_nulls (num_nulls)
+{
+  BTID_COPY (&m_btid, btid_int->sys_btid);
+  HFID_COPY (&m_hfid, hfid);
+  COPY_OID (&m_class_oid, class_oid);
+}
+
+int
+index_builder_scan::run (cubthread::entry &thread_ref, int thread_count)
+{
+  int worker_count;
+  int ret = NO_ERROR;
+
+  ret = m_ranges.collect (thread_ref, &m_hfid, 1);
+  if (ret != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return ret;
+    }
+
+  /* This thread scans too. Workers insert keys as the system transaction, like the tasks of the loader pool. */
+  worker_count = get_worker_limit (thread_count - 1);
+  (void) start_workers (thread_ref, worker_count, LOG_SYSTEM_TRAN_INDEX);
+  execute_worker (thread_ref, 0);
+  wait_workers ();
+  m_ranges.clear ();
+
+  ret = raise_error ();
+  if (ret == NO_ERROR && m_load_context.m_has_error)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IB_ERROR_ABORT, 0);
+      ret = m_load_context.m_error_code;
+    }
+
+  return ret;
+}
+
+void
+index_builder_scan::execute_worker (cubthread::entry &thread_ref, int worker_index)
+{
+  HEAP_SCANCACHE scan_cache;
+  HEAP_CACHE_ATTRINFO attr_info;
+  bool scan_cache_inited = false;
+  bool attr_info_inited = false;
+  std::unique_ptr<index_builder_loader_task> load_task;
+  cubheap::page_ranges::range range;
+  int ret = NO_ERROR;
+
+  ret = heap_scancache_start (&thread_ref, &scan_cache, &m_hfid, &m_class_oid, true, false, NULL);
+  if (ret == NO_ERROR)
+    {
+      scan_cache_inited = true;
+      /* Read like the index builder. */
+      scan_cache.mvcc_snapshot = m_snapshot;
+
+      ret = heap_attrinfo_start (&thread_ref, &m_class_oid, m_n_attrs, m_attrids, &attr_info);
+      attr_info_inited = (ret == NO_ERROR);
+    }
+
+  while (ret == NO_ERROR && !is_stopped () && !m_load_context.m_has_error && m_ranges.claim (range))
+    {
+      ret = scan_range (thread_ref, range, scan_cache, attr_info, load_task);
+    }
+
+  if (ret == NO_ERROR && load_task != NULL && load_task->has_keys () && !m_load_context.m_has_error)
+    {
+      /* Insert the last keys. Errors are set in the loader context. */
+      load_task->execute (thread_ref);
+    }
+  load_task.reset ();
+
+  if (ret != NO_ERROR)
+    {
+      set_error ();
+    }
+
+  if (attr_info_inited)
+    {
+      heap_attrinfo_end (&thread_ref, &attr_info);
+    }
+  if (scan_cache_inited)
+    {
+      (void) heap_scancache_end (&thread_ref, &scan_cache);
+    }
+}
+
+int
+index_builder_scan::scan_range (cubthread::entry &thread_ref, const cubheap::page_ranges::range &range,
+				HEAP_SCANCACHE &scan_cache, HEAP_CACHE_ATTRINFO &attr_info,
+				std::unique_ptr<index_builder_loader_task> &load_task)
+{
+  char midxkey_buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_midxkey_buf;
+  index_builder_loader_task::batch_key_status status = index_builder_loader_task::BATCH_CONTINUE;
+  DB_VALUE dbvalue;
+  DB_VALUE *p_dbvalue;
+  RECDES recdes;
+  OID oid;
+  SCAN_CODE sc;
+  bool continue_checking = true;
+  int n_rows = 0;
+  int ret = NO_ERROR;
+
+  aligned_midxkey_buf = PTR_ALIGN (midxkey_buf, MAX_ALIGNMENT);
+
+  for (std::size_t i = range.first; i < range.last; i++)
+    {
+      if (is_stopped () || m_load_context.m_has_error)
+	{
+	  /* Stopped by another thread. */
+	  break;
+	}
+      if (is_interrupted (thread_ref, continue_checking))
+	{
+	  ret = ER_INTERRUPTED;
+	  break;
+	}
+
+      const VPID &vpid = m_ranges.get_page (range.heap_index, i);
+
+      oid.volid = vpid.volid;
+      oid.pageid = vpid.pageid;
+      oid.slotid = NULL_SLOTID;
+      while (true)
+	{
+	  recdes.data = NULL;
+	  sc = heap_next_in_page (&thread_ref, &vpid, &m_class_oid, &oid, &recdes, &scan_cache, PEEK);
+	  if (sc != S_SUCCESS)
+	    {
+	      break;
+	    }
+	  n_rows++;
+
+	  if (m_n_attrs == 1)
+	    {
+	      /* Single column index. */
+	      ret = heap_attrinfo_read_dbvalues (&thread_ref, &oid, &recdes, NULL, &attr_info);
+	      if (ret != NO_ERROR)
+		{
+		  break;
+		}
+	    }
+
+	  db_make_null (&dbvalue);
+	  p_dbvalue = heap_attrinfo_generate_key (&thread_ref, m_n_attrs, m_attrids, m_attrs_prefix_length,
+						  &attr_info, &recdes, &dbvalue, aligned_midxkey_buf, NULL,
+						  const_cast<TP_DOMAIN *> (m_load_context.m_key_type));
+	  if (p_dbvalue == NULL)
+	    {
+	      ret = ER_FAILED;
+	      break;
+	    }
+
+	  if (load_task == NULL)
+	    {
+	      load_task.reset (new index_builder_loader_task (&m_btid, &m_class_oid, m_unique_pk, m_load_context,
+							      m_num_keys, m_num_oids, m_num_nulls));
+	    }
+	  if (load_task->add_key (p_dbvalue, oid) == index_builder_loader_task::BATCH_FULL)
+	    {
+	      status = index_builder_loader_task::BATCH_FULL;
+	    }
+
+	  /* Clear index key. */
+	  pr_clear_value (p_dbvalue);
+	}
+      if (ret != NO_ERROR)
+	{
+	  break;
+	}
+      if (sc != S_END)
+	{
+	  ASSERT_ERROR_AND_SET (ret);
+	  break;
+	}
+
+      /* The page was unfixed at its end; insert the keys without holding heap pages. */
+      if (status == index_builder_loader_task::BATCH_FULL)
+	{
+	  load_task->execute (thread_ref);
+	  load_task.reset ();
+	  status = index_builder_loader_task::BATCH_CONTINUE;
+	}
+    }
+
+  perfmon_add_stat (&thread_ref, PSTAT_BT_NUM_LOAD_ROWS, n_rows);
+
+  return ret;
+}
+// *INDENT-ON*
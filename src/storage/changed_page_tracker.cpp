@@ -0,0 +1,586 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// changed_page_tracker.cpp - bitmaps of data pages changed since the last backups, used by incremental backup
+//
+
+#include "changed_page_tracker.hpp"
+
+#include "crc32c.hpp"
+
+#include <bitset>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <string>
+
+namespace cubio
+{
+  //
+  // file layout: header, then one record for each non-empty chunk of each complete bitmap, then an end record and the
+  // CRC-32C of everything before it.
+  //
+  static const char CHANGED_PAGE_FILE_MAGIC[8] = { 'C', 'U', 'B', 'C', 'P', 'T', '0', '1' };
+
+  struct changed_page_file_header
+  {
+    char magic[8];
+    std::int64_t db_creation;
+    std::int64_t rebuild_lsa_pageid;
+    std::int64_t rebuild_lsa_offset;
+    std::int32_t valid_levels[changed_page_tracker::LEVEL_COUNT];
+  };
+
+  struct changed_page_file_record
+  {
+    std::int32_t level;		// -1 for end record
+    std::int32_t volid;
+    std::int32_t chunk_index;
+  };
+
+  //
+  // changed_page_bitmap
+  //
+
+  changed_page_bitmap::changed_page_bitmap ()
+    : m_volumes (new std::atomic<chunk_table *>[MAX_VOLUMES])
+  {
+    for (int i = 0; i < MAX_VOLUMES; i++)
+      {
+	m_volumes[i].store (NULL);
+      }
+  }
+
+  changed_page_bitmap::~changed_page_bitmap ()
+  {
+    for (int volid = 0; volid < MAX_VOLUMES; volid++)
+      {
+	chunk_table *table = m_volumes[volid].load ();
+	if (table == NULL)
+	  {
+	    continue;
+	  }
+	for (int i = 0; i < CHUNKS_PER_VOLUME; i++)
+	  {
+	    delete [] table[i].load ();
+	  }
+	delete [] table;
+      }
+    delete [] m_volumes;
+  }
+
+  std::atomic<std::uint64_t> *
+  changed_page_bitmap::get_or_create_chunk (int volid, int chunk_index)
+  {
+    if (volid < 0 || volid >= MAX_VOLUMES || chunk_index < 0 || chunk_index >= CHUNKS_PER_VOLUME)
+      {
+	return NULL;
+      }
+
+    chunk_table *table = m_volumes[volid].load (std::memory_order_acquire);
+    if (table == NULL)
+      {
+	chunk_table *new_table = new (std::nothrow) chunk_table[CHUNKS_PER_VOLUME];
+	if (new_table == NULL)
+	  {
+	    return NULL;
+	  }
+	for (int i = 0; i < CHUNKS_PER_VOLUME; i++)
+	  {
+	    new_table[i].store (NULL);
+	  }
+	if (m_volumes[volid].compare_exchange_strong (table, new_table))
+	  {
+	    table = new_table;
+	  }
+	else
+	  {
+	    // other thread was faster; table was updated by compare_exchange_strong
+	    delete [] new_table;
+	  }
+      }
+
+    chunk_type *chunk = table[chunk_index].load (std::memory_order_acquire);
+    if (chunk == NULL)
+      {
+	chunk_type *new_chunk = new (std::nothrow) chunk_type[CHUNK_WORDS];
+	if (new_chunk == NULL)
+	  {
+	    return NULL;
+	  }
+	for (int i = 0; i < CHUNK_WORDS; i++)
+	  {
+	    new_chunk[i].store (0);
+	  }
+	if (table[chunk_index].compare_exchange_strong (chunk, new_chunk))
+	  {
+	    chunk = new_chunk;
+	  }
+	else
+	  {
+	    delete [] new_chunk;
+	  }
+      }
+    return chunk;
+  }
+
+  const std::atomic<std::uint64_t> *
+  changed_page_bitmap::get_chunk (int volid, int chunk_index) const
+  {
+    if (volid < 0 || volid >= MAX_VOLUMES || chunk_index < 0 || chunk_index >= CHUNKS_PER_VOLUME)
+      {
+	return NULL;
+      }
+
+    const chunk_table *table = m_volumes[volid].load (std::memory_order_acquire);
+    if (table == NULL)
+      {
+	return NULL;
+      }
+    return table[chunk_index].load (std::memory_order_acquire);
+  }
+
+  bool
+  changed_page_bitmap::has_volume (int volid) const
+  {
+    return volid >= 0 && volid < MAX_VOLUMES && m_volumes[volid].load (std::memory_order_acquire) != NULL;
+  }
+
+  bool
+  changed_page_bitmap::set (int volid, int pageid)
+  {
+    if (pageid < 0)
+      {
+	return true;
+      }
+
+    std::atomic<std::uint64_t> *chunk = get_or_create_chunk (volid, pageid >> CHUNK_PAGES_LOG2);
+    if (chunk == NULL)
+      {
+	return false;
+      }
+
+    int bit = pageid & (CHUNK_PAGES - 1);
+    std::uint64_t mask = ((std::uint64_t) 1) << (bit & 63);
+    if ((chunk[bit >> 6].load (std::memory_order_relaxed) & mask) == 0)
+      {
+	chunk[bit >> 6].fetch_or (mask);
+      }
+    return true;
+  }
+
+  bool
+  changed_page_bitmap::test (int volid, int pageid) const
+  {
+    if (pageid < 0)
+      {
+	return false;
+      }
+
+    const std::atomic<std::uint64_t> *chunk = get_chunk (volid, pageid >> CHUNK_PAGES_LOG2);
+    if (chunk == NULL)
+      {
+	return false;
+      }
+
+    int bit = pageid & (CHUNK_PAGES - 1);
+    return (chunk[bit >> 6].load () & (((std::uint64_t) 1) << (bit & 63))) != 0;
+  }
+
+  void
+  changed_page_bitmap::clear ()
+  {
+    for (int volid = 0; volid < MAX_VOLUMES; volid++)
+      {
+	chunk_table *table = m_volumes[volid].load ();
+	if (table == NULL)
+	  {
+	    continue;
+	  }
+	for (int i = 0; i < CHUNKS_PER_VOLUME; i++)
+	  {
+	    chunk_type *chunk = table[i].load ();
+	    if (chunk == NULL)
+	      {
+		continue;
+	      }
+	    for (int w = 0; w < CHUNK_WORDS; w++)
+	      {
+		chunk[w].store (0, std::memory_order_relaxed);
+	      }
+	  }
+      }
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+  }
+
+  std::size_t
+  changed_page_bitmap::count () const
+  {
+    std::size_t total = 0;
+
+    for (int volid = 0; volid < MAX_VOLUMES; volid++)
+      {
+	const chunk_table *table = m_volumes[volid].load ();
+	if (table == NULL)
+	  {
+	    continue;
+	  }
+	for (int i = 0; i < CHUNKS_PER_VOLUME; i++)
+	  {
+	    const chunk_type *chunk = table[i].load ();
+	    if (chunk == NULL)
+	      {
+		continue;
+	      }
+	    for (int w = 0; w < CHUNK_WORDS; w++)
+	      {
+		total += std::bitset<64> (chunk[w].load (std::memory_order_relaxed)).count ();
+	      }
+	  }
+      }
+    return total;
+  }
+
+  //
+  // changed_page_tracker
+  //
+
+  changed_page_tracker::changed_page_tracker ()
+    : m_bitmaps ()
+    , m_current ()
+    , m_pending ()
+    , m_mutex ()
+  {
+    for (int level = 0; level < LEVEL_COUNT; level++)
+      {
+	m_current[level].store (NO_BITMAP);
+	m_pending[level].store (NO_BITMAP);
+      }
+  }
+
+  void
+  changed_page_tracker::mark (int volid, int pageid)
+  {
+    int index;
+
+    for (int level = 0; level < LEVEL_COUNT; level++)
+      {
+	index = m_current[level].load ();
+	if (index != NO_BITMAP && !m_bitmaps[index].set (volid, pageid))
+	  {
+	    // out of memory; the bitmap is not complete anymore
+	    m_current[level].compare_exchange_strong (index, NO_BITMAP);
+	  }
+	index = m_pending[level].load ();
+	if (index != NO_BITMAP && !m_bitmaps[index].set (volid, pageid))
+	  {
+	    m_pending[level].compare_exchange_strong (index, NO_BITMAP);
+	  }
+      }
+  }
+
+  int
+  changed_page_tracker::get_free_bitmap () const
+  {
+    for (int index = 0; index < BITMAP_COUNT; index++)
+      {
+	bool is_used = false;
+	for (int level = 0; level < LEVEL_COUNT; level++)
+	  {
+	    if (m_current[level].load () == index || m_pending[level].load () == index)
+	      {
+		is_used = true;
+		break;
+	      }
+	  }
+	if (!is_used)
+	  {
+	    return index;
+	  }
+      }
+
+    // there are two bitmaps for each level
+    assert (false);
+    return NO_BITMAP;
+  }
+
+  void
+  changed_page_tracker::start_backup (int level)
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+
+    // a backup of level N restarts tracking for levels N and higher
+    for (int base_level = level < 0 ? 0 : level; base_level < LEVEL_COUNT; base_level++)
+      {
+	int index = m_pending[base_level].load ();
+	if (index == NO_BITMAP)
+	  {
+	    index = get_free_bitmap ();
+	    if (index == NO_BITMAP)
+	      {
+		continue;
+	      }
+	  }
+	// late marks of a previous use may still land in the bitmap; extra bits are harmless
+	m_bitmaps[index].clear ();
+	m_pending[base_level].store (index);
+      }
+  }
+
+  void
+  changed_page_tracker::end_backup (int level, bool success)
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+
+    for (int base_level = level < 0 ? 0 : level; base_level < LEVEL_COUNT; base_level++)
+      {
+	int index = m_pending[base_level].load ();
+	if (index == NO_BITMAP)
+	  {
+	    continue;
+	  }
+	if (success)
+	  {
+	    m_current[base_level].store (index);
+	  }
+	m_pending[base_level].store (NO_BITMAP);
+      }
+  }
+
+  const changed_page_bitmap *
+  changed_page_tracker::get_backup_bitmap (int level) const
+  {
+    // backup of level N is based on last backup of level N - 1. changes since a lower level backup are a superset.
+    for (int base_level = level - 1; base_level >= 0; base_level--)
+      {
+	if (base_level >= LEVEL_COUNT)
+	  {
+	    continue;
+	  }
+	int index = m_current[base_level].load ();
+	if (index != NO_BITMAP)
+	  {
+	    return &m_bitmaps[index];
+	  }
+      }
+    return NULL;
+  }
+
+  void
+  changed_page_tracker::invalidate ()
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+
+    for (int level = 0; level < LEVEL_COUNT; level++)
+      {
+	m_current[level].store (NO_BITMAP);
+	m_pending[level].store (NO_BITMAP);
+      }
+  }
+
+  bool
+  changed_page_tracker::is_valid (int base_level) const
+  {
+    return base_level >= 0 && base_level < LEVEL_COUNT && m_current[base_level].load () != NO_BITMAP;
+  }
+
+  bool
+  changed_page_tracker::save (const char *file_name, std::int64_t db_creation, const log_lsa &rebuild_lsa)
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    changed_page_file_header header;
+    changed_page_file_record record;
+    std::uint64_t words[changed_page_bitmap::CHUNK_WORDS];
+    std::uint32_t crc;
+    std::string tmp_file_name (file_name);
+    FILE *fp;
+    bool success = true;
+
+    std::memset (&header, 0, sizeof (header));
+    std::memcpy (header.magic, CHANGED_PAGE_FILE_MAGIC, sizeof (header.magic));
+    header.db_creation = db_creation;
+    header.rebuild_lsa_pageid = rebuild_lsa.pageid;
+    header.rebuild_lsa_offset = rebuild_lsa.offset;
+    for (int level = 0; level < LEVEL_COUNT; level++)
+      {
+	header.valid_levels[level] = m_current[level].load () != NO_BITMAP ? 1 : 0;
+      }
+
+    // write aside and rename, so that a crash never leaves a partial file behind
+    tmp_file_name += ".tmp";
+    fp = std::fopen (tmp_file_name.c_str (), "wb");
+    if (fp == NULL)
+      {
+	return false;
+      }
+
+    success = std::fwrite (&header, sizeof (header), 1, fp) == 1;
+    crc = cubbase::crc32c (&header, sizeof (header));
+    for (int level = 0; level < LEVEL_COUNT && success; level++)
+      {
+	int index = m_current[level].load ();
+	if (index == NO_BITMAP)
+	  {
+	    continue;
+	  }
+	for (int volid = 0; volid < changed_page_bitmap::MAX_VOLUMES && success; volid++)
+	  {
+	    if (!m_bitmaps[index].has_volume (volid))
+	      {
+		continue;
+	      }
+	    for (int chunk_index = 0; chunk_index < changed_page_bitmap::CHUNKS_PER_VOLUME && success; chunk_index++)
+	      {
+		const std::atomic<std::uint64_t> *chunk = m_bitmaps[index].get_chunk (volid, chunk_index);
+		if (chunk == NULL)
+		  {
+		    continue;
+		  }
+
+		bool is_empty = true;
+		for (int w = 0; w < changed_page_bitmap::CHUNK_WORDS; w++)
+		  {
+		    words[w] = chunk[w].load (std::memory_order_relaxed);
+		    is_empty = is_empty && words[w] == 0;
+		  }
+		if (is_empty)
+		  {
+		    continue;
+		  }
+
+		record.level = level;
+		record.volid = volid;
+		record.chunk_index = chunk_index;
+		success = (std::fwrite (&record, sizeof (record), 1, fp) == 1
+			   && std::fwrite (words, sizeof (words), 1, fp) == 1);
+		crc = cubbase::crc32c_extend (crc, &record, sizeof (record));
+		crc = cubbase::crc32c_extend (crc, words, sizeof (words));
+	      }
+	  }
+      }
+
+    if (success)
+      {
+	record.level = -1;
+	record.volid = -1;
+	record.chunk_index = -1;
+	crc = cubbase::crc32c_extend (crc, &record, sizeof (record));
+	success = (std::fwrite (&record, sizeof (record), 1, fp) == 1 && std::fwrite (&crc, sizeof (crc), 1, fp) == 1
+		   && std::fflush (fp) == 0);
+      }
+
+    if (std::fclose (fp) != 0)
+      {
+	success = false;
+      }
+    if (!success || std::rename (tmp_file_name.c_str (), file_name) != 0)
+      {
+	(void) std::remove (tmp_file_name.c_str ());
+	return false;
+      }
+    return true;
+  }
+
+  bool
+  changed_page_tracker::load (const char *file_name, std::int64_t db_creation, log_lsa &rebuild_lsa)
+  {
+    changed_page_file_header header;
+    changed_page_file_record record;
+    std::uint64_t words[changed_page_bitmap::CHUNK_WORDS];
+    std::uint32_t crc, saved_crc;
+    int indexes[LEVEL_COUNT];
+    FILE *fp;
+    bool success;
+
+    invalidate ();
+
+    std::unique_lock<std::mutex> ulock (m_mutex);
+
+    fp = std::fopen (file_name, "rb");
+    if (fp == NULL)
+      {
+	return false;
+      }
+
+    success = (std::fread (&header, sizeof (header), 1, fp) == 1
+	       && std::memcmp (header.magic, CHANGED_PAGE_FILE_MAGIC, sizeof (header.magic)) == 0
+	       && header.db_creation == db_creation);
+    crc = cubbase::crc32c (&header, sizeof (header));
+
+    for (int level = 0; level < LEVEL_COUNT; level++)
+      {
+	indexes[level] = NO_BITMAP;
+	if (success && header.valid_levels[level] != 0)
+	  {
+	    indexes[level] = level;
+	    m_bitmaps[level].clear ();
+	  }
+      }
+
+    while (success)
+      {
+	if (std::fread (&record, sizeof (record), 1, fp) != 1)
+	  {
+	    success = false;
+	    break;
+	  }
+	crc = cubbase::crc32c_extend (crc, &record, sizeof (record));
+	if (record.level == -1)
+	  {
+	    // end record
+	    success = std::fread (&saved_crc, sizeof (saved_crc), 1, fp) == 1 && saved_crc == crc;
+	    break;
+	  }
+	if (record.level < 0 || record.level >= LEVEL_COUNT || indexes[record.level] == NO_BITMAP
+	    || std::fread (words, sizeof (words), 1, fp) != 1)
+	  {
+	    success = false;
+	    break;
+	  }
+	crc = cubbase::crc32c_extend (crc, words, sizeof (words));
+
+	std::atomic<std::uint64_t> *chunk =
+		m_bitmaps[indexes[record.level]].get_or_create_chunk (record.volid, record.chunk_index);
+	if (chunk == NULL)
+	  {
+	    success = false;
+	    break;
+	  }
+	for (int w = 0; w < changed_page_bitmap::CHUNK_WORDS; w++)
+	  {
+	    chunk[w].store (words[w], std::memory_order_relaxed);
+	  }
+      }
+    std::fclose (fp);
+
+    if (!success)
+      {
+	return false;
+      }
+
+    rebuild_lsa.pageid = header.rebuild_lsa_pageid;
+    rebuild_lsa.offset = header.rebuild_lsa_offset;
+    for (int level = 0; level < LEVEL_COUNT; level++)
+      {
+	m_current[level].store (indexes[level]);
+      }
+    return true;
+  }
+} // namespace cubio
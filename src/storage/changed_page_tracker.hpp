@@ -0,0 +1,134 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// changed_page_tracker.hpp - bitmaps of data pages changed since the last backups, used by incremental backup
+//
+
+#ifndef _CHANGED_PAGE_TRACKER_HPP_
+#define _CHANGED_PAGE_TRACKER_HPP_
+
+#include "log_lsa.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace cubio
+{
+  //  changed_page_bitmap - one bit for each page of each volume
+  //
+  //  Bits are set without locks and concurrently with readers. Memory is allocated in chunks, on first set in a chunk,
+  //  and is not released until the bitmap is destroyed; clear () only resets the bits, so that it is safe to call
+  //  while other threads may still set bits.
+  //
+  class changed_page_bitmap
+  {
+    public:
+      static const int MAX_VOLUMES = 32768;
+      static const int CHUNK_PAGES_LOG2 = 18;
+      static const int CHUNK_PAGES = 1 << CHUNK_PAGES_LOG2;
+      static const int CHUNK_WORDS = CHUNK_PAGES / 64;
+      static const int CHUNKS_PER_VOLUME = (int) ((1U << 31) >> CHUNK_PAGES_LOG2);
+
+      changed_page_bitmap ();
+      ~changed_page_bitmap ();
+
+      changed_page_bitmap (const changed_page_bitmap &) = delete;
+      changed_page_bitmap &operator= (const changed_page_bitmap &) = delete;
+
+      // set page bit; returns false if memory cannot be allocated
+      bool set (int volid, int pageid);
+      bool test (int volid, int pageid) const;
+      void clear ();
+      std::size_t count () const;
+      bool has_volume (int volid) const;
+
+      // get allocated chunk, or NULL
+      const std::atomic<std::uint64_t> *get_chunk (int volid, int chunk_index) const;
+      // get chunk, allocating it if needed. returns NULL if allocation fails.
+      std::atomic<std::uint64_t> *get_or_create_chunk (int volid, int chunk_index);
+
+    private:
+      using chunk_type = std::atomic<std::uint64_t>;
+      using chunk_table = std::atomic<chunk_type *>;
+
+      std::atomic<chunk_table *> *m_volumes;
+  };
+
+  //  changed_page_tracker - tracks the pages changed since the last backups of levels 0 and 1
+  //
+  //  An incremental backup of level N only needs the pages changed since the last backup of level N - 1. The tracker
+  //  keeps one bitmap for each base level. Tracking for a level (re)starts when a backup of that level (or lower)
+  //  starts, in a pending bitmap that replaces the current one only if the backup succeeds. Until a bitmap is complete,
+  //  get_backup_bitmap returns NULL and backup has to scan every page.
+  //
+  //  How to use:
+  //
+  //      tracker.mark (volid, pageid);           // before a changed page is written to disk
+  //
+  //      tracker.start_backup (level);           // before backup reads the volumes
+  //      bitmap = tracker.get_backup_bitmap (level);
+  //      ... backup pages that are set in bitmap, or all pages if bitmap is NULL
+  //      tracker.end_backup (level, success);
+  //
+  //  The state is saved with save () and restored with load (). A saved state is complete only together with the
+  //  pages logged since the rebuild LSA given to save (); recovery must mark them again.
+  //
+  class changed_page_tracker
+  {
+    public:
+      static const int LEVEL_COUNT = 2;
+
+      changed_page_tracker ();
+      ~changed_page_tracker () = default;
+
+      changed_page_tracker (const changed_page_tracker &) = delete;
+      changed_page_tracker &operator= (const changed_page_tracker &) = delete;
+
+      void mark (int volid, int pageid);
+
+      void start_backup (int level);
+      void end_backup (int level, bool success);
+
+      // bitmap of pages changed since the backup that a backup of given level is based on; NULL if not complete
+      const changed_page_bitmap *get_backup_bitmap (int level) const;
+
+      // forget all tracked changes
+      void invalidate ();
+      bool is_valid (int base_level) const;
+
+      // save/load state; rebuild_lsa is saved along. return false on I/O error or on invalid file.
+      bool save (const char *file_name, std::int64_t db_creation, const log_lsa &rebuild_lsa);
+      bool load (const char *file_name, std::int64_t db_creation, log_lsa &rebuild_lsa);
+
+    private:
+      static const int BITMAP_COUNT = 2 * LEVEL_COUNT;
+      static const int NO_BITMAP = -1;
+
+      int get_free_bitmap () const;
+
+      changed_page_bitmap m_bitmaps[BITMAP_COUNT];
+      std::atomic<int> m_current[LEVEL_COUNT];	// bitmaps complete since last backup of level; or NO_BITMAP
+      std::atomic<int> m_pending[LEVEL_COUNT];	// bitmaps started by running backup; or NO_BITMAP
+      std::mutex m_mutex;			// serialize changes of m_current and m_pending
+  };
+} // namespace cubio
+
+#endif // _CHANGED_PAGE_TRACKER_HPP_
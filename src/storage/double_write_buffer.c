@@ -350,6 +350,7 @@ STATIC_INLINE int dwb_block_create_ordered_slots (DWB_BLOCK * block, DWB_SLOT **
 static int dwb_compare_vol_fd (const void *v1, const void *v2);
 STATIC_INLINE FLUSH_VOLUME_INFO *dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
 								     int vol_fd) __attribute__ ((ALWAYS_INLINE));
+static int dwb_write_block_pages_batch (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots);
 STATIC_INLINE int dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_slots,
 				   unsigned int ordered_slots_length, bool file_sync_helper_can_flush,
 				   bool remove_from_hash) __attribute__ ((ALWAYS_INLINE));
@@ -1025,7 +1026,16 @@ dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned in
   block_buffer_size = num_block_pages * IO_PAGESIZE;
   for (i = 0; i < num_blocks; i++)
     {
+#if defined (WINDOWS)
       blocks_write_buffer[i] = (char *) malloc (block_buffer_size * sizeof (char));
+#else /* !WINDOWS */
+      /* pages are written from the block, they must be aligned for direct I/O volumes */
+      if (posix_memalign ((void **) &blocks_write_buffer[i], FILEIO_DIRECT_IO_ALIGNMENT,
+			  block_buffer_size * sizeof (char)) != 0)
+	{
+	  blocks_write_buffer[i] = NULL;
+	}
+#endif /* !WINDOWS */
       if (blocks_write_buffer[i] == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, block_buffer_size * sizeof (char));
@@ -1161,7 +1171,8 @@ dwb_create_internal (THREAD_ENTRY * thread_p, const char *dwb_volume_name, UINT6
 
   double_write_buffer_size = prm_get_integer_value (PRM_ID_DWB_SIZE);
   num_blocks = prm_get_integer_value (PRM_ID_DWB_BLOCKS);
-  if (double_write_buffer_size == 0 || num_blocks == 0)
+  if (double_write_buffer_size == 0 || num_blocks == 0
+      || prm_get_integer_value (PRM_ID_DWB_ATOMIC_WRITE) == FILEIO_ATOMIC_WRITE_ALWAYS)
     {
       /* Do not use double write buffer. */
       return NO_ERROR;
@@ -1974,6 +1985,76 @@ dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
   return flush_new_volume_info;
 }
 
+/*
+ * dwb_write_block_pages_batch () - Write all block pages, submitting them in batches.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * block(in): The block that is written.
+ * p_dwb_ordered_slots(in): The slots that gives the pages flush order.
+ */
+static int
+dwb_write_block_pages_batch (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots)
+{
+#define DWB_WRITE_BATCH_MAX_PAGES 64
+  FILEIO_BATCH_PAGE batch_pages[DWB_WRITE_BATCH_MAX_PAGES];
+  int npages = 0;
+  VOLID last_volid = NULL_VOLID;
+  int last_vol_fd = NULL_VOLDES;
+  VPID *vpid;
+  unsigned int i;
+  int error_code = NO_ERROR;
+
+  for (i = 0; i < block->count_wb_pages; i++)
+    {
+      vpid = &p_dwb_ordered_slots[i].vpid;
+      if (VPID_ISNULL (vpid))
+	{
+	  continue;
+	}
+
+      if (last_volid != vpid->volid)
+	{
+	  last_volid = vpid->volid;
+	  last_vol_fd = fileio_get_volume_descriptor (vpid->volid);
+	}
+      if (last_vol_fd == NULL_VOLDES)
+	{
+	  /* probably it was removed meanwhile. skip it! */
+	  continue;
+	}
+
+      batch_pages[npages].vol_fd = last_vol_fd;
+      batch_pages[npages].page_id = vpid->pageid;
+      batch_pages[npages].io_page = p_dwb_ordered_slots[i].io_page;
+      npages++;
+
+      if (npages == DWB_WRITE_BATCH_MAX_PAGES)
+	{
+	  error_code = fileio_write_batch (thread_p, batch_pages, npages, IO_PAGESIZE);
+	  if (error_code != NO_ERROR)
+	    {
+	      dwb_log_error ("DWB write batch of %d pages failed with %d error\n", npages, error_code);
+	      return error_code;
+	    }
+	  npages = 0;
+	}
+    }
+
+  if (npages > 0)
+    {
+      error_code = fileio_write_batch (thread_p, batch_pages, npages, IO_PAGESIZE);
+      if (error_code != NO_ERROR)
+	{
+	  dwb_log_error ("DWB write batch of %d pages failed with %d error\n", npages, error_code);
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+#undef DWB_WRITE_BATCH_MAX_PAGES
+}
+
 /*
  * dwb_write_block () - Write block pages in specified order.
  *
@@ -1999,6 +2080,7 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   int count_writes = 0, num_pages_to_sync;
   FLUSH_VOLUME_INFO *current_flush_volume_info = NULL;
   bool can_flush_volume = false;
+  bool pages_already_written = false;
 
   assert (block != NULL && p_dwb_ordered_slots != NULL);
 
@@ -2016,6 +2098,18 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   last_written_volid = NULL_VOLID;
   last_written_vol_fd = NULL_VOLDES;
 
+  if (fileio_is_async_io_enabled ())
+    {
+      /* Submit all writes of the block at once. The loop below only accounts the written pages. */
+      error_code = dwb_write_block_pages_batch (thread_p, block, p_dwb_ordered_slots);
+      if (error_code != NO_ERROR)
+	{
+	  assert (false);
+	  return error_code;
+	}
+      pages_already_written = true;
+    }
+
   for (i = 0; i < block->count_wb_pages; i++)
     {
       vpid = &p_dwb_ordered_slots[i].vpid;
@@ -2058,8 +2152,9 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 	      && p_dwb_ordered_slots[i].vpid.volid == p_dwb_ordered_slots[i].io_page->prv.volid);
 
       /* Write the data. */
-      if (fileio_write (thread_p, last_written_vol_fd, p_dwb_ordered_slots[i].io_page, vpid->pageid, IO_PAGESIZE,
-			FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+      if (!pages_already_written
+	  && fileio_write (thread_p, last_written_vol_fd, p_dwb_ordered_slots[i].io_page, vpid->pageid, IO_PAGESIZE,
+			   FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
 	{
 	  ASSERT_ERROR ();
 	  dwb_log_error ("DWB write page VPID=(%d, %d) LSA=(%lld,%d) with %d error: \n",
@@ -3090,6 +3185,9 @@ dwb_check_data_page_is_sane (THREAD_ENTRY * thread_p, DWB_BLOCK * rcv_block, DWB
  *  Note: This function is called at recovery. The corrupted pages are recovered from double write volume buffer disk.
  *    Then, double write volume buffer disk is recreated according to user specifications.
  *    Currently we use a DWB block in memory to recover corrupted page.
+ *    The DWB volume is recovered whatever the current double_write_buffer_atomic_write value is, since it may have
+ *    been written by a previous run using DWB for volumes that now skip it. Only afterwards, it is recreated if
+ *    still needed. Pages of atomic write volumes are never torn, they don't need DWB copies.
  */
 int
 dwb_load_and_recover_pages (THREAD_ENTRY * thread_p, const char *dwb_path_p, const char *db_name_p)
@@ -124,6 +124,7 @@ struct px_tree_node
   int px_id;			/* node ID */
 #if defined(SERVER_MODE)
   int px_status;		/* node status; access through px_mtx */
+  int px_claimed;		/* taken by a worker or by its parent; access through px_mtx */
 #endif				/* SERVER_MODE */
 
   int px_height;		/* tournament tree: node level */
@@ -179,6 +180,11 @@ struct sort_param
   /* support parallelism */
 #if defined(SERVER_MODE)
   pthread_mutex_t px_mtx;	/* px_node status mutex */
+  pthread_cond_t px_cond;	/* signaled when a px_node is done or a px task exits */
+  int px_pending;		/* px tasks pushed to workers and not exited yet */
+  bool px_stop;			/* a px_node failed; the others stop */
+  bool px_has_error;		/* px_error_area keeps an error */
+  int px_error_area[256];	/* first error of a px_node, see er_get_area_error */
 #endif
   int px_height_max;		/* px_node tournament tree max level */
   int px_array_size;		/* px_node array size */
@@ -247,6 +253,11 @@ static int sort_validate (char **vector, long size, SORT_CMP_FUNC * compare, voi
 static PX_TREE_NODE *px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, char **px_buff,
 				     char **px_vector, long px_vector_size, int px_height, int px_myself);
 static int px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node);
+static int px_sort_run (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **px_buff, char **px_vector,
+			long px_vector_size, char ***px_result, long *px_result_size);
+#if defined(SERVER_MODE)
+static void px_sort_stop (SORT_PARAM * sort_param);
+#endif /* SERVER_MODE */
 #if defined(SERVER_MODE)
 static int px_sort_communicate (PX_TREE_NODE * px_node);
 #endif
@@ -1348,12 +1359,12 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 {
   int error = NO_ERROR;
   SORT_PARAM *sort_param = NULL;
-  bool prm_enable_sort_parallel = false;	/* TODO - PRM_SORT_PARALLEL_SORT */
   INT32 input_pages;
   int i;
   int file_pg_cnt_est;
   unsigned int total_numrecs = 0;
 #if defined(SERVER_MODE)
+  int px_threads;
   int num_cpus;
   int rv;
 #endif /* SERVER_MODE */
@@ -1383,6 +1394,22 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 
       return error;
     }
+
+  rv = pthread_cond_init (&(sort_param->px_cond), NULL);
+  if (rv != 0)
+    {
+      error = ER_CSS_PTHREAD_COND_INIT;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+
+      pthread_mutex_destroy (&(sort_param->px_mtx));
+      free_and_init (sort_param);
+
+      return error;
+    }
+
+  sort_param->px_pending = 0;
+  sort_param->px_stop = false;
+  sort_param->px_has_error = false;
 #endif /* SERVER_MODE */
 
   sort_param->cmp_fn = cmp_fn;
@@ -1478,25 +1505,24 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
   sort_param->px_height_max = 0;	/* init */
   sort_param->px_array_size = 1;	/* init */
 
-#if 1				/* TODO - currently, disable parallelism */
-  prm_enable_sort_parallel = false;
-#endif
-
 #if !defined(NDEBUG)
   er_log_debug (ARG_FILE_LINE, "TDE: sort_listfile(): tde_encrypted = %d\n", sort_param->tde_encrypted);
 #endif /* !NDEBUG */
 
 #if defined(SERVER_MODE)
-  if (prm_enable_sort_parallel == true)
+  /* the runs are sorted by a tournament tree of 2^^n nodes; every node but the root runs on a worker. there is no
+   * point in more workers than the other CPUs. */
+  px_threads = prm_get_integer_value (PRM_ID_SORT_PARALLEL_THREADS);
+  if (px_threads > 0)
     {
-      /* TODO - calc n, 2^^n get the number of CPUs TODO - fileio_os_sysconf really get #cores instead of #CPUs -
-       * NEED MORE CONSIDERATION */
       num_cpus = fileio_os_sysconf ();
+      px_threads = MIN (px_threads, num_cpus - 1);
 
-      sort_param->px_height_max = (int) sqrt ((double) num_cpus);	/* n */
-      sort_param->px_array_size = num_cpus;	/* 2^^n */
-
-      assert_release (sort_param->px_array_size == pow ((double) 2, (double) sort_param->px_height_max));
+      while ((2 << sort_param->px_height_max) <= px_threads + 1)
+	{
+	  sort_param->px_height_max++;	/* n */
+	}
+      sort_param->px_array_size = 1 << sort_param->px_height_max;	/* 2^^n */
     }
 #endif /* SERVER_MODE */
 
@@ -1660,6 +1686,7 @@ px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, cha
 #endif
 
   px_node->px_status = 0;
+  px_node->px_claimed = 0;
 
   pthread_mutex_unlock (&(sort_param->px_mtx));
 #else /* SERVER_MODE */
@@ -1699,7 +1726,39 @@ px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, cha
 static void
 px_sort_myself_execute (cubthread::entry &thread_ref, PX_TREE_NODE * px_node)
 {
-  (void) px_sort_myself (&thread_ref, px_node);
+  SORT_PARAM *sort_param = (SORT_PARAM *) (px_node->px_arg);
+  bool is_claimed;
+  int rv;
+
+  /* the external task is called with tran_index_lock locked */
+  pthread_mutex_unlock (&thread_ref.tran_index_lock);
+
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  /* the parent runs the node itself if it gets there first */
+  is_claimed = (px_node->px_claimed != 0);
+  px_node->px_claimed = 1;
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+
+  if (!is_claimed)
+    {
+      thread_ref.tran_index = px_node->px_tran_index;
+
+      (void) px_sort_myself (&thread_ref, px_node);
+      er_clear ();
+    }
+
+  /* sort_param may be freed as soon as the last task exits */
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  assert (sort_param->px_pending > 0);
+  sort_param->px_pending--;
+  pthread_cond_broadcast (&(sort_param->px_cond));
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
 }
 
 /*
@@ -1723,6 +1782,13 @@ px_sort_communicate (PX_TREE_NODE * px_node)
   assert_release (px_node->px_id < sort_param->px_array_size);
   assert_release (px_node->px_vector_size > 1);
 
+  int rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  sort_param->px_pending++;
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+
   cubthread::entry_callable_task *task =
     new cubthread::entry_callable_task (std::bind (px_sort_myself_execute, std::placeholders::_1, px_node));
   css_push_external_task (css_get_current_conn_entry (), task);
@@ -1730,8 +1796,116 @@ px_sort_communicate (PX_TREE_NODE * px_node)
   return NO_ERROR;
 }
 // *INDENT-ON*
+
+/*
+ * px_sort_stop() - stop all px_nodes of the current run
+ *   return:
+ *   sort_param(in): sort parameters
+ *
+ * NOTE: the first error is kept to be raised again by the thread of the sort.
+ */
+static void
+px_sort_stop (SORT_PARAM * sort_param)
+{
+  int length = (int) sizeof (sort_param->px_error_area);
+  int rv;
+
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  if (!sort_param->px_has_error && er_errid () != NO_ERROR)
+    {
+      (void) er_get_area_error ((char *) sort_param->px_error_area, &length);
+      sort_param->px_has_error = true;
+    }
+  sort_param->px_stop = true;
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+}
 #endif /* SERVER_MODE */
 
+/*
+ * px_sort_run() - sort a run of the internal memory
+ *   return: NO_ERROR, or error code
+ *   thread_p(in):
+ *   sort_param(in): sort parameters
+ *   px_buff(in): buffer of px_vector_size elements
+ *   px_vector(in): record pointers to sort
+ *   px_vector_size(in):
+ *   px_result(out): sorted record pointers; either px_vector or px_buff
+ *   px_result_size(out): number of sorted records
+ *
+ * NOTE: support parallelism
+ */
+static int
+px_sort_run (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **px_buff, char **px_vector,
+	     long px_vector_size, char ***px_result, long *px_result_size)
+{
+  PX_TREE_NODE *px_node;
+  int error;
+#if defined(SERVER_MODE)
+  int i;
+  int rv;
+#endif /* SERVER_MODE */
+
+  assert (sort_param->px_height_max >= 0);
+  assert (sort_param->px_array_size >= 1);
+
+#if defined(SERVER_MODE)
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  assert (sort_param->px_pending == 0);
+  for (i = 0; i < sort_param->px_array_size; i++)
+    {
+      sort_param->px_array[i].px_status = 0;	/* init */
+    }
+  sort_param->px_stop = false;
+  sort_param->px_has_error = false;
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+#endif /* SERVER_MODE */
+
+  px_node = px_sort_assign (thread_p, sort_param, 0, px_buff, px_vector, px_vector_size, sort_param->px_height_max,
+			    0 /* px_myself: set as root */ );
+  if (px_node == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  error = px_sort_myself (thread_p, px_node);
+
+#if defined(SERVER_MODE)
+  /* wait for the tasks of all workers to exit; they use the px_nodes of this run */
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  while (sort_param->px_pending > 0)
+    {
+      pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
+    }
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+
+  if (error != NO_ERROR && sort_param->px_has_error)
+    {
+      er_set_area_error ((char *) sort_param->px_error_area);
+      error = er_errid ();
+      error = (error == NO_ERROR) ? ER_FAILED : error;
+    }
+#endif /* SERVER_MODE */
+
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  *px_result = px_node->px_result;
+  *px_result_size = px_node->px_result_size;
+
+  return NO_ERROR;
+}
+
 /*
  * px_sort_myself() -
  *   return:
@@ -1751,10 +1925,11 @@ px_sort_communicate (PX_TREE_NODE * px_node)
 static int
 px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 {
-#define SORT_PARTITION_RUN_SIZE_MIN (ONE_M)
+#define SORT_PARTITION_RUN_SIZE_MIN (4 * ONE_K)
 
   int ret = NO_ERROR;
   bool old_check_interrupt;
+  bool continue_checking = true;
 
 #if defined(SERVER_MODE)
   int parent;
@@ -1787,13 +1962,6 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
   sort_param = (SORT_PARAM *) (px_node->px_arg);
 
 #if defined(SERVER_MODE)
-  if (px_node->px_id > 0)
-    {
-      /* is new childs */
-      thread_p->tran_index = px_node->px_tran_index;
-      pthread_mutex_unlock (&thread_p->tran_index_lock);
-    }
-
 #if !defined(NDEBUG)
   rv = pthread_mutex_lock (&(sort_param->px_mtx));
   assert (rv == NO_ERROR);
@@ -1818,6 +1986,22 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 
   assert_release (vector_size > 0);
 
+#if defined(SERVER_MODE)
+  if (sort_param->px_stop)
+    {
+      /* another px_node failed */
+      ret = ER_FAILED;
+      goto exit_on_error;
+    }
+#endif /* SERVER_MODE */
+
+  if (logtb_is_interrupted_tran (thread_p, false, &continue_checking, px_node->px_tran_index))
+    {
+      ret = ER_INTERRUPTED;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ret, 0);
+      goto exit_on_error;
+    }
+
 #if defined(SERVER_MODE)
   parent = px_node->px_id & ~(1 << px_node->px_height);
   child_height = px_node->px_height - 1;
@@ -1842,6 +2026,7 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 
       assert_release (px_node->px_status == 0);
       px_node->px_status = 1;	/* done */
+      pthread_cond_broadcast (&(sort_param->px_cond));
 
       pthread_mutex_unlock (&(sort_param->px_mtx));
 
@@ -1888,6 +2073,7 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 
 	  assert_release (right_px_node->px_status == 0);
 	  right_px_node->px_status = 1;	/* done */
+	  right_px_node->px_claimed = 1;
 
 	  pthread_mutex_unlock (&(sort_param->px_mtx));
 	}
@@ -1919,26 +2105,35 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 	    }
 	}
 
-      /* wait for right-child finished */
-      do
+      /* wait for right-child finished; run it here if no worker has taken it yet. a waiting node never waits for
+       * a task still queued, so busy workers cannot dead-lock */
+      rv = pthread_mutex_lock (&(sort_param->px_mtx));
+      assert (rv == NO_ERROR);
+
+      if (right_px_node->px_claimed == 0)
 	{
+	  right_px_node->px_claimed = 1;
+	  pthread_mutex_unlock (&(sort_param->px_mtx));
+
+	  (void) px_sort_myself (thread_p, right_px_node);
+
 	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
 	  assert (rv == NO_ERROR);
+	}
 
-	  if (right_px_node->px_status != 0)
-	    {
-	      assert (right_px_node->px_status == 1);
-	      pthread_mutex_unlock (&(sort_param->px_mtx));
-	      break;
-	    }
+      while (right_px_node->px_status == 0)
+	{
+	  pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
+	}
+      assert (right_px_node->px_status == 1);
 
-	  pthread_mutex_unlock (&(sort_param->px_mtx));
+      pthread_mutex_unlock (&(sort_param->px_mtx));
 
-#if 1				/* TODO */
-	  thread_sleep (10);	/* 10 msec */
-#endif
+      if (sort_param->px_stop)
+	{
+	  ret = ER_FAILED;
+	  goto exit_on_error;
 	}
-      while (1);
 
       assert_release (px_node == left_px_node);
 #if !defined(NDEBUG)
@@ -2132,6 +2327,7 @@ exit_on_end:
 
       assert_release (px_node->px_status == 0);
       px_node->px_status = 1;	/* done */
+      pthread_cond_broadcast (&(sort_param->px_cond));
 
       pthread_mutex_unlock (&(sort_param->px_mtx));
     }
@@ -2148,6 +2344,10 @@ exit_on_error:
 
   ret = (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 
+#if defined(SERVER_MODE)
+  px_sort_stop (sort_param);
+#endif /* SERVER_MODE */
+
   goto exit_on_end;
 }
 
@@ -2187,11 +2387,6 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
   int i;
   int error = NO_ERROR;
 
-  PX_TREE_NODE *px_node;
-#if defined (SERVER_MODE)
-  int rv = NO_ERROR;
-#endif /* SERVER_MODE */
-
   assert (sort_param->half_files <= SORT_MAX_HALF_FILES);
 
   assert (sort_param->px_height_max >= 0);
@@ -2270,36 +2465,11 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 
 	      if (sort_numrecs == 0)
 		{
-		  assert (sort_param->px_height_max >= 0);
-		  assert (sort_param->px_array_size >= 1);
-#if defined(SERVER_MODE)
-		  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-		  assert (rv == NO_ERROR);
-
-		  for (i = 0; i < sort_param->px_array_size; i++)
-		    {
-		      sort_param->px_array[i].px_status = 0;	/* init */
-		    }
-
-		  pthread_mutex_unlock (&(sort_param->px_mtx));
-#endif /* SERVER_MODE */
-
-		  px_node = px_sort_assign (thread_p, sort_param, 0, index_buff, index_area, numrecs,
-					    sort_param->px_height_max, 0 /* px_myself: set as root */ );
-		  if (px_node == NULL)
-		    {
-		      error = ER_FAILED;
-		      goto exit_on_error;
-		    }
-
-		  error = px_sort_myself (thread_p, px_node);
+		  error = px_sort_run (thread_p, sort_param, index_buff, index_area, numrecs, &index_area, &numrecs);
 		  if (error != NO_ERROR)
 		    {
 		      goto exit_on_error;
 		    }
-
-		  index_area = px_node->px_result;
-		  numrecs = px_node->px_result_size;
 		  *total_numrecs += numrecs;
 		}
 	      else
@@ -2458,8 +2628,8 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 
 	      /* Create a multipage record for this long record : insert to multipage_file and put the pointer as the
 	       * first record in this run */
-	      if (overflow_insert (thread_p, &sort_param->multipage_file, (VPID *) item_ptr, &long_recdes, FILE_TEMP)
-		  != NO_ERROR)
+	      if (overflow_insert (thread_p, &sort_param->multipage_file, (VPID *) item_ptr, &long_recdes, FILE_TEMP,
+				   false) != NO_ERROR)
 		{
 		  ASSERT_ERROR_AND_SET (error);
 		  goto exit_on_error;
@@ -2525,36 +2695,11 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 
       if (sort_numrecs == 0)
 	{
-	  assert (sort_param->px_height_max >= 0);
-	  assert (sort_param->px_array_size >= 1);
-#if defined(SERVER_MODE)
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
-
-	  for (i = 0; i < sort_param->px_array_size; i++)
-	    {
-	      sort_param->px_array[i].px_status = 0;	/* init */
-	    }
-
-	  pthread_mutex_unlock (&(sort_param->px_mtx));
-#endif /* SERVER_MODE */
-
-	  px_node = px_sort_assign (thread_p, sort_param, 0, index_buff, index_area, numrecs, sort_param->px_height_max,
-				    0 /* px_myself: set as root */ );
-	  if (px_node == NULL)
-	    {
-	      error = ER_FAILED;
-	      goto exit_on_error;
-	    }
-
-	  if (px_sort_myself (thread_p, px_node) != NO_ERROR)
+	  error = px_sort_run (thread_p, sort_param, index_buff, index_area, numrecs, &index_area, &numrecs);
+	  if (error != NO_ERROR)
 	    {
-	      error = ER_FAILED;
 	      goto exit_on_error;
 	    }
-
-	  index_area = px_node->px_result;
-	  numrecs = px_node->px_result_size;
 	  *total_numrecs += numrecs;
 	}
       else
@@ -4445,11 +4590,19 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
   sort_param->px_height_max = sort_param->px_array_size = 0;
 
 #if defined(SERVER_MODE)
+  assert (sort_param->px_pending == 0);
+
   rv = pthread_mutex_destroy (&(sort_param->px_mtx));
   if (rv != 0)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_DESTROY, 0);
     }
+
+  rv = pthread_cond_destroy (&(sort_param->px_cond));
+  if (rv != 0)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_COND_DESTROY, 0);
+    }
 #endif
 
   free_and_init (sort_param);
@@ -128,6 +128,15 @@ struct SORTKEY_INFO
   SUBKEY_INFO *key;		/* Points to `default_keys' if `nkeys' <= 8; otherwise it points to malloc'ed space. */
   SUBKEY_INFO default_keys[8];	/* Default storage; this ought to work for most cases. */
   int error;			/* median domain convert errors */
+
+  /*
+   * Non-zero iff the sort records keep an order preserving binary prefix
+   * of the first key, right before the key fields.  Two records whose
+   * prefixes differ are ordered by the prefixes alone.
+   */
+  int use_prefix;
+  int is_prefix_exact;		/* Non-zero iff the prefix holds the whole value of the first key. */
+  const unsigned int *prefix_weights;	/* Byte weights of the collation of a string first key; NULL if binary. */
 };
 
 struct SORT_INFO
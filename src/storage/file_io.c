@@ -85,6 +85,8 @@
 #include "log_common_impl.h"
 #include "log_volids.hpp"
 #include "fault_injection.h"
+#include "async_io.hpp"
+#include "crc32c.hpp"
 #if defined (SERVER_MODE)
 #include "vacuum.h"
 #endif /* SERVER_MODE */
@@ -188,6 +190,23 @@
 #define FILEIO_BACKUP_NO_ZIP_HEADER_VERSION        1
 #define FILEIO_BACKUP_CURRENT_HEADER_VERSION       2
 #define FILEIO_CHECK_FOR_INTERRUPT_INTERVAL       100
+/* Parallel backup: read threads may run ahead of the write thread by this many queued pages each */
+#define FILEIO_BACKUP_QUEUE_PAGES_PER_THREAD      8
+
+/* Asynchronous I/O: large contiguous transfers are split in chunks that are submitted together; at most
+ * FILEIO_ASYNC_IO_MAX_REQUESTS requests are submitted at once. */
+#define FILEIO_ASYNC_IO_CHUNK_SIZE                (256 * 1024)
+#define FILEIO_ASYNC_IO_MAX_REQUESTS              64
+
+/* Direct I/O bypasses the operating system cache for data volumes (data_volume_direct_io). */
+#if defined (LINUX) && defined (O_DIRECT)
+#define FILEIO_HAVE_DIRECT_IO
+#endif
+
+/* Atomic page writes need the RWF_ATOMIC write flag and statx reporting the atomic write unit limits. */
+#if defined (LINUX) && defined (RWF_ATOMIC) && defined (STATX_WRITE_ATOMIC)
+#define FILEIO_HAVE_RWF_ATOMIC
+#endif
 
 #define FILEIO_PAGE_SIZE_FULL_LEVEL (IO_PAGESIZE * FILEIO_FULL_LEVEL_EXP)
 #define FILEIO_BACKUP_PAGE_OVERHEAD \
@@ -384,6 +403,7 @@ struct fileio_volinfo
   VOLID volid;
   int vdes;
   FILEIO_LOCKF_TYPE lockf_type;
+  bool atomic_write;		/* pages are never torn when written, they skip double write buffer */
 #if defined(SERVER_MODE) && defined(WINDOWS)
   pthread_mutex_t vol_mutex;	/* for fileio_read()/fileio_write() */
 #endif				/* SERVER_MODE && WINDOWS */
@@ -442,6 +462,23 @@ static FILEIO_VOLUME_HEADER fileio_Vol_info_header = {
 static FILEIO_BACKUP_INFO_QUEUE fileio_Backup_vol_info_data[2] =
   { {false, {NULL, NULL, NULL}, NULL}, {false, {NULL, NULL, NULL}, NULL} };
 
+#if defined (FILEIO_HAVE_RWF_ATOMIC)
+/* Atomic write probes of the devices of data volumes; a device is probed once */
+#define FILEIO_ATOMIC_WRITE_MAX_DEVICES 32
+
+typedef struct fileio_atomic_write_device FILEIO_ATOMIC_WRITE_DEVICE;
+struct fileio_atomic_write_device
+{
+  unsigned int dev_major;
+  unsigned int dev_minor;
+  bool is_capable;
+};
+
+static FILEIO_ATOMIC_WRITE_DEVICE fileio_Atomic_write_devices[FILEIO_ATOMIC_WRITE_MAX_DEVICES];
+static int fileio_Num_atomic_write_devices = 0;
+static pthread_mutex_t fileio_Atomic_write_devices_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif /* FILEIO_HAVE_RWF_ATOMIC */
+
 /* Flush Control */
 #if !defined(HAVE_ATOMIC_BUILTINS)
 static pthread_mutex_t fileio_Flushed_page_counter_mutex = PTHREAD_MUTEX_INITIALIZER;
@@ -510,9 +547,27 @@ static bool fileio_is_terminated_process (int pid);
 
 static ssize_t fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
 static ssize_t fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
+static ssize_t fileio_os_write_atomic (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count,
+				      off_t offset);
+static bool fileio_is_atomic_write_capable (int vol_fd, const char *vol_label_p);
+#if defined (FILEIO_HAVE_RWF_ATOMIC)
+static bool fileio_probe_atomic_write (const char *vol_label_p);
+#endif /* FILEIO_HAVE_RWF_ATOMIC */
+static void fileio_set_direct_io (int vol_fd, const char *vol_label_p);
+#if defined (FILEIO_HAVE_DIRECT_IO)
+static ssize_t fileio_os_transfer_misaligned (int vol_fd, void *io_page_p, size_t count, off_t offset,
+					      bool is_write, bool is_atomic);
+#endif /* FILEIO_HAVE_DIRECT_IO */
+#if !defined (WINDOWS)
+static ssize_t fileio_pwrite_atomic (int vol_fd, const void *buf, size_t count, off_t offset);
+#endif /* !WINDOWS */
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+static size_t fileio_async_transfer_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, off_t offset,
+					   size_t nbytes, size_t page_size, bool is_write);
+#endif /* SERVER_MODE && !WINDOWS */
 #if !defined (WINDOWS)
 static ssize_t pwrite_with_injected_fault (THREAD_ENTRY * thread_p, int fd, const void *buf, size_t count,
-					   off_t offset);
+					   off_t offset, bool is_atomic);
 #endif
 
 #if !defined(WINDOWS)
@@ -522,8 +577,13 @@ static FILEIO_LOCKF_TYPE fileio_get_lockf_type (int vdes);
 #endif /* !WINDOWS */
 
 static int fileio_get_primitive_way_max (const char *path, long int *filename_max, long int *pathname_max);
+static UINT32 fileio_compute_page_checksum (const FILEIO_PAGE * io_page);
 static int fileio_flush_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session);
-static ssize_t fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, int pageid);
+#if !defined(CS_MODE)
+static int fileio_skip_unchanged_backup_pages (FILEIO_BACKUP_SESSION * session, int page_id, int npages);
+#endif /* !CS_MODE */
+static ssize_t fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session,
+				   FILEIO_BACKUP_PAGE * area, int pageid);
 static int fileio_write_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, ssize_t towrite_nbytes);
 static int fileio_write_backup_header (FILEIO_BACKUP_SESSION * session);
 
@@ -1004,6 +1064,7 @@ fileio_allocate_and_initialize_volume_info (FILEIO_VOLUME_HEADER * header_p, int
       vol_info_p[i].volid = NULL_VOLID;
       vol_info_p[i].vdes = NULL_VOLDES;
       vol_info_p[i].lockf_type = FILEIO_NOT_LOCKF;
+      vol_info_p[i].atomic_write = false;
       vol_info_p[i].vlabel[0] = '\0';
 #if defined(WINDOWS)
       pthread_mutex_init (&vol_info_p[i].vol_mutex, NULL);
@@ -2863,6 +2924,10 @@ fileio_copy_volume (THREAD_ENTRY * thread_p, int from_vol_desc, DKNPAGES npages,
 	  else
 	    {
 	      fileio_reset_page_lsa (malloc_io_page_p, IO_PAGESIZE);
+	      if (malloc_io_page_p->prv.pflag & FILEIO_PAGE_FLAG_CHECKSUM)
+		{
+		  (void) fileio_set_page_checksum (thread_p, malloc_io_page_p);
+		}
 	      if (fileio_write_or_add_to_dwb (thread_p, to_vol_desc, malloc_io_page_p, page_id, IO_PAGESIZE) == NULL)
 		{
 		  goto error;
@@ -2920,6 +2985,10 @@ fileio_reset_volume (THREAD_ENTRY * thread_p, int vol_fd, const char *vlabel, DK
       if (fileio_read (thread_p, vol_fd, malloc_io_page_p, page_id, IO_PAGESIZE) != NULL)
 	{
 	  fileio_set_page_lsa (malloc_io_page_p, reset_lsa_p, IO_PAGESIZE);
+	  if (malloc_io_page_p->prv.pflag & FILEIO_PAGE_FLAG_CHECKSUM)
+	    {
+	      (void) fileio_set_page_checksum (thread_p, malloc_io_page_p);
+	    }
 
 	  if (fileio_write_or_add_to_dwb (thread_p, vol_fd, malloc_io_page_p, page_id, IO_PAGESIZE) == NULL)
 	    {
@@ -3634,17 +3703,26 @@ fileio_page_hexa_dump (const char *src_data, int length)
  *   buf(in):  buffer to write
  *   count(in): count bytes to write
  *   offset(in): offset into file
+ *   is_atomic(in): the buffer is a page of an atomic write volume, it is never torn
+ *
+ * Note: FI_TEST_FILE_IO_WRITE_PARTS1 and FI_TEST_FILE_IO_WRITE_PARTS2 write 4K blocks in order or in reverse order
+ *       and crash in the middle. FI_TEST_FILE_IO_WRITE_PARTS3 loses random 512 byte sectors and crashes, like a
+ *       device persisting sectors in any order. Pages of atomic write volumes are written all or nothing: the
+ *       crash happens before or after the write.
  */
 static ssize_t
-pwrite_with_injected_fault (THREAD_ENTRY * thread_p, int fd, const void *buf, size_t count, off_t offset)
+pwrite_with_injected_fault (THREAD_ENTRY * thread_p, int fd, const void *buf, size_t count, off_t offset,
+			    bool is_atomic)
 {
   static bool init = false;
   const int mod_factor = 25000;
-  const int block_size = 4096;
+  const int sector_size = 512;
+  int block_size = 4096;
   int count_blocks;
   ssize_t r, written_nbytes;
   off_t unit_offset;
-  bool fi_partial_write1_on, fi_partial_write2_on;
+  bool fi_partial_write1_on, fi_partial_write2_on, fi_partial_write3_on;
+  bool do_exit = false;
 
   if (init == false)
     {
@@ -3654,25 +3732,50 @@ pwrite_with_injected_fault (THREAD_ENTRY * thread_p, int fd, const void *buf, si
 
   fi_partial_write1_on = FI_INSERTED (FI_TEST_FILE_IO_WRITE_PARTS1);
   fi_partial_write2_on = FI_INSERTED (FI_TEST_FILE_IO_WRITE_PARTS2);
+  fi_partial_write3_on = FI_INSERTED (FI_TEST_FILE_IO_WRITE_PARTS3);
 
-  if ((fi_partial_write1_on || fi_partial_write2_on) && ((rand () % mod_factor) == 0))
+  if ((fi_partial_write1_on || fi_partial_write2_on || fi_partial_write3_on) && ((rand () % mod_factor) == 0))
     {
+      if (is_atomic)
+	{
+	  // all or nothing
+	  block_size = (int) count;
+	  do_exit = (rand () % 2) == 0;
+	}
+      else if (fi_partial_write3_on)
+	{
+	  block_size = sector_size;
+	}
+
       // simulate partial write
       count_blocks = count / block_size;
       written_nbytes = 0;
-      for (int i = 0; i < count_blocks; i++)
+      for (int i = 0; i < count_blocks && !do_exit; i++)
 	{
-	  if (fi_partial_write1_on)
+	  if (fi_partial_write2_on && !fi_partial_write1_on)
 	    {
-	      unit_offset = i * block_size;
+	      // reverse order
+	      unit_offset = ((count_blocks - 1) - i) * block_size;
 	    }
 	  else
 	    {
-	      // reverse order
-	      unit_offset = ((count_blocks - 1) - i) * block_size;
+	      unit_offset = i * block_size;
 	    }
 
-	  r = pwrite (fd, ((char *) buf) + unit_offset, block_size, offset + unit_offset);
+	  if (fi_partial_write3_on && !is_atomic && (rand () % 2) == 0)
+	    {
+	      // the sector keeps its previous content
+	      continue;
+	    }
+
+	  if (is_atomic)
+	    {
+	      r = fileio_pwrite_atomic (fd, ((char *) buf) + unit_offset, block_size, offset + unit_offset);
+	    }
+	  else
+	    {
+	      r = pwrite (fd, ((char *) buf) + unit_offset, block_size, offset + unit_offset);
+	    }
 	  written_nbytes += r;
 	  if (r != block_size)
 	    {
@@ -3680,65 +3783,73 @@ pwrite_with_injected_fault (THREAD_ENTRY * thread_p, int fd, const void *buf, si
 	    }
 
 	  // randomly exits to remain page is partially written
-	  if ((rand () % count_blocks - 1) == 0)
+	  if (is_atomic || (rand () % count_blocks - 1) == 0)
 	    {
-	      char msg[1024];
-	      char *vlabel;
+	      do_exit = true;
+	    }
+	}
 
-	      vlabel = fileio_get_volume_label_by_fd (fd, PEEK);
-	      sprintf (msg, "fault injected to write a page to offset (%ld) of '%s'\n", offset,
-		       vlabel ? vlabel : "unknown volume");
-	      er_print_callstack (ARG_FILE_LINE, "FAULT INJECTION: RANDOM EXIT\n");
-	      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_FAILED_ASSERTION, 1, msg);
+      if (do_exit || fi_partial_write3_on)
+	{
+	  char msg[1024];
+	  char *vlabel;
+
+	  vlabel = fileio_get_volume_label_by_fd (fd, PEEK);
+	  sprintf (msg, "fault injected to write a page to offset (%ld) of '%s'\n", offset,
+		   vlabel ? vlabel : "unknown volume");
+	  er_print_callstack (ARG_FILE_LINE, "FAULT INJECTION: RANDOM EXIT\n");
+	  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_FAILED_ASSERTION, 1, msg);
 
-	      // exit handler
-	      (void) fileio_synchronize (thread_p, fd, vlabel, FILEIO_SYNC_ONLY);
+	  // exit handler
+	  (void) fileio_synchronize (thread_p, fd, vlabel, FILEIO_SYNC_ONLY);
 
 #if !defined(NDEBUG)
-	      if (prm_get_bool_value (PRM_ID_ER_LOG_DEBUG))
-		{
-		  fileio_page_hexa_dump ((const char *) buf, count);
+	  if (prm_get_bool_value (PRM_ID_ER_LOG_DEBUG))
+	    {
+	      fileio_page_hexa_dump ((const char *) buf, count);
 
 #if defined (SERVER_MODE) || defined (SA_MODE)
-		  /* Verify page correctness before the crash, for proper recovery purpose. */
-		  if (fileio_is_permanent_volume_descriptor (thread_p, fd))
-		    {
-		      /* Permanent data volume. */
-		      int error_code;
-		      bool is_page_corrupted;
+	      /* Verify page correctness before the crash, for proper recovery purpose. */
+	      if (fileio_is_permanent_volume_descriptor (thread_p, fd))
+		{
+		  /* Permanent data volume. */
+		  int error_code;
+		  bool is_page_corrupted;
 
-		      error_code = fileio_page_check_corruption (thread_p, (FILEIO_PAGE *) buf, &is_page_corrupted);
-		      assert (error_code == NO_ERROR && is_page_corrupted == false);
-		    }
-		  else
+		  error_code = fileio_page_check_corruption (thread_p, (FILEIO_PAGE *) buf, &is_page_corrupted);
+		  assert (error_code == NO_ERROR && is_page_corrupted == false);
+		}
+	      else
+		{
+		  /* sys volume ? */
+		  int rv;
+		  FILEIO_SYSTEM_VOLUME_INFO *sys_volinfo;
+		  APPLY_ARG arg = { 0 };
+
+		  rv = pthread_mutex_lock (&fileio_Sys_vol_info_header.mutex);
+		  arg.vdes = fd;
+		  sys_volinfo = fileio_find_system_volume (thread_p, fileio_is_system_volume_descriptor_equal, &arg);
+		  pthread_mutex_unlock (&fileio_Sys_vol_info_header.mutex);
+		  if (sys_volinfo)
 		    {
-		      /* sys volume ? */
-		      int rv;
-		      FILEIO_SYSTEM_VOLUME_INFO *sys_volinfo;
-		      APPLY_ARG arg = { 0 };
-
-		      rv = pthread_mutex_lock (&fileio_Sys_vol_info_header.mutex);
-		      arg.vdes = fd;
-		      sys_volinfo =
-			fileio_find_system_volume (thread_p, fileio_is_system_volume_descriptor_equal, &arg);
-		      pthread_mutex_unlock (&fileio_Sys_vol_info_header.mutex);
-		      if (sys_volinfo)
-			{
-			  logpb_debug_check_log_page (thread_p, (void *) buf);
-			}
+		      logpb_debug_check_log_page (thread_p, (void *) buf);
 		    }
-#endif /* defined (SERVER_MODE) || (SA_MODE) */
 		}
+#endif /* defined (SERVER_MODE) || (SA_MODE) */
+	    }
 
 #endif /* defined (NDEBUG) */
-	      // exit
-	      _exit (0);
-	    }
+	  // exit
+	  _exit (0);
 	}
 
       return written_nbytes;
     }
 
+  if (is_atomic)
+    {
+      return fileio_pwrite_atomic (fd, buf, count, offset);
+    }
   return pwrite (fd, buf, count, offset);
 }
 #endif
@@ -3884,6 +3995,10 @@ fileio_get_volume_mutex (THREAD_ENTRY * thread_p, int vdes)
 static ssize_t
 fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
 {
+#if !defined (SERVER_MODE) || !defined (WINDOWS)
+  ssize_t nbytes;
+#endif /* !SERVER_MODE || !WINDOWS */
+
 #if !defined (SERVER_MODE)
   /* Locate the desired page */
   if (lseek (vol_fd, offset, SEEK_SET) != offset)
@@ -3892,7 +4007,14 @@ fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t cou
     }
 
   /* Read the desired page */
-  return read (vol_fd, io_page_p, count);
+  nbytes = read (vol_fd, io_page_p, count);
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  if (nbytes < 0 && errno == EINVAL)
+    {
+      nbytes = fileio_os_transfer_misaligned (vol_fd, io_page_p, count, offset, false, false);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+  return nbytes;
 #elif defined (WINDOWS)
   // TODO: replace it with ReadFile
   ssize_t nbytes;
@@ -3930,7 +4052,14 @@ fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t cou
 
   return nbytes;
 #else /* WINDOWS */
-  return pread (vol_fd, io_page_p, count, offset);
+  nbytes = pread (vol_fd, io_page_p, count, offset);
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  if (nbytes < 0 && errno == EINVAL)
+    {
+      nbytes = fileio_os_transfer_misaligned (vol_fd, io_page_p, count, offset, false, false);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+  return nbytes;
 #endif
 }
 
@@ -4012,7 +4141,8 @@ fileio_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_i
 }
 
 /*
- * fileio_write_or_add_to_dwb () - Write a page to disk if DWb disabled, otherwise add it to DWB
+ * fileio_write_or_add_to_dwb () - Write a page to disk if DWb disabled or the volume has atomic page writes,
+ *				    otherwise add it to DWB
  *   return: io_page_p on success, NULL on failure
  *   vol_fd(in): Volume descriptor
  *   io_page_p(in): In-memory address where the current content of page resides
@@ -4036,13 +4166,18 @@ fileio_write_or_add_to_dwb (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * i
   assert (vol_fd != NULL_VOLDES && io_page_p != NULL);
 
   skip_flush = dwb_is_created ();
-  if (skip_flush)
+  if (skip_flush || prm_get_integer_value (PRM_ID_DWB_ATOMIC_WRITE) != FILEIO_ATOMIC_WRITE_NEVER)
     {
       FILEIO_CHECK_AND_INITIALIZE_VOLUME_HEADER_CACHE (NULL);
 
       arg.vdes = vol_fd;
       vol_info_p = fileio_traverse_permanent_volume (thread_p, fileio_is_volume_descriptor_equal, &arg);
-      if (vol_info_p)
+      if (vol_info_p && vol_info_p->atomic_write)
+	{
+	  /* The page can't be torn, it doesn't need DWB. */
+	  return fileio_write (thread_p, vol_fd, io_page_p, page_id, page_size, FILEIO_WRITE_ATOMIC_WRITE);
+	}
+      else if (vol_info_p && skip_flush)
 	{
 	  /* Permanent volumes - uses DWB. */
 	  VPID_SET (&vpid, vol_info_p->volid, page_id);
@@ -4086,6 +4221,10 @@ fileio_write_or_add_to_dwb (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * i
 static ssize_t
 fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
 {
+#if !defined (SERVER_MODE) || !defined (WINDOWS)
+  ssize_t nbytes;
+#endif /* !SERVER_MODE || !WINDOWS */
+
 #if !defined (SERVER_MODE)
   if (lseek (vol_fd, offset, SEEK_SET) != offset)
     {
@@ -4093,7 +4232,14 @@ fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t co
     }
 
   /* write the page */
-  return write (vol_fd, io_page_p, count);
+  nbytes = write (vol_fd, io_page_p, count);
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  if (nbytes < 0 && errno == EINVAL)
+    {
+      nbytes = fileio_os_transfer_misaligned (vol_fd, io_page_p, count, offset, true, false);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+  return nbytes;
 #elif defined (WINDOWS)
   // TODO: replace it with WriteFile
   int rv, nbytes;
@@ -4127,13 +4273,303 @@ fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t co
   return (ssize_t) nbytes;
 #elif defined (NDEBUG)
   /* release mode */
-  return pwrite (vol_fd, io_page_p, count, offset);
+  nbytes = pwrite (vol_fd, io_page_p, count, offset);
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  if (nbytes < 0 && errno == EINVAL)
+    {
+      nbytes = fileio_os_transfer_misaligned (vol_fd, io_page_p, count, offset, true, false);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+  return nbytes;
 #else
   /* server debugging mode */
-  return pwrite_with_injected_fault (thread_p, vol_fd, io_page_p, count, offset);
+  nbytes = pwrite_with_injected_fault (thread_p, vol_fd, io_page_p, count, offset, false);
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  if (nbytes < 0 && errno == EINVAL)
+    {
+      nbytes = fileio_os_transfer_misaligned (vol_fd, io_page_p, count, offset, true, false);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+  return nbytes;
 #endif
 }
 
+/*
+ * fileio_os_write_atomic () - helper for fileio_write of pages that must not be torn
+ *   return: the number of bytes written is returned. On error, error code.
+ *   vol_fd(in): Volume descriptor of an atomic write volume
+ *   io_page_p(in): In-memory address where the current content of page resides
+ *   count(in): the number of bytes to be written
+ *   offset(in): starting file offset
+ *
+ * Note: With double_write_buffer_atomic_write = 2, the storage is trusted to never tear a page and the page is
+ *       written as usual. Otherwise, the volume was probed to accept RWF_ATOMIC writes of a page.
+ */
+static ssize_t
+fileio_os_write_atomic (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
+{
+#if (defined (SERVER_MODE) && !defined (WINDOWS) && !defined (NDEBUG)) || defined (FILEIO_HAVE_RWF_ATOMIC)
+  ssize_t nbytes;
+
+#if defined (SERVER_MODE) && !defined (WINDOWS) && !defined (NDEBUG)
+  /* server debugging mode */
+  nbytes = pwrite_with_injected_fault (thread_p, vol_fd, io_page_p, count, offset, true);
+#else
+  nbytes = fileio_pwrite_atomic (vol_fd, io_page_p, count, offset);
+#endif
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  if (nbytes < 0 && errno == EINVAL)
+    {
+      nbytes = fileio_os_transfer_misaligned (vol_fd, io_page_p, count, offset, true, true);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+  return nbytes;
+#else
+  return fileio_os_write (thread_p, vol_fd, io_page_p, count, offset);
+#endif
+}
+
+#if !defined (WINDOWS)
+/*
+ * fileio_pwrite_atomic () - write a page in a single write that is never torn
+ *   return: the number of bytes written is returned. On error, -1.
+ *   vol_fd(in): Volume descriptor of an atomic write volume
+ *   buf(in): buffer to write
+ *   count(in): the number of bytes to be written
+ *   offset(in): starting file offset
+ */
+static ssize_t
+fileio_pwrite_atomic (int vol_fd, const void *buf, size_t count, off_t offset)
+{
+#if defined (FILEIO_HAVE_RWF_ATOMIC)
+  struct iovec iov;
+
+  if (prm_get_integer_value (PRM_ID_DWB_ATOMIC_WRITE) == FILEIO_ATOMIC_WRITE_AUTO)
+    {
+      iov.iov_base = (void *) buf;
+      iov.iov_len = count;
+      return pwritev2 (vol_fd, &iov, 1, offset, RWF_ATOMIC);
+    }
+#endif /* FILEIO_HAVE_RWF_ATOMIC */
+
+  /* the storage is trusted to never tear a page */
+  return pwrite (vol_fd, buf, count, offset);
+}
+#endif /* !WINDOWS */
+
+/*
+ * fileio_is_atomic_write_capable () - can pages of the volume be written without the double write buffer?
+ *   return: true if page writes to the volume are never torn
+ *   vol_fd(in): Volume descriptor
+ *   vol_label_p(in): Volume label
+ *
+ * Note: Automatic detection needs the kernel to report an atomic write unit range covering IO_PAGESIZE, a volume
+ *       opened with direct I/O (RWF_ATOMIC needs it) and a successful atomic write on the device of the volume. The
+ *       result of the write is kept for the device, so it is probed once and not on every mount.
+ */
+static bool
+fileio_is_atomic_write_capable (int vol_fd, const char *vol_label_p)
+{
+#if defined (FILEIO_HAVE_RWF_ATOMIC)
+  struct statx stx;
+  FILEIO_ATOMIC_WRITE_DEVICE *device_p;
+  int flags;
+  int i;
+  bool is_capable;
+#endif /* FILEIO_HAVE_RWF_ATOMIC */
+
+  switch (prm_get_integer_value (PRM_ID_DWB_ATOMIC_WRITE))
+    {
+    case FILEIO_ATOMIC_WRITE_ALWAYS:
+      return true;
+
+    case FILEIO_ATOMIC_WRITE_AUTO:
+#if defined (FILEIO_HAVE_RWF_ATOMIC)
+      if (statx (vol_fd, "", AT_EMPTY_PATH, STATX_WRITE_ATOMIC, &stx) != 0 || !(stx.stx_mask & STATX_WRITE_ATOMIC)
+	  || stx.stx_atomic_write_unit_min > (unsigned int) IO_PAGESIZE
+	  || stx.stx_atomic_write_unit_max < (unsigned int) IO_PAGESIZE)
+	{
+	  return false;
+	}
+
+      flags = fcntl (vol_fd, F_GETFL);
+      if (flags == -1 || !(flags & O_DIRECT))
+	{
+	  return false;
+	}
+
+      pthread_mutex_lock (&fileio_Atomic_write_devices_mutex);
+      for (i = 0; i < fileio_Num_atomic_write_devices; i++)
+	{
+	  device_p = &fileio_Atomic_write_devices[i];
+	  if (device_p->dev_major == stx.stx_dev_major && device_p->dev_minor == stx.stx_dev_minor)
+	    {
+	      is_capable = device_p->is_capable;
+	      pthread_mutex_unlock (&fileio_Atomic_write_devices_mutex);
+	      return is_capable;
+	    }
+	}
+
+      is_capable = fileio_probe_atomic_write (vol_label_p);
+      if (fileio_Num_atomic_write_devices < FILEIO_ATOMIC_WRITE_MAX_DEVICES)
+	{
+	  device_p = &fileio_Atomic_write_devices[fileio_Num_atomic_write_devices++];
+	  device_p->dev_major = stx.stx_dev_major;
+	  device_p->dev_minor = stx.stx_dev_minor;
+	  device_p->is_capable = is_capable;
+	}
+      pthread_mutex_unlock (&fileio_Atomic_write_devices_mutex);
+
+      return is_capable;
+#else /* !FILEIO_HAVE_RWF_ATOMIC */
+      return false;
+#endif /* !FILEIO_HAVE_RWF_ATOMIC */
+
+    case FILEIO_ATOMIC_WRITE_NEVER:
+    default:
+      return false;
+    }
+}
+
+#if defined (FILEIO_HAVE_RWF_ATOMIC)
+/*
+ * fileio_probe_atomic_write () - make sure that the device of a volume accepts atomic page writes
+ *   return: true if an atomic write of a page succeeded
+ *   vol_label_p(in): Volume label
+ *
+ * Note: The page is written to a scratch file next to the volume, so the pages of the volume are never rewritten by
+ *       the probe. The scratch file is removed as soon as it is created.
+ */
+static bool
+fileio_probe_atomic_write (const char *vol_label_p)
+{
+  char probe_label[PATH_MAX];
+  struct iovec iov;
+  void *probe_page_p = NULL;
+  int probe_fd;
+  bool is_capable = false;
+
+  if (snprintf (probe_label, PATH_MAX, "%s_atomic_probe", vol_label_p) >= PATH_MAX)
+    {
+      return false;
+    }
+
+  if (posix_memalign (&probe_page_p, IO_PAGESIZE, IO_PAGESIZE) != 0)
+    {
+      return false;
+    }
+  memset (probe_page_p, 0, IO_PAGESIZE);
+
+  probe_fd = fileio_open (probe_label, O_RDWR | O_CREAT | O_TRUNC | O_DIRECT, FILEIO_DISK_PROTECTION_MODE);
+  if (probe_fd != NULL_VOLDES)
+    {
+      (void) unlink (probe_label);
+
+      iov.iov_base = probe_page_p;
+      iov.iov_len = IO_PAGESIZE;
+      is_capable = (pwritev2 (probe_fd, &iov, 1, 0, RWF_ATOMIC) == IO_PAGESIZE);
+      fileio_close (probe_fd);
+    }
+  free (probe_page_p);
+
+  return is_capable;
+}
+#endif /* FILEIO_HAVE_RWF_ATOMIC */
+
+/*
+ * fileio_set_direct_io () - bypass the operating system cache for a volume
+ *   return: void
+ *   vol_fd(in): Volume descriptor of a permanent data volume or of the double write buffer
+ *   vol_label_p(in): Volume label
+ *
+ * Note: Pages are cached by the page buffer, so the operating system cache only doubles the memory used by them.
+ *       When the file system refuses direct I/O, a notification is raised and the volume stays buffered.
+ */
+static void
+fileio_set_direct_io (int vol_fd, const char *vol_label_p)
+{
+#if defined (FILEIO_HAVE_DIRECT_IO)
+  int flags;
+
+  if (!prm_get_bool_value (PRM_ID_DATA_VOLUME_DIRECT_IO))
+    {
+      return;
+    }
+
+  flags = fcntl (vol_fd, F_GETFL);
+  if (flags == -1 || (flags & O_DIRECT))
+    {
+      return;
+    }
+
+  if (fcntl (vol_fd, F_SETFL, flags | O_DIRECT) == -1)
+    {
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_IO_DIRECT_IO_NOT_SUPPORTED, 1, vol_label_p);
+    }
+#endif /* FILEIO_HAVE_DIRECT_IO */
+}
+
+#if defined (FILEIO_HAVE_DIRECT_IO)
+/*
+ * fileio_os_transfer_misaligned () - read or write a buffer refused by a direct I/O volume
+ *   return: the number of bytes transferred is returned. On error, -1.
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(in/out): buffer to transfer
+ *   count(in): the number of bytes to be transferred
+ *   offset(in): starting file offset
+ *   is_write(in): true to write io_page_p, false to read into it
+ *   is_atomic(in): true to write io_page_p to an atomic write volume
+ *
+ * Note: Direct I/O refuses (EINVAL) buffers that are not aligned as the device requires. Page buffer frames and
+ *       double write buffer blocks are aligned; other buffers (e.g. pages allocated on the stack or by malloc when a
+ *       volume is formatted or expanded) are transferred through an aligned copy.
+ */
+static ssize_t
+fileio_os_transfer_misaligned (int vol_fd, void *io_page_p, size_t count, off_t offset, bool is_write,
+			       bool is_atomic)
+{
+  void *aligned_p = NULL;
+  ssize_t nbytes;
+
+  if (((UINTPTR) io_page_p & (FILEIO_DIRECT_IO_ALIGNMENT - 1)) == 0 || !prm_get_bool_value (PRM_ID_DATA_VOLUME_DIRECT_IO))
+    {
+      /* the buffer is not the problem */
+      errno = EINVAL;
+      return -1;
+    }
+
+  if (posix_memalign (&aligned_p, FILEIO_DIRECT_IO_ALIGNMENT, count) != 0)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  if (is_write)
+    {
+      memcpy (aligned_p, io_page_p, count);
+      if (is_atomic)
+	{
+	  nbytes = fileio_pwrite_atomic (vol_fd, aligned_p, count, offset);
+	}
+      else
+	{
+	  nbytes = pwrite (vol_fd, aligned_p, count, offset);
+	}
+    }
+  else
+    {
+      nbytes = pread (vol_fd, aligned_p, count, offset);
+      if (nbytes > 0)
+	{
+	  memcpy (io_page_p, aligned_p, nbytes);
+	}
+    }
+
+  free (aligned_p);
+  return nbytes;
+}
+#endif /* FILEIO_HAVE_DIRECT_IO */
+
 /*
  * fileio_write () - WRITE A PAGE TO DISK
  *   return: io_page_p on success, NULL on failure
@@ -4141,7 +4577,8 @@ fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t co
  *   io_page_p(in): In-memory address where the current content of page resides
  *   page_id(in): Page identifier
  *   page_size(in): Page size
- *   write_mode(in): FILEIO_WRITE_NO_COMPENSATE_WRITE skips page flush
+ *   write_mode(in): FILEIO_WRITE_NO_COMPENSATE_WRITE skips page flush, FILEIO_WRITE_ATOMIC_WRITE writes the page
+ *                   in a single atomic write
  *
  * Note:  Write the content of the page described by page_id to disk. The content of the page is stored onto io_page_p
  *        buffer which is page_size long.
@@ -4169,7 +4606,14 @@ fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_
     {
       is_retry = false;
 
-      nbytes_written = fileio_os_write (thread_p, vol_fd, io_page_p, page_size, offset);
+      if (write_mode == FILEIO_WRITE_ATOMIC_WRITE)
+	{
+	  nbytes_written = fileio_os_write_atomic (thread_p, vol_fd, io_page_p, page_size, offset);
+	}
+      else
+	{
+	  nbytes_written = fileio_os_write (thread_p, vol_fd, io_page_p, page_size, offset);
+	}
       if (nbytes_written != (ssize_t) page_size)
 	{
 	  if (errno == EINTR)
@@ -4210,7 +4654,7 @@ fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_
     }
 #endif
 
-  if (write_mode == FILEIO_WRITE_DEFAULT_WRITE)
+  if (write_mode != FILEIO_WRITE_NO_COMPENSATE_WRITE)
     {
       fileio_compensate_flush (thread_p, vol_fd, 1);
     }
@@ -4247,6 +4691,18 @@ fileio_read_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEID
     }
 #endif
 
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+  if (nbytes_to_be_read >= 2 * FILEIO_ASYNC_IO_CHUNK_SIZE && fileio_is_async_io_enabled ())
+    {
+      /* read chunks concurrently. if anything is left, it is read (and errors are reported) below. */
+      nbytes_read = (ssize_t) fileio_async_transfer_pages (thread_p, vol_fd, io_pages_p, offset, nbytes_to_be_read,
+							   page_size, false);
+      offset += nbytes_read;
+      io_pages_p += nbytes_read;
+      nbytes_to_be_read -= nbytes_read;
+    }
+#endif /* SERVER_MODE && !WINDOWS */
+
   while (nbytes_to_be_read > 0)
     {
       nbytes_read = fileio_os_read (thread_p, vol_fd, io_pages_p, nbytes_to_be_read, offset);
@@ -4334,6 +4790,18 @@ fileio_write_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEI
     }
 #endif
 
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+  if (nbytes_to_be_written >= 2 * FILEIO_ASYNC_IO_CHUNK_SIZE && fileio_is_async_io_enabled ())
+    {
+      /* write chunks concurrently. if anything is left, it is written (and errors are reported) below. */
+      nbytes_written = (ssize_t) fileio_async_transfer_pages (thread_p, vol_fd, io_pages_p, offset,
+							      nbytes_to_be_written, page_size, true);
+      offset += nbytes_written;
+      io_pages_p += nbytes_written;
+      nbytes_to_be_written -= nbytes_written;
+    }
+#endif /* SERVER_MODE && !WINDOWS */
+
   while (nbytes_to_be_written > 0)
     {
       nbytes_written = fileio_os_write (thread_p, vol_fd, io_pages_p, nbytes_to_be_written, offset);
@@ -4415,19 +4883,196 @@ fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID
   int i;
   FILEIO_WRITE_MODE write_mode = FILEIO_WRITE_DEFAULT_WRITE;
 
-#if !defined (CS_MODE)
-  write_mode = dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE;
-#endif
+#if !defined (CS_MODE)
+  write_mode = dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE;
+#endif
+
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+  if (npages > 1 && fileio_is_async_io_enabled ())
+    {
+      FILEIO_BATCH_PAGE batch_pages[FILEIO_ASYNC_IO_MAX_REQUESTS];
+      int npages_in_batch;
+
+      for (i = 0; i < npages; i += npages_in_batch)
+	{
+	  npages_in_batch = MIN (npages - i, FILEIO_ASYNC_IO_MAX_REQUESTS);
+	  for (int j = 0; j < npages_in_batch; j++)
+	    {
+	      batch_pages[j].vol_fd = vol_fd;
+	      batch_pages[j].page_id = start_page_id + i + j;
+	      batch_pages[j].io_page = io_page_array[i + j];
+	    }
+	  if (fileio_write_batch (thread_p, batch_pages, npages_in_batch, page_size) != NO_ERROR)
+	    {
+	      return NULL;
+	    }
+	}
+
+      if (write_mode == FILEIO_WRITE_DEFAULT_WRITE)
+	{
+	  fileio_compensate_flush (thread_p, vol_fd, npages);
+	}
+      return io_page_array[0];
+    }
+#endif /* SERVER_MODE && !WINDOWS */
+
+  for (i = 0; i < npages; i++)
+    {
+      if (fileio_write (thread_p, vol_fd, io_page_array[i], start_page_id + i, page_size, write_mode) == NULL)
+	{
+	  return NULL;
+	}
+    }
+
+  return io_page_array[0];
+}
+
+/*
+ * fileio_is_async_io_enabled () - are reads and writes submitted as asynchronous batches?
+ *   return: true if io_async_enable is set and the kernel supports io_uring
+ */
+bool
+fileio_is_async_io_enabled (void)
+{
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+  return prm_get_bool_value (PRM_ID_IO_ASYNC_ENABLE) && cubio::is_async_supported ();
+#else /* !SERVER_MODE || WINDOWS */
+  return false;
+#endif /* !SERVER_MODE || WINDOWS */
+}
+
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+/*
+ * fileio_async_transfer_pages () - read or write contiguous pages as concurrent chunk requests
+ *   return: number of bytes transferred. it is less than nbytes if a chunk failed; the caller should retry the rest
+ *           synchronously and report the error.
+ *   vol_fd(in): Volume descriptor
+ *   io_pages_p(in/out): In-memory address of pages
+ *   offset(in): starting file offset
+ *   nbytes(in): number of bytes to transfer
+ *   page_size(in): Page size
+ *   is_write(in): true to write, false to read
+ */
+static size_t
+fileio_async_transfer_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, off_t offset, size_t nbytes,
+			     size_t page_size, bool is_write)
+{
+  cubio::request requests[FILEIO_ASYNC_IO_MAX_REQUESTS];
+  size_t chunk_size;
+  size_t nbytes_done = 0;
+  size_t nbytes_req;
+  int nrequests, i;
+  bool success;
+
+  /* chunks are made of whole pages */
+  chunk_size = MAX (page_size, (FILEIO_ASYNC_IO_CHUNK_SIZE / page_size) * page_size);
+
+  while (nbytes_done < nbytes)
+    {
+      for (nrequests = 0; nrequests < FILEIO_ASYNC_IO_MAX_REQUESTS && nbytes_done < nbytes; nrequests++)
+	{
+	  nbytes_req = MIN (chunk_size, nbytes - nbytes_done);
+	  if (is_write)
+	    {
+	      requests[nrequests].set_write (vol_fd, io_pages_p + nbytes_done, nbytes_req,
+					     offset + (off_t) nbytes_done);
+	    }
+	  else
+	    {
+	      requests[nrequests].set_read (vol_fd, io_pages_p + nbytes_done, nbytes_req, offset + (off_t) nbytes_done);
+	    }
+	  nbytes_done += nbytes_req;
+	}
+
+      success = cubio::execute_batch (requests, nrequests, true);
+      perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_ASYNC_IO_BATCHES);
+      if (!success)
+	{
+	  /* count only the leading chunks that were completed */
+	  for (i = 0; i < nrequests; i++)
+	    {
+	      nbytes_done -= requests[i].count;
+	    }
+	  for (i = 0; i < nrequests && requests[i].is_completed (); i++)
+	    {
+	      nbytes_done += requests[i].count;
+	    }
+	  return nbytes_done;
+	}
+    }
+
+  return nbytes_done;
+}
+#endif /* SERVER_MODE && !WINDOWS */
+
+/*
+ * fileio_write_batch () - write a batch of pages, possibly of different volumes. pages are submitted together when
+ *			   asynchronous I/O is enabled, otherwise they are written one by one.
+ *   return: error code
+ *   batch_pages(in): pages to write
+ *   npages(in): Number of pages
+ *   page_size(in): Page size
+ *
+ * Note: Writes are not compensated (like FILEIO_WRITE_NO_COMPENSATE_WRITE); the caller is responsible to synchronize
+ *       the volumes.
+ */
+int
+fileio_write_batch (THREAD_ENTRY * thread_p, FILEIO_BATCH_PAGE * batch_pages, int npages, size_t page_size)
+{
+  int i;
+
+  assert (npages >= 0 && (npages == 0 || batch_pages != NULL));
+
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+  if (npages > 1 && fileio_is_async_io_enabled ())
+    {
+      cubio::request requests[FILEIO_ASYNC_IO_MAX_REQUESTS];
+      int start, nrequests;
+
+      for (start = 0; start < npages; start += nrequests)
+	{
+	  nrequests = MIN (npages - start, FILEIO_ASYNC_IO_MAX_REQUESTS);
+	  for (i = 0; i < nrequests; i++)
+	    {
+	      requests[i].set_write (batch_pages[start + i].vol_fd, batch_pages[start + i].io_page, page_size,
+				     FILEIO_GET_FILE_SIZE (page_size, batch_pages[start + i].page_id));
+	    }
+
+	  perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_ASYNC_IO_BATCHES);
+	  (void) cubio::execute_batch (requests, nrequests, true);
+	  for (i = 0; i < nrequests; i++)
+	    {
+	      if (requests[i].is_completed ())
+		{
+		  perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_IOWRITES);
+		  continue;
+		}
+
+	      /* retry synchronously; fileio_write reports the error */
+	      if (fileio_write (thread_p, batch_pages[start + i].vol_fd, batch_pages[start + i].io_page,
+				batch_pages[start + i].page_id, page_size, FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+		{
+		  ASSERT_ERROR ();
+		  return er_errid ();
+		}
+	    }
+	}
+
+      return NO_ERROR;
+    }
+#endif /* SERVER_MODE && !WINDOWS */
 
   for (i = 0; i < npages; i++)
     {
-      if (fileio_write (thread_p, vol_fd, io_page_array[i], start_page_id + i, page_size, write_mode) == NULL)
+      if (fileio_write (thread_p, batch_pages[i].vol_fd, batch_pages[i].io_page, batch_pages[i].page_id, page_size,
+			FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
 	{
-	  return NULL;
+	  ASSERT_ERROR ();
+	  return er_errid ();
 	}
     }
 
-  return io_page_array[0];
+  return NO_ERROR;
 }
 
 /*
@@ -4490,7 +5135,19 @@ fileio_synchronize (THREAD_ENTRY * thread_p, int vol_fd, const char *vlabel, FIL
   /* If all_sync is true, everything was synchronized. This happens when DWB is completely flushed. */
   if (ret == NO_ERROR && all_sync == false)
     {
-      ret = fsync (vol_fd);
+#if defined (FILEIO_HAVE_DIRECT_IO)
+      int flags = fcntl (vol_fd, F_GETFL);
+
+      if (flags != -1 && (flags & O_DIRECT))
+	{
+	  /* page contents already reached the device; only the device cache and the file size need to be flushed */
+	  ret = fdatasync (vol_fd);
+	}
+      else
+#endif /* FILEIO_HAVE_DIRECT_IO */
+	{
+	  ret = fsync (vol_fd);
+	}
     }
 
 #if defined (EnableThreadMonitoring)
@@ -5638,6 +6295,38 @@ fileio_make_volume_info_name (char *vol_info_name_p, const char *db_full_name_p)
   sprintf (vol_info_name_p, "%s%s", db_full_name_p, FILEIO_VOLINFO_SUFFIX);
 }
 
+/*
+ * fileio_make_pgbuf_warmup_name () - Build the name of page buffer warmup file
+ *   return: void
+ *   warmup_name(out):
+ *   db_fullname(in):
+ *
+ * Note: The caller must have enough space to store the name of the file
+ *       that is constructed(sprintf). It is recommended to have at least
+ *       DB_MAX_PATH_LENGTH length.
+ */
+void
+fileio_make_pgbuf_warmup_name (char *warmup_name_p, const char *db_full_name_p)
+{
+  sprintf (warmup_name_p, "%s%s", db_full_name_p, FILEIO_SUFFIX_PGBUF_WARMUP);
+}
+
+/*
+ * fileio_make_changed_pages_name () - Build the name of the file of pages changed since last backups
+ *   return: void
+ *   changed_pages_name(out):
+ *   db_fullname(in):
+ *
+ * Note: The caller must have enough space to store the name of the file
+ *       that is constructed(sprintf). It is recommended to have at least
+ *       DB_MAX_PATH_LENGTH length.
+ */
+void
+fileio_make_changed_pages_name (char *changed_pages_name_p, const char *db_full_name_p)
+{
+  sprintf (changed_pages_name_p, "%s%s", db_full_name_p, FILEIO_SUFFIX_CHANGED_PAGES);
+}
+
 /*
  * fileio_make_volume_ext_name () - Build the name of volumes
  *   return: void
@@ -5983,6 +6672,11 @@ fileio_cache (VOLID vol_id, const char *vol_label_p, int vol_fd, FILEIO_LOCKF_TY
       vol_info_p->volid = vol_id;
       vol_info_p->vdes = vol_fd;
       vol_info_p->lockf_type = lockf_type;
+      if (is_permanent_volume)
+	{
+	  fileio_set_direct_io (vol_fd, vol_label_p);
+	}
+      vol_info_p->atomic_write = is_permanent_volume && fileio_is_atomic_write_capable (vol_fd, vol_label_p);
       strncpy (vol_info_p->vlabel, vol_label_p, PATH_MAX);
       /* modify next volume id */
       rv = pthread_mutex_lock (&fileio_Vol_info_header.mutex);
@@ -6007,6 +6701,7 @@ fileio_cache (VOLID vol_id, const char *vol_label_p, int vol_fd, FILEIO_LOCKF_TY
       if (vol_id == LOG_DBDWB_VOLID)
 	{
 	  /* Do not cache DWB. */
+	  fileio_set_direct_io (vol_fd, vol_label_p);
 	  return vol_fd;
 	}
 
@@ -6137,6 +6832,7 @@ fileio_decache (THREAD_ENTRY * thread_p, int vol_fd)
       vol_info_p->volid = NULL_VOLID;
       vol_info_p->vdes = NULL_VOLDES;
       vol_info_p->lockf_type = FILEIO_NOT_LOCKF;
+      vol_info_p->atomic_write = false;
       vol_info_p->vlabel[0] = '\0';
 #if defined(SERVER_MODE) && defined(WINDOWS)
       pthread_mutex_destroy (&vol_info_p->vol_mutex);
@@ -6164,6 +6860,7 @@ fileio_decache (THREAD_ENTRY * thread_p, int vol_fd)
       vol_info_p->volid = NULL_VOLID;
       vol_info_p->vdes = NULL_VOLDES;
       vol_info_p->lockf_type = FILEIO_NOT_LOCKF;
+      vol_info_p->atomic_write = false;
       vol_info_p->vlabel[0] = '\0';
 #if defined(SERVER_MODE) && defined(WINDOWS)
       pthread_mutex_destroy (&vol_info_p->vol_mutex);
@@ -6535,6 +7232,32 @@ fileio_get_volume_descriptor (VOLID vol_id)
   return vol_fd;
 }
 
+/*
+ * fileio_is_atomic_write_volume () - Are pages of the permanent volume written atomically, without DWB?
+ *   return: true if the volume is mounted and its page writes are never torn
+ *   volid(in): Permanent volume identifier
+ */
+bool
+fileio_is_atomic_write_volume (VOLID vol_id)
+{
+  FILEIO_VOLUME_INFO *vol_info_p;
+
+  if (prm_get_integer_value (PRM_ID_DWB_ATOMIC_WRITE) == FILEIO_ATOMIC_WRITE_NEVER)
+    {
+      return false;
+    }
+
+  FILEIO_CHECK_AND_INITIALIZE_VOLUME_HEADER_CACHE (false);
+  if (vol_id <= NULL_VOLID || vol_id >= fileio_Vol_info_header.next_temp_volid
+      || vol_id >= fileio_Vol_info_header.max_perm_vols)
+    {
+      return false;
+    }
+
+  vol_info_p = &fileio_Vol_info_header.volinfo[vol_id / FILEIO_VOLINFO_INCREMENT][vol_id % FILEIO_VOLINFO_INCREMENT];
+  return vol_info_p->vdes != NULL_VOLDES && vol_info_p->atomic_write;
+}
+
 /*
  * fileio_find_volume_descriptor_with_label () - Find the volume descriptor given the volume label/name
  *   return: Volume Name/label
@@ -7792,6 +8515,11 @@ exit_on_error:
  * fileio_read_backup_volume () -
  *   return:
  *   session(in/out):
+ *
+ * Note: Each read thread reserves the next page and its slot in the queue while holding the mutex, then reads,
+ *       filters and compresses the page without it. Since slots are reserved in page order, the write thread still
+ *       writes the pages in order and the backup stream is the same as with a single thread. A slot of a page that
+ *       does not need to be backed up is handed to the writer with nread = 0.
  */
 #if defined(SERVER_MODE)
 static void
@@ -7801,9 +8529,9 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
   FILEIO_QUEUE *queue_p;
   FILEIO_NODE *node_p = NULL;
   int rv;
+  int max_queue_size;
   bool need_unlock = false;
   FILEIO_BACKUP_HEADER *backup_header_p;
-  FILEIO_BACKUP_PAGE *save_area_p;
 
   if (thread_p == NULL)
     {
@@ -7829,11 +8557,12 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
   fprintf (stdout, "start io_backup_volume_read, session = %p\n", session_p);
 #endif /* CUBRID_DEBUG */
   backup_header_p = session_p->bkup.bkuphdr;
-  node_p = NULL;		/* init */
+  max_queue_size = thread_info_p->act_r_threads * FILEIO_BACKUP_QUEUE_PAGES_PER_THREAD;
   while (1)
     {
       rv = pthread_mutex_lock (&thread_info_p->mtx);
-      while (thread_info_p->io_type == FILEIO_WRITE)
+      /* do not run too far ahead of the write thread */
+      while (queue_p->size >= max_queue_size && thread_info_p->io_type != FILEIO_ERROR_INTERRUPT)
 	{
 	  pthread_cond_wait (&thread_info_p->rcv, &thread_info_p->mtx);
 	}
@@ -7841,25 +8570,17 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
       if (thread_info_p->io_type == FILEIO_ERROR_INTERRUPT)
 	{
 	  need_unlock = true;
-	  node_p = NULL;
 	  goto exit_on_error;
 	}
 
-      /* get one page from queue head and do write */
-      if (node_p)
+      if (thread_info_p->only_changed_pages && thread_info_p->pageid < thread_info_p->from_npages)
 	{
-	  node_p->writeable = true;
-	  thread_info_p->io_type = FILEIO_WRITE;
-	  pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
-	  while (thread_info_p->io_type == FILEIO_WRITE)
-	    {
-	      pthread_cond_wait (&thread_info_p->rcv, &thread_info_p->mtx);
-	    }
-
-	  if (thread_info_p->io_type == FILEIO_ERROR_INTERRUPT)
+	  thread_info_p->pageid =
+	    fileio_skip_unchanged_backup_pages (session_p, thread_info_p->pageid, thread_info_p->from_npages);
+	  if (thread_info_p->pageid < 0)
 	    {
+	      thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
 	      need_unlock = true;
-	      node_p = NULL;
 	      goto exit_on_error;
 	    }
 	}
@@ -7870,14 +8591,13 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
 	  thread_info_p->end_r_threads++;
 	  if (thread_info_p->end_r_threads >= thread_info_p->act_r_threads)
 	    {
-	      thread_info_p->io_type = FILEIO_WRITE;
 	      pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
 	    }
 	  pthread_mutex_unlock (&thread_info_p->mtx);
 	  break;
 	}
 
-      /* alloc queue node */
+      /* alloc queue node and reserve its place in the queue */
       node_p = fileio_allocate_node (queue_p, backup_header_p);
       if (node_p == NULL)
 	{
@@ -7886,37 +8606,37 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
 	  goto exit_on_error;
 	}
 
-      /* read one page from Disk sequentially */
-
-      save_area_p = session_p->dbfile.area;	/* save link */
-      session_p->dbfile.area = node_p->area;
       node_p->pageid = thread_info_p->pageid;
       node_p->writeable = false;	/* init */
-      node_p->nread = fileio_read_backup (thread_p, session_p, node_p->pageid);
-      session_p->dbfile.area = save_area_p;	/* restore link */
+      (void) fileio_append_queue (queue_p, node_p);
+      thread_info_p->pageid++;
+#if defined(WINDOWS)
+      /* there is no positioned read; read the pages sequentially while holding the mutex */
+      node_p->nread = fileio_read_backup (thread_p, session_p, node_p->area, node_p->pageid);
+      pthread_mutex_unlock (&thread_info_p->mtx);
+#else /* WINDOWS */
+      pthread_mutex_unlock (&thread_info_p->mtx);
+
+      /* read one page from Disk; other read threads are reading their pages concurrently */
+      node_p->nread = fileio_read_backup (thread_p, session_p, node_p->area, node_p->pageid);
+#endif /* WINDOWS */
       if (node_p->nread == -1)
 	{
-	  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	  need_unlock = true;
 	  goto exit_on_error;
 	}
       else if (node_p->nread == 0)
 	{
 	  /* This could be an error since we estimated more pages. End of file/volume. */
-	  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	  need_unlock = true;
 	  goto exit_on_error;
 	}
 
       /* Have to allow other threads to run and check for interrupts from the user (i.e. Ctrl-C ) */
-      if ((thread_info_p->pageid % FILEIO_CHECK_FOR_INTERRUPT_INTERVAL) == 0
+      if ((node_p->pageid % FILEIO_CHECK_FOR_INTERRUPT_INTERVAL) == 0
 	  && pgbuf_is_log_check_for_interrupts (thread_p) == true)
 	{
 #if defined(CUBRID_DEBUG)
 	  fprintf (stdout, "io_backup_volume_read interrupt\n");
 #endif /* CUBRID_DEBUG */
-	  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	  need_unlock = true;
 	  goto exit_on_error;
 	}
 
@@ -7929,24 +8649,7 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
       if (thread_info_p->only_updated_pages == false || LSA_ISNULL (&session_p->dbfile.lsa)
 	  || LSA_LT (&session_p->dbfile.lsa, &node_p->area->iopage.prv.lsa))
 	{
-	  /* Backup the content of this page along with its page identifier add alloced node to the queue */
-	  (void) fileio_append_queue (queue_p, node_p);
-	}
-      else
-	{
-	  /* free node */
-	  (void) fileio_free_node (queue_p, node_p);
-	  node_p = NULL;
-	}
-
-#if defined(CUBRID_DEBUG)
-      fprintf (stdout, "read_thread from_npages = %d, pageid = %d\n", thread_info_p->from_npages,
-	       thread_info_p->pageid);
-#endif /* CUBRID_DEBUG */
-      thread_info_p->pageid++;
-      pthread_mutex_unlock (&thread_info_p->mtx);
-      if (node_p)
-	{
+	  /* Backup the content of this page along with its page identifier */
 	  node_p->nread += FILEIO_BACKUP_PAGE_OVERHEAD;
 	  FILEIO_SET_BACKUP_PAGE_ID_COPY (node_p->area, node_p->pageid, backup_header_p->bkpagesize);
 
@@ -7960,12 +8663,28 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
 	  if (backup_header_p->zip_method != FILEIO_ZIP_NONE_METHOD
 	      && fileio_compress_backup_node (node_p, backup_header_p) != NO_ERROR)
 	    {
-	      thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	      need_unlock = false;
-	      node_p = NULL;
 	      goto exit_on_error;
 	    }
 	}
+      else
+	{
+	  /* skip this page; the write thread only releases the node */
+	  node_p->nread = 0;
+	}
+
+#if defined(CUBRID_DEBUG)
+      fprintf (stdout, "read_thread from_npages = %d, pageid = %d\n", thread_info_p->from_npages, node_p->pageid);
+#endif /* CUBRID_DEBUG */
+
+      /* hand the page to the write thread */
+      rv = pthread_mutex_lock (&thread_info_p->mtx);
+      node_p->writeable = true;
+      if (node_p == queue_p->head)
+	{
+	  pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
+	}
+      node_p = NULL;
+      pthread_mutex_unlock (&thread_info_p->mtx);
     }
 
 exit_on_end:
@@ -7976,6 +8695,11 @@ exit_on_end:
   return;
 exit_on_error:
 
+  if (!need_unlock)
+    {
+      rv = pthread_mutex_lock (&thread_info_p->mtx);
+    }
+
   /* set error info */
   if (thread_info_p->errid == NO_ERROR)
     {
@@ -7983,21 +8707,12 @@ exit_on_error:
       thread_info_p->errid = er_errid ();
     }
 
+  /* a node that is already in the queue is released together with the queue */
+  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
   thread_info_p->end_r_threads++;
-  if (thread_info_p->end_r_threads >= thread_info_p->act_r_threads)
-    {
-      pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
-    }
-
-  if (need_unlock)
-    {
-      pthread_mutex_unlock (&thread_info_p->mtx);
-    }
-
-  if (node_p != NULL)
-    {
-      (void) fileio_free_node (queue_p, node_p);
-    }
+  pthread_cond_broadcast (&thread_info_p->rcv);	/* wake up waiting read threads */
+  pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
+  pthread_mutex_unlock (&thread_info_p->mtx);
 
   goto exit_on_end;
 }
@@ -8006,6 +8721,9 @@ exit_on_error:
  * fileio_write_backup_volume () -
  *   return:
  *   session(in/out):
+ *
+ * Note: Pages are written in queue order as soon as the head of the queue is ready. The mutex is not held while
+ *       writing, so read threads keep reading and compressing the following pages.
  */
 static FILEIO_TYPE
 fileio_write_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p)
@@ -8014,7 +8732,6 @@ fileio_write_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * ses
   FILEIO_QUEUE *queue_p;
   FILEIO_NODE *node_p;
   int rv;
-  bool need_unlock = false;
   FILEIO_BACKUP_HEADER *backup_header_p;
   FILEIO_BACKUP_PAGE *save_area_p;
 
@@ -8032,68 +8749,61 @@ fileio_write_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * ses
   rv = pthread_mutex_lock (&thread_info_p->mtx);
   while (1)
     {
-      while (thread_info_p->io_type == FILEIO_READ)
+      while ((queue_p->head == NULL || queue_p->head->writeable == false)
+	     && thread_info_p->io_type != FILEIO_ERROR_INTERRUPT
+	     && thread_info_p->end_r_threads < thread_info_p->act_r_threads)
 	{
 	  pthread_cond_wait (&thread_info_p->wcv, &thread_info_p->mtx);
 	}
 
       if (thread_info_p->io_type == FILEIO_ERROR_INTERRUPT)
 	{
-	  need_unlock = true;
 	  goto exit_on_error;
 	}
 
+      if (queue_p->head == NULL || queue_p->head->writeable == false)
+	{
+	  /* check EOF: all read threads are ended and all their pages are written */
+	  assert (queue_p->head == NULL);
+	  pthread_mutex_unlock (&thread_info_p->mtx);
+	  break;
+	}
+
+      /* delete the head node of the queue; it is owned by this thread from now on */
+      node_p = fileio_delete_queue_head (queue_p);
+      pthread_cond_broadcast (&thread_info_p->rcv);	/* wake up read threads waiting for queue space */
+      pthread_mutex_unlock (&thread_info_p->mtx);
+
       /* do write */
-      while (queue_p->head && queue_p->head->writeable == true)
+      rv = NO_ERROR;
+      if (node_p->nread > 0)
 	{
-	  /* delete the head node of the queue */
-	  node_p = fileio_delete_queue_head (queue_p);
-	  if (node_p == NULL)
-	    {
-	      thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	    }
-	  else
-	    {
-	      save_area_p = session_p->dbfile.area;	/* save link */
-	      rv = fileio_write_backup_node (thread_p, session_p, node_p, backup_header_p);
-	      if (rv != NO_ERROR)
-		{
-		  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-		}
-	      session_p->dbfile.area = save_area_p;	/* restore link */
+	  save_area_p = session_p->dbfile.area;	/* save link */
+	  rv = fileio_write_backup_node (thread_p, session_p, node_p, backup_header_p);
+	  session_p->dbfile.area = save_area_p;	/* restore link */
 #if defined(CUBRID_DEBUG)
-	      fprintf (stdout, "write_thread node->pageid = %d, node->nread = %d\n", node_p->pageid, node_p->nread);
+	  fprintf (stdout, "write_thread node->pageid = %d, node->nread = %d\n", node_p->pageid, node_p->nread);
 #endif /* CUBRID_DEBUG */
-	      if (session_p->verbose_fp && thread_info_p->from_npages >= 25
-		  && node_p->pageid >= thread_info_p->check_npages)
-		{
-		  fprintf (session_p->verbose_fp, "#");
-		  thread_info_p->check_ratio++;
-		  thread_info_p->check_npages =
-		    (int) (((float) thread_info_p->from_npages / 25.0) * thread_info_p->check_ratio);
-		}
-
-	      /* free node */
-	      (void) fileio_free_node (queue_p, node_p);
-	    }
-
-	  if (thread_info_p->io_type == FILEIO_ERROR_INTERRUPT)
-	    {
-	      need_unlock = true;
-	      goto exit_on_error;
-	    }
 	}
 
-      thread_info_p->io_type = FILEIO_READ;	/* reset */
-      /* check EOF */
-      if (thread_info_p->end_r_threads >= thread_info_p->act_r_threads)
+      while (session_p->verbose_fp && thread_info_p->from_npages >= 25
+	     && node_p->pageid >= thread_info_p->check_npages)
 	{
-	  /* only write thread alive */
-	  pthread_mutex_unlock (&thread_info_p->mtx);
-	  break;
+	  fprintf (session_p->verbose_fp, "#");
+	  thread_info_p->check_ratio++;
+	  thread_info_p->check_npages =
+	    (int) (((float) thread_info_p->from_npages / 25.0) * thread_info_p->check_ratio);
 	}
 
-      pthread_cond_broadcast (&thread_info_p->rcv);	/* wake up all read threads */
+      pthread_mutex_lock (&thread_info_p->mtx);
+
+      /* free node */
+      (void) fileio_free_node (queue_p, node_p);
+      if (rv != NO_ERROR)
+	{
+	  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
+	  goto exit_on_error;
+	}
     }
 
 #if defined(CUBRID_DEBUG)
@@ -8119,17 +8829,12 @@ exit_on_error:
 	}
     }
 
-  if (thread_info_p->end_r_threads >= thread_info_p->act_r_threads)
+  /* wake up all read threads and wait for all killed; the session still refers to the queue they use */
+  pthread_cond_broadcast (&thread_info_p->rcv);
+  while (thread_info_p->end_r_threads < thread_info_p->act_r_threads)
     {
-      /* only write thread alive an error (i.e, INTERRUPT) was broken out, so terminate the all threads. But, I am the
-       * last one, and all the readers are terminated */
-      pthread_mutex_unlock (&thread_info_p->mtx);
-      goto exit_on_end;
+      pthread_cond_wait (&thread_info_p->wcv, &thread_info_p->mtx);
     }
-
-  /* wake up all read threads and wait for all killed */
-  pthread_cond_broadcast (&thread_info_p->rcv);
-  pthread_cond_wait (&thread_info_p->wcv, &thread_info_p->mtx);
   pthread_mutex_unlock (&thread_info_p->mtx);
   goto exit_on_end;
 }
@@ -8351,6 +9056,9 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 
   thread_info_p = &session_p->read_thread_info;
   queue_p = &thread_info_p->io_queue;
+  /* pages that were not written since the base backup need not be read at all */
+  thread_info_p->only_changed_pages = (is_only_updated_pages
+				       && pgbuf_changed_pages_is_tracked (backup_header_p->level));
   /* set the number of activated read threads */
   thread_info_p->act_r_threads = MAX (thread_info_p->num_threads - 1, 0);
   thread_info_p->act_r_threads = MIN (thread_info_p->act_r_threads, from_npages);
@@ -8373,6 +9081,19 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
     {
       for (page_id = 0; page_id < from_npages; page_id++)
 	{
+	  if (thread_info_p->only_changed_pages)
+	    {
+	      page_id = fileio_skip_unchanged_backup_pages (session_p, page_id, from_npages);
+	      if (page_id < 0)
+		{
+		  goto error;
+		}
+	      else if (page_id >= from_npages)
+		{
+		  break;
+		}
+	    }
+
 	  /* Have to allow other threads to run and check for interrupts from the user (i.e. Ctrl-C ). check for
 	   * standalone-mode too. */
 	  if ((page_id % FILEIO_CHECK_FOR_INTERRUPT_INTERVAL) == 0
@@ -8389,11 +9110,8 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 	    }
 
 	  /* read one page sequentially */
-	  save_area_p = session_p->dbfile.area;	/* save link */
-	  session_p->dbfile.area = node_p->area;
 	  node_p->pageid = page_id;
-	  node_p->nread = fileio_read_backup (thread_p, session_p, node_p->pageid);
-	  session_p->dbfile.area = save_area_p;	/* restore link */
+	  node_p->nread = fileio_read_backup (thread_p, session_p, node_p->area, node_p->pageid);
 	  if (node_p->nread == -1)
 	    {
 	      goto error;
@@ -8441,7 +9159,7 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 		}
 	    }
 
-	  if (session_p->verbose_fp && from_npages >= 25 && page_id >= check_npages)
+	  while (session_p->verbose_fp && from_npages >= 25 && page_id >= check_npages)
 	    {
 	      fprintf (session_p->verbose_fp, "#");
 	      check_ratio++;
@@ -8706,11 +9424,56 @@ fileio_flush_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p)
   return NO_ERROR;
 }
 
+/*
+ * fileio_skip_unchanged_backup_pages () - Skip the pages that were not written
+ *                                        since the backup this backup is based on
+ *   return: next page to read, npages if there is none, or -1 on error
+ *   session(in/out): The session array
+ *   page_id(in): first page to check
+ *   npages(in): number of pages of the volume
+ *
+ * Note: These pages are the same on disk as in the base backup. When pages are
+ *       read sequentially, the file position is moved to the returned page.
+ */
+#if !defined(CS_MODE)
+static int
+fileio_skip_unchanged_backup_pages (FILEIO_BACKUP_SESSION * session_p, int page_id, int npages)
+{
+  VPID vpid;
+
+  vpid.volid = session_p->dbfile.volid;
+  for (vpid.pageid = page_id; vpid.pageid < npages; vpid.pageid++)
+    {
+      if (pgbuf_changed_pages_is_changed (session_p->bkup.bkuphdr->level, &vpid))
+	{
+	  break;
+	}
+    }
+
+#if !defined(SERVER_MODE) || defined(WINDOWS)
+  if (vpid.pageid != page_id && vpid.pageid < npages)
+    {
+      off_t offset = FILEIO_GET_FILE_SIZE (session_p->bkup.bkuphdr->bkpagesize, vpid.pageid);
+
+      if (lseek (session_p->dbfile.vdes, offset, SEEK_SET) != offset)
+	{
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_READ, 2, vpid.pageid,
+			       session_p->dbfile.vlabel);
+	  return -1;
+	}
+    }
+#endif /* !SERVER_MODE || WINDOWS */
+
+  return vpid.pageid;
+}
+#endif /* !CS_MODE */
+
 /*
  * fileio_read_backup () - Read a database page from the current database
  *                     volume/file that is backed up
  *   return:
  *   session(in/out): The session array
+ *   area(out): The area where the page is read
  *   pageid(in): The page from which we are reading
  *
  * Note: If we run into an end of file, we filled the page with nulls. This is
@@ -8719,7 +9482,8 @@ fileio_flush_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p)
  *       the whole volume/file is backed up.
  */
 static ssize_t
-fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p, int page_id)
+fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p, FILEIO_BACKUP_PAGE * area_p,
+		    int page_id)
 {
   int io_page_size = session_p->bkup.bkuphdr->bkpagesize;
 #if defined(WINDOWS)
@@ -8731,15 +9495,15 @@ fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p,
 
   /* Read until you acumulate io_pagesize or the EOF mark is reached. */
   nread = 0;
-  FILEIO_SET_BACKUP_PAGE_ID (session_p->dbfile.area, page_id, io_page_size);
+  FILEIO_SET_BACKUP_PAGE_ID (area_p, page_id, io_page_size);
 
 #if defined(CUBRID_DEBUG)
-  fprintf (stdout, "fileio_read_backup: %d\t%d,\t%d\n", ((FILEIO_BACKUP_PAGE *) (session_p->dbfile.area))->iopageid,
-	   *(PAGEID *) (((char *) (session_p->dbfile.area)) + offsetof (FILEIO_BACKUP_PAGE, iopage) + io_page_size),
+  fprintf (stdout, "fileio_read_backup: %d\t%d,\t%d\n", ((FILEIO_BACKUP_PAGE *) (area_p))->iopageid,
+	   *(PAGEID *) (((char *) (area_p)) + offsetof (FILEIO_BACKUP_PAGE, iopage) + io_page_size),
 	   io_page_size);
 #endif
 
-  buffer_p = (char *) &session_p->dbfile.area->iopage;
+  buffer_p = (char *) &area_p->iopage;
   while (nread < io_page_size)
     {
       /* Read the desired amount of bytes */
@@ -8757,7 +9521,7 @@ fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p,
 	  if (errno != EINTR)
 	    {
 	      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_READ, 2,
-				   FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area), session_p->dbfile.vlabel);
+				   FILEIO_GET_BACKUP_PAGE_ID (area_p), session_p->dbfile.vlabel);
 	      return -1;
 	    }
 	}
@@ -8810,6 +9574,13 @@ fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p,
       if (sleep_msecs > 0)
 	{
 	  sleep_msecs = (int) (((double) sleep_msecs) / (ONE_M / io_page_size));
+#if !defined(WINDOWS)
+	  /* read threads sleep concurrently; keep the overall read rate of a single thread */
+	  if (session_p->read_thread_info.act_r_threads > 1)
+	    {
+	      sleep_msecs *= session_p->read_thread_info.act_r_threads;
+	    }
+#endif /* !WINDOWS */
 
 	  if (sleep_msecs > 0)
 	    {
@@ -11581,7 +12352,7 @@ fileio_initialize_res (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, PGLENGTH
 
   io_page->prv.ptype = '\0';
   io_page->prv.pflag = '\0';
-  io_page->prv.p_reserve_1 = 0;
+  io_page->prv.checksum = 0;
   io_page->prv.p_reserve_2 = 0;
   io_page->prv.tde_nonce = 0;
 }
@@ -11832,6 +12603,82 @@ fileio_page_check_corruption (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, bo
   assert (io_page != NULL && is_page_corrupted != NULL);
 
   *is_page_corrupted = !fileio_is_page_sane (io_page, IO_PAGESIZE);
+  if (!*is_page_corrupted && (io_page->prv.pflag & FILEIO_PAGE_FLAG_CHECKSUM))
+    {
+      *is_page_corrupted = (io_page->prv.checksum != (INT32) fileio_compute_page_checksum (io_page));
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_compute_page_checksum - Compute CRC32C of the page, as if its checksum field was zero.
+ *   return: checksum
+ *   io_page (in): the page
+ */
+static UINT32
+fileio_compute_page_checksum (const FILEIO_PAGE * io_page)
+{
+  const char *page_p = (const char *) io_page;
+  const size_t checksum_offset = offsetof (FILEIO_PAGE, prv.checksum);
+  const INT32 zero = 0;
+  UINT32 checksum;
+
+  checksum = cubbase::crc32c (page_p, checksum_offset);
+  checksum = cubbase::crc32c_extend (checksum, &zero, sizeof (zero));
+  checksum = cubbase::crc32c_extend (checksum, page_p + checksum_offset + sizeof (zero),
+				     IO_PAGESIZE - checksum_offset - sizeof (zero));
+
+  return checksum;
+}
+
+/*
+ * fileio_set_page_checksum - Set the page checksum.
+ *   return: error code
+ *   thread_p (in): thread entry
+ *   io_page (in/out): the page, as it is written to disk
+ *
+ *   Note: Must be called after the last change of page content, encryption included.
+ */
+int
+fileio_set_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page)
+{
+  assert (io_page != NULL);
+
+  io_page->prv.pflag |= FILEIO_PAGE_FLAG_CHECKSUM;
+  io_page->prv.checksum = (INT32) fileio_compute_page_checksum (io_page);
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_check_page_checksum - Check the checksum of a page read from disk.
+ *   return: error code, ER_PB_PAGE_CHECKSUM_MISMATCH if the page is corrupted
+ *   thread_p (in): thread entry
+ *   io_page (in): the page, as it was read from disk
+ *   vpid (in): page identifier
+ *
+ *   Note: Pages written without checksum are not checked.
+ */
+int
+fileio_check_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, const VPID * vpid)
+{
+  INT32 checksum;
+
+  assert (io_page != NULL && vpid != NULL);
+
+  if (!(io_page->prv.pflag & FILEIO_PAGE_FLAG_CHECKSUM))
+    {
+      return NO_ERROR;
+    }
+
+  checksum = (INT32) fileio_compute_page_checksum (io_page);
+  if (checksum != io_page->prv.checksum)
+    {
+      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_PB_PAGE_CHECKSUM_MISMATCH, 4, vpid->pageid,
+	      fileio_get_volume_label (vpid->volid, PEEK), io_page->prv.checksum, checksum);
+      return ER_PB_PAGE_CHECKSUM_MISMATCH;
+    }
 
   return NO_ERROR;
 }
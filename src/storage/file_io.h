@@ -65,6 +65,13 @@
 
 #define FILEIO_PAGE_FLAG_ENCRYPTED_MASK 0x3
 
+#define FILEIO_PAGE_FLAG_CHECKSUM 0x4	/* checksum of page is set */
+
+/* Direct I/O (data_volume_direct_io): buffers aligned to FILEIO_DIRECT_IO_ALIGNMENT are accepted by any device.
+ * Most devices accept FILEIO_DIRECT_IO_MIN_ALIGNMENT too. Misaligned buffers are transferred through a copy. */
+#define FILEIO_DIRECT_IO_ALIGNMENT 4096
+#define FILEIO_DIRECT_IO_MIN_ALIGNMENT 512
+
 #if defined(WINDOWS)
 #define STR_PATH_SEPARATOR "\\"
 #else /* WINDOWS */
@@ -91,6 +98,8 @@
 #define FILEIO_VOLLOCK_SUFFIX        "__lock"
 #define FILEIO_SUFFIX_DWB            "_dwb"
 #define FILEIO_SUFFIX_KEYS           "_keys"
+#define FILEIO_SUFFIX_PGBUF_WARMUP   "_pbwrm"
+#define FILEIO_SUFFIX_CHANGED_PAGES  "_bkchg"
 #define FILEIO_MAX_SUFFIX_LENGTH     7
 
 typedef enum
@@ -164,9 +173,18 @@ typedef enum
 typedef enum
 {
   FILEIO_WRITE_DEFAULT_WRITE,	/* default write mode does compensate write including sync */
-  FILEIO_WRITE_NO_COMPENSATE_WRITE	/* skips */
+  FILEIO_WRITE_NO_COMPENSATE_WRITE,	/* skips */
+  FILEIO_WRITE_ATOMIC_WRITE	/* like default, but the page can't be torn; only for atomic write volumes */
 } FILEIO_WRITE_MODE;
 
+/* Values of double_write_buffer_atomic_write parameter */
+typedef enum
+{
+  FILEIO_ATOMIC_WRITE_NEVER = 0,	/* all permanent pages go through double write buffer */
+  FILEIO_ATOMIC_WRITE_AUTO = 1,	/* volumes supporting atomic page writes skip double write buffer */
+  FILEIO_ATOMIC_WRITE_ALWAYS = 2	/* storage never tears page writes, double write buffer is not used */
+} FILEIO_ATOMIC_WRITE_MODE;
+
 /* Reserved area of FILEIO_PAGE */
 typedef struct fileio_page_reserved FILEIO_PAGE_RESERVED;
 struct fileio_page_reserved
@@ -176,7 +194,7 @@ struct fileio_page_reserved
   INT16 volid;			/* Volume identifier where the page reside */
   unsigned char ptype;		/* Page type */
   unsigned char pflag;
-  INT32 p_reserve_1;
+  INT32 checksum;		/* CRC32C of page, if FILEIO_PAGE_FLAG_CHECKSUM is set in pflag */
   INT32 p_reserve_2;		/* unused - Reserved field */
   INT64 tde_nonce;		/* tde nonce. atomic counter for temp pages, lsa for perm pages */
 };
@@ -187,6 +205,15 @@ struct fileio_page_watermark
   LOG_LSA lsa;			/* duplication of prv.lsa */
 };
 
+/* A page write of a batch. Pages of a batch may belong to different volumes. */
+typedef struct fileio_batch_page FILEIO_BATCH_PAGE;
+struct fileio_batch_page
+{
+  int vol_fd;			/* Volume descriptor */
+  PAGEID page_id;		/* Page identifier */
+  void *io_page;		/* Page content; page_size long */
+};
+
 /* The FILEIO_PAGE */
 typedef struct fileio_page FILEIO_PAGE;
 struct fileio_page
@@ -417,6 +444,7 @@ struct fileio_thread_info
   int errid;
 
   bool only_updated_pages;
+  bool only_changed_pages;	/* skip pages that are not marked as changed since the base backup */
   bool initialized;
 
   int check_ratio;
@@ -490,6 +518,8 @@ extern void *fileio_write_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_p
 				 size_t page_size, FILEIO_WRITE_MODE write_mode);
 extern void *fileio_writev (THREAD_ENTRY * thread_p, int vdes, void **arrayof_io_pgptr, PAGEID start_pageid,
 			    DKNPAGES npages, size_t page_size);
+extern bool fileio_is_async_io_enabled (void);
+extern int fileio_write_batch (THREAD_ENTRY * thread_p, FILEIO_BATCH_PAGE * batch_pages, int npages, size_t page_size);
 extern int fileio_synchronize (THREAD_ENTRY * thread_p, int vdes, const char *vlabel,
 			       FILEIO_SYNC_OPTION check_sync_dwb);
 extern int fileio_synchronize_all (THREAD_ENTRY * thread_p, bool include_log);
@@ -511,6 +541,7 @@ extern VOLID fileio_find_previous_perm_volume (THREAD_ENTRY * thread_p, VOLID vo
 extern VOLID fileio_find_previous_temp_volume (THREAD_ENTRY * thread_p, VOLID volid);
 
 extern int fileio_get_volume_descriptor (VOLID volid);
+extern bool fileio_is_atomic_write_volume (VOLID volid);
 extern bool fileio_map_mounted (THREAD_ENTRY * thread_p, bool (*fun) (THREAD_ENTRY * thread_p, VOLID volid, void *args),
 				void *args);
 extern int fileio_get_number_of_partition_free_pages (const char *path, size_t page_size);	/* remove me */
@@ -523,6 +554,8 @@ extern const char *fileio_get_base_file_name (const char *fullname);
 extern char *fileio_get_directory_path (char *path, const char *fullname);
 extern int fileio_get_volume_max_suffix (void);
 extern void fileio_make_volume_info_name (char *volinfo_name, const char *db_fullname);
+extern void fileio_make_pgbuf_warmup_name (char *warmup_name, const char *db_fullname);
+extern void fileio_make_changed_pages_name (char *changed_pages_name, const char *db_fullname);
 extern void fileio_make_volume_ext_name (char *volext_fullname, const char *ext_path, const char *ext_name,
 					 VOLID volid);
 extern void fileio_make_volume_ext_given_name (char *volext_fullname, const char *ext_path, const char *ext_name);
@@ -624,6 +657,7 @@ extern void fileio_page_bitmap_list_add (FILEIO_RESTORE_PAGE_BITMAP_LIST * page_
 					 FILEIO_RESTORE_PAGE_BITMAP * page_bitmap);
 extern void fileio_page_bitmap_list_destroy (FILEIO_RESTORE_PAGE_BITMAP_LIST * page_bitmap_list);
 extern int fileio_set_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page);
+extern int fileio_check_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, const VPID * vpid);
 extern int fileio_page_check_corruption (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, bool * is_page_corrupted);
 extern void fileio_page_hexa_dump (const char *data, int length);
 extern bool fileio_is_formatted_page (THREAD_ENTRY * thread_p, const char *io_page);
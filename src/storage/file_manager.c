@@ -430,6 +430,18 @@ struct file_map_context
   void *args;
 };
 
+/* FILE_COLLECT_PAGES_CONTEXT - context variables for file_collect_user_pages function. */
+typedef struct file_collect_pages_context FILE_COLLECT_PAGES_CONTEXT;
+struct file_collect_pages_context
+{
+  bool is_partial;
+  FILE_FTAB_COLLECTOR ftab_collector;
+
+  VPID *vpids;
+  int n_vpids;
+  int max_vpids;
+};
+
 /* FILE_SET_TDE_ALGORITHM_ARGS - args varaible for file_apply_tde_algorithm() */
 typedef struct file_set_tde_algorithm_args FILE_SET_TDE_ALGORITHM_ARGS;
 struct file_set_tde_algorithm_args
@@ -726,6 +738,8 @@ static int file_rv_dealloc_internal (THREAD_ENTRY * thread_p, LOG_RCV * rcv, boo
 STATIC_INLINE int file_create_temp_internal (THREAD_ENTRY * thread_p, int npages, FILE_TYPE ftype, bool is_numerable,
 					     VFID * vfid_out) __attribute__ ((ALWAYS_INLINE));
 static int file_sector_map_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args);
+static int file_sector_collect_user_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop,
+					   void *args);
 static DISK_ISVALID file_table_check (THREAD_ENTRY * thread_p, const VFID * vfid, DISK_VOLMAP_CLONE * disk_map_clone);
 
 STATIC_INLINE int file_table_dump (THREAD_ENTRY * thread_p, const FILE_HEADER * fhead, FILE * fp)
@@ -7265,6 +7279,179 @@ exit:
   return error_code;
 }
 
+/*
+ * file_sector_collect_user_pages () - Function callable by file_extdata_apply_funcs. Used to collect the user pages of
+ *                                     a sector from file table.
+ *
+ * return        : NO_ERROR
+ * thread_p (in) : thread entry
+ * data (in)     : partial sector or sector ID
+ * index (in)    : unused
+ * stop (in)     : unused
+ * args (in/out) : FILE_COLLECT_PAGES_CONTEXT *
+ */
+static int
+file_sector_collect_user_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args)
+{
+  FILE_COLLECT_PAGES_CONTEXT *context = (FILE_COLLECT_PAGES_CONTEXT *) args;
+  FILE_PARTIAL_SECTOR partsect = FILE_PARTIAL_SECTOR_INITIALIZER;
+  int iter;
+  VPID vpid;
+
+  /* hack to know this is partial table or full table */
+  if (context->is_partial)
+    {
+      partsect = *(FILE_PARTIAL_SECTOR *) data;
+    }
+  else
+    {
+      partsect.vsid = *(VSID *) data;
+    }
+
+  vpid.volid = partsect.vsid.volid;
+  for (iter = 0, vpid.pageid = SECTOR_FIRST_PAGEID (partsect.vsid.sectid); iter < FILE_ALLOC_BITMAP_NBITS;
+       iter++, vpid.pageid++)
+    {
+      if (context->is_partial && !file_partsect_is_bit_set (&partsect, iter))
+	{
+	  /* not allocated */
+	  continue;
+	}
+
+      if (file_table_collector_has_page (&context->ftab_collector, &vpid))
+	{
+	  /* skip table pages */
+	  continue;
+	}
+
+      if (context->n_vpids >= context->max_vpids)
+	{
+	  /* header user page count is exhausted */
+	  assert_release (false);
+	  *stop = true;
+	  return NO_ERROR;
+	}
+      context->vpids[context->n_vpids++] = vpid;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * file_collect_user_pages () - collect the identifiers of all user pages without fixing them
+ *
+ * return           : error code
+ * thread_p (in)    : thread entry
+ * vfid (in)        : file identifier
+ * vpids_out (out)  : user page identifiers, ordered by volume and page. the array is allocated with db_private_alloc
+ *                    and must be freed by caller.
+ * n_vpids_out (out): user page count
+ *
+ * note: only the file header and table pages are fixed (read-latched). pages allocated after the call are not
+ *       collected and pages collected may be deallocated later; callers (e.g. parallel heap scans) must handle both.
+ */
+int
+file_collect_user_pages (THREAD_ENTRY * thread_p, const VFID * vfid, VPID ** vpids_out, int *n_vpids_out)
+{
+  VPID vpid_fhead;
+  PAGE_PTR page_fhead = NULL;
+  FILE_HEADER *fhead = NULL;
+  FILE_EXTENSIBLE_DATA *extdata_ftab;
+  FILE_COLLECT_PAGES_CONTEXT context;
+  int error_code = NO_ERROR;
+
+  assert (vfid != NULL && !VFID_ISNULL (vfid));
+  assert (vpids_out != NULL && n_vpids_out != NULL);
+
+  *vpids_out = NULL;
+  *n_vpids_out = 0;
+
+  FILE_GET_HEADER_VPID (vfid, &vpid_fhead);
+  page_fhead = pgbuf_fix (thread_p, &vpid_fhead, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (page_fhead == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  fhead = (FILE_HEADER *) page_fhead;
+  file_header_sanity_check (thread_p, fhead);
+
+  context.ftab_collector.partsect_ftab = NULL;
+  context.n_vpids = 0;
+  context.max_vpids = fhead->n_page_user;
+  context.vpids = NULL;
+  if (context.max_vpids == 0)
+    {
+      goto exit;
+    }
+
+  context.vpids = (VPID *) db_private_alloc (thread_p, context.max_vpids * sizeof (VPID));
+  if (context.vpids == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, context.max_vpids * sizeof (VPID));
+      goto exit;
+    }
+
+  /* collect table pages */
+  error_code = file_table_collect_ftab_pages (thread_p, page_fhead, true, &context.ftab_collector);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  /* collect from partial sectors table */
+  FILE_HEADER_GET_PART_FTAB (fhead, extdata_ftab);
+  context.is_partial = true;
+  error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_collect_user_pages, &context,
+					 false, NULL, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  if (!FILE_IS_TEMPORARY (fhead))
+    {
+      /* collect from full table */
+      context.is_partial = false;
+      FILE_HEADER_GET_FULL_FTAB (fhead, extdata_ftab);
+      error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_collect_user_pages,
+					     &context, false, NULL, NULL);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit;
+	}
+    }
+
+  qsort (context.vpids, context.n_vpids, sizeof (VPID), file_compare_vpids);
+
+exit:
+  if (page_fhead != NULL)
+    {
+      pgbuf_unfix (thread_p, page_fhead);
+    }
+  if (context.ftab_collector.partsect_ftab != NULL)
+    {
+      db_private_free (thread_p, context.ftab_collector.partsect_ftab);
+    }
+
+  if (error_code != NO_ERROR)
+    {
+      if (context.vpids != NULL)
+	{
+	  db_private_free (thread_p, context.vpids);
+	}
+      return error_code;
+    }
+
+  *vpids_out = context.vpids;
+  *n_vpids_out = context.n_vpids;
+  return NO_ERROR;
+}
+
 /*
  * file_table_check () - check file table is valid
  *
@@ -193,6 +193,7 @@ extern int file_get_type (THREAD_ENTRY * thread_p, const VFID * vfid, FILE_TYPE
 extern int file_is_temp (THREAD_ENTRY * thread_p, const VFID * vfid, bool * is_temp);
 extern int file_map_pages (THREAD_ENTRY * thread_p, const VFID * vfid, PGBUF_LATCH_MODE latch_mode,
 			   PGBUF_LATCH_CONDITION latch_cond, FILE_MAP_PAGE_FUNC func, void *args);
+extern int file_collect_user_pages (THREAD_ENTRY * thread_p, const VFID * vfid, VPID ** vpids_out, int *n_vpids_out);
 extern int file_dump (THREAD_ENTRY * thread_p, const VFID * vfid, FILE * fp);
 extern int file_spacedb (THREAD_ENTRY * thread_p, SPACEDB_FILES * spacedb);
 
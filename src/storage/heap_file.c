@@ -223,11 +223,14 @@ struct heap_hdr_stats
 				 * these values are only used for hints. These values may not be accurate at any given
 				 * time and the entries may contain duplicated pages. */
 
-  int reserve0_for_future;	/* Nothing reserved for future */
+  int flags;			/* HEAP_HDR_FLAG_* */
   int reserve1_for_future;	/* Nothing reserved for future */
   int reserve2_for_future;	/* Nothing reserved for future */
 };
 
+/* Define heap header flags. */
+#define HEAP_HDR_FLAG_COMPRESS_OVERFLOW	  0x1	/* overflow (big) records are stored LZ4 compressed */
+
 typedef struct heap_stats_entry HEAP_STATS_ENTRY;
 struct heap_stats_entry
 {
@@ -478,6 +481,28 @@ struct heap_stats_bestspace_cache
   pthread_mutex_t bestspace_mutex;
 };
 
+/*
+ * Insert page affinity. Each thread remembers the page it inserts into for the last few heaps. While the page has
+ * space, the thread inserts into it without fixing the heap header page or looking into the best space cache. The
+ * estimates of the heap header are updated lazily, every HEAP_INSERT_AFFINITY_SYNC_RECS records or when the thread
+ * looks for a new page.
+ */
+#define HEAP_INSERT_AFFINITY_SIZE 4	/* number of heaps remembered by each thread */
+#define HEAP_INSERT_AFFINITY_SYNC_RECS 64
+
+typedef struct heap_insert_affinity HEAP_INSERT_AFFINITY;
+struct heap_insert_affinity
+{
+  HFID hfid;			/* heap file identifier */
+  OID class_oid;		/* class of heap */
+  VPID vpid;			/* page the thread inserts into or NULL */
+  UINT64 version;		/* heap_Insert_affinity_version when page was taken */
+  int unfill_space;		/* unfill space of heap */
+  int num_recs;			/* records not yet added to heap header estimates */
+  int num_pages;		/* pages not yet added to heap header estimates */
+  float recs_sumlen;		/* record length not yet added to heap header estimates */
+};
+
 typedef struct heap_show_scan_ctx HEAP_SHOW_SCAN_CTX;
 struct heap_show_scan_ctx
 {
@@ -501,6 +526,12 @@ static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area =
 
 static HEAP_STATS_BESTSPACE_CACHE *heap_Bestspace = NULL;
 
+/* HEAP_INSERT_AFFINITY_SIZE entries for each thread */
+static HEAP_INSERT_AFFINITY *heap_Insert_affinity = NULL;
+static int heap_Insert_affinity_count = 0;
+/* incremented when heap pages or files are removed; affinity pages taken before are dropped */
+static volatile UINT64 heap_Insert_affinity_version = 0;
+
 static HEAP_HFID_TABLE heap_Hfid_table_area = { LF_HASH_TABLE_INITIALIZER, LF_ENTRY_DESCRIPTOR_INITIALIZER,
   LF_FREELIST_INITIALIZER, false
 };
@@ -651,6 +682,8 @@ static DISK_ISVALID heap_scanrange_isvalid (HEAP_SCANRANGE * scan_range);
 #endif /* CUBRID_DEBUG */
 static OID *heap_ovf_insert (THREAD_ENTRY * thread_p, const HFID * hfid, OID * ovf_oid, RECDES * recdes);
 static const OID *heap_ovf_update (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * ovf_oid, RECDES * recdes);
+static VFID *heap_ovf_find_vfid_internal (THREAD_ENTRY * thread_p, const HFID * hfid, VFID * ovf_vfid, bool docreate,
+					  PGBUF_LATCH_CONDITION latch_cond, int *hdr_flags);
 static int heap_ovf_flush (THREAD_ENTRY * thread_p, const OID * ovf_oid);
 static int heap_ovf_get_length (THREAD_ENTRY * thread_p, const OID * ovf_oid);
 static SCAN_CODE heap_ovf_get (THREAD_ENTRY * thread_p, const OID * ovf_oid, RECDES * recdes, int chn,
@@ -743,6 +776,15 @@ static HEAP_BESTSPACE heap_stats_get_bestspace_by_vpid (THREAD_ENTRY * thread_p,
 static HEAP_STATS_ENTRY *heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpid,
 						   int freespace);
 static int heap_stats_entry_free (THREAD_ENTRY * thread_p, void *data, void *args);
+static int heap_insert_affinity_initialize (void);
+static void heap_insert_affinity_finalize (void);
+static HEAP_INSERT_AFFINITY *heap_insert_affinity_get (THREAD_ENTRY * thread_p, const HFID * hfid, bool do_add);
+static void heap_insert_affinity_apply_stats (HEAP_INSERT_AFFINITY * affinity, HEAP_HDR_STATS * heap_hdr);
+static void heap_insert_affinity_sync_stats (THREAD_ENTRY * thread_p, HEAP_INSERT_AFFINITY * affinity);
+static PAGE_PTR heap_insert_affinity_find_page (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space,
+						bool isnew_rec, int newrec_size, PGBUF_WATCHER * pg_watcher);
+static void heap_insert_affinity_set_page (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr,
+					   PAGE_PTR pgptr);
 static int heap_get_partitions_from_subclasses (THREAD_ENTRY * thread_p, const OID * subclasses, int *parts_count,
 						OR_PARTITION * partitions);
 static int heap_class_get_partition_info (THREAD_ENTRY * thread_p, const OID * class_oid, OR_PARTITION * partition_info,
@@ -1103,6 +1145,9 @@ heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid)
 
   PERF_UTIME_TRACKER_START (thread_p, &time_best_space);
 
+  /* drop the insert affinity pages too */
+  ATOMIC_INC_64 (&heap_Insert_affinity_version, 1ULL);
+
   rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
 
   while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, NULL)) != NULL)
@@ -1141,6 +1186,10 @@ heap_stats_del_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
   PERF_UTIME_TRACKER time_best_space = PERF_UTIME_TRACKER_INITIALIZER;
 
   PERF_UTIME_TRACKER_START (thread_p, &time_best_space);
+
+  /* drop the insert affinity pages too */
+  ATOMIC_INC_64 (&heap_Insert_affinity_version, 1ULL);
+
   rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
 
   ent = (HEAP_STATS_ENTRY *) mht_get (heap_Bestspace->vpid_ht, vpid);
@@ -3499,6 +3548,8 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
   PGBUF_WATCHER hdr_page_watcher;
   int error_code = NO_ERROR;
   PERF_UTIME_TRACKER time_find_best_page = PERF_UTIME_TRACKER_INITIALIZER;
+  PERF_UTIME_TRACKER time_hdr_fix = PERF_UTIME_TRACKER_INITIALIZER;
+  HEAP_INSERT_AFFINITY *affinity;
 
   PERF_UTIME_TRACKER_START (thread_p, &time_find_best_page);
   /*
@@ -3507,6 +3558,14 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
    */
 
   assert (scan_cache == NULL || scan_cache->cache_last_fix_page == false || scan_cache->page_watcher.pgptr == NULL);
+
+  /* First, try the page this thread inserted into last time. */
+  if (heap_insert_affinity_find_page (thread_p, hfid, needed_space, isnew_rec, newrec_size, pg_watcher) != NULL)
+    {
+      PERF_UTIME_TRACKER_TIME (thread_p, &time_find_best_page, PSTAT_HF_HEAP_FIND_BEST_PAGE);
+      return pg_watcher->pgptr;
+    }
+
   PGBUF_INIT_WATCHER (&hdr_page_watcher, PGBUF_ORDERED_HEAP_HDR, hfid);
 
   /*
@@ -3524,7 +3583,9 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
   addr_hdr.vfid = &hfid->vfid;
   addr_hdr.offset = HEAP_HEADER_AND_CHAIN_SLOTID;
 
+  PERF_UTIME_TRACKER_START (thread_p, &time_hdr_fix);
   error_code = pgbuf_ordered_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_WRITE, &hdr_page_watcher);
+  PERF_UTIME_TRACKER_TIME (thread_p, &time_hdr_fix, PSTAT_HF_HEAP_HDR_FIX_FOR_INSERT);
   if (error_code != NO_ERROR)
     {
       /* something went wrong. Unable to fetch header page */
@@ -3554,6 +3615,13 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
     }
   heap_hdr->estimates.recs_sumlen += (float) newrec_size;
 
+  /* add what was inserted through insert affinity since last time */
+  affinity = heap_insert_affinity_get (thread_p, hfid, false);
+  if (affinity != NULL)
+    {
+      heap_insert_affinity_apply_stats (affinity, heap_hdr);
+    }
+
   assert (!heap_is_big_length (needed_space));
   /* Take into consideration the unfill factor for pages with objects */
   total_space = needed_space + heap_Slotted_overhead + heap_hdr->unfill_space;
@@ -3658,6 +3726,11 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
 	      || er_errid () == ER_FILE_NOT_ENOUGH_PAGES_IN_DATABASE);
     }
 
+  if (pg_watcher->pgptr != NULL)
+    {
+      heap_insert_affinity_set_page (thread_p, hfid, heap_hdr, pg_watcher->pgptr);
+    }
+
   addr_hdr.pgptr = hdr_page_watcher.pgptr;
   log_skip_logging (thread_p, &addr_hdr);
   pgbuf_ordered_set_dirty_and_free (thread_p, &hdr_page_watcher);
@@ -5096,6 +5169,12 @@ heap_manager_initialize (void)
       return ret;
     }
 
+  ret = heap_insert_affinity_initialize ();
+  if (ret != NO_ERROR)
+    {
+      return ret;
+    }
+
   /* Initialize class OID->HFID cache */
   ret = heap_initialize_hfid_table ();
 
@@ -5130,6 +5209,8 @@ heap_manager_finalize (void)
       return ret;
     }
 
+  heap_insert_affinity_finalize ();
+
   heap_finalize_hfid_table ();
 
   return ret;
@@ -5293,6 +5374,10 @@ heap_create_internal (THREAD_ENTRY * thread_p, HFID * hfid, const OID * class_oi
   VPID_SET_NULL (&heap_hdr.next_vpid);
 
   heap_hdr.unfill_space = (int) ((float) DB_PAGESIZE * prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
+  if (prm_get_bool_value (PRM_ID_HEAP_RECORD_COMPRESSION) && !OID_ISNULL (class_oid))
+    {
+      heap_hdr.flags |= HEAP_HDR_FLAG_COMPRESS_OVERFLOW;
+    }
 
   heap_hdr.estimates.num_pages = 1;
   heap_hdr.estimates.num_recs = 0;
@@ -5658,6 +5743,11 @@ heap_reuse (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * class_oid, c
    */
   VFID_SET_NULL (&heap_hdr->ovf_vfid);
   heap_hdr->unfill_space = (int) ((float) DB_PAGESIZE * prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
+  heap_hdr->flags = 0;
+  if (prm_get_bool_value (PRM_ID_HEAP_RECORD_COMPRESSION))
+    {
+      heap_hdr->flags |= HEAP_HDR_FLAG_COMPRESS_OVERFLOW;
+    }
   heap_hdr->estimates.num_pages = npages;
   heap_hdr->estimates.num_recs = 0;
   heap_hdr->estimates.recs_sumlen = 0.0;
@@ -6352,6 +6442,22 @@ exit_on_error:
 VFID *
 heap_ovf_find_vfid (THREAD_ENTRY * thread_p, const HFID * hfid, VFID * ovf_vfid, bool docreate,
 		    PGBUF_LATCH_CONDITION latch_cond)
+{
+  return heap_ovf_find_vfid_internal (thread_p, hfid, ovf_vfid, docreate, latch_cond, NULL);
+}
+
+/*
+ * heap_ovf_find_vfid_internal () - Find overflow file identifier and the heap header flags
+ *   return: ovf_vfid or NULL
+ *   hfid(in): Object heap file identifier
+ *   ovf_vfid(in/out): Overflow file identifier.
+ *   docreate(in): true/false. If true and the overflow file does not
+ *                 exist, it is created.
+ *   hdr_flags(out): if not NULL, the flags of heap header
+ */
+static VFID *
+heap_ovf_find_vfid_internal (THREAD_ENTRY * thread_p, const HFID * hfid, VFID * ovf_vfid, bool docreate,
+			     PGBUF_LATCH_CONDITION latch_cond, int *hdr_flags)
 {
   HEAP_HDR_STATS *heap_hdr;	/* Header of heap structure */
   LOG_DATA_ADDR addr_hdr;	/* Address of logging data */
@@ -6385,6 +6491,11 @@ heap_ovf_find_vfid (THREAD_ENTRY * thread_p, const HFID * hfid, VFID * ovf_vfid,
     }
 
   heap_hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
+  if (hdr_flags != NULL)
+    {
+      *hdr_flags = heap_hdr->flags;
+    }
+
   if (VFID_ISNULL (&heap_hdr->ovf_vfid))
     {
       if (docreate == true)
@@ -6452,16 +6563,19 @@ exit:
  *   ovf_oid(in/out): Overflow address
  *   recdes(in): Record descriptor
  *
- * Note: Insert the content of a multipage object in overflow.
+ * Note: Insert the content of a multipage object in overflow. The content is
+ * compressed if the heap was created with record compression.
  */
 static OID *
 heap_ovf_insert (THREAD_ENTRY * thread_p, const HFID * hfid, OID * ovf_oid, RECDES * recdes)
 {
   VFID ovf_vfid;
   VPID ovf_vpid;		/* Address of overflow insertion */
+  int hdr_flags = 0;
 
-  if (heap_ovf_find_vfid (thread_p, hfid, &ovf_vfid, true, PGBUF_UNCONDITIONAL_LATCH) == NULL
-      || overflow_insert (thread_p, &ovf_vfid, &ovf_vpid, recdes, FILE_MULTIPAGE_OBJECT_HEAP) != NO_ERROR)
+  if (heap_ovf_find_vfid_internal (thread_p, hfid, &ovf_vfid, true, PGBUF_UNCONDITIONAL_LATCH, &hdr_flags) == NULL
+      || overflow_insert (thread_p, &ovf_vfid, &ovf_vpid, recdes, FILE_MULTIPAGE_OBJECT_HEAP,
+			  (hdr_flags & HEAP_HDR_FLAG_COMPRESS_OVERFLOW) != 0) != NO_ERROR)
     {
       return NULL;
     }
@@ -6487,8 +6601,9 @@ heap_ovf_update (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * ovf_oid
 {
   VFID ovf_vfid;
   VPID ovf_vpid;
+  int hdr_flags = 0;
 
-  if (heap_ovf_find_vfid (thread_p, hfid, &ovf_vfid, false, PGBUF_UNCONDITIONAL_LATCH) == NULL)
+  if (heap_ovf_find_vfid_internal (thread_p, hfid, &ovf_vfid, false, PGBUF_UNCONDITIONAL_LATCH, &hdr_flags) == NULL)
     {
       return NULL;
     }
@@ -6496,7 +6611,8 @@ heap_ovf_update (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * ovf_oid
   ovf_vpid.pageid = ovf_oid->pageid;
   ovf_vpid.volid = ovf_oid->volid;
 
-  if (overflow_update (thread_p, &ovf_vfid, &ovf_vpid, recdes, FILE_MULTIPAGE_OBJECT_HEAP) != NO_ERROR)
+  if (overflow_update (thread_p, &ovf_vfid, &ovf_vpid, recdes, FILE_MULTIPAGE_OBJECT_HEAP,
+		       (hdr_flags & HEAP_HDR_FLAG_COMPRESS_OVERFLOW) != 0) != NO_ERROR)
     {
       ASSERT_ERROR ();
       return NULL;
@@ -6793,6 +6909,7 @@ heap_scancache_start_internal (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_ca
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = mvcc_snapshot;
   scan_cache->partition_list = NULL;
+  pgbuf_read_ahead_init (&scan_cache->read_ahead);
 
   return ret;
 
@@ -7093,6 +7210,7 @@ heap_scancache_quick_start_internal (HEAP_SCANCACHE * scan_cache, const HFID * h
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = NULL;
   scan_cache->partition_list = NULL;
+  pgbuf_read_ahead_init (&scan_cache->read_ahead);
 
   return NO_ERROR;
 }
@@ -7873,6 +7991,11 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 	    }
 	  if (curr_page_watcher.pgptr == NULL)
 	    {
+	      if (!reversed_direction)
+		{
+		  /* let page buffer load next pages ahead if the scan goes sequentially through the volume */
+		  pgbuf_read_ahead_notify (thread_p, &scan_cache->read_ahead, &vpid);
+		}
 	      curr_page_watcher.pgptr =
 		heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, scan_cache,
 					     &curr_page_watcher);
@@ -10037,7 +10160,12 @@ heap_attrinfo_clear_dbvalues (HEAP_CACHE_ATTRINFO * attr_info)
       for (i = 0; i < attr_info->num_values; i++)
 	{
 	  value = &attr_info->values[i];
-	  if (value->state != HEAP_UNINIT_ATTRVALUE)
+	  if (value->state == HEAP_UNREAD_ATTRVALUE)
+	    {
+	      /* cleared when it was bound to the record */
+	      value->state = HEAP_UNINIT_ATTRVALUE;
+	    }
+	  else if (value->state != HEAP_UNINIT_ATTRVALUE)
 	    {
 	      /*
 	       * Was the value set up from a default value or from a representation
@@ -10170,7 +10298,7 @@ heap_attrvalue_read (RECDES * recdes, HEAP_ATTRVALUE * value, HEAP_CACHE_ATTRINF
   /*
    * Clear/decache any old value
    */
-  if (value->state != HEAP_UNINIT_ATTRVALUE)
+  if (value->state != HEAP_UNINIT_ATTRVALUE && value->state != HEAP_UNREAD_ATTRVALUE)
     {
       (void) pr_clear_value (&value->dbvalue);
     }
@@ -10397,6 +10525,88 @@ exit_on_error:
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
 
+/*
+ * heap_attrinfo_read_dbvalues_lazy () - Bind the desired attributes of given instance to be decoded on first access
+ *   return: NO_ERROR
+ *   inst_oid(in): The instance oid
+ *   recdes(in): The instance Record descriptor
+ *   attr_info(in/out): The attribute information structure which describe the
+ *                      desired attributes
+ *
+ * Note: Like heap_attrinfo_read_dbvalues, except the values are decoded by heap_attrinfo_access or by fetching their
+ *       regulator variables. Values never accessed (e.g. of the predicate terms after one that rejects the instance)
+ *       are never decoded. The record must stay valid until the instance is done with.
+ */
+int
+heap_attrinfo_read_dbvalues_lazy (THREAD_ENTRY * thread_p, const OID * inst_oid, RECDES * recdes,
+				  HEAP_CACHE_ATTRINFO * attr_info)
+{
+  int i;
+  REPR_ID reprid;		/* The disk representation of the object */
+  HEAP_ATTRVALUE *value;	/* Disk value Attr info for a particular attr */
+  int ret = NO_ERROR;
+
+  /* check to make sure the attr_info has been used */
+  if (attr_info->num_values == -1)
+    {
+      return NO_ERROR;
+    }
+
+  if (inst_oid == NULL || recdes == NULL || recdes->data == NULL)
+    {
+      /* default, shared or class attribute values */
+      return heap_attrinfo_read_dbvalues (thread_p, inst_oid, recdes, NULL, attr_info);
+    }
+
+  /*
+   * Make sure that we have the needed cached representation.
+   */
+  reprid = or_rep_id (recdes);
+  if (attr_info->read_classrepr == NULL || attr_info->read_classrepr->id != reprid)
+    {
+      /* Get the needed representation */
+      ret = heap_attrinfo_recache (thread_p, reprid, attr_info);
+      if (ret != NO_ERROR)
+	{
+	  return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
+	}
+    }
+
+  for (i = 0; i < attr_info->num_values; i++)
+    {
+      value = &attr_info->values[i];
+      if (value->state != HEAP_UNINIT_ATTRVALUE && value->state != HEAP_UNREAD_ATTRVALUE)
+	{
+	  (void) pr_clear_value (&value->dbvalue);
+	}
+      value->state = HEAP_UNREAD_ATTRVALUE;
+    }
+  attr_info->unread_recdes = *recdes;
+
+  /*
+   * Cache the information of the instance
+   */
+  attr_info->inst_chn = or_chn (recdes);
+  attr_info->inst_oid = *inst_oid;
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_attrinfo_read_unread_dbvalue () - Decode a value bound by heap_attrinfo_read_dbvalues_lazy
+ *   return: NO_ERROR
+ *   value(in/out): attribute value in HEAP_UNREAD_ATTRVALUE state
+ *   attr_info(in/out): The attribute information structure of value
+ */
+int
+heap_attrinfo_read_unread_dbvalue (HEAP_ATTRVALUE * value, HEAP_CACHE_ATTRINFO * attr_info)
+{
+  assert (value >= attr_info->values && value < attr_info->values + attr_info->num_values);
+  assert (value->state == HEAP_UNREAD_ATTRVALUE);
+
+  return heap_attrvalue_read (&attr_info->unread_recdes, value, attr_info);
+}
+
 int
 heap_attrinfo_read_dbvalues_without_oid (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_CACHE_ATTRINFO * attr_info)
 {
@@ -10680,6 +10890,11 @@ heap_attrinfo_access (ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info)
       return NULL;
     }
 
+  if (value->state == HEAP_UNREAD_ATTRVALUE && heap_attrinfo_read_unread_dbvalue (value, attr_info) != NO_ERROR)
+    {
+      return NULL;
+    }
+
   return &value->dbvalue;
 }
 
@@ -14060,7 +14275,7 @@ heap_dump_hdr (FILE * fp, HEAP_HDR_STATS * heap_hdr)
 	   heap_hdr->class_oid.slotid);
   fprintf (fp, "OVF_VFID = %4d|%4d, NEXT_VPID = %4d|%4d\n", heap_hdr->ovf_vfid.volid, heap_hdr->ovf_vfid.fileid,
 	   heap_hdr->next_vpid.volid, heap_hdr->next_vpid.pageid);
-  fprintf (fp, "unfill_space = %4d\n", heap_hdr->unfill_space);
+  fprintf (fp, "unfill_space = %4d, flags = %d\n", heap_hdr->unfill_space, heap_hdr->flags);
   fprintf (fp, "Estimated: num_pages = %d, num_recs = %d,  avg reclength = %d\n", heap_hdr->estimates.num_pages,
 	   heap_hdr->estimates.num_recs, avg_length);
   fprintf (fp, "Estimated: num high best = %d, num others(not in array) high best = %d\n",
@@ -15120,917 +15335,908 @@ heap_stats_bestspace_finalize (void)
 }
 
 /*
- * heap_chnguess_decache () - Decache a specific entry or all entries
- *   return: NO_ERROR
- *   oid(in): oid: class oid or NULL
- *            IF NULL implies all classes
- *
- * Note: Remove from the hash the entry associated with given oid. If
- * oid is NULL, all entries in hash are removed.
- * This function is called when a class is updated or during
- * rollback when a class was changed
+ * heap_insert_affinity_initialize () - Initialize insert page affinity of all threads
+ *   return: NO_ERROR or error code
  */
 static int
-heap_chnguess_decache (const OID * oid)
+heap_insert_affinity_initialize (void)
 {
-  HEAP_CHNGUESS_ENTRY *entry;
-  int ret = NO_ERROR;
+  size_t size;
+  int i;
 
-  if (heap_Guesschn == NULL)
-    {
-      return NO_ERROR;		/* nop */
-    }
+  heap_insert_affinity_finalize ();
 
-  if (oid == NULL)
-    {
-      (void) mht_map (heap_Guesschn->ht, heap_chnguess_remove_entry, NULL);
-    }
-  else
+  heap_Insert_affinity_count = (int) thread_num_total_threads () * HEAP_INSERT_AFFINITY_SIZE;
+  size = heap_Insert_affinity_count * sizeof (HEAP_INSERT_AFFINITY);
+  heap_Insert_affinity = (HEAP_INSERT_AFFINITY *) malloc (size);
+  if (heap_Insert_affinity == NULL)
     {
-      entry = (HEAP_CHNGUESS_ENTRY *) mht_get (heap_Guesschn->ht, oid);
-      if (entry != NULL)
-	{
-	  (void) heap_chnguess_remove_entry (oid, entry, NULL);
-	}
+      heap_Insert_affinity_count = 0;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
     }
 
-  if (heap_Guesschn->schema_change == true && oid == NULL)
+  for (i = 0; i < heap_Insert_affinity_count; i++)
     {
-      heap_Guesschn->schema_change = false;
+      HFID_SET_NULL (&heap_Insert_affinity[i].hfid);
+      OID_SET_NULL (&heap_Insert_affinity[i].class_oid);
+      VPID_SET_NULL (&heap_Insert_affinity[i].vpid);
+      heap_Insert_affinity[i].version = 0;
+      heap_Insert_affinity[i].unfill_space = 0;
+      heap_Insert_affinity[i].num_recs = 0;
+      heap_Insert_affinity[i].num_pages = 0;
+      heap_Insert_affinity[i].recs_sumlen = 0;
     }
 
-  return ret;
-}
-
-/*
- * heap_chnguess_remove_entry () - Remove an entry from chnguess hash table
- *   return: NO_ERROR
- *   oid_key(in): Key (oid) of chnguess table
- *   ent(in): The entry of hash table
- *   xignore(in): Extra arguments (currently ignored)
- *
- * Note: Remove from the hash the given entry. The entry is marked as
- * for immediate reuse.
- */
-static int
-heap_chnguess_remove_entry (const void *oid_key, void *ent, void *xignore)
-{
-  HEAP_CHNGUESS_ENTRY *entry = (HEAP_CHNGUESS_ENTRY *) ent;
-
-  /* mht_rem() has been updated to take a function and an arg pointer that can be called on the entry before it is
-   * removed.  We may want to take advantage of that here to free the memory associated with the entry */
-  (void) mht_rem (heap_Guesschn->ht, oid_key, NULL, NULL);
-  OID_SET_NULL (&entry->oid);
-  entry->chn = NULL_CHN;
-  entry->recently_accessed = false;
-  heap_Guesschn_area.clock_hand = entry->idx;
-
   return NO_ERROR;
 }
 
-#if defined (CUBRID_DEBUG)
 /*
- * heap_chnguess_dump () - Dump current chnguess hash table
- *   return:
+ * heap_insert_affinity_finalize () - Free insert page affinity of all threads
+ *   return: void
  *
- * Note: Dump all valid chnguess entries.
+ * Note: estimates not yet added to heap headers are lost. They are fixed by the next statistics update.
  */
-void
-heap_chnguess_dump (FILE * fp)
+static void
+heap_insert_affinity_finalize (void)
 {
-  int max_tranindex, tran_index, i;
-  HEAP_CHNGUESS_ENTRY *entry;
-
-  if (heap_Guesschn != NULL)
+  if (heap_Insert_affinity != NULL)
     {
-      fprintf (fp, "*** Dump of CLASS_OID to CHNGUESS at clients *** \n");
-      fprintf (fp, "Schema_change = %d, clock_hand = %d,\n", heap_Guesschn->schema_change, heap_Guesschn->clock_hand);
-      fprintf (fp, "Nentries = %d, Nactive_entries = %u, maxnum of clients = %d, nbytes = %d\n",
-	       heap_Guesschn->num_entries, mht_count (heap_Guesschn->ht), heap_Guesschn->num_clients,
-	       heap_Guesschn->nbytes);
-      fprintf (fp, "Hash Table = %p, Entries = %p, Bitindex = %p\n", heap_Guesschn->ht, heap_Guesschn->entries,
-	       heap_Guesschn->bitindex);
-
-      max_tranindex = logtb_get_number_of_total_tran_indices ();
-      for (i = 0; i < heap_Guesschn->num_entries; i++)
-	{
-	  entry = &heap_Guesschn_area.entries[i];
-
-	  if (!OID_ISNULL (&entry->oid))
-	    {
-	      fprintf (fp, " \nEntry_id %d", entry->idx);
-	      fprintf (fp, "OID = %2d|%4d|%2d, chn = %d, recently_free = %d,", entry->oid.volid, entry->oid.pageid,
-		       entry->oid.slotid, entry->chn, entry->recently_accessed);
-
-	      /* Dump one bit at a time */
-	      for (tran_index = 0; tran_index < max_tranindex; tran_index++)
-		{
-		  if (tran_index % 40 == 0)
-		    {
-		      fprintf (fp, "\n ");
-		    }
-		  else if (tran_index % 10 == 0)
-		    {
-		      fprintf (fp, " ");
-		    }
-		  fprintf (fp, "%d", HEAP_BIT_GET (entry->bits, tran_index) ? 1 : 0);
-		}
-	      fprintf (fp, "\n");
-	    }
-	}
+      free_and_init (heap_Insert_affinity);
     }
+  heap_Insert_affinity_count = 0;
 }
-#endif /* CUBRID_DEBUG */
 
 /*
- * heap_chnguess_get () - Guess chn of given oid for given tran index (at client)
- *   return:
- *   oid(in): OID from where to guess chn at client workspace
- *   tran_index(in): The client transaction index
+ * heap_insert_affinity_get () - Get insert page affinity of current thread for a heap
+ *   return: affinity entry or NULL
+ *   hfid(in): heap file identifier
+ *   do_add(in): true to take an entry for the heap if it has none
  *
- * Note: Find/guess the chn of the given OID object at the workspace of
- * given client transaction index
+ * Note: when all entries of the thread are taken, the first one without a page and without pending estimates is
+ *       reused. Otherwise, the entries are reused in turn and the pending estimates of the old heap are flushed.
  */
-int
-heap_chnguess_get (THREAD_ENTRY * thread_p, const OID * oid, int tran_index)
+static HEAP_INSERT_AFFINITY *
+heap_insert_affinity_get (THREAD_ENTRY * thread_p, const HFID * hfid, bool do_add)
 {
-  int chn = NULL_CHN;
-  HEAP_CHNGUESS_ENTRY *entry;
+  HEAP_INSERT_AFFINITY *thread_affinity;
+  HEAP_INSERT_AFFINITY *victim = NULL;
+  int thread_index;
+  int i;
 
-  if (csect_enter (thread_p, CSECT_HEAP_CHNGUESS, INF_WAIT) != NO_ERROR)
+  if (heap_Insert_affinity == NULL)
     {
-      return NULL_CHN;
+      return NULL;
     }
 
-  if (heap_Guesschn != NULL)
+  thread_index = thread_get_entry_index (thread_p);
+  if (thread_index < 0 || (thread_index + 1) * HEAP_INSERT_AFFINITY_SIZE > heap_Insert_affinity_count)
     {
-      if (heap_Guesschn->num_clients <= tran_index)
+      assert (false);
+      return NULL;
+    }
+  thread_affinity = &heap_Insert_affinity[thread_index * HEAP_INSERT_AFFINITY_SIZE];
+
+  for (i = 0; i < HEAP_INSERT_AFFINITY_SIZE; i++)
+    {
+      if (HFID_EQ (&thread_affinity[i].hfid, hfid))
 	{
-	  if (heap_chnguess_realloc () != NO_ERROR)
-	    {
-	      csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
-	      return NULL_CHN;
-	    }
+	  return &thread_affinity[i];
+	}
+      if (victim == NULL && VPID_ISNULL (&thread_affinity[i].vpid) && thread_affinity[i].num_recs == 0
+	  && thread_affinity[i].recs_sumlen == 0)
+	{
+	  victim = &thread_affinity[i];
 	}
+    }
 
-      /*
-       * Do we have this entry in hash table, if we do then check corresponding
-       * bit for given client transaction index.
-       */
+  if (!do_add)
+    {
+      return NULL;
+    }
 
-      entry = (HEAP_CHNGUESS_ENTRY *) mht_get (heap_Guesschn->ht, oid);
-      if (entry != NULL && HEAP_BIT_GET (entry->bits, tran_index))
+  if (victim == NULL)
+    {
+      /* shift the entries and reuse the last one */
+      victim = &thread_affinity[HEAP_INSERT_AFFINITY_SIZE - 1];
+      if (victim->num_recs != 0 || victim->recs_sumlen != 0)
 	{
-	  chn = entry->chn;
+	  heap_insert_affinity_sync_stats (thread_p, victim);
 	}
+      memmove (&thread_affinity[1], &thread_affinity[0], (HEAP_INSERT_AFFINITY_SIZE - 1) * sizeof (*victim));
+      victim = &thread_affinity[0];
     }
 
-  csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
+  HFID_COPY (&victim->hfid, hfid);
+  OID_SET_NULL (&victim->class_oid);
+  VPID_SET_NULL (&victim->vpid);
+  victim->version = 0;
+  victim->unfill_space = 0;
+  victim->num_recs = 0;
+  victim->num_pages = 0;
+  victim->recs_sumlen = 0;
 
-  return chn;
+  return victim;
 }
 
 /*
- * heap_chnguess_put () - Oid object is in the process of been sent to client
- *   return: chn or NULL_CHN if not cached
- *   oid(in): object oid
- *   tran_index(in): The client transaction index
- *   chn(in): cache coherency number.
+ * heap_insert_affinity_apply_stats () - Add pending estimates to heap header
+ *   return: void
+ *   affinity(in/out): insert page affinity
+ *   heap_hdr(in/out): heap header (header page must be fixed for write)
+ */
+static void
+heap_insert_affinity_apply_stats (HEAP_INSERT_AFFINITY * affinity, HEAP_HDR_STATS * heap_hdr)
+{
+  heap_hdr->estimates.num_recs += affinity->num_recs;
+  heap_hdr->estimates.num_pages += affinity->num_pages;
+  heap_hdr->estimates.recs_sumlen += affinity->recs_sumlen;
+
+  affinity->num_recs = 0;
+  affinity->num_pages = 0;
+  affinity->recs_sumlen = 0;
+}
+
+/*
+ * heap_insert_affinity_sync_stats () - Flush pending estimates to heap header if header is not busy
+ *   return: void
+ *   affinity(in/out): insert page affinity
  *
- * Note: Cache the information that object oid with chn has been sent
- * to client with trans_index.
- * If the function fails, it returns NULL_CHN. This failure is
- * more like a warning since the chnguess is just a caching structure.
+ * Note: we do not wait for the header page. If it is busy, the estimates stay pending until next time.
  */
-int
-heap_chnguess_put (THREAD_ENTRY * thread_p, const OID * oid, int tran_index, int chn)
+static void
+heap_insert_affinity_sync_stats (THREAD_ENTRY * thread_p, HEAP_INSERT_AFFINITY * affinity)
 {
-  int i;
-  bool can_continue;
-  HEAP_CHNGUESS_ENTRY *entry;
+  VPID vpid;
+  PAGE_PTR hdr_pgptr;
+  RECDES recdes;
+  LOG_DATA_ADDR addr;
 
-  if (heap_Guesschn == NULL)
+  vpid.volid = affinity->hfid.vfid.volid;
+  vpid.pageid = affinity->hfid.hpgid;
+
+  hdr_pgptr = pgbuf_fix (thread_p, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, PGBUF_CONDITIONAL_LATCH);
+  if (hdr_pgptr == NULL)
     {
-      return NULL_CHN;
+      /* page is busy or gone */
+      if (er_errid () != ER_INTERRUPTED)
+	{
+	  er_clear ();
+	}
+      return;
     }
 
-  if (csect_enter (thread_p, CSECT_HEAP_CHNGUESS, INF_WAIT) != NO_ERROR)
+  if (pgbuf_get_page_ptype (thread_p, hdr_pgptr) != PAGE_HEAP
+      || spage_get_record (thread_p, hdr_pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK) != S_SUCCESS
+      || !OID_EQ (&((HEAP_HDR_STATS *) recdes.data)->class_oid, &affinity->class_oid))
     {
-      return NULL_CHN;
+      pgbuf_unfix_and_init (thread_p, hdr_pgptr);
+      return;
     }
 
-  if (heap_Guesschn->num_clients <= tran_index)
+  heap_insert_affinity_apply_stats (affinity, (HEAP_HDR_STATS *) recdes.data);
+
+  addr.vfid = &affinity->hfid.vfid;
+  addr.pgptr = hdr_pgptr;
+  addr.offset = HEAP_HEADER_AND_CHAIN_SLOTID;
+  log_skip_logging (thread_p, &addr);
+  pgbuf_set_dirty (thread_p, hdr_pgptr, FREE);
+}
+
+/*
+ * heap_insert_affinity_find_page () - Fix the page the thread inserted into last time for the heap, if it still has
+ *				       the needed space
+ *   return: fixed page or NULL
+ *   hfid(in): heap file identifier
+ *   needed_space(in): the minimal space needed
+ *   isnew_rec(in): are we inserting a new record to the heap ?
+ *   newrec_size(in): size of the new record
+ *   pg_watcher(out): watcher for the fixed page
+ *
+ * Note: the heap header page is not fixed. Estimates are added to the header every HEAP_INSERT_AFFINITY_SYNC_RECS
+ *       records or when the thread needs a new page. When the page is too full, it is given to the best space cache
+ *       for the other threads and the thread looks for a new page.
+ */
+static PAGE_PTR
+heap_insert_affinity_find_page (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space, bool isnew_rec,
+				int newrec_size, PGBUF_WATCHER * pg_watcher)
+{
+  HEAP_INSERT_AFFINITY *affinity;
+  RECDES recdes;
+  int total_space, freespace;
+  int old_wait_msecs;
+  bool page_is_valid;
+
+  if (!prm_get_bool_value (PRM_ID_HEAP_INSERT_PAGE_AFFINITY))
     {
-      if (heap_chnguess_realloc () != NO_ERROR)
-	{
-	  csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
-	  return NULL_CHN;
-	}
+      return NULL;
     }
 
-  /*
-   * Is the entry already in the chnguess hash table ?
-   */
-  entry = (HEAP_CHNGUESS_ENTRY *) mht_get (heap_Guesschn->ht, oid);
-  if (entry != NULL)
+  affinity = heap_insert_affinity_get (thread_p, hfid, false);
+  if (affinity == NULL || VPID_ISNULL (&affinity->vpid))
     {
-      /*
-       * If the cache coherence number is different reset all client entries
-       */
-      if (entry->chn != chn)
+      return NULL;
+    }
+
+  if (affinity->version != ATOMIC_LOAD_64 (&heap_Insert_affinity_version))
+    {
+      /* pages were removed since; we cannot trust the page anymore */
+      VPID_SET_NULL (&affinity->vpid);
+      return NULL;
+    }
+
+  total_space = needed_space + heap_Slotted_overhead + affinity->unfill_space;
+  if (heap_is_big_length (total_space))
+    {
+      total_space = needed_space + heap_Slotted_overhead;
+    }
+
+  /* Do not wait for the page. If others use it, find another one. */
+  old_wait_msecs = xlogtb_reset_wait_msecs (thread_p, LK_FORCE_ZERO_WAIT);
+  (void) pgbuf_ordered_fix (thread_p, &affinity->vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, pg_watcher);
+  (void) xlogtb_reset_wait_msecs (thread_p, old_wait_msecs);
+
+  if (pg_watcher->pgptr == NULL)
+    {
+      /* page is busy or was deallocated */
+      if (er_errid () != ER_INTERRUPTED)
 	{
-	  HEAP_NBYTES_CLEARED (entry->bits, heap_Guesschn_area.nbytes);
-	  entry->chn = chn;
+	  er_clear ();
 	}
+      VPID_SET_NULL (&affinity->vpid);
+      return NULL;
     }
-  else
+
+  /* the page may have been removed while we fixed it */
+  page_is_valid = (affinity->version == ATOMIC_LOAD_64 (&heap_Insert_affinity_version)
+		   && pgbuf_get_page_ptype (thread_p, pg_watcher->pgptr) == PAGE_HEAP
+		   && spage_get_record (thread_p, pg_watcher->pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes,
+					PEEK) == S_SUCCESS && OID_EQ ((OID *) recdes.data, &affinity->class_oid));
+  if (!page_is_valid)
     {
-      /*
-       * Replace one of the entries that has not been used for a while.
-       * Follow clock replacement algorithm.
-       */
-      can_continue = true;
-      while (entry == NULL && can_continue == true)
-	{
-	  can_continue = false;
-	  for (i = 0; i < heap_Guesschn->num_entries; i++)
-	    {
-	      /*
-	       * Increase the clock to next entry
-	       */
-	      heap_Guesschn->clock_hand++;
-	      if (heap_Guesschn->clock_hand >= heap_Guesschn->num_entries)
-		{
-		  heap_Guesschn->clock_hand = 0;
-		}
+      pgbuf_ordered_unfix (thread_p, pg_watcher);
+      VPID_SET_NULL (&affinity->vpid);
+      return NULL;
+    }
 
-	      entry = &heap_Guesschn->entries[heap_Guesschn->clock_hand];
-	      if (entry->recently_accessed == true)
-		{
-		  /*
-		   * Set recently freed to false, so it can be replaced in next
-		   * if the entry is not referenced
-		   */
-		  entry->recently_accessed = false;
-		  entry = NULL;
-		  can_continue = true;
-		}
-	      else
-		{
-		  entry->oid = *oid;
-		  entry->chn = chn;
-		  HEAP_NBYTES_CLEARED (entry->bits, heap_Guesschn_area.nbytes);
-		  break;
-		}
-	    }
+  freespace = spage_max_space_for_new_record (thread_p, pg_watcher->pgptr);
+  if (freespace < total_space)
+    {
+      /* let other threads fill the rest of the page */
+      if (freespace > HEAP_DROP_FREE_SPACE && prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0)
+	{
+	  (void) heap_stats_add_bestspace (thread_p, hfid, &affinity->vpid, freespace);
 	}
+      pgbuf_ordered_unfix (thread_p, pg_watcher);
+      VPID_SET_NULL (&affinity->vpid);
+      return NULL;
     }
 
-  /*
-   * Now set the desired client transaction index bit
-   */
-  if (entry != NULL)
+  if (isnew_rec)
     {
-      HEAP_BIT_SET (entry->bits, tran_index);
-      entry->recently_accessed = true;
+      affinity->num_recs++;
+      if (newrec_size > DB_PAGESIZE)
+	{
+	  affinity->num_pages += CEIL_PTVDIV (newrec_size, DB_PAGESIZE);
+	}
     }
-  else
+  affinity->recs_sumlen += (float) newrec_size;
+
+  if (affinity->num_recs >= HEAP_INSERT_AFFINITY_SYNC_RECS)
     {
-      chn = NULL_CHN;
+      heap_insert_affinity_sync_stats (thread_p, affinity);
     }
 
-  csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
+  perfmon_inc_stat (thread_p, PSTAT_HF_NUM_INSERT_AFFINITY_HITS);
 
-  return chn;
+  return pg_watcher->pgptr;
 }
 
 /*
- * heap_chnguess_clear () - Clear any cached information for given client
- *                        used when client is shutdown
- *   return:
- *   tran_index(in): The client transaction index
- *
- * Note: Clear the transaction index bit for all chnguess entries.
+ * heap_insert_affinity_set_page () - Remember the page found for insert as the insert page of the thread
+ *   return: void
+ *   hfid(in): heap file identifier
+ *   heap_hdr(in): heap header (header page is fixed)
+ *   pgptr(in): page found for insert
  */
-void
-heap_chnguess_clear (THREAD_ENTRY * thread_p, int tran_index)
+static void
+heap_insert_affinity_set_page (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr, PAGE_PTR pgptr)
 {
-  int i;
-  HEAP_CHNGUESS_ENTRY *entry;
+  HEAP_INSERT_AFFINITY *affinity;
 
-  if (csect_enter (thread_p, CSECT_HEAP_CHNGUESS, INF_WAIT) != NO_ERROR)
+  if (!prm_get_bool_value (PRM_ID_HEAP_INSERT_PAGE_AFFINITY))
     {
       return;
     }
 
-  if (heap_Guesschn != NULL)
+  affinity = heap_insert_affinity_get (thread_p, hfid, true);
+  if (affinity == NULL)
     {
-      for (i = 0; i < heap_Guesschn->num_entries; i++)
-	{
-	  entry = &heap_Guesschn_area.entries[i];
-	  if (!OID_ISNULL (&entry->oid))
-	    {
-	      HEAP_BIT_CLEAR (entry->bits, (unsigned int) tran_index);
-	    }
-	}
+      return;
     }
 
-  csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
-
+  /* read the version before the page can be removed; a later removal makes the page stale */
+  affinity->version = ATOMIC_LOAD_64 (&heap_Insert_affinity_version);
+  VPID_COPY (&affinity->vpid, pgbuf_get_vpid_ptr (pgptr));
+  COPY_OID (&affinity->class_oid, &heap_hdr->class_oid);
+  affinity->unfill_space = heap_hdr->unfill_space;
 }
 
 /*
- * Recovery functions
- */
-
-/*
- * heap_rv_redo_newpage () - Redo the statistics or a new page allocation for
- *                           a heap file
- *   return: int
- *   rcv(in): Recovery structure
+ * heap_chnguess_decache () - Decache a specific entry or all entries
+ *   return: NO_ERROR
+ *   oid(in): oid: class oid or NULL
+ *            IF NULL implies all classes
+ *
+ * Note: Remove from the hash the entry associated with given oid. If
+ * oid is NULL, all entries in hash are removed.
+ * This function is called when a class is updated or during
+ * rollback when a class was changed
  */
-int
-heap_rv_redo_newpage (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+static int
+heap_chnguess_decache (const OID * oid)
 {
-  RECDES recdes;
-  INT16 slotid;
-  int sp_success;
-
-  (void) pgbuf_set_page_ptype (thread_p, rcv->pgptr, PAGE_HEAP);
-
-  /* Initialize header page */
-  spage_initialize (thread_p, rcv->pgptr, heap_get_spage_type (), HEAP_MAX_ALIGN, SAFEGUARD_RVSPACE);
+  HEAP_CHNGUESS_ENTRY *entry;
+  int ret = NO_ERROR;
 
-  /* Now insert first record (either statistics or chain record) */
-  recdes.area_size = recdes.length = rcv->length;
-  recdes.type = REC_HOME;
-  recdes.data = (char *) rcv->data;
-  sp_success = spage_insert (thread_p, rcv->pgptr, &recdes, &slotid);
-  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+  if (heap_Guesschn == NULL)
+    {
+      return NO_ERROR;		/* nop */
+    }
 
-  if (sp_success != SP_SUCCESS || slotid != HEAP_HEADER_AND_CHAIN_SLOTID)
+  if (oid == NULL)
     {
-      if (sp_success != SP_SUCCESS)
+      (void) mht_map (heap_Guesschn->ht, heap_chnguess_remove_entry, NULL);
+    }
+  else
+    {
+      entry = (HEAP_CHNGUESS_ENTRY *) mht_get (heap_Guesschn->ht, oid);
+      if (entry != NULL)
 	{
-	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	  (void) heap_chnguess_remove_entry (oid, entry, NULL);
 	}
-      /* something went wrong. Unable to redo initialization of new heap page */
-      assert (er_errid () != NO_ERROR);
-      return er_errid ();
     }
 
-  return NO_ERROR;
+  if (heap_Guesschn->schema_change == true && oid == NULL)
+    {
+      heap_Guesschn->schema_change = false;
+    }
+
+  return ret;
 }
 
 /*
- * heap_rv_undoredo_pagehdr () - Recover the header of a heap page
- *                    (either statistics/chain)
- *   return: int
- *   rcv(in): Recovery structure
+ * heap_chnguess_remove_entry () - Remove an entry from chnguess hash table
+ *   return: NO_ERROR
+ *   oid_key(in): Key (oid) of chnguess table
+ *   ent(in): The entry of hash table
+ *   xignore(in): Extra arguments (currently ignored)
  *
- * Note: Recover the update of the header or a heap page. The header
- * can be the heap header or a chain header.
+ * Note: Remove from the hash the given entry. The entry is marked as
+ * for immediate reuse.
  */
-int
-heap_rv_undoredo_pagehdr (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+static int
+heap_chnguess_remove_entry (const void *oid_key, void *ent, void *xignore)
 {
-  RECDES recdes;
-  int sp_success;
-
-  (void) pgbuf_check_page_ptype (thread_p, rcv->pgptr, PAGE_HEAP);
-
-  recdes.area_size = recdes.length = rcv->length;
-  recdes.type = REC_HOME;
-  recdes.data = (char *) rcv->data;
-
-  sp_success = spage_update (thread_p, rcv->pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes);
-  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+  HEAP_CHNGUESS_ENTRY *entry = (HEAP_CHNGUESS_ENTRY *) ent;
 
-  if (sp_success != SP_SUCCESS)
-    {
-      /* something went wrong. Unable to redo update statistics for chain */
-      if (sp_success != SP_ERROR)
-	{
-	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
-	}
-      assert (er_errid () != NO_ERROR);
-      return er_errid ();
-    }
-  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+  /* mht_rem() has been updated to take a function and an arg pointer that can be called on the entry before it is
+   * removed.  We may want to take advantage of that here to free the memory associated with the entry */
+  (void) mht_rem (heap_Guesschn->ht, oid_key, NULL, NULL);
+  OID_SET_NULL (&entry->oid);
+  entry->chn = NULL_CHN;
+  entry->recently_accessed = false;
+  heap_Guesschn_area.clock_hand = entry->idx;
 
   return NO_ERROR;
 }
 
+#if defined (CUBRID_DEBUG)
 /*
- * heap_rv_dump_statistics () - Dump statistics recovery information
- *   return: int
- *   ignore_length(in): Length of Recovery Data
- *   data(in): The data being logged
+ * heap_chnguess_dump () - Dump current chnguess hash table
+ *   return:
  *
- * Note: Dump statistics recovery information
+ * Note: Dump all valid chnguess entries.
  */
 void
-heap_rv_dump_statistics (FILE * fp, int ignore_length, void *data)
+heap_chnguess_dump (FILE * fp)
 {
-  int ret = NO_ERROR;
+  int max_tranindex, tran_index, i;
+  HEAP_CHNGUESS_ENTRY *entry;
 
-  HEAP_HDR_STATS *heap_hdr;	/* Header of heap structure */
+  if (heap_Guesschn != NULL)
+    {
+      fprintf (fp, "*** Dump of CLASS_OID to CHNGUESS at clients *** \n");
+      fprintf (fp, "Schema_change = %d, clock_hand = %d,\n", heap_Guesschn->schema_change, heap_Guesschn->clock_hand);
+      fprintf (fp, "Nentries = %d, Nactive_entries = %u, maxnum of clients = %d, nbytes = %d\n",
+	       heap_Guesschn->num_entries, mht_count (heap_Guesschn->ht), heap_Guesschn->num_clients,
+	       heap_Guesschn->nbytes);
+      fprintf (fp, "Hash Table = %p, Entries = %p, Bitindex = %p\n", heap_Guesschn->ht, heap_Guesschn->entries,
+	       heap_Guesschn->bitindex);
 
-  heap_hdr = (HEAP_HDR_STATS *) data;
-  ret = heap_dump_hdr (fp, heap_hdr);
-}
+      max_tranindex = logtb_get_number_of_total_tran_indices ();
+      for (i = 0; i < heap_Guesschn->num_entries; i++)
+	{
+	  entry = &heap_Guesschn_area.entries[i];
 
-/*
- * heap_rv_dump_chain () - Dump chain recovery information
- *   return: int
- *   ignore_length(in): Length of Recovery Data
- *   data(in): The data being logged
- */
-void
-heap_rv_dump_chain (FILE * fp, int ignore_length, void *data)
-{
-  HEAP_CHAIN *chain;
+	  if (!OID_ISNULL (&entry->oid))
+	    {
+	      fprintf (fp, " \nEntry_id %d", entry->idx);
+	      fprintf (fp, "OID = %2d|%4d|%2d, chn = %d, recently_free = %d,", entry->oid.volid, entry->oid.pageid,
+		       entry->oid.slotid, entry->chn, entry->recently_accessed);
 
-  chain = (HEAP_CHAIN *) data;
-  fprintf (fp, "CLASS_OID = %2d|%4d|%2d, PREV_VPID = %2d|%4d, NEXT_VPID = %2d|%4d, MAX_MVCCID=%llu, flags=%d.\n",
-	   chain->class_oid.volid, chain->class_oid.pageid, chain->class_oid.slotid, chain->prev_vpid.volid,
-	   chain->prev_vpid.pageid, chain->next_vpid.volid, chain->next_vpid.pageid,
-	   (unsigned long long int) chain->max_mvccid, (int) chain->flags);
+	      /* Dump one bit at a time */
+	      for (tran_index = 0; tran_index < max_tranindex; tran_index++)
+		{
+		  if (tran_index % 40 == 0)
+		    {
+		      fprintf (fp, "\n ");
+		    }
+		  else if (tran_index % 10 == 0)
+		    {
+		      fprintf (fp, " ");
+		    }
+		  fprintf (fp, "%d", HEAP_BIT_GET (entry->bits, tran_index) ? 1 : 0);
+		}
+	      fprintf (fp, "\n");
+	    }
+	}
+    }
 }
+#endif /* CUBRID_DEBUG */
 
 /*
- * heap_rv_redo_insert () - Redo the insertion of an object
- *   return: int
- *   rcv(in): Recovery structure
+ * heap_chnguess_get () - Guess chn of given oid for given tran index (at client)
+ *   return:
+ *   oid(in): OID from where to guess chn at client workspace
+ *   tran_index(in): The client transaction index
  *
- * Note: Redo the insertion of an object at a specific location (OID).
+ * Note: Find/guess the chn of the given OID object at the workspace of
+ * given client transaction index
  */
 int
-heap_rv_redo_insert (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+heap_chnguess_get (THREAD_ENTRY * thread_p, const OID * oid, int tran_index)
 {
-  INT16 slotid;
-  RECDES recdes;
-  int sp_success;
+  int chn = NULL_CHN;
+  HEAP_CHNGUESS_ENTRY *entry;
 
-  slotid = rcv->offset;
-  recdes.type = *(INT16 *) (rcv->data);
-  recdes.data = (char *) (rcv->data) + sizeof (recdes.type);
-  recdes.area_size = recdes.length = rcv->length - sizeof (recdes.type);
+  if (csect_enter (thread_p, CSECT_HEAP_CHNGUESS, INF_WAIT) != NO_ERROR)
+    {
+      return NULL_CHN;
+    }
 
-  if (recdes.type == REC_ASSIGN_ADDRESS)
+  if (heap_Guesschn != NULL)
     {
+      if (heap_Guesschn->num_clients <= tran_index)
+	{
+	  if (heap_chnguess_realloc () != NO_ERROR)
+	    {
+	      csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
+	      return NULL_CHN;
+	    }
+	}
+
       /*
-       * The data here isn't really the data to be inserted (because there
-       * wasn't any); instead it's the number of bytes that were reserved
-       * for future insertion.  Change recdes.length to reflect the number
-       * of bytes to reserve, but there's no need for a valid recdes.data:
-       * spage_insert_for_recovery knows to ignore it in this case.
+       * Do we have this entry in hash table, if we do then check corresponding
+       * bit for given client transaction index.
        */
-      recdes.area_size = recdes.length = *(INT16 *) recdes.data;
-      recdes.data = NULL;
-    }
 
-  sp_success = spage_insert_for_recovery (thread_p, rcv->pgptr, slotid, &recdes);
-  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
-
-  if (sp_success != SP_SUCCESS)
-    {
-      /* Unable to redo insertion */
-      if (sp_success != SP_ERROR)
+      entry = (HEAP_CHNGUESS_ENTRY *) mht_get (heap_Guesschn->ht, oid);
+      if (entry != NULL && HEAP_BIT_GET (entry->bits, tran_index))
 	{
-	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	  chn = entry->chn;
 	}
-      assert (er_errid () != NO_ERROR);
-      return er_errid ();
     }
 
-  return NO_ERROR;
+  csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
+
+  return chn;
 }
 
 /*
- * heap_mvcc_log_insert () - Log MVCC insert heap operation.
+ * heap_chnguess_put () - Oid object is in the process of been sent to client
+ *   return: chn or NULL_CHN if not cached
+ *   oid(in): object oid
+ *   tran_index(in): The client transaction index
+ *   chn(in): cache coherency number.
  *
- * return	 : Void.
- * thread_p (in) : Thread entry.
- * p_recdes (in) : Newly inserted record.
- * p_addr (in)	 : Log address data.
+ * Note: Cache the information that object oid with chn has been sent
+ * to client with trans_index.
+ * If the function fails, it returns NULL_CHN. This failure is
+ * more like a warning since the chnguess is just a caching structure.
  */
-static void
-heap_mvcc_log_insert (THREAD_ENTRY * thread_p, RECDES * p_recdes, LOG_DATA_ADDR * p_addr)
+int
+heap_chnguess_put (THREAD_ENTRY * thread_p, const OID * oid, int tran_index, int chn)
 {
-#define HEAP_LOG_MVCC_INSERT_MAX_REDO_CRUMBS	    4
-
-  int n_redo_crumbs = 0, data_copy_offset = 0, chn_offset;
-  LOG_CRUMB redo_crumbs[HEAP_LOG_MVCC_INSERT_MAX_REDO_CRUMBS];
-  INT32 mvcc_flags;
-  HEAP_PAGE_VACUUM_STATUS vacuum_status;
-
-  assert (p_recdes != NULL);
-  assert (p_addr != NULL);
-
-  vacuum_status = heap_page_get_vacuum_status (thread_p, p_addr->pgptr);
+  int i;
+  bool can_continue;
+  HEAP_CHNGUESS_ENTRY *entry;
 
-  /* Update chain. */
-  heap_page_update_chain_after_mvcc_op (thread_p, p_addr->pgptr, logtb_get_current_mvccid (thread_p));
-  if (vacuum_status != heap_page_get_vacuum_status (thread_p, p_addr->pgptr))
+  if (heap_Guesschn == NULL)
     {
-      /* Mark status change for recovery. */
-      p_addr->offset |= HEAP_RV_FLAG_VACUUM_STATUS_CHANGE;
+      return NULL_CHN;
     }
 
-  /* Build redo crumbs */
-  /* Add record type */
-  redo_crumbs[n_redo_crumbs].length = sizeof (p_recdes->type);
-  redo_crumbs[n_redo_crumbs++].data = &p_recdes->type;
-
-  if (p_recdes->type != REC_BIGONE)
+  if (csect_enter (thread_p, CSECT_HEAP_CHNGUESS, INF_WAIT) != NO_ERROR)
     {
-      mvcc_flags = (INT32) OR_GET_MVCC_FLAG (p_recdes->data);
-      chn_offset = OR_CHN_OFFSET;
-
-      /* Add representation ID and flags field */
-      redo_crumbs[n_redo_crumbs].length = OR_INT_SIZE;
-      redo_crumbs[n_redo_crumbs++].data = p_recdes->data;
-
-      /* Add CHN */
-      redo_crumbs[n_redo_crumbs].length = OR_INT_SIZE;
-      redo_crumbs[n_redo_crumbs++].data = p_recdes->data + chn_offset;
-
-      /* Set data copy offset after the record header */
-      data_copy_offset = OR_HEADER_SIZE (p_recdes->data);
+      return NULL_CHN;
     }
 
-  /* Add record data - record may be skipped if the record is not big one */
-  redo_crumbs[n_redo_crumbs].length = p_recdes->length - data_copy_offset;
-  redo_crumbs[n_redo_crumbs++].data = p_recdes->data + data_copy_offset;
-
-  /* Safe guard */
-  assert (n_redo_crumbs <= HEAP_LOG_MVCC_INSERT_MAX_REDO_CRUMBS);
+  if (heap_Guesschn->num_clients <= tran_index)
+    {
+      if (heap_chnguess_realloc () != NO_ERROR)
+	{
+	  csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
+	  return NULL_CHN;
+	}
+    }
 
-  /* Append redo crumbs; undo crumbs not necessary as the spage_delete physical operation uses the offset field of the
-   * address */
-  if (thread_p->no_logging)
+  /*
+   * Is the entry already in the chnguess hash table ?
+   */
+  entry = (HEAP_CHNGUESS_ENTRY *) mht_get (heap_Guesschn->ht, oid);
+  if (entry != NULL)
     {
-      log_append_undo_crumbs (thread_p, RVHF_MVCC_INSERT, p_addr, 0, NULL);
+      /*
+       * If the cache coherence number is different reset all client entries
+       */
+      if (entry->chn != chn)
+	{
+	  HEAP_NBYTES_CLEARED (entry->bits, heap_Guesschn_area.nbytes);
+	  entry->chn = chn;
+	}
     }
   else
     {
-      log_append_undoredo_crumbs (thread_p, RVHF_MVCC_INSERT, p_addr, 0, n_redo_crumbs, NULL, redo_crumbs);
-    }
-}
-
-/*
- * heap_rv_mvcc_redo_insert () - Redo the MVCC insertion of an object
- *   return: int
- *   rcv(in): Recovery structure
- *
- * Note: MVCC redo the insertion of an object at a specific location (OID).
- */
-int
-heap_rv_mvcc_redo_insert (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
-{
-  INT16 slotid;
-  RECDES recdes;
-  int chn, sp_success;
-  MVCC_REC_HEADER mvcc_rec_header;
-  INT16 record_type;
-  bool vacuum_status_change = false;
-
-  assert (rcv->pgptr != NULL);
-  assert (MVCCID_IS_NORMAL (rcv->mvcc_id));
+      /*
+       * Replace one of the entries that has not been used for a while.
+       * Follow clock replacement algorithm.
+       */
+      can_continue = true;
+      while (entry == NULL && can_continue == true)
+	{
+	  can_continue = false;
+	  for (i = 0; i < heap_Guesschn->num_entries; i++)
+	    {
+	      /*
+	       * Increase the clock to next entry
+	       */
+	      heap_Guesschn->clock_hand++;
+	      if (heap_Guesschn->clock_hand >= heap_Guesschn->num_entries)
+		{
+		  heap_Guesschn->clock_hand = 0;
+		}
 
-  slotid = rcv->offset;
-  if (slotid & HEAP_RV_FLAG_VACUUM_STATUS_CHANGE)
-    {
-      vacuum_status_change = true;
+	      entry = &heap_Guesschn->entries[heap_Guesschn->clock_hand];
+	      if (entry->recently_accessed == true)
+		{
+		  /*
+		   * Set recently freed to false, so it can be replaced in next
+		   * if the entry is not referenced
+		   */
+		  entry->recently_accessed = false;
+		  entry = NULL;
+		  can_continue = true;
+		}
+	      else
+		{
+		  entry->oid = *oid;
+		  entry->chn = chn;
+		  HEAP_NBYTES_CLEARED (entry->bits, heap_Guesschn_area.nbytes);
+		  break;
+		}
+	    }
+	}
     }
-  slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
-  assert (slotid > 0);
 
-  record_type = *(INT16 *) rcv->data;
-  if (record_type == REC_BIGONE)
+  /*
+   * Now set the desired client transaction index bit
+   */
+  if (entry != NULL)
     {
-      /* no data header */
-      HEAP_SET_RECORD (&recdes, rcv->length - sizeof (record_type), rcv->length - sizeof (record_type), REC_BIGONE,
-		       rcv->data + sizeof (record_type));
+      HEAP_BIT_SET (entry->bits, tran_index);
+      entry->recently_accessed = true;
     }
   else
     {
-      char data_buffer[IO_DEFAULT_PAGE_SIZE + OR_MVCC_MAX_HEADER_SIZE + MAX_ALIGNMENT];
-      int repid_and_flags, offset, mvcc_flag, offset_size;
-
-      offset = sizeof (record_type);
-
-      repid_and_flags = OR_GET_INT (rcv->data + offset);
-      offset += OR_INT_SIZE;
-
-      chn = OR_GET_INT (rcv->data + offset);
-      offset += OR_INT_SIZE;
-
-      mvcc_flag = (char) ((repid_and_flags >> OR_MVCC_FLAG_SHIFT_BITS) & OR_MVCC_FLAG_MASK);
-
-      assert (!(mvcc_flag & OR_MVCC_FLAG_VALID_DELID));
+      chn = NULL_CHN;
+    }
 
-      if ((repid_and_flags & OR_OFFSET_SIZE_FLAG) == OR_OFFSET_SIZE_1BYTE)
-	{
-	  offset_size = OR_BYTE_SIZE;
-	}
-      else if ((repid_and_flags & OR_OFFSET_SIZE_FLAG) == OR_OFFSET_SIZE_2BYTE)
-	{
-	  offset_size = OR_SHORT_SIZE;
-	}
-      else
-	{
-	  offset_size = OR_INT_SIZE;
-	}
+  csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
 
-      MVCC_SET_REPID (&mvcc_rec_header, repid_and_flags & OR_MVCC_REPID_MASK);
-      MVCC_SET_FLAG (&mvcc_rec_header, mvcc_flag);
-      MVCC_SET_INSID (&mvcc_rec_header, rcv->mvcc_id);
-      MVCC_SET_CHN (&mvcc_rec_header, chn);
+  return chn;
+}
 
-      HEAP_SET_RECORD (&recdes, IO_DEFAULT_PAGE_SIZE + OR_MVCC_MAX_HEADER_SIZE, 0, record_type,
-		       PTR_ALIGN (data_buffer, MAX_ALIGNMENT));
-      or_mvcc_add_header (&recdes, &mvcc_rec_header, repid_and_flags & OR_BOUND_BIT_FLAG, offset_size);
+/*
+ * heap_chnguess_clear () - Clear any cached information for given client
+ *                        used when client is shutdown
+ *   return:
+ *   tran_index(in): The client transaction index
+ *
+ * Note: Clear the transaction index bit for all chnguess entries.
+ */
+void
+heap_chnguess_clear (THREAD_ENTRY * thread_p, int tran_index)
+{
+  int i;
+  HEAP_CHNGUESS_ENTRY *entry;
 
-      memcpy (recdes.data + recdes.length, rcv->data + offset, rcv->length - offset);
-      recdes.length += (rcv->length - offset);
+  if (csect_enter (thread_p, CSECT_HEAP_CHNGUESS, INF_WAIT) != NO_ERROR)
+    {
+      return;
     }
 
-  sp_success = spage_insert_for_recovery (thread_p, rcv->pgptr, slotid, &recdes);
-
-  if (sp_success != SP_SUCCESS)
+  if (heap_Guesschn != NULL)
     {
-      /* Unable to redo insertion */
-      assert_release (false);
-      return ER_FAILED;
+      for (i = 0; i < heap_Guesschn->num_entries; i++)
+	{
+	  entry = &heap_Guesschn_area.entries[i];
+	  if (!OID_ISNULL (&entry->oid))
+	    {
+	      HEAP_BIT_CLEAR (entry->bits, (unsigned int) tran_index);
+	    }
+	}
     }
 
-  heap_page_rv_chain_update (thread_p, rcv->pgptr, rcv->mvcc_id, vacuum_status_change);
-  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+  csect_exit (thread_p, CSECT_HEAP_CHNGUESS);
 
-  return NO_ERROR;
 }
 
 /*
- * heap_rv_undo_insert () - Undo the insertion of an object.
+ * Recovery functions
+ */
+
+/*
+ * heap_rv_redo_newpage () - Redo the statistics or a new page allocation for
+ *                           a heap file
  *   return: int
  *   rcv(in): Recovery structure
- *
- * Note: Delete an object for recovery purposes. The OID of the object
- * is reused since the object was never committed.
  */
 int
-heap_rv_undo_insert (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+heap_rv_redo_newpage (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
+  RECDES recdes;
   INT16 slotid;
+  int sp_success;
 
-  slotid = rcv->offset;
-  /* Clear HEAP_RV_FLAG_VACUUM_STATUS_CHANGE */
-  slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
-  (void) spage_delete_for_recovery (thread_p, rcv->pgptr, slotid);
+  (void) pgbuf_set_page_ptype (thread_p, rcv->pgptr, PAGE_HEAP);
+
+  /* Initialize header page */
+  spage_initialize (thread_p, rcv->pgptr, heap_get_spage_type (), HEAP_MAX_ALIGN, SAFEGUARD_RVSPACE);
+
+  /* Now insert first record (either statistics or chain record) */
+  recdes.area_size = recdes.length = rcv->length;
+  recdes.type = REC_HOME;
+  recdes.data = (char *) rcv->data;
+  sp_success = spage_insert (thread_p, rcv->pgptr, &recdes, &slotid);
   pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
 
+  if (sp_success != SP_SUCCESS || slotid != HEAP_HEADER_AND_CHAIN_SLOTID)
+    {
+      if (sp_success != SP_SUCCESS)
+	{
+	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	}
+      /* something went wrong. Unable to redo initialization of new heap page */
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
+    }
+
   return NO_ERROR;
 }
 
 /*
- * heap_rv_redo_delete () - Redo the deletion of an object
+ * heap_rv_undoredo_pagehdr () - Recover the header of a heap page
+ *                    (either statistics/chain)
  *   return: int
  *   rcv(in): Recovery structure
  *
- * Note: Redo the deletion of an object.
- * The OID of the object is not reuse since we don't know if the object was a
- * newly created object.
+ * Note: Recover the update of the header or a heap page. The header
+ * can be the heap header or a chain header.
  */
 int
-heap_rv_redo_delete (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+heap_rv_undoredo_pagehdr (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
-  INT16 slotid;
+  RECDES recdes;
+  int sp_success;
 
-  slotid = rcv->offset;
-  (void) spage_delete (thread_p, rcv->pgptr, slotid);
+  (void) pgbuf_check_page_ptype (thread_p, rcv->pgptr, PAGE_HEAP);
+
+  recdes.area_size = recdes.length = rcv->length;
+  recdes.type = REC_HOME;
+  recdes.data = (char *) rcv->data;
+
+  sp_success = spage_update (thread_p, rcv->pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes);
+  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+
+  if (sp_success != SP_SUCCESS)
+    {
+      /* something went wrong. Unable to redo update statistics for chain */
+      if (sp_success != SP_ERROR)
+	{
+	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	}
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
+    }
   pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
 
   return NO_ERROR;
 }
 
 /*
- * heap_mvcc_log_delete () - Log normal MVCC heap delete operation (just
- *			     append delete MVCCID and next version OID).
+ * heap_rv_dump_statistics () - Dump statistics recovery information
+ *   return: int
+ *   ignore_length(in): Length of Recovery Data
+ *   data(in): The data being logged
  *
- * return		    : Void.
- * thread_p (in)	    : Thread entry.
- * p_addr (in)		    : Log address data.
- * rcvindex(in)		    : Index to recovery function
+ * Note: Dump statistics recovery information
  */
-static void
-heap_mvcc_log_delete (THREAD_ENTRY * thread_p, LOG_DATA_ADDR * p_addr, LOG_RCVINDEX rcvindex)
+void
+heap_rv_dump_statistics (FILE * fp, int ignore_length, void *data)
 {
-  char redo_data_buffer[OR_MVCCID_SIZE + MAX_ALIGNMENT];
-  char *redo_data_p = PTR_ALIGN (redo_data_buffer, MAX_ALIGNMENT);
-  char *ptr;
-  int redo_data_size = 0;
-  HEAP_PAGE_VACUUM_STATUS vacuum_status;
+  int ret = NO_ERROR;
 
-  assert (p_addr != NULL);
-  assert (rcvindex == RVHF_MVCC_DELETE_REC_HOME || rcvindex == RVHF_MVCC_DELETE_REC_NEWHOME
-	  || rcvindex == RVHF_MVCC_DELETE_OVERFLOW);
+  HEAP_HDR_STATS *heap_hdr;	/* Header of heap structure */
 
-  if (LOG_IS_MVCC_HEAP_OPERATION (rcvindex))
-    {
-      vacuum_status = heap_page_get_vacuum_status (thread_p, p_addr->pgptr);
+  heap_hdr = (HEAP_HDR_STATS *) data;
+  ret = heap_dump_hdr (fp, heap_hdr);
+}
 
-      heap_page_update_chain_after_mvcc_op (thread_p, p_addr->pgptr, logtb_get_current_mvccid (thread_p));
-      if (heap_page_get_vacuum_status (thread_p, p_addr->pgptr) != vacuum_status)
-	{
-	  /* Mark vacuum status change for recovery. */
-	  p_addr->offset |= HEAP_RV_FLAG_VACUUM_STATUS_CHANGE;
-	}
-    }
-
-  /* Prepare redo data. */
-  ptr = redo_data_p;
-
-  if (rcvindex != RVHF_MVCC_DELETE_REC_HOME)
-    {
-      /* MVCCID must be packed also, since it is not saved in log record structure. */
-      ptr = or_pack_mvccid (ptr, logtb_get_current_mvccid (thread_p));
-      redo_data_size += OR_MVCCID_SIZE;
-    }
-
-  assert ((ptr - redo_data_buffer) <= (int) sizeof (redo_data_buffer));
+/*
+ * heap_rv_dump_chain () - Dump chain recovery information
+ *   return: int
+ *   ignore_length(in): Length of Recovery Data
+ *   data(in): The data being logged
+ */
+void
+heap_rv_dump_chain (FILE * fp, int ignore_length, void *data)
+{
+  HEAP_CHAIN *chain;
 
-  /* Log append undo/redo crumbs */
-  if (thread_p->no_logging)
-    {
-      log_append_undo_data (thread_p, rcvindex, p_addr, 0, NULL);
-    }
-  else
-    {
-      log_append_undoredo_data (thread_p, rcvindex, p_addr, 0, redo_data_size, NULL, redo_data_p);
-    }
+  chain = (HEAP_CHAIN *) data;
+  fprintf (fp, "CLASS_OID = %2d|%4d|%2d, PREV_VPID = %2d|%4d, NEXT_VPID = %2d|%4d, MAX_MVCCID=%llu, flags=%d.\n",
+	   chain->class_oid.volid, chain->class_oid.pageid, chain->class_oid.slotid, chain->prev_vpid.volid,
+	   chain->prev_vpid.pageid, chain->next_vpid.volid, chain->next_vpid.pageid,
+	   (unsigned long long int) chain->max_mvccid, (int) chain->flags);
 }
 
 /*
- * heap_rv_mvcc_undo_delete () - Undo the MVCC deletion of an object
+ * heap_rv_redo_insert () - Redo the insertion of an object
  *   return: int
  *   rcv(in): Recovery structure
+ *
+ * Note: Redo the insertion of an object at a specific location (OID).
  */
 int
-heap_rv_mvcc_undo_delete (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+heap_rv_redo_insert (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
   INT16 slotid;
-  MVCC_REC_HEADER mvcc_rec_header;
-  char data_buffer[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
-  RECDES rebuild_record;
+  RECDES recdes;
+  int sp_success;
 
   slotid = rcv->offset;
-  slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
-  assert (slotid > 0);
-
-  rebuild_record.data = PTR_ALIGN (data_buffer, MAX_ALIGNMENT);
-  rebuild_record.area_size = DB_PAGESIZE;
-  if (spage_get_record (thread_p, rcv->pgptr, slotid, &rebuild_record, COPY) != S_SUCCESS)
-    {
-      assert_release (false);
-      return ER_FAILED;
-    }
-  assert (rebuild_record.type == REC_HOME || rebuild_record.type == REC_NEWHOME);
+  recdes.type = *(INT16 *) (rcv->data);
+  recdes.data = (char *) (rcv->data) + sizeof (recdes.type);
+  recdes.area_size = recdes.length = rcv->length - sizeof (recdes.type);
 
-  if (or_mvcc_get_header (&rebuild_record, &mvcc_rec_header) != NO_ERROR)
+  if (recdes.type == REC_ASSIGN_ADDRESS)
     {
-      assert_release (false);
-      return ER_FAILED;
+      /*
+       * The data here isn't really the data to be inserted (because there
+       * wasn't any); instead it's the number of bytes that were reserved
+       * for future insertion.  Change recdes.length to reflect the number
+       * of bytes to reserve, but there's no need for a valid recdes.data:
+       * spage_insert_for_recovery knows to ignore it in this case.
+       */
+      recdes.area_size = recdes.length = *(INT16 *) recdes.data;
+      recdes.data = NULL;
     }
-  assert (MVCC_IS_FLAG_SET (&mvcc_rec_header, OR_MVCC_FLAG_VALID_DELID));
-  MVCC_CLEAR_FLAG_BITS (&mvcc_rec_header, OR_MVCC_FLAG_VALID_DELID);
 
-  if (or_mvcc_set_header (&rebuild_record, &mvcc_rec_header) != NO_ERROR)
-    {
-      assert_release (false);
-      return ER_FAILED;
-    }
+  sp_success = spage_insert_for_recovery (thread_p, rcv->pgptr, slotid, &recdes);
+  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
 
-  if (spage_update (thread_p, rcv->pgptr, slotid, &rebuild_record) != SP_SUCCESS)
+  if (sp_success != SP_SUCCESS)
     {
-      assert_release (false);
-      return ER_FAILED;
+      /* Unable to redo insertion */
+      if (sp_success != SP_ERROR)
+	{
+	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	}
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
     }
 
-  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
   return NO_ERROR;
 }
 
 /*
- * heap_rv_mvcc_undo_delete_overflow () - Undo MVCC delete of an overflow
- *					  record.
+ * heap_mvcc_log_insert () - Log MVCC insert heap operation.
  *
- * return	 : Error code.
+ * return	 : Void.
  * thread_p (in) : Thread entry.
- * rcv (in)	 : Recovery data.
+ * p_recdes (in) : Newly inserted record.
+ * p_addr (in)	 : Log address data.
  */
-int
-heap_rv_mvcc_undo_delete_overflow (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+static void
+heap_mvcc_log_insert (THREAD_ENTRY * thread_p, RECDES * p_recdes, LOG_DATA_ADDR * p_addr)
 {
-  MVCC_REC_HEADER mvcc_header;
+#define HEAP_LOG_MVCC_INSERT_MAX_REDO_CRUMBS	    4
 
-  if (heap_get_mvcc_rec_header_from_overflow (rcv->pgptr, &mvcc_header, NULL) != NO_ERROR)
-    {
-      assert_release (false);
-      return ER_FAILED;
-    }
+  int n_redo_crumbs = 0, data_copy_offset = 0, chn_offset;
+  LOG_CRUMB redo_crumbs[HEAP_LOG_MVCC_INSERT_MAX_REDO_CRUMBS];
+  INT32 mvcc_flags;
+  HEAP_PAGE_VACUUM_STATUS vacuum_status;
 
-  /* All flags should be set. Overflow header should be set to maximum size */
-  assert (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_DELID));
-  assert (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_PREV_VERSION));
+  assert (p_recdes != NULL);
+  assert (p_addr != NULL);
 
-  MVCC_SET_DELID (&mvcc_header, MVCCID_NULL);
+  vacuum_status = heap_page_get_vacuum_status (thread_p, p_addr->pgptr);
 
-  /* Change header. */
-  if (heap_set_mvcc_rec_header_on_overflow (rcv->pgptr, &mvcc_header) != NO_ERROR)
+  /* Update chain. */
+  heap_page_update_chain_after_mvcc_op (thread_p, p_addr->pgptr, logtb_get_current_mvccid (thread_p));
+  if (vacuum_status != heap_page_get_vacuum_status (thread_p, p_addr->pgptr))
     {
-      assert_release (false);
-      return ER_FAILED;
+      /* Mark status change for recovery. */
+      p_addr->offset |= HEAP_RV_FLAG_VACUUM_STATUS_CHANGE;
     }
 
-  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
-  return NO_ERROR;
-}
+  /* Build redo crumbs */
+  /* Add record type */
+  redo_crumbs[n_redo_crumbs].length = sizeof (p_recdes->type);
+  redo_crumbs[n_redo_crumbs++].data = &p_recdes->type;
 
-/*
- * heap_rv_mvcc_redo_delete_internal () - Internal function to be used by
- *					  heap_rv_mvcc_redo_delete_home and
- *					  heap_rv_mvcc_redo_delete_newhome.
- *
- * return	      : Error code.
- * thread_p (in)      : Thread entry.
- * page (in)	      : Heap page.
- * slotid (in)	      : Recovered record slotid.
- * mvccid (in)	      : Delete MVCCID.
- */
-static int
-heap_rv_mvcc_redo_delete_internal (THREAD_ENTRY * thread_p, PAGE_PTR page, PGSLOTID slotid, MVCCID mvccid)
-{
-  RECDES rebuild_record;
-  char data_buffer[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
-  MVCC_REC_HEADER mvcc_rec_header;
+  if (p_recdes->type != REC_BIGONE)
+    {
+      mvcc_flags = (INT32) OR_GET_MVCC_FLAG (p_recdes->data);
+      chn_offset = OR_CHN_OFFSET;
 
-  assert (page != NULL);
-  assert (MVCCID_IS_NORMAL (mvccid));
+      /* Add representation ID and flags field */
+      redo_crumbs[n_redo_crumbs].length = OR_INT_SIZE;
+      redo_crumbs[n_redo_crumbs++].data = p_recdes->data;
 
-  rebuild_record.data = PTR_ALIGN (data_buffer, MAX_ALIGNMENT);
-  rebuild_record.area_size = DB_PAGESIZE;
+      /* Add CHN */
+      redo_crumbs[n_redo_crumbs].length = OR_INT_SIZE;
+      redo_crumbs[n_redo_crumbs++].data = p_recdes->data + chn_offset;
 
-  /* Get record. */
-  if (spage_get_record (thread_p, page, slotid, &rebuild_record, COPY) != S_SUCCESS)
-    {
-      assert_release (false);
-      return ER_FAILED;
+      /* Set data copy offset after the record header */
+      data_copy_offset = OR_HEADER_SIZE (p_recdes->data);
     }
 
-  /* Get MVCC header. */
-  if (or_mvcc_get_header (&rebuild_record, &mvcc_rec_header) != NO_ERROR)
-    {
-      assert_release (false);
-      return ER_FAILED;
-    }
+  /* Add record data - record may be skipped if the record is not big one */
+  redo_crumbs[n_redo_crumbs].length = p_recdes->length - data_copy_offset;
+  redo_crumbs[n_redo_crumbs++].data = p_recdes->data + data_copy_offset;
 
-  /* Set delete MVCCID. */
-  MVCC_SET_FLAG_BITS (&mvcc_rec_header, OR_MVCC_FLAG_VALID_DELID);
-  MVCC_SET_DELID (&mvcc_rec_header, mvccid);
+  /* Safe guard */
+  assert (n_redo_crumbs <= HEAP_LOG_MVCC_INSERT_MAX_REDO_CRUMBS);
 
-  /* Change header. */
-  if (or_mvcc_set_header (&rebuild_record, &mvcc_rec_header) != NO_ERROR)
+  /* Append redo crumbs; undo crumbs not necessary as the spage_delete physical operation uses the offset field of the
+   * address */
+  if (thread_p->no_logging)
     {
-      assert_release (false);
-      return ER_FAILED;
+      log_append_undo_crumbs (thread_p, RVHF_MVCC_INSERT, p_addr, 0, NULL);
     }
-
-  /* Update record in page. */
-  if (spage_update (thread_p, page, slotid, &rebuild_record) != SP_SUCCESS)
+  else
     {
-      assert_release (false);
-      return ER_FAILED;
+      log_append_undoredo_crumbs (thread_p, RVHF_MVCC_INSERT, p_addr, 0, n_redo_crumbs, NULL, redo_crumbs);
     }
-
-  /* Success. */
-  return NO_ERROR;
 }
 
 /*
- * heap_rv_mvcc_redo_delete_home () - Redo MVCC delete of REC_HOME record.
+ * heap_rv_mvcc_redo_insert () - Redo the MVCC insertion of an object
+ *   return: int
+ *   rcv(in): Recovery structure
  *
- * return	 : Error code
- * thread_p (in) : Thread entry.
- * rcv (in)	 : Recovery data.
+ * Note: MVCC redo the insertion of an object at a specific location (OID).
  */
 int
-heap_rv_mvcc_redo_delete_home (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+heap_rv_mvcc_redo_insert (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
-  int error_code = NO_ERROR;
-  int offset = 0;
-  PGSLOTID slotid;
+  INT16 slotid;
+  RECDES recdes;
+  int chn, sp_success;
+  MVCC_REC_HEADER mvcc_rec_header;
+  INT16 record_type;
   bool vacuum_status_change = false;
 
   assert (rcv->pgptr != NULL);
@@ -16044,2585 +16250,3525 @@ heap_rv_mvcc_redo_delete_home (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
   slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
   assert (slotid > 0);
 
-  assert (offset == rcv->length);
-
-  error_code = heap_rv_mvcc_redo_delete_internal (thread_p, rcv->pgptr, slotid, rcv->mvcc_id);
-  if (error_code != NO_ERROR)
+  record_type = *(INT16 *) rcv->data;
+  if (record_type == REC_BIGONE)
     {
-      ASSERT_ERROR ();
-      return error_code;
+      /* no data header */
+      HEAP_SET_RECORD (&recdes, rcv->length - sizeof (record_type), rcv->length - sizeof (record_type), REC_BIGONE,
+		       rcv->data + sizeof (record_type));
     }
-  heap_page_rv_chain_update (thread_p, rcv->pgptr, rcv->mvcc_id, vacuum_status_change);
+  else
+    {
+      char data_buffer[IO_DEFAULT_PAGE_SIZE + OR_MVCC_MAX_HEADER_SIZE + MAX_ALIGNMENT];
+      int repid_and_flags, offset, mvcc_flag, offset_size;
 
-  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
-  return NO_ERROR;
-}
+      offset = sizeof (record_type);
 
-/*
- * heap_rv_mvcc_redo_delete_overflow () - Redo MVCC delete of overflow record.
- *
- * return	 : Error code
- * thread_p (in) : Thread entry.
- * rcv (in)	 : Recovery data.
- */
-int
-heap_rv_mvcc_redo_delete_overflow (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
-{
-  int offset = 0;
-  MVCCID mvccid;
-  MVCC_REC_HEADER mvcc_header;
+      repid_and_flags = OR_GET_INT (rcv->data + offset);
+      offset += OR_INT_SIZE;
 
-  assert (rcv->pgptr != NULL);
+      chn = OR_GET_INT (rcv->data + offset);
+      offset += OR_INT_SIZE;
 
-  OR_GET_MVCCID (rcv->data + offset, &mvccid);
-  offset += OR_MVCCID_SIZE;
+      mvcc_flag = (char) ((repid_and_flags >> OR_MVCC_FLAG_SHIFT_BITS) & OR_MVCC_FLAG_MASK);
 
-  assert (offset == rcv->length);
+      assert (!(mvcc_flag & OR_MVCC_FLAG_VALID_DELID));
 
-  if (heap_get_mvcc_rec_header_from_overflow (rcv->pgptr, &mvcc_header, NULL) != NO_ERROR)
-    {
-      assert_release (false);
-      return ER_FAILED;
+      if ((repid_and_flags & OR_OFFSET_SIZE_FLAG) == OR_OFFSET_SIZE_1BYTE)
+	{
+	  offset_size = OR_BYTE_SIZE;
+	}
+      else if ((repid_and_flags & OR_OFFSET_SIZE_FLAG) == OR_OFFSET_SIZE_2BYTE)
+	{
+	  offset_size = OR_SHORT_SIZE;
+	}
+      else
+	{
+	  offset_size = OR_INT_SIZE;
+	}
+
+      MVCC_SET_REPID (&mvcc_rec_header, repid_and_flags & OR_MVCC_REPID_MASK);
+      MVCC_SET_FLAG (&mvcc_rec_header, mvcc_flag);
+      MVCC_SET_INSID (&mvcc_rec_header, rcv->mvcc_id);
+      MVCC_SET_CHN (&mvcc_rec_header, chn);
+
+      HEAP_SET_RECORD (&recdes, IO_DEFAULT_PAGE_SIZE + OR_MVCC_MAX_HEADER_SIZE, 0, record_type,
+		       PTR_ALIGN (data_buffer, MAX_ALIGNMENT));
+      or_mvcc_add_header (&recdes, &mvcc_rec_header, repid_and_flags & OR_BOUND_BIT_FLAG, offset_size);
+
+      memcpy (recdes.data + recdes.length, rcv->data + offset, rcv->length - offset);
+      recdes.length += (rcv->length - offset);
     }
-  assert (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_INSID));
 
-  assert (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_DELID));
-  MVCC_SET_DELID (&mvcc_header, mvccid);
+  sp_success = spage_insert_for_recovery (thread_p, rcv->pgptr, slotid, &recdes);
 
-  /* Update MVCC header. */
-  if (heap_set_mvcc_rec_header_on_overflow (rcv->pgptr, &mvcc_header) != NO_ERROR)
+  if (sp_success != SP_SUCCESS)
     {
+      /* Unable to redo insertion */
       assert_release (false);
       return ER_FAILED;
     }
 
+  heap_page_rv_chain_update (thread_p, rcv->pgptr, rcv->mvcc_id, vacuum_status_change);
   pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+
   return NO_ERROR;
 }
 
 /*
- * heap_rv_mvcc_redo_delete_newhome () - Redo MVCC delete of REC_NEWHOME
- *					 record.
+ * heap_rv_undo_insert () - Undo the insertion of an object.
+ *   return: int
+ *   rcv(in): Recovery structure
  *
- * return	 : Error code
- * thread_p (in) : Thread entry.
- * rcv (in)	 : Recovery data.
+ * Note: Delete an object for recovery purposes. The OID of the object
+ * is reused since the object was never committed.
  */
 int
-heap_rv_mvcc_redo_delete_newhome (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+heap_rv_undo_insert (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
-  int error_code = NO_ERROR;
-  int offset = 0;
-  MVCCID mvccid;
-
-  assert (rcv->pgptr != NULL);
-
-  OR_GET_MVCCID (rcv->data + offset, &mvccid);
-  offset += OR_MVCCID_SIZE;
-
-  assert (offset == rcv->length);
-
-  error_code = heap_rv_mvcc_redo_delete_internal (thread_p, rcv->pgptr, rcv->offset, mvccid);
-  if (error_code != NO_ERROR)
-    {
-      ASSERT_ERROR ();
-      return error_code;
-    }
+  INT16 slotid;
 
+  slotid = rcv->offset;
+  /* Clear HEAP_RV_FLAG_VACUUM_STATUS_CHANGE */
+  slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
+  (void) spage_delete_for_recovery (thread_p, rcv->pgptr, slotid);
   pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+
   return NO_ERROR;
 }
 
 /*
- * heap_rv_redo_mark_reusable_slot () - Marks a deleted slot as reusable; used
- *                                      as a postponed log operation and a
- *                                      REDO function
+ * heap_rv_redo_delete () - Redo the deletion of an object
  *   return: int
  *   rcv(in): Recovery structure
  *
- * Note: Mark (during postponed operation execution)/Redo (during recovery)
- *       the marking of a deleted slot as reusable.
+ * Note: Redo the deletion of an object.
+ * The OID of the object is not reuse since we don't know if the object was a
+ * newly created object.
  */
 int
-heap_rv_redo_mark_reusable_slot (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+heap_rv_redo_delete (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
   INT16 slotid;
 
   slotid = rcv->offset;
-  (void) spage_mark_deleted_slot_as_reusable (thread_p, rcv->pgptr, slotid);
+  (void) spage_delete (thread_p, rcv->pgptr, slotid);
   pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
 
   return NO_ERROR;
 }
 
 /*
- * heap_rv_undo_delete () - Undo the deletion of an object
- *   return: int
- *   rcv(in): Recovery structure
+ * heap_mvcc_log_delete () - Log normal MVCC heap delete operation (just
+ *			     append delete MVCCID and next version OID).
+ *
+ * return		    : Void.
+ * thread_p (in)	    : Thread entry.
+ * p_addr (in)		    : Log address data.
+ * rcvindex(in)		    : Index to recovery function
  */
-int
-heap_rv_undo_delete (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+static void
+heap_mvcc_log_delete (THREAD_ENTRY * thread_p, LOG_DATA_ADDR * p_addr, LOG_RCVINDEX rcvindex)
 {
-  INT16 slotid;
-  INT16 recdes_type;
-  int error_code;
+  char redo_data_buffer[OR_MVCCID_SIZE + MAX_ALIGNMENT];
+  char *redo_data_p = PTR_ALIGN (redo_data_buffer, MAX_ALIGNMENT);
+  char *ptr;
+  int redo_data_size = 0;
+  HEAP_PAGE_VACUUM_STATUS vacuum_status;
 
-  error_code = heap_rv_redo_insert (thread_p, rcv);
-  if (error_code != NO_ERROR)
-    {
-      return error_code;
-    }
+  assert (p_addr != NULL);
+  assert (rcvindex == RVHF_MVCC_DELETE_REC_HOME || rcvindex == RVHF_MVCC_DELETE_REC_NEWHOME
+	  || rcvindex == RVHF_MVCC_DELETE_OVERFLOW);
 
-  /* vacuum atomicity */
-  recdes_type = *(INT16 *) (rcv->data);
-  if (recdes_type == REC_NEWHOME)
+  if (LOG_IS_MVCC_HEAP_OPERATION (rcvindex))
     {
-      slotid = rcv->offset;
-      slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
-      error_code = vacuum_rv_check_at_undo (thread_p, rcv->pgptr, slotid, recdes_type);
-      if (error_code != NO_ERROR)
+      vacuum_status = heap_page_get_vacuum_status (thread_p, p_addr->pgptr);
+
+      heap_page_update_chain_after_mvcc_op (thread_p, p_addr->pgptr, logtb_get_current_mvccid (thread_p));
+      if (heap_page_get_vacuum_status (thread_p, p_addr->pgptr) != vacuum_status)
 	{
-	  assert_release (false);
-	  return ER_FAILED;
+	  /* Mark vacuum status change for recovery. */
+	  p_addr->offset |= HEAP_RV_FLAG_VACUUM_STATUS_CHANGE;
 	}
     }
 
-  return NO_ERROR;
-}
-
-/*
- * heap_rv_undo_update () - Undo the update of an object
- *   return: int
- *   rev(in): Recovery structure
- */
-int
-heap_rv_undo_update (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
-{
-  INT16 recdes_type;
-  int error_code;
+  /* Prepare redo data. */
+  ptr = redo_data_p;
 
-  error_code = heap_rv_undoredo_update (thread_p, rcv);
-  if (error_code != NO_ERROR)
+  if (rcvindex != RVHF_MVCC_DELETE_REC_HOME)
     {
-      ASSERT_ERROR ();
-      return error_code;
+      /* MVCCID must be packed also, since it is not saved in log record structure. */
+      ptr = or_pack_mvccid (ptr, logtb_get_current_mvccid (thread_p));
+      redo_data_size += OR_MVCCID_SIZE;
     }
 
-  /* vacuum atomicity */
-  recdes_type = *(INT16 *) (rcv->data);
-  if (recdes_type == REC_HOME || recdes_type == REC_NEWHOME)
-    {
-      INT16 slotid;
+  assert ((ptr - redo_data_buffer) <= (int) sizeof (redo_data_buffer));
 
-      slotid = rcv->offset;
-      slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
-      error_code = vacuum_rv_check_at_undo (thread_p, rcv->pgptr, slotid, recdes_type);
-      if (error_code != NO_ERROR)
-	{
-	  assert_release (false);
-	  return error_code;
-	}
+  /* Log append undo/redo crumbs */
+  if (thread_p->no_logging)
+    {
+      log_append_undo_data (thread_p, rcvindex, p_addr, 0, NULL);
+    }
+  else
+    {
+      log_append_undoredo_data (thread_p, rcvindex, p_addr, 0, redo_data_size, NULL, redo_data_p);
     }
-
-  return NO_ERROR;
-}
-
-/*
- * heap_rv_redo_update () - Redo the update of an object
- *   return: int
- *   rcv(in): Recovrery structure
- */
-int
-heap_rv_redo_update (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
-{
-  return heap_rv_undoredo_update (thread_p, rcv);
 }
 
 /*
- * heap_rv_undoredo_update () - Recover an update either for undo or redo
+ * heap_rv_mvcc_undo_delete () - Undo the MVCC deletion of an object
  *   return: int
  *   rcv(in): Recovery structure
  */
 int
-heap_rv_undoredo_update (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+heap_rv_mvcc_undo_delete (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
   INT16 slotid;
-  RECDES recdes;
-  int sp_success;
+  MVCC_REC_HEADER mvcc_rec_header;
+  char data_buffer[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  RECDES rebuild_record;
 
   slotid = rcv->offset;
   slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
   assert (slotid > 0);
 
-  recdes.type = *(INT16 *) (rcv->data);
-  recdes.data = (char *) (rcv->data) + sizeof (recdes.type);
-  recdes.area_size = recdes.length = rcv->length - sizeof (recdes.type);
-  if (recdes.area_size <= 0)
+  rebuild_record.data = PTR_ALIGN (data_buffer, MAX_ALIGNMENT);
+  rebuild_record.area_size = DB_PAGESIZE;
+  if (spage_get_record (thread_p, rcv->pgptr, slotid, &rebuild_record, COPY) != S_SUCCESS)
     {
-      sp_success = SP_SUCCESS;
+      assert_release (false);
+      return ER_FAILED;
     }
-  else
+  assert (rebuild_record.type == REC_HOME || rebuild_record.type == REC_NEWHOME);
+
+  if (or_mvcc_get_header (&rebuild_record, &mvcc_rec_header) != NO_ERROR)
     {
-      if (heap_update_physical (thread_p, rcv->pgptr, slotid, &recdes) != NO_ERROR)
-	{
-	  assert_release (false);
-	  return ER_FAILED;
-	}
+      assert_release (false);
+      return ER_FAILED;
+    }
+  assert (MVCC_IS_FLAG_SET (&mvcc_rec_header, OR_MVCC_FLAG_VALID_DELID));
+  MVCC_CLEAR_FLAG_BITS (&mvcc_rec_header, OR_MVCC_FLAG_VALID_DELID);
+
+  if (or_mvcc_set_header (&rebuild_record, &mvcc_rec_header) != NO_ERROR)
+    {
+      assert_release (false);
+      return ER_FAILED;
     }
 
+  if (spage_update (thread_p, rcv->pgptr, slotid, &rebuild_record) != SP_SUCCESS)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+
+  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
   return NO_ERROR;
 }
 
 /*
- * heap_rv_redo_reuse_page () - Redo the deletion of all objects in page for
- *                              reuse purposes
- *   return: int
- *   rcv(in): Recovery structure
+ * heap_rv_mvcc_undo_delete_overflow () - Undo MVCC delete of an overflow
+ *					  record.
+ *
+ * return	 : Error code.
+ * thread_p (in) : Thread entry.
+ * rcv (in)	 : Recovery data.
  */
 int
-heap_rv_redo_reuse_page (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+heap_rv_mvcc_undo_delete_overflow (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
-  VPID vpid;
-  RECDES recdes;
-  HEAP_CHAIN *chain;		/* Chain to next and prev page */
-  int sp_success;
-  const bool is_header_page = ((rcv->offset != 0) ? true : false);
+  MVCC_REC_HEADER mvcc_header;
 
-  (void) pgbuf_check_page_ptype (thread_p, rcv->pgptr, PAGE_HEAP);
+  if (heap_get_mvcc_rec_header_from_overflow (rcv->pgptr, &mvcc_header, NULL) != NO_ERROR)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
 
-  vpid.volid = pgbuf_get_volume_id (rcv->pgptr);
-  vpid.pageid = pgbuf_get_page_id (rcv->pgptr);
+  /* All flags should be set. Overflow header should be set to maximum size */
+  assert (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_DELID));
+  assert (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_PREV_VERSION));
 
-  /* We ignore the return value. It should be true (objects were deleted) except for the scenario when the redo actions
-   * are applied twice. */
-  (void) heap_delete_all_page_records (thread_p, &vpid, rcv->pgptr);
+  MVCC_SET_DELID (&mvcc_header, MVCCID_NULL);
 
-  /* At here, do not consider the header of heap. Later redo the update of the header of heap at RVHF_STATS log. */
-  if (!is_header_page)
+  /* Change header. */
+  if (heap_set_mvcc_rec_header_on_overflow (rcv->pgptr, &mvcc_header) != NO_ERROR)
     {
-      sp_success = spage_get_record (thread_p, rcv->pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK);
-      if (sp_success != SP_SUCCESS)
-	{
-	  /* something went wrong. Unable to redo update class_oid */
-	  if (sp_success != SP_ERROR)
-	    {
-	      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
-	    }
-	  assert (er_errid () != NO_ERROR);
-	  return er_errid ();
-	}
-
-      chain = (HEAP_CHAIN *) recdes.data;
-      COPY_OID (&(chain->class_oid), (OID *) (rcv->data));
-      chain->max_mvccid = MVCCID_NULL;
-      chain->flags = 0;
-      HEAP_PAGE_SET_VACUUM_STATUS (chain, HEAP_PAGE_VACUUM_NONE);
+      assert_release (false);
+      return ER_FAILED;
     }
 
   pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
-
   return NO_ERROR;
 }
 
 /*
- * heap_rv_redo_reuse_page_reuse_oid () - Redo the deletion of all objects in
- *                                        a reusable oid heap page for reuse
- *                                        purposes
- *   return: int
- *   rcv(in): Recovery structure
+ * heap_rv_mvcc_redo_delete_internal () - Internal function to be used by
+ *					  heap_rv_mvcc_redo_delete_home and
+ *					  heap_rv_mvcc_redo_delete_newhome.
+ *
+ * return	      : Error code.
+ * thread_p (in)      : Thread entry.
+ * page (in)	      : Heap page.
+ * slotid (in)	      : Recovered record slotid.
+ * mvccid (in)	      : Delete MVCCID.
  */
-int
-heap_rv_redo_reuse_page_reuse_oid (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+static int
+heap_rv_mvcc_redo_delete_internal (THREAD_ENTRY * thread_p, PAGE_PTR page, PGSLOTID slotid, MVCCID mvccid)
 {
-  RECDES recdes;
-  HEAP_CHAIN *chain;		/* Chain to next and prev page */
-  int sp_success;
-  const bool is_header_page = ((rcv->offset != 0) ? true : false);
+  RECDES rebuild_record;
+  char data_buffer[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  MVCC_REC_HEADER mvcc_rec_header;
 
-  (void) heap_reinitialize_page (thread_p, rcv->pgptr, is_header_page);
+  assert (page != NULL);
+  assert (MVCCID_IS_NORMAL (mvccid));
 
-  (void) pgbuf_set_page_ptype (thread_p, rcv->pgptr, PAGE_HEAP);
+  rebuild_record.data = PTR_ALIGN (data_buffer, MAX_ALIGNMENT);
+  rebuild_record.area_size = DB_PAGESIZE;
 
-  /* At here, do not consider the header of heap. Later redo the update of the header of heap at RVHF_STATS log. */
-  if (!is_header_page)
+  /* Get record. */
+  if (spage_get_record (thread_p, page, slotid, &rebuild_record, COPY) != S_SUCCESS)
     {
-      sp_success = spage_get_record (thread_p, rcv->pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK);
-      if (sp_success != SP_SUCCESS)
-	{
-	  /* something went wrong. Unable to redo update class_oid */
-	  if (sp_success != SP_ERROR)
-	    {
-	      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
-	    }
-	  assert (er_errid () != NO_ERROR);
-	  return er_errid ();
-	}
+      assert_release (false);
+      return ER_FAILED;
+    }
 
-      chain = (HEAP_CHAIN *) recdes.data;
-      COPY_OID (&(chain->class_oid), (OID *) (rcv->data));
-      chain->max_mvccid = MVCCID_NULL;
-      chain->flags = 0;
-      HEAP_PAGE_SET_VACUUM_STATUS (chain, HEAP_PAGE_VACUUM_NONE);
+  /* Get MVCC header. */
+  if (or_mvcc_get_header (&rebuild_record, &mvcc_rec_header) != NO_ERROR)
+    {
+      assert_release (false);
+      return ER_FAILED;
     }
 
-  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+  /* Set delete MVCCID. */
+  MVCC_SET_FLAG_BITS (&mvcc_rec_header, OR_MVCC_FLAG_VALID_DELID);
+  MVCC_SET_DELID (&mvcc_rec_header, mvccid);
+
+  /* Change header. */
+  if (or_mvcc_set_header (&rebuild_record, &mvcc_rec_header) != NO_ERROR)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+
+  /* Update record in page. */
+  if (spage_update (thread_p, page, slotid, &rebuild_record) != SP_SUCCESS)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
 
+  /* Success. */
   return NO_ERROR;
 }
 
 /*
- * heap_rv_dump_reuse_page () - Dump reuse page
- *   return: int
- *   ignore_length(in): Length of Recovery Data
- *   ignore_data(in): The data being logged
+ * heap_rv_mvcc_redo_delete_home () - Redo MVCC delete of REC_HOME record.
  *
- * Note: Dump information about reuse of page.
- */
-void
-heap_rv_dump_reuse_page (FILE * fp, int ignore_length, void *ignore_data)
-{
-  fprintf (fp, "Delete all objects in page for reuse purposes of page\n");
-}
-
-/*
- * xheap_get_class_num_objects_pages () -
- *   return: NO_ERROR
- *   hfid(in):
- *   approximation(in):
- *   nobjs(in):
- *   npages(in):
+ * return	 : Error code
+ * thread_p (in) : Thread entry.
+ * rcv (in)	 : Recovery data.
  */
 int
-xheap_get_class_num_objects_pages (THREAD_ENTRY * thread_p, const HFID * hfid, int approximation, int *nobjs,
-				   int *npages)
+heap_rv_mvcc_redo_delete_home (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
-  int length, num;
-  int ret;
+  int error_code = NO_ERROR;
+  int offset = 0;
+  PGSLOTID slotid;
+  bool vacuum_status_change = false;
 
-  assert (!HFID_IS_NULL (hfid));
+  assert (rcv->pgptr != NULL);
+  assert (MVCCID_IS_NORMAL (rcv->mvcc_id));
 
-  if (approximation)
-    {
-      num = heap_estimate (thread_p, hfid, npages, nobjs, &length);
-    }
-  else
+  slotid = rcv->offset;
+  if (slotid & HEAP_RV_FLAG_VACUUM_STATUS_CHANGE)
     {
-      num = heap_get_num_objects (thread_p, hfid, npages, nobjs, &length);
+      vacuum_status_change = true;
     }
+  slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
+  assert (slotid > 0);
 
-  if (num < 0)
+  assert (offset == rcv->length);
+
+  error_code = heap_rv_mvcc_redo_delete_internal (thread_p, rcv->pgptr, slotid, rcv->mvcc_id);
+  if (error_code != NO_ERROR)
     {
-      return (((ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret);
+      ASSERT_ERROR ();
+      return error_code;
     }
+  heap_page_rv_chain_update (thread_p, rcv->pgptr, rcv->mvcc_id, vacuum_status_change);
 
+  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
   return NO_ERROR;
 }
 
 /*
- * xheap_has_instance () -
- *   return:
- *   hfid(in):
- *   class_oid(in):
- *   has_visible_instance(in): true if we need to check for a visible record
+ * heap_rv_mvcc_redo_delete_overflow () - Redo MVCC delete of overflow record.
+ *
+ * return	 : Error code
+ * thread_p (in) : Thread entry.
+ * rcv (in)	 : Recovery data.
  */
 int
-xheap_has_instance (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, int has_visible_instance)
+heap_rv_mvcc_redo_delete_overflow (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
-  OID oid;
-  HEAP_SCANCACHE scan_cache;
-  RECDES recdes;
-  SCAN_CODE r;
-  MVCC_SNAPSHOT *mvcc_snapshot = NULL;
+  int offset = 0;
+  MVCCID mvccid;
+  MVCC_REC_HEADER mvcc_header;
 
-  OID_SET_NULL (&oid);
+  assert (rcv->pgptr != NULL);
 
-  if (has_visible_instance)
-    {
-      mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
-      if (mvcc_snapshot == NULL)
-	{
-	  return ER_FAILED;
-	}
-    }
-  if (heap_scancache_start (thread_p, &scan_cache, hfid, class_oid, true, false, mvcc_snapshot) != NO_ERROR)
+  OR_GET_MVCCID (rcv->data + offset, &mvccid);
+  offset += OR_MVCCID_SIZE;
+
+  assert (offset == rcv->length);
+
+  if (heap_get_mvcc_rec_header_from_overflow (rcv->pgptr, &mvcc_header, NULL) != NO_ERROR)
     {
+      assert_release (false);
       return ER_FAILED;
     }
+  assert (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_INSID));
 
-  recdes.data = NULL;
-  r = heap_first (thread_p, hfid, class_oid, &oid, &recdes, &scan_cache, true);
-  heap_scancache_end (thread_p, &scan_cache);
+  assert (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_DELID));
+  MVCC_SET_DELID (&mvcc_header, mvccid);
 
-  if (r == S_ERROR)
+  /* Update MVCC header. */
+  if (heap_set_mvcc_rec_header_on_overflow (rcv->pgptr, &mvcc_header) != NO_ERROR)
     {
+      assert_release (false);
       return ER_FAILED;
     }
-  else if (r == S_DOESNT_EXIST || r == S_END)
-    {
-      return 0;
-    }
-  else
-    {
-      return 1;
-    }
+
+  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+  return NO_ERROR;
 }
 
 /*
- * heap_get_class_repr_id () -
- *   return:
- *   class_oid(in):
- */
-REPR_ID
-heap_get_class_repr_id (THREAD_ENTRY * thread_p, OID * class_oid)
-{
-  OR_CLASSREP *rep = NULL;
-  REPR_ID id;
-  int idx_incache = -1;
+ * heap_rv_mvcc_redo_delete_newhome () - Redo MVCC delete of REC_NEWHOME
+ *					 record.
+ *
+ * return	 : Error code
+ * thread_p (in) : Thread entry.
+ * rcv (in)	 : Recovery data.
+ */
+int
+heap_rv_mvcc_redo_delete_newhome (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+{
+  int error_code = NO_ERROR;
+  int offset = 0;
+  MVCCID mvccid;
 
-  if (!class_oid || !idx_incache)
-    {
-      return 0;
-    }
+  assert (rcv->pgptr != NULL);
 
-  rep = heap_classrepr_get (thread_p, class_oid, NULL, NULL_REPRID, &idx_incache);
-  if (rep == NULL)
+  OR_GET_MVCCID (rcv->data + offset, &mvccid);
+  offset += OR_MVCCID_SIZE;
+
+  assert (offset == rcv->length);
+
+  error_code = heap_rv_mvcc_redo_delete_internal (thread_p, rcv->pgptr, rcv->offset, mvccid);
+  if (error_code != NO_ERROR)
     {
-      return 0;
+      ASSERT_ERROR ();
+      return error_code;
     }
 
-  id = rep->id;
-  heap_classrepr_free_and_init (rep, &idx_incache);
+  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+  return NO_ERROR;
+}
 
-  return id;
+/*
+ * heap_rv_redo_mark_reusable_slot () - Marks a deleted slot as reusable; used
+ *                                      as a postponed log operation and a
+ *                                      REDO function
+ *   return: int
+ *   rcv(in): Recovery structure
+ *
+ * Note: Mark (during postponed operation execution)/Redo (during recovery)
+ *       the marking of a deleted slot as reusable.
+ */
+int
+heap_rv_redo_mark_reusable_slot (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+{
+  INT16 slotid;
+
+  slotid = rcv->offset;
+  (void) spage_mark_deleted_slot_as_reusable (thread_p, rcv->pgptr, slotid);
+  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
+
+  return NO_ERROR;
 }
 
 /*
- * heap_set_autoincrement_value () -
- *   return: NO_ERROR, or ER_code
- *   attr_info(in):
- *   scan_cache(in):
- *   is_set(out): 1 if at least one autoincrement value has been set
+ * heap_rv_undo_delete () - Undo the deletion of an object
+ *   return: int
+ *   rcv(in): Recovery structure
  */
 int
-heap_set_autoincrement_value (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info, HEAP_SCANCACHE * scan_cache,
-			      int *is_set)
+heap_rv_undo_delete (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 {
-  int i, idx_in_cache;
-  char *classname = NULL;
-  char *attr_name = NULL;
-  RECDES recdes;		/* Used to obtain attribute name */
-  char serial_name[AUTO_INCREMENT_SERIAL_NAME_MAX_LENGTH];
-  HEAP_ATTRVALUE *value;
-  DB_VALUE dbvalue_numeric, *dbvalue, key_val;
-  OR_ATTRIBUTE *att;
-  OID serial_class_oid;
-  LC_FIND_CLASSNAME status;
-  OR_CLASSREP *classrep;
-  BTID serial_btid;
-  DB_DATA_STATUS data_stat;
-  HEAP_SCANCACHE local_scan_cache;
-  bool use_local_scan_cache = false;
-  int ret = NO_ERROR;
-  int alloced_string = 0;
-  char *string = NULL;
+  INT16 slotid;
+  INT16 recdes_type;
+  int error_code;
 
-  if (!attr_info || !scan_cache)
+  error_code = heap_rv_redo_insert (thread_p, rcv);
+  if (error_code != NO_ERROR)
     {
-      return ER_FAILED;
+      return error_code;
     }
 
-  *is_set = 0;
+  /* vacuum atomicity */
+  recdes_type = *(INT16 *) (rcv->data);
+  if (recdes_type == REC_NEWHOME)
+    {
+      slotid = rcv->offset;
+      slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
+      error_code = vacuum_rv_check_at_undo (thread_p, rcv->pgptr, slotid, recdes_type);
+      if (error_code != NO_ERROR)
+	{
+	  assert_release (false);
+	  return ER_FAILED;
+	}
+    }
 
-  recdes.data = NULL;
-  recdes.area_size = 0;
+  return NO_ERROR;
+}
 
-  for (i = 0; i < attr_info->num_values; i++)
+/*
+ * heap_rv_undo_update () - Undo the update of an object
+ *   return: int
+ *   rev(in): Recovery structure
+ */
+int
+heap_rv_undo_update (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+{
+  INT16 recdes_type;
+  int error_code;
+
+  error_code = heap_rv_undoredo_update (thread_p, rcv);
+  if (error_code != NO_ERROR)
     {
-      value = &attr_info->values[i];
-      dbvalue = &value->dbvalue;
-      att = &attr_info->last_classrepr->attributes[i];
+      ASSERT_ERROR ();
+      return error_code;
+    }
 
-      if (att->is_autoincrement && (value->state == HEAP_UNINIT_ATTRVALUE))
+  /* vacuum atomicity */
+  recdes_type = *(INT16 *) (rcv->data);
+  if (recdes_type == REC_HOME || recdes_type == REC_NEWHOME)
+    {
+      INT16 slotid;
+
+      slotid = rcv->offset;
+      slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
+      error_code = vacuum_rv_check_at_undo (thread_p, rcv->pgptr, slotid, recdes_type);
+      if (error_code != NO_ERROR)
 	{
-	  OID serial_obj_oid = att->auto_increment.serial_obj.load ().oid;
-	  if (OID_ISNULL (&serial_obj_oid))
-	    {
-	      memset (serial_name, '\0', sizeof (serial_name));
-	      recdes.data = NULL;
-	      recdes.area_size = 0;
+	  assert_release (false);
+	  return error_code;
+	}
+    }
 
-	      if (scan_cache->cache_last_fix_page == false)
-		{
-		  scan_cache = &local_scan_cache;
-		  (void) heap_scancache_quick_start_root_hfid (thread_p, scan_cache);
-		  use_local_scan_cache = true;
-		}
+  return NO_ERROR;
+}
 
-	      if (heap_get_class_record (thread_p, &(attr_info->class_oid), &recdes, scan_cache, PEEK) != S_SUCCESS)
-		{
-		  ret = ER_FAILED;
-		  goto exit_on_error;
-		}
+/*
+ * heap_rv_redo_update () - Redo the update of an object
+ *   return: int
+ *   rcv(in): Recovrery structure
+ */
+int
+heap_rv_redo_update (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+{
+  return heap_rv_undoredo_update (thread_p, rcv);
+}
 
-	      if (heap_get_class_name (thread_p, &(att->classoid), &classname) != NO_ERROR || classname == NULL)
-		{
-		  ASSERT_ERROR_AND_SET (ret);
-		  goto exit_on_error;
-		}
+/*
+ * heap_rv_undoredo_update () - Recover an update either for undo or redo
+ *   return: int
+ *   rcv(in): Recovery structure
+ */
+int
+heap_rv_undoredo_update (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+{
+  INT16 slotid;
+  RECDES recdes;
+  int sp_success;
 
-	      string = NULL;
-	      alloced_string = 0;
+  slotid = rcv->offset;
+  slotid = slotid & (~HEAP_RV_FLAG_VACUUM_STATUS_CHANGE);
+  assert (slotid > 0);
 
-	      ret = or_get_attrname (&recdes, att->id, &string, &alloced_string);
-	      if (ret != NO_ERROR)
-		{
-		  ASSERT_ERROR ();
-		  goto exit_on_error;
-		}
+  recdes.type = *(INT16 *) (rcv->data);
+  recdes.data = (char *) (rcv->data) + sizeof (recdes.type);
+  recdes.area_size = recdes.length = rcv->length - sizeof (recdes.type);
+  if (recdes.area_size <= 0)
+    {
+      sp_success = SP_SUCCESS;
+    }
+  else
+    {
+      if (heap_update_physical (thread_p, rcv->pgptr, slotid, &recdes) != NO_ERROR)
+	{
+	  assert_release (false);
+	  return ER_FAILED;
+	}
+    }
 
-	      attr_name = string;
-	      if (attr_name == NULL)
-		{
-		  ret = ER_FAILED;
-		  goto exit_on_error;
-		}
+  return NO_ERROR;
+}
 
-	      SET_AUTO_INCREMENT_SERIAL_NAME (serial_name, classname, attr_name);
+/*
+ * heap_rv_redo_reuse_page () - Redo the deletion of all objects in page for
+ *                              reuse purposes
+ *   return: int
+ *   rcv(in): Recovery structure
+ */
+int
+heap_rv_redo_reuse_page (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+{
+  VPID vpid;
+  RECDES recdes;
+  HEAP_CHAIN *chain;		/* Chain to next and prev page */
+  int sp_success;
+  const bool is_header_page = ((rcv->offset != 0) ? true : false);
 
-	      if (string != NULL && alloced_string == 1)
-		{
-		  db_private_free_and_init (thread_p, string);
-		}
+  (void) pgbuf_check_page_ptype (thread_p, rcv->pgptr, PAGE_HEAP);
 
-	      free_and_init (classname);
+  vpid.volid = pgbuf_get_volume_id (rcv->pgptr);
+  vpid.pageid = pgbuf_get_page_id (rcv->pgptr);
 
-	      if (db_make_varchar (&key_val, DB_MAX_IDENTIFIER_LENGTH, serial_name, (int) strlen (serial_name),
-				   LANG_SYS_CODESET, LANG_SYS_COLLATION) != NO_ERROR)
-		{
-		  ret = ER_FAILED;
-		  goto exit_on_error;
-		}
+  /* We ignore the return value. It should be true (objects were deleted) except for the scenario when the redo actions
+   * are applied twice. */
+  (void) heap_delete_all_page_records (thread_p, &vpid, rcv->pgptr);
 
-	      status = xlocator_find_class_oid (thread_p, CT_SERIAL_NAME, &serial_class_oid, NULL_LOCK);
-	      if (status == LC_CLASSNAME_ERROR || status == LC_CLASSNAME_DELETED)
-		{
-		  ret = ER_FAILED;
-		  goto exit_on_error;
-		}
+  /* At here, do not consider the header of heap. Later redo the update of the header of heap at RVHF_STATS log. */
+  if (!is_header_page)
+    {
+      sp_success = spage_get_record (thread_p, rcv->pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK);
+      if (sp_success != SP_SUCCESS)
+	{
+	  /* something went wrong. Unable to redo update class_oid */
+	  if (sp_success != SP_ERROR)
+	    {
+	      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	    }
+	  assert (er_errid () != NO_ERROR);
+	  return er_errid ();
+	}
 
-	      classrep = heap_classrepr_get (thread_p, &serial_class_oid, NULL, NULL_REPRID, &idx_in_cache);
-	      if (classrep == NULL)
-		{
-		  ret = ER_FAILED;
-		  goto exit_on_error;
-		}
+      chain = (HEAP_CHAIN *) recdes.data;
+      COPY_OID (&(chain->class_oid), (OID *) (rcv->data));
+      chain->max_mvccid = MVCCID_NULL;
+      chain->flags = 0;
+      HEAP_PAGE_SET_VACUUM_STATUS (chain, HEAP_PAGE_VACUUM_NONE);
+    }
 
-	      if (classrep->indexes)
-		{
-		  BTREE_SEARCH search_result;
-		  OID serial_oid;
+  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
 
-		  BTID_COPY (&serial_btid, &(classrep->indexes[0].btid));
-		  search_result =
-		    xbtree_find_unique (thread_p, &serial_btid, S_SELECT, &key_val, &serial_class_oid, &serial_oid,
-					false);
-		  heap_classrepr_free_and_init (classrep, &idx_in_cache);
-		  if (search_result != BTREE_KEY_FOUND)
-		    {
-		      ret = ER_FAILED;
-		      goto exit_on_error;
-		    }
+  return NO_ERROR;
+}
 
-		  assert (!OID_ISNULL (&serial_oid));
-		  or_aligned_oid null_aligned_oid = { oid_Null_oid };
-		  or_aligned_oid serial_aligned_oid = { serial_oid };
-		  att->auto_increment.serial_obj.compare_exchange_strong (null_aligned_oid, serial_aligned_oid);
-		}
-	      else
-		{
-		  heap_classrepr_free_and_init (classrep, &idx_in_cache);
-		  ret = ER_FAILED;
-		  goto exit_on_error;
-		}
-	    }
+/*
+ * heap_rv_redo_reuse_page_reuse_oid () - Redo the deletion of all objects in
+ *                                        a reusable oid heap page for reuse
+ *                                        purposes
+ *   return: int
+ *   rcv(in): Recovery structure
+ */
+int
+heap_rv_redo_reuse_page_reuse_oid (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
+{
+  RECDES recdes;
+  HEAP_CHAIN *chain;		/* Chain to next and prev page */
+  int sp_success;
+  const bool is_header_page = ((rcv->offset != 0) ? true : false);
 
-	  if ((att->type == DB_TYPE_SHORT) || (att->type == DB_TYPE_INTEGER) || (att->type == DB_TYPE_BIGINT))
-	    {
-	      OID serial_obj_oid = att->auto_increment.serial_obj.load ().oid;
-	      if (xserial_get_next_value (thread_p, &dbvalue_numeric, &serial_obj_oid, 0,	/* no cache */
-					  1,	/* generate one value */
-					  GENERATE_AUTO_INCREMENT, false) != NO_ERROR)
-		{
-		  ret = ER_FAILED;
-		  goto exit_on_error;
-		}
+  (void) heap_reinitialize_page (thread_p, rcv->pgptr, is_header_page);
 
-	      if (numeric_db_value_coerce_from_num (&dbvalue_numeric, dbvalue, &data_stat) != NO_ERROR)
-		{
-		  ret = ER_FAILED;
-		  goto exit_on_error;
-		}
-	    }
-	  else if (att->type == DB_TYPE_NUMERIC)
+  (void) pgbuf_set_page_ptype (thread_p, rcv->pgptr, PAGE_HEAP);
+
+  /* At here, do not consider the header of heap. Later redo the update of the header of heap at RVHF_STATS log. */
+  if (!is_header_page)
+    {
+      sp_success = spage_get_record (thread_p, rcv->pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK);
+      if (sp_success != SP_SUCCESS)
+	{
+	  /* something went wrong. Unable to redo update class_oid */
+	  if (sp_success != SP_ERROR)
 	    {
-	      OID serial_obj_oid = att->auto_increment.serial_obj.load ().oid;
-	      if (xserial_get_next_value (thread_p, dbvalue, &serial_obj_oid, 0,	/* no cache */
-					  1,	/* generate one value */
-					  GENERATE_AUTO_INCREMENT, false) != NO_ERROR)
-		{
-		  ret = ER_FAILED;
-		  goto exit_on_error;
-		}
+	      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
 	    }
-
-	  *is_set = 1;
-	  value->state = HEAP_READ_ATTRVALUE;
+	  assert (er_errid () != NO_ERROR);
+	  return er_errid ();
 	}
-    }
 
-  if (use_local_scan_cache)
-    {
-      heap_scancache_end (thread_p, scan_cache);
+      chain = (HEAP_CHAIN *) recdes.data;
+      COPY_OID (&(chain->class_oid), (OID *) (rcv->data));
+      chain->max_mvccid = MVCCID_NULL;
+      chain->flags = 0;
+      HEAP_PAGE_SET_VACUUM_STATUS (chain, HEAP_PAGE_VACUUM_NONE);
     }
 
-  return ret;
-
-exit_on_error:
-  if (classname != NULL)
-    {
-      free_and_init (classname);
-    }
+  pgbuf_set_dirty (thread_p, rcv->pgptr, DONT_FREE);
 
-  if (use_local_scan_cache)
-    {
-      heap_scancache_end (thread_p, scan_cache);
-    }
-  return ret;
+  return NO_ERROR;
 }
 
 /*
- * heap_attrinfo_set_uninitialized_global () -
- *   return: NO_ERROR
- *   inst_oid(in):
- *   recdes(in):
- *   attr_info(in):
+ * heap_rv_dump_reuse_page () - Dump reuse page
+ *   return: int
+ *   ignore_length(in): Length of Recovery Data
+ *   ignore_data(in): The data being logged
+ *
+ * Note: Dump information about reuse of page.
  */
-int
-heap_attrinfo_set_uninitialized_global (THREAD_ENTRY * thread_p, OID * inst_oid, RECDES * recdes,
-					HEAP_CACHE_ATTRINFO * attr_info)
+void
+heap_rv_dump_reuse_page (FILE * fp, int ignore_length, void *ignore_data)
 {
-  if (attr_info == NULL)
-    {
-      return ER_FAILED;
-    }
-
-  return heap_attrinfo_set_uninitialized (thread_p, inst_oid, recdes, attr_info);
+  fprintf (fp, "Delete all objects in page for reuse purposes of page\n");
 }
 
 /*
- * heap_get_class_info () - get HFID and file type for class.
- *
- * return             : error code
- * thread_p (in)      : thread entry
- * class_oid (in)     : class OID
- * hfid_out (out)     : output heap file identifier
- * ftype_out (out)    : output heap file type
- * classname_out (out): output classname
+ * xheap_get_class_num_objects_pages () -
+ *   return: NO_ERROR
+ *   hfid(in):
+ *   approximation(in):
+ *   nobjs(in):
+ *   npages(in):
  */
 int
-heap_get_class_info (THREAD_ENTRY * thread_p, const OID * class_oid, HFID * hfid_out,
-		     FILE_TYPE * ftype_out, char **classname_out)
+xheap_get_class_num_objects_pages (THREAD_ENTRY * thread_p, const HFID * hfid, int approximation, int *nobjs,
+				   int *npages)
 {
-  int error_code = NO_ERROR;
+  int length, num;
+  int ret;
 
-  error_code = heap_hfid_cache_get (thread_p, class_oid, hfid_out, ftype_out, classname_out);
-  if (error_code != NO_ERROR)
+  assert (!HFID_IS_NULL (hfid));
+
+  if (approximation)
     {
-      ASSERT_ERROR_AND_SET (error_code);
-      return error_code;
+      num = heap_estimate (thread_p, hfid, npages, nobjs, &length);
+    }
+  else
+    {
+      num = heap_get_num_objects (thread_p, hfid, npages, nobjs, &length);
     }
 
-  return error_code;
+  if (num < 0)
+    {
+      return (((ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret);
+    }
+
+  return NO_ERROR;
 }
 
 /*
- * heap_compact_pages () - compact all pages from hfid of specified class OID
- *   return: error_code
- *   class_oid(out):  the class oid
+ * xheap_has_instance () -
+ *   return:
+ *   hfid(in):
+ *   class_oid(in):
+ *   has_visible_instance(in): true if we need to check for a visible record
  */
 int
-heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
+xheap_has_instance (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, int has_visible_instance)
 {
-  int ret = NO_ERROR;
-  VPID vpid;
-  VPID next_vpid;
-  LOG_DATA_ADDR addr;
-  HFID hfid;
-  PGBUF_WATCHER pg_watcher;
-  PGBUF_WATCHER old_pg_watcher;
+  OID oid;
+  HEAP_SCANCACHE scan_cache;
+  RECDES recdes;
+  SCAN_CODE r;
+  MVCC_SNAPSHOT *mvcc_snapshot = NULL;
 
-  if (class_oid == NULL)
+  OID_SET_NULL (&oid);
+
+  if (has_visible_instance)
     {
-      return ER_QPROC_INVALID_PARAMETER;
+      mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+      if (mvcc_snapshot == NULL)
+	{
+	  return ER_FAILED;
+	}
     }
-
-  if (lock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
+  if (heap_scancache_start (thread_p, &scan_cache, hfid, class_oid, true, false, mvcc_snapshot) != NO_ERROR)
     {
       return ER_FAILED;
     }
 
-  ret = heap_get_class_info (thread_p, class_oid, &hfid, NULL, NULL);
-  if (ret != NO_ERROR || HFID_IS_NULL (&hfid))
+  recdes.data = NULL;
+  r = heap_first (thread_p, hfid, class_oid, &oid, &recdes, &scan_cache, true);
+  heap_scancache_end (thread_p, &scan_cache);
+
+  if (r == S_ERROR)
     {
-      lock_unlock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, true);
-      return ret;
+      return ER_FAILED;
     }
-
-  PGBUF_INIT_WATCHER (&pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, &hfid);
-  PGBUF_INIT_WATCHER (&old_pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, &hfid);
-
-  addr.vfid = &hfid.vfid;
-  addr.pgptr = NULL;
-  addr.offset = 0;
-
-  vpid.volid = hfid.vfid.volid;
-  vpid.pageid = hfid.hpgid;
-
-  if (pgbuf_ordered_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_READ, &pg_watcher) != NO_ERROR)
+  else if (r == S_DOESNT_EXIST || r == S_END)
     {
-      lock_unlock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, true);
-      ret = ER_FAILED;
-      goto exit_on_error;
+      return 0;
     }
-
-  (void) pgbuf_check_page_ptype (thread_p, pg_watcher.pgptr, PAGE_HEAP);
-
-  lock_unlock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, true);
-
-  /* skip header page */
-  ret = heap_vpid_next (thread_p, &hfid, pg_watcher.pgptr, &next_vpid);
-  if (ret != NO_ERROR)
+  else
     {
-      goto exit_on_error;
+      return 1;
     }
-  pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
-
-  while (!VPID_ISNULL (&next_vpid))
-    {
-      vpid = next_vpid;
-      pg_watcher.pgptr =
-	heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, X_LOCK, NULL, &pg_watcher);
-      if (old_pg_watcher.pgptr != NULL)
-	{
-	  pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
-	}
-      if (pg_watcher.pgptr == NULL)
-	{
-	  ret = ER_FAILED;
-	  goto exit_on_error;
-	}
-
-      ret = heap_vpid_next (thread_p, &hfid, pg_watcher.pgptr, &next_vpid);
-      if (ret != NO_ERROR)
-	{
-	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
-	  goto exit_on_error;
-	}
-
-      if (spage_compact (thread_p, pg_watcher.pgptr) != NO_ERROR)
-	{
-	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
-	  ret = ER_FAILED;
-	  goto exit_on_error;
-	}
+}
 
-      addr.pgptr = pg_watcher.pgptr;
-      log_skip_logging (thread_p, &addr);
-      pgbuf_set_dirty (thread_p, pg_watcher.pgptr, DONT_FREE);
-      pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
-    }
+/*
+ * heap_get_class_repr_id () -
+ *   return:
+ *   class_oid(in):
+ */
+REPR_ID
+heap_get_class_repr_id (THREAD_ENTRY * thread_p, OID * class_oid)
+{
+  OR_CLASSREP *rep = NULL;
+  REPR_ID id;
+  int idx_incache = -1;
 
-  if (old_pg_watcher.pgptr != NULL)
+  if (!class_oid || !idx_incache)
     {
-      pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
+      return 0;
     }
-  assert (pg_watcher.pgptr == NULL);
-
-  return ret;
-
-exit_on_error:
 
-  if (pg_watcher.pgptr != NULL)
-    {
-      pgbuf_ordered_unfix (thread_p, &pg_watcher);
-    }
-  if (old_pg_watcher.pgptr != NULL)
+  rep = heap_classrepr_get (thread_p, class_oid, NULL, NULL_REPRID, &idx_incache);
+  if (rep == NULL)
     {
-      pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
+      return 0;
     }
 
-  return ret;
+  id = rep->id;
+  heap_classrepr_free_and_init (rep, &idx_incache);
+
+  return id;
 }
 
 /*
- * heap_classrepr_dump_all () - dump all representations belongs to a class
- *   return: none
- *   fp(in): file pointer to print out
- *   class_oid(in): class oid to be dumped
+ * heap_set_autoincrement_value () -
+ *   return: NO_ERROR, or ER_code
+ *   attr_info(in):
+ *   scan_cache(in):
+ *   is_set(out): 1 if at least one autoincrement value has been set
  */
-void
-heap_classrepr_dump_all (THREAD_ENTRY * thread_p, FILE * fp, OID * class_oid)
+int
+heap_set_autoincrement_value (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info, HEAP_SCANCACHE * scan_cache,
+			      int *is_set)
 {
-  RECDES peek_recdes;
-  HEAP_SCANCACHE scan_cache;
-  OR_CLASSREP **rep_all;
-  int count, i;
-  char *classname;
-  bool need_free_classname = false;
+  int i, idx_in_cache;
+  char *classname = NULL;
+  char *attr_name = NULL;
+  RECDES recdes;		/* Used to obtain attribute name */
+  char serial_name[AUTO_INCREMENT_SERIAL_NAME_MAX_LENGTH];
+  HEAP_ATTRVALUE *value;
+  DB_VALUE dbvalue_numeric, *dbvalue, key_val;
+  OR_ATTRIBUTE *att;
+  OID serial_class_oid;
+  LC_FIND_CLASSNAME status;
+  OR_CLASSREP *classrep;
+  BTID serial_btid;
+  DB_DATA_STATUS data_stat;
+  HEAP_SCANCACHE local_scan_cache;
+  bool use_local_scan_cache = false;
+  int ret = NO_ERROR;
+  int alloced_string = 0;
+  char *string = NULL;
 
-  if (heap_get_class_name (thread_p, class_oid, &classname) != NO_ERROR || classname == NULL)
-    {
-      classname = (char *) "unknown";
-      er_clear ();
-    }
-  else
+  if (!attr_info || !scan_cache)
     {
-      need_free_classname = true;
+      return ER_FAILED;
     }
 
-  heap_scancache_quick_start_root_hfid (thread_p, &scan_cache);
+  *is_set = 0;
 
-  if (heap_get_class_record (thread_p, class_oid, &peek_recdes, &scan_cache, PEEK) == S_SUCCESS)
+  recdes.data = NULL;
+  recdes.area_size = 0;
+
+  for (i = 0; i < attr_info->num_values; i++)
     {
-      rep_all = or_get_all_representation (&peek_recdes, true, &count);
-      fprintf (fp, "*** Dumping representations of class %s\n    Classname = %s, Class-OID = %d|%d|%d, #Repr = %d\n",
-	       classname, classname, (int) class_oid->volid, class_oid->pageid, (int) class_oid->slotid, count);
+      value = &attr_info->values[i];
+      dbvalue = &value->dbvalue;
+      att = &attr_info->last_classrepr->attributes[i];
 
-      for (i = 0; i < count; i++)
+      if (att->is_autoincrement && (value->state == HEAP_UNINIT_ATTRVALUE))
 	{
-	  assert (rep_all[i] != NULL);
-	  heap_classrepr_dump (thread_p, fp, class_oid, rep_all[i]);
-	  or_free_classrep (rep_all[i]);
-	}
+	  OID serial_obj_oid = att->auto_increment.serial_obj.load ().oid;
+	  if (OID_ISNULL (&serial_obj_oid))
+	    {
+	      memset (serial_name, '\0', sizeof (serial_name));
+	      recdes.data = NULL;
+	      recdes.area_size = 0;
 
-      fprintf (fp, "\n*** End of dump.\n");
-      free_and_init (rep_all);
-    }
+	      if (scan_cache->cache_last_fix_page == false)
+		{
+		  scan_cache = &local_scan_cache;
+		  (void) heap_scancache_quick_start_root_hfid (thread_p, scan_cache);
+		  use_local_scan_cache = true;
+		}
 
-  heap_scancache_end (thread_p, &scan_cache);
+	      if (heap_get_class_record (thread_p, &(attr_info->class_oid), &recdes, scan_cache, PEEK) != S_SUCCESS)
+		{
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
 
-  if (need_free_classname)
-    {
-      free_and_init (classname);
-    }
-}
+	      if (heap_get_class_name (thread_p, &(att->classoid), &classname) != NO_ERROR || classname == NULL)
+		{
+		  ASSERT_ERROR_AND_SET (ret);
+		  goto exit_on_error;
+		}
 
-/*
- * heap_get_btid_from_index_name () - gets the BTID of an index using its name
- *				      and OID of class
- *
- *   return: NO_ERROR, or error code
- *   thread_p(in)   : thread context
- *   p_class_oid(in): OID of class
- *   index_name(in) : name of index
- *   p_found_btid(out): the BTREE ID of index
- *
- *  Note : the 'p_found_btid' argument must be a pointer to a BTID value,
- *	   the found BTID is 'BTID_COPY-ed' into it.
- *	   Null arguments are not allowed.
- *	   If an index name is not found, the 'p_found_btid' is returned as
- *	   NULL BTID and no error is set.
- *
- */
-int
-heap_get_btid_from_index_name (THREAD_ENTRY * thread_p, const OID * p_class_oid, const char *index_name,
-			       BTID * p_found_btid)
-{
-  int error = NO_ERROR;
-  int classrepr_cacheindex = -1;
-  int idx_cnt;
-  OR_CLASSREP *classrepr = NULL;
-  OR_INDEX *curr_index = NULL;
+	      string = NULL;
+	      alloced_string = 0;
 
-  assert (p_found_btid != NULL);
-  assert (p_class_oid != NULL);
-  assert (index_name != NULL);
+	      ret = or_get_attrname (&recdes, att->id, &string, &alloced_string);
+	      if (ret != NO_ERROR)
+		{
+		  ASSERT_ERROR ();
+		  goto exit_on_error;
+		}
 
-  BTID_SET_NULL (p_found_btid);
+	      attr_name = string;
+	      if (attr_name == NULL)
+		{
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
 
-  /* get the BTID associated from the index name : the only structure containing this info is OR_CLASSREP */
+	      SET_AUTO_INCREMENT_SERIAL_NAME (serial_name, classname, attr_name);
 
-  /* get class representation */
-  classrepr = heap_classrepr_get (thread_p, (OID *) p_class_oid, NULL, NULL_REPRID, &classrepr_cacheindex);
+	      if (string != NULL && alloced_string == 1)
+		{
+		  db_private_free_and_init (thread_p, string);
+		}
 
-  if (classrepr == NULL)
-    {
-      error = er_errid ();
-      if (error == NO_ERROR)
-	{
-	  assert (error != NO_ERROR);
-	  error = ER_FAILED;
-	}
-      goto exit;
-    }
+	      free_and_init (classname);
 
-  /* iterate through indexes looking for index name */
-  for (idx_cnt = 0, curr_index = classrepr->indexes; idx_cnt < classrepr->n_indexes; idx_cnt++, curr_index++)
-    {
-      if (curr_index == NULL)
-	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_UNEXPECTED, 1, "Bad index information in class representation.");
-	  error = ER_UNEXPECTED;
-	  goto exit_cleanup;
-	}
+	      if (db_make_varchar (&key_val, DB_MAX_IDENTIFIER_LENGTH, serial_name, (int) strlen (serial_name),
+				   LANG_SYS_CODESET, LANG_SYS_COLLATION) != NO_ERROR)
+		{
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
 
-      if (intl_identifier_casecmp (curr_index->btname, index_name) == 0)
-	{
-	  BTID_COPY (p_found_btid, &(curr_index->btid));
-	  break;
+	      status = xlocator_find_class_oid (thread_p, CT_SERIAL_NAME, &serial_class_oid, NULL_LOCK);
+	      if (status == LC_CLASSNAME_ERROR || status == LC_CLASSNAME_DELETED)
+		{
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
+
+	      classrep = heap_classrepr_get (thread_p, &serial_class_oid, NULL, NULL_REPRID, &idx_in_cache);
+	      if (classrep == NULL)
+		{
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
+
+	      if (classrep->indexes)
+		{
+		  BTREE_SEARCH search_result;
+		  OID serial_oid;
+
+		  BTID_COPY (&serial_btid, &(classrep->indexes[0].btid));
+		  search_result =
+		    xbtree_find_unique (thread_p, &serial_btid, S_SELECT, &key_val, &serial_class_oid, &serial_oid,
+					false);
+		  heap_classrepr_free_and_init (classrep, &idx_in_cache);
+		  if (search_result != BTREE_KEY_FOUND)
+		    {
+		      ret = ER_FAILED;
+		      goto exit_on_error;
+		    }
+
+		  assert (!OID_ISNULL (&serial_oid));
+		  or_aligned_oid null_aligned_oid = { oid_Null_oid };
+		  or_aligned_oid serial_aligned_oid = { serial_oid };
+		  att->auto_increment.serial_obj.compare_exchange_strong (null_aligned_oid, serial_aligned_oid);
+		}
+	      else
+		{
+		  heap_classrepr_free_and_init (classrep, &idx_in_cache);
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
+	    }
+
+	  if ((att->type == DB_TYPE_SHORT) || (att->type == DB_TYPE_INTEGER) || (att->type == DB_TYPE_BIGINT))
+	    {
+	      OID serial_obj_oid = att->auto_increment.serial_obj.load ().oid;
+	      if (xserial_get_next_value (thread_p, &dbvalue_numeric, &serial_obj_oid, 0,	/* no cache */
+					  1,	/* generate one value */
+					  GENERATE_AUTO_INCREMENT, false) != NO_ERROR)
+		{
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
+
+	      if (numeric_db_value_coerce_from_num (&dbvalue_numeric, dbvalue, &data_stat) != NO_ERROR)
+		{
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
+	    }
+	  else if (att->type == DB_TYPE_NUMERIC)
+	    {
+	      OID serial_obj_oid = att->auto_increment.serial_obj.load ().oid;
+	      if (xserial_get_next_value (thread_p, dbvalue, &serial_obj_oid, 0,	/* no cache */
+					  1,	/* generate one value */
+					  GENERATE_AUTO_INCREMENT, false) != NO_ERROR)
+		{
+		  ret = ER_FAILED;
+		  goto exit_on_error;
+		}
+	    }
+
+	  *is_set = 1;
+	  value->state = HEAP_READ_ATTRVALUE;
 	}
     }
 
-exit_cleanup:
-  if (classrepr)
+  if (use_local_scan_cache)
     {
-      heap_classrepr_free_and_init (classrepr, &classrepr_cacheindex);
+      heap_scancache_end (thread_p, scan_cache);
     }
 
-exit:
-  return error;
+  return ret;
+
+exit_on_error:
+  if (classname != NULL)
+    {
+      free_and_init (classname);
+    }
+
+  if (use_local_scan_cache)
+    {
+      heap_scancache_end (thread_p, scan_cache);
+    }
+  return ret;
 }
 
 /*
- * heap_object_upgrade_domain - upgrades a single attibute in an instance from
- *				the domain of current representation to the
- *				domain of the last representation.
- *
- *    return: error code , NO_ERROR if no error occured
- *    thread_p(in) : thread context
- *    upd_scancache(in): scan context
- *    attr_info(in): aatribute info structure
- *    oid(in): the oid of the object to process
- *    att_id(in): attribute id within the class (same as in schema)
+ * heap_attrinfo_set_uninitialized_global () -
+ *   return: NO_ERROR
+ *   inst_oid(in):
+ *   recdes(in):
+ *   attr_info(in):
+ */
+int
+heap_attrinfo_set_uninitialized_global (THREAD_ENTRY * thread_p, OID * inst_oid, RECDES * recdes,
+					HEAP_CACHE_ATTRINFO * attr_info)
+{
+  if (attr_info == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  return heap_attrinfo_set_uninitialized (thread_p, inst_oid, recdes, attr_info);
+}
+
+/*
+ * heap_get_class_info () - get HFID and file type for class.
  *
- *  Note : this function is used in ALTER CHANGE (with type change syntax)
+ * return             : error code
+ * thread_p (in)      : thread entry
+ * class_oid (in)     : class OID
+ * hfid_out (out)     : output heap file identifier
+ * ftype_out (out)    : output heap file type
+ * classname_out (out): output classname
  */
 int
-heap_object_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * upd_scancache, HEAP_CACHE_ATTRINFO * attr_info,
-			    OID * oid, const ATTR_ID att_id)
+heap_get_class_info (THREAD_ENTRY * thread_p, const OID * class_oid, HFID * hfid_out,
+		     FILE_TYPE * ftype_out, char **classname_out)
 {
-  int i = 0, error = NO_ERROR;
-  HEAP_ATTRVALUE *value = NULL;
-  int force_count = 0, updated_n_attrs_id = 0;
-  ATTR_ID atts_id[1] = { 0 };
-  DB_VALUE orig_value;
-  TP_DOMAIN_STATUS status;
+  int error_code = NO_ERROR;
 
-  db_make_null (&orig_value);
+  error_code = heap_hfid_cache_get (thread_p, class_oid, hfid_out, ftype_out, classname_out);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
 
-  if (upd_scancache == NULL || attr_info == NULL || oid == NULL)
+  return error_code;
+}
+
+/*
+ * heap_compact_pages () - compact all pages from hfid of specified class OID
+ *   return: error_code
+ *   class_oid(out):  the class oid
+ */
+int
+heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
+{
+  int ret = NO_ERROR;
+  VPID vpid;
+  VPID next_vpid;
+  LOG_DATA_ADDR addr;
+  HFID hfid;
+  PGBUF_WATCHER pg_watcher;
+  PGBUF_WATCHER old_pg_watcher;
+
+  if (class_oid == NULL)
     {
-      error = ER_UNEXPECTED;
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, "Unexpected NULL arguments.");
-      goto exit;
+      return ER_QPROC_INVALID_PARAMETER;
     }
 
-  for (i = 0, value = attr_info->values; i < attr_info->num_values; i++, value++)
+  if (lock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
     {
-      TP_DOMAIN *dest_dom = value->last_attrepr->domain;
-      bool log_warning = false;
-      int warning_code = NO_ERROR;
-      DB_TYPE dest_type;
-      DB_TYPE src_type = DB_VALUE_DOMAIN_TYPE (&(value->dbvalue));
-      int curr_prec = 0;
-      int dest_prec = 0;
+      return ER_FAILED;
+    }
 
-      dest_type = TP_DOMAIN_TYPE (dest_dom);
+  ret = heap_get_class_info (thread_p, class_oid, &hfid, NULL, NULL);
+  if (ret != NO_ERROR || HFID_IS_NULL (&hfid))
+    {
+      lock_unlock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, true);
+      return ret;
+    }
 
-      if (att_id != value->attrid)
-	{
-	  continue;
-	}
+  PGBUF_INIT_WATCHER (&pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, &hfid);
+  PGBUF_INIT_WATCHER (&old_pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, &hfid);
 
-      if (QSTR_IS_BIT (src_type))
-	{
-	  curr_prec = db_get_string_length (&(value->dbvalue));
-	}
-      else if (QSTR_IS_ANY_CHAR (src_type))
-	{
-	  if (TP_DOMAIN_CODESET (dest_dom) == INTL_CODESET_RAW_BYTES)
-	    {
-	      curr_prec = db_get_string_size (&(value->dbvalue));
-	    }
-	  else if (!DB_IS_NULL (&(value->dbvalue)))
-	    {
-	      curr_prec = db_get_string_length (&(value->dbvalue));
-	    }
-	  else
-	    {
-	      curr_prec = dest_dom->precision;
-	    }
-	}
+  addr.vfid = &hfid.vfid;
+  addr.pgptr = NULL;
+  addr.offset = 0;
 
-      dest_prec = dest_dom->precision;
+  vpid.volid = hfid.vfid.volid;
+  vpid.pageid = hfid.hpgid;
 
-      if (QSTR_IS_ANY_CHAR_OR_BIT (src_type) && QSTR_IS_ANY_CHAR_OR_BIT (dest_type))
-	{
-	  /* check phase of ALTER TABLE .. CHANGE should not allow changing the domains from one flavour to another : */
-	  assert ((QSTR_IS_ANY_CHAR (src_type) && QSTR_IS_ANY_CHAR (dest_type))
-		  || (!QSTR_IS_ANY_CHAR (src_type) && !QSTR_IS_ANY_CHAR (dest_type)));
+  if (pgbuf_ordered_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_READ, &pg_watcher) != NO_ERROR)
+    {
+      lock_unlock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, true);
+      ret = ER_FAILED;
+      goto exit_on_error;
+    }
 
-	  assert ((QSTR_IS_BIT (src_type) && QSTR_IS_BIT (dest_type))
-		  || (!QSTR_IS_BIT (src_type) && !QSTR_IS_BIT (dest_type)));
+  (void) pgbuf_check_page_ptype (thread_p, pg_watcher.pgptr, PAGE_HEAP);
 
-	  /* check string truncation */
-	  if (dest_prec < curr_prec)
-	    {
-	      if (prm_get_bool_value (PRM_ID_ALTER_TABLE_CHANGE_TYPE_STRICT) == true
-		  || prm_get_bool_value (PRM_ID_ALLOW_TRUNCATED_STRING) == false)
-		{
-		  error = ER_ALTER_CHANGE_TRUNC_OVERFLOW_NOT_ALLOWED;
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
-		  goto exit;
-		}
-	      else
-		{
-		  /* allow truncation in cast, just warning */
-		  log_warning = true;
-		  warning_code = ER_QPROC_SIZE_STRING_TRUNCATED;
-		}
-	    }
-	}
+  lock_unlock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, true);
 
-      error = pr_clone_value (&(value->dbvalue), &orig_value);
-      if (error != NO_ERROR)
+  /* skip header page */
+  ret = heap_vpid_next (thread_p, &hfid, pg_watcher.pgptr, &next_vpid);
+  if (ret != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+  pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
+
+  while (!VPID_ISNULL (&next_vpid))
+    {
+      vpid = next_vpid;
+      pg_watcher.pgptr =
+	heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, X_LOCK, NULL, &pg_watcher);
+      if (old_pg_watcher.pgptr != NULL)
 	{
-	  goto exit;
+	  pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
 	}
-
-      if (TP_IS_CHAR_TYPE (TP_DOMAIN_TYPE (dest_dom))
-	  && !(TP_IS_CHAR_TYPE (src_type) || src_type == DB_TYPE_ENUMERATION)
-	  && prm_get_bool_value (PRM_ID_ALTER_TABLE_CHANGE_TYPE_STRICT) == false
-	  && prm_get_bool_value (PRM_ID_ALLOW_TRUNCATED_STRING) == true)
+      if (pg_watcher.pgptr == NULL)
 	{
-	  /* If destination is char/varchar, we need to first cast the value to a string with no precision, then to
-	   * destination type with the desired precision. */
-	  TP_DOMAIN *string_dom;
-	  if (TP_DOMAIN_TYPE (dest_dom) == DB_TYPE_NCHAR || TP_DOMAIN_TYPE (dest_dom) == DB_TYPE_VARNCHAR)
-	    {
-	      string_dom = tp_domain_resolve_default (DB_TYPE_VARNCHAR);
-	    }
-	  else
-	    {
-	      string_dom = tp_domain_resolve_default (DB_TYPE_VARCHAR);
-	    }
-	  if ((status = tp_value_cast (&(value->dbvalue), &(value->dbvalue), string_dom, false)) != DOMAIN_COMPATIBLE)
-	    {
-	      error = tp_domain_status_er_set (status, ARG_FILE_LINE, &(value->dbvalue), string_dom);
-	    }
+	  ret = ER_FAILED;
+	  goto exit_on_error;
 	}
 
-      if (error == NO_ERROR)
+      ret = heap_vpid_next (thread_p, &hfid, pg_watcher.pgptr, &next_vpid);
+      if (ret != NO_ERROR)
 	{
-	  if ((status = tp_value_cast (&(value->dbvalue), &(value->dbvalue), dest_dom, false)) != DOMAIN_COMPATIBLE)
-	    {
-	      error = tp_domain_status_er_set (status, ARG_FILE_LINE, &(value->dbvalue), dest_dom);
-	    }
+	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
+	  goto exit_on_error;
 	}
-      if (error != NO_ERROR)
+
+      if (spage_compact (thread_p, pg_watcher.pgptr) != NO_ERROR)
 	{
-	  bool set_default_value = false;
-	  bool set_min_value = false;
-	  bool set_max_value = false;
+	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
+	  ret = ER_FAILED;
+	  goto exit_on_error;
+	}
 
-	  if (prm_get_bool_value (PRM_ID_ALTER_TABLE_CHANGE_TYPE_STRICT) == true
-	      || (TP_IS_CHAR_TYPE (TP_DOMAIN_TYPE (dest_dom))
-		  && prm_get_bool_value (PRM_ID_ALLOW_TRUNCATED_STRING) == false))
-	    {
-	      error = ER_ALTER_CHANGE_TRUNC_OVERFLOW_NOT_ALLOWED;
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
-	      goto exit;
-	    }
+      addr.pgptr = pg_watcher.pgptr;
+      log_skip_logging (thread_p, &addr);
+      pgbuf_set_dirty (thread_p, pg_watcher.pgptr, DONT_FREE);
+      pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
+    }
 
-	  if (error == ER_IT_DATA_OVERFLOW)
-	    {
-	      int is_positive = -1;	/* -1:UNKNOWN, 0:negative, 1:positive */
+  if (old_pg_watcher.pgptr != NULL)
+    {
+      pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
+    }
+  assert (pg_watcher.pgptr == NULL);
 
-	      /* determine sign of orginal value: */
-	      switch (src_type)
-		{
-		case DB_TYPE_INTEGER:
-		  is_positive = ((db_get_int (&value->dbvalue) >= 0) ? 1 : 0);
-		  break;
-		case DB_TYPE_SMALLINT:
-		  is_positive = ((db_get_short (&value->dbvalue) >= 0) ? 1 : 0);
-		  break;
-		case DB_TYPE_BIGINT:
-		  is_positive = ((db_get_bigint (&value->dbvalue) >= 0) ? 1 : 0);
-		  break;
-		case DB_TYPE_FLOAT:
-		  is_positive = ((db_get_float (&value->dbvalue) >= 0) ? 1 : 0);
-		  break;
-		case DB_TYPE_DOUBLE:
-		  is_positive = ((db_get_double (&value->dbvalue) >= 0) ? 1 : 0);
-		  break;
-		case DB_TYPE_NUMERIC:
-		  is_positive = numeric_db_value_is_positive (&value->dbvalue);
-		  break;
-		case DB_TYPE_MONETARY:
-		  is_positive = ((db_get_monetary (&value->dbvalue)->amount >= 0) ? 1 : 0);
-		  break;
+  return ret;
 
-		case DB_TYPE_CHAR:
-		case DB_TYPE_VARCHAR:
-		case DB_TYPE_NCHAR:
-		case DB_TYPE_VARNCHAR:
-		  {
-		    const char *str = db_get_string (&(value->dbvalue));
-		    const char *str_end = str + db_get_string_length (&(value->dbvalue));
-		    const char *p = NULL;
+exit_on_error:
 
-		    /* get the sign in the source string; look directly into the buffer string, no copy */
-		    p = str;
-		    while (char_isspace (*p) && p < str_end)
-		      {
-			p++;
-		      }
+  if (pg_watcher.pgptr != NULL)
+    {
+      pgbuf_ordered_unfix (thread_p, &pg_watcher);
+    }
+  if (old_pg_watcher.pgptr != NULL)
+    {
+      pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
+    }
 
-		    is_positive = ((p < str_end && (*p) == '-') ? 0 : 1);
-		    break;
-		  }
+  return ret;
+}
 
-		default:
-		  is_positive = -1;
-		  break;
-		}
+/*
+ * heap_classrepr_dump_all () - dump all representations belongs to a class
+ *   return: none
+ *   fp(in): file pointer to print out
+ *   class_oid(in): class oid to be dumped
+ */
+void
+heap_classrepr_dump_all (THREAD_ENTRY * thread_p, FILE * fp, OID * class_oid)
+{
+  RECDES peek_recdes;
+  HEAP_SCANCACHE scan_cache;
+  OR_CLASSREP **rep_all;
+  int count, i;
+  char *classname;
+  bool need_free_classname = false;
 
-	      if (is_positive == 1)
-		{
-		  set_max_value = true;
-		}
-	      else if (is_positive == 0)
-		{
-		  set_min_value = true;
-		}
-	      else
-		{
-		  set_default_value = true;
-		}
-	    }
-	  else
-	    {
-	      set_default_value = true;
-	    }
-	  /* clear the error */
-	  er_clear ();
+  if (heap_get_class_name (thread_p, class_oid, &classname) != NO_ERROR || classname == NULL)
+    {
+      classname = (char *) "unknown";
+      er_clear ();
+    }
+  else
+    {
+      need_free_classname = true;
+    }
 
-	  log_warning = true;
+  heap_scancache_quick_start_root_hfid (thread_p, &scan_cache);
 
-	  /* the casted value will be overwritten, so a clear is needed, here */
-	  pr_clear_value (&(value->dbvalue));
+  if (heap_get_class_record (thread_p, class_oid, &peek_recdes, &scan_cache, PEEK) == S_SUCCESS)
+    {
+      rep_all = or_get_all_representation (&peek_recdes, true, &count);
+      fprintf (fp, "*** Dumping representations of class %s\n    Classname = %s, Class-OID = %d|%d|%d, #Repr = %d\n",
+	       classname, classname, (int) class_oid->volid, class_oid->pageid, (int) class_oid->slotid, count);
 
-	  if (set_max_value)
-	    {
-	      /* set max value of destination domain */
-	      error =
-		db_value_domain_max (&(value->dbvalue), dest_type, dest_prec, dest_dom->scale, dest_dom->codeset,
-				     dest_dom->collation_id, &dest_dom->enumeration);
-	      if (error != NO_ERROR)
-		{
-		  /* this should not happen */
-		  goto exit;
-		}
+      for (i = 0; i < count; i++)
+	{
+	  assert (rep_all[i] != NULL);
+	  heap_classrepr_dump (thread_p, fp, class_oid, rep_all[i]);
+	  or_free_classrep (rep_all[i]);
+	}
 
-	      warning_code = ER_ALTER_CHANGE_CAST_FAILED_SET_MAX;
-	    }
-	  else if (set_min_value)
-	    {
-	      /* set min value of destination domain */
-	      error =
-		db_value_domain_min (&(value->dbvalue), dest_type, dest_prec, dest_dom->scale, dest_dom->codeset,
-				     dest_dom->collation_id, &dest_dom->enumeration);
-	      if (error != NO_ERROR)
-		{
-		  /* this should not happen */
-		  goto exit;
-		}
-	      warning_code = ER_ALTER_CHANGE_CAST_FAILED_SET_MIN;
-	    }
-	  else
-	    {
-	      assert (set_default_value == true);
+      fprintf (fp, "\n*** End of dump.\n");
+      free_and_init (rep_all);
+    }
 
-	      /* set default value of destination domain */
-	      error =
-		db_value_domain_default (&(value->dbvalue), dest_type, dest_prec, dest_dom->scale, dest_dom->codeset,
-					 dest_dom->collation_id, &dest_dom->enumeration);
-	      if (error != NO_ERROR)
-		{
-		  /* this should not happen */
-		  goto exit;
-		}
-	      warning_code = ER_ALTER_CHANGE_CAST_FAILED_SET_DEFAULT;
-	    }
+  heap_scancache_end (thread_p, &scan_cache);
+
+  if (need_free_classname)
+    {
+      free_and_init (classname);
+    }
+}
+
+/*
+ * heap_get_btid_from_index_name () - gets the BTID of an index using its name
+ *				      and OID of class
+ *
+ *   return: NO_ERROR, or error code
+ *   thread_p(in)   : thread context
+ *   p_class_oid(in): OID of class
+ *   index_name(in) : name of index
+ *   p_found_btid(out): the BTREE ID of index
+ *
+ *  Note : the 'p_found_btid' argument must be a pointer to a BTID value,
+ *	   the found BTID is 'BTID_COPY-ed' into it.
+ *	   Null arguments are not allowed.
+ *	   If an index name is not found, the 'p_found_btid' is returned as
+ *	   NULL BTID and no error is set.
+ *
+ */
+int
+heap_get_btid_from_index_name (THREAD_ENTRY * thread_p, const OID * p_class_oid, const char *index_name,
+			       BTID * p_found_btid)
+{
+  int error = NO_ERROR;
+  int classrepr_cacheindex = -1;
+  int idx_cnt;
+  OR_CLASSREP *classrepr = NULL;
+  OR_INDEX *curr_index = NULL;
+
+  assert (p_found_btid != NULL);
+  assert (p_class_oid != NULL);
+  assert (index_name != NULL);
+
+  BTID_SET_NULL (p_found_btid);
+
+  /* get the BTID associated from the index name : the only structure containing this info is OR_CLASSREP */
+
+  /* get class representation */
+  classrepr = heap_classrepr_get (thread_p, (OID *) p_class_oid, NULL, NULL_REPRID, &classrepr_cacheindex);
+
+  if (classrepr == NULL)
+    {
+      error = er_errid ();
+      if (error == NO_ERROR)
+	{
+	  assert (error != NO_ERROR);
+	  error = ER_FAILED;
+	}
+      goto exit;
+    }
+
+  /* iterate through indexes looking for index name */
+  for (idx_cnt = 0, curr_index = classrepr->indexes; idx_cnt < classrepr->n_indexes; idx_cnt++, curr_index++)
+    {
+      if (curr_index == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_UNEXPECTED, 1, "Bad index information in class representation.");
+	  error = ER_UNEXPECTED;
+	  goto exit_cleanup;
+	}
+
+      if (intl_identifier_casecmp (curr_index->btname, index_name) == 0)
+	{
+	  BTID_COPY (p_found_btid, &(curr_index->btid));
+	  break;
+	}
+    }
+
+exit_cleanup:
+  if (classrepr)
+    {
+      heap_classrepr_free_and_init (classrepr, &classrepr_cacheindex);
+    }
+
+exit:
+  return error;
+}
+
+/*
+ * heap_object_upgrade_domain - upgrades a single attibute in an instance from
+ *				the domain of current representation to the
+ *				domain of the last representation.
+ *
+ *    return: error code , NO_ERROR if no error occured
+ *    thread_p(in) : thread context
+ *    upd_scancache(in): scan context
+ *    attr_info(in): aatribute info structure
+ *    oid(in): the oid of the object to process
+ *    att_id(in): attribute id within the class (same as in schema)
+ *
+ *  Note : this function is used in ALTER CHANGE (with type change syntax)
+ */
+int
+heap_object_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * upd_scancache, HEAP_CACHE_ATTRINFO * attr_info,
+			    OID * oid, const ATTR_ID att_id)
+{
+  int i = 0, error = NO_ERROR;
+  HEAP_ATTRVALUE *value = NULL;
+  int force_count = 0, updated_n_attrs_id = 0;
+  ATTR_ID atts_id[1] = { 0 };
+  DB_VALUE orig_value;
+  TP_DOMAIN_STATUS status;
+
+  db_make_null (&orig_value);
+
+  if (upd_scancache == NULL || attr_info == NULL || oid == NULL)
+    {
+      error = ER_UNEXPECTED;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, "Unexpected NULL arguments.");
+      goto exit;
+    }
+
+  for (i = 0, value = attr_info->values; i < attr_info->num_values; i++, value++)
+    {
+      TP_DOMAIN *dest_dom = value->last_attrepr->domain;
+      bool log_warning = false;
+      int warning_code = NO_ERROR;
+      DB_TYPE dest_type;
+      DB_TYPE src_type = DB_VALUE_DOMAIN_TYPE (&(value->dbvalue));
+      int curr_prec = 0;
+      int dest_prec = 0;
+
+      dest_type = TP_DOMAIN_TYPE (dest_dom);
+
+      if (att_id != value->attrid)
+	{
+	  continue;
+	}
+
+      if (QSTR_IS_BIT (src_type))
+	{
+	  curr_prec = db_get_string_length (&(value->dbvalue));
+	}
+      else if (QSTR_IS_ANY_CHAR (src_type))
+	{
+	  if (TP_DOMAIN_CODESET (dest_dom) == INTL_CODESET_RAW_BYTES)
+	    {
+	      curr_prec = db_get_string_size (&(value->dbvalue));
+	    }
+	  else if (!DB_IS_NULL (&(value->dbvalue)))
+	    {
+	      curr_prec = db_get_string_length (&(value->dbvalue));
+	    }
+	  else
+	    {
+	      curr_prec = dest_dom->precision;
+	    }
+	}
+
+      dest_prec = dest_dom->precision;
+
+      if (QSTR_IS_ANY_CHAR_OR_BIT (src_type) && QSTR_IS_ANY_CHAR_OR_BIT (dest_type))
+	{
+	  /* check phase of ALTER TABLE .. CHANGE should not allow changing the domains from one flavour to another : */
+	  assert ((QSTR_IS_ANY_CHAR (src_type) && QSTR_IS_ANY_CHAR (dest_type))
+		  || (!QSTR_IS_ANY_CHAR (src_type) && !QSTR_IS_ANY_CHAR (dest_type)));
+
+	  assert ((QSTR_IS_BIT (src_type) && QSTR_IS_BIT (dest_type))
+		  || (!QSTR_IS_BIT (src_type) && !QSTR_IS_BIT (dest_type)));
+
+	  /* check string truncation */
+	  if (dest_prec < curr_prec)
+	    {
+	      if (prm_get_bool_value (PRM_ID_ALTER_TABLE_CHANGE_TYPE_STRICT) == true
+		  || prm_get_bool_value (PRM_ID_ALLOW_TRUNCATED_STRING) == false)
+		{
+		  error = ER_ALTER_CHANGE_TRUNC_OVERFLOW_NOT_ALLOWED;
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+		  goto exit;
+		}
+	      else
+		{
+		  /* allow truncation in cast, just warning */
+		  log_warning = true;
+		  warning_code = ER_QPROC_SIZE_STRING_TRUNCATED;
+		}
+	    }
+	}
+
+      error = pr_clone_value (&(value->dbvalue), &orig_value);
+      if (error != NO_ERROR)
+	{
+	  goto exit;
+	}
+
+      if (TP_IS_CHAR_TYPE (TP_DOMAIN_TYPE (dest_dom))
+	  && !(TP_IS_CHAR_TYPE (src_type) || src_type == DB_TYPE_ENUMERATION)
+	  && prm_get_bool_value (PRM_ID_ALTER_TABLE_CHANGE_TYPE_STRICT) == false
+	  && prm_get_bool_value (PRM_ID_ALLOW_TRUNCATED_STRING) == true)
+	{
+	  /* If destination is char/varchar, we need to first cast the value to a string with no precision, then to
+	   * destination type with the desired precision. */
+	  TP_DOMAIN *string_dom;
+	  if (TP_DOMAIN_TYPE (dest_dom) == DB_TYPE_NCHAR || TP_DOMAIN_TYPE (dest_dom) == DB_TYPE_VARNCHAR)
+	    {
+	      string_dom = tp_domain_resolve_default (DB_TYPE_VARNCHAR);
+	    }
+	  else
+	    {
+	      string_dom = tp_domain_resolve_default (DB_TYPE_VARCHAR);
+	    }
+	  if ((status = tp_value_cast (&(value->dbvalue), &(value->dbvalue), string_dom, false)) != DOMAIN_COMPATIBLE)
+	    {
+	      error = tp_domain_status_er_set (status, ARG_FILE_LINE, &(value->dbvalue), string_dom);
+	    }
+	}
+
+      if (error == NO_ERROR)
+	{
+	  if ((status = tp_value_cast (&(value->dbvalue), &(value->dbvalue), dest_dom, false)) != DOMAIN_COMPATIBLE)
+	    {
+	      error = tp_domain_status_er_set (status, ARG_FILE_LINE, &(value->dbvalue), dest_dom);
+	    }
+	}
+      if (error != NO_ERROR)
+	{
+	  bool set_default_value = false;
+	  bool set_min_value = false;
+	  bool set_max_value = false;
+
+	  if (prm_get_bool_value (PRM_ID_ALTER_TABLE_CHANGE_TYPE_STRICT) == true
+	      || (TP_IS_CHAR_TYPE (TP_DOMAIN_TYPE (dest_dom))
+		  && prm_get_bool_value (PRM_ID_ALLOW_TRUNCATED_STRING) == false))
+	    {
+	      error = ER_ALTER_CHANGE_TRUNC_OVERFLOW_NOT_ALLOWED;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+	      goto exit;
+	    }
+
+	  if (error == ER_IT_DATA_OVERFLOW)
+	    {
+	      int is_positive = -1;	/* -1:UNKNOWN, 0:negative, 1:positive */
+
+	      /* determine sign of orginal value: */
+	      switch (src_type)
+		{
+		case DB_TYPE_INTEGER:
+		  is_positive = ((db_get_int (&value->dbvalue) >= 0) ? 1 : 0);
+		  break;
+		case DB_TYPE_SMALLINT:
+		  is_positive = ((db_get_short (&value->dbvalue) >= 0) ? 1 : 0);
+		  break;
+		case DB_TYPE_BIGINT:
+		  is_positive = ((db_get_bigint (&value->dbvalue) >= 0) ? 1 : 0);
+		  break;
+		case DB_TYPE_FLOAT:
+		  is_positive = ((db_get_float (&value->dbvalue) >= 0) ? 1 : 0);
+		  break;
+		case DB_TYPE_DOUBLE:
+		  is_positive = ((db_get_double (&value->dbvalue) >= 0) ? 1 : 0);
+		  break;
+		case DB_TYPE_NUMERIC:
+		  is_positive = numeric_db_value_is_positive (&value->dbvalue);
+		  break;
+		case DB_TYPE_MONETARY:
+		  is_positive = ((db_get_monetary (&value->dbvalue)->amount >= 0) ? 1 : 0);
+		  break;
+
+		case DB_TYPE_CHAR:
+		case DB_TYPE_VARCHAR:
+		case DB_TYPE_NCHAR:
+		case DB_TYPE_VARNCHAR:
+		  {
+		    const char *str = db_get_string (&(value->dbvalue));
+		    const char *str_end = str + db_get_string_length (&(value->dbvalue));
+		    const char *p = NULL;
+
+		    /* get the sign in the source string; look directly into the buffer string, no copy */
+		    p = str;
+		    while (char_isspace (*p) && p < str_end)
+		      {
+			p++;
+		      }
+
+		    is_positive = ((p < str_end && (*p) == '-') ? 0 : 1);
+		    break;
+		  }
+
+		default:
+		  is_positive = -1;
+		  break;
+		}
+
+	      if (is_positive == 1)
+		{
+		  set_max_value = true;
+		}
+	      else if (is_positive == 0)
+		{
+		  set_min_value = true;
+		}
+	      else
+		{
+		  set_default_value = true;
+		}
+	    }
+	  else
+	    {
+	      set_default_value = true;
+	    }
+	  /* clear the error */
+	  er_clear ();
+
+	  log_warning = true;
+
+	  /* the casted value will be overwritten, so a clear is needed, here */
+	  pr_clear_value (&(value->dbvalue));
+
+	  if (set_max_value)
+	    {
+	      /* set max value of destination domain */
+	      error =
+		db_value_domain_max (&(value->dbvalue), dest_type, dest_prec, dest_dom->scale, dest_dom->codeset,
+				     dest_dom->collation_id, &dest_dom->enumeration);
+	      if (error != NO_ERROR)
+		{
+		  /* this should not happen */
+		  goto exit;
+		}
+
+	      warning_code = ER_ALTER_CHANGE_CAST_FAILED_SET_MAX;
+	    }
+	  else if (set_min_value)
+	    {
+	      /* set min value of destination domain */
+	      error =
+		db_value_domain_min (&(value->dbvalue), dest_type, dest_prec, dest_dom->scale, dest_dom->codeset,
+				     dest_dom->collation_id, &dest_dom->enumeration);
+	      if (error != NO_ERROR)
+		{
+		  /* this should not happen */
+		  goto exit;
+		}
+	      warning_code = ER_ALTER_CHANGE_CAST_FAILED_SET_MIN;
+	    }
+	  else
+	    {
+	      assert (set_default_value == true);
+
+	      /* set default value of destination domain */
+	      error =
+		db_value_domain_default (&(value->dbvalue), dest_type, dest_prec, dest_dom->scale, dest_dom->codeset,
+					 dest_dom->collation_id, &dest_dom->enumeration);
+	      if (error != NO_ERROR)
+		{
+		  /* this should not happen */
+		  goto exit;
+		}
+	      warning_code = ER_ALTER_CHANGE_CAST_FAILED_SET_DEFAULT;
+	    }
+	}
+
+      if (!DB_IS_NULL (&orig_value))
+	{
+	  assert (!DB_IS_NULL (&(value->dbvalue)));
+	}
+
+      if (log_warning)
+	{
+	  assert (warning_code != NO_ERROR);
+
+	  /* Since we don't like to bother callers with the following warning which is just for a logging, it will be
+	   * poped once it is set. */
+	  er_stack_push ();
+
+	  if (warning_code == ER_QPROC_SIZE_STRING_TRUNCATED)
+	    {
+	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, warning_code, 1, "ALTER TABLE .. CHANGE");
+	    }
+	  else
+	    {
+	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, warning_code, 0);
+	    }
+
+	  /* forget the warning */
+	  er_stack_pop ();
+	}
+
+      value->state = HEAP_WRITTEN_ATTRVALUE;
+      atts_id[updated_n_attrs_id] = value->attrid;
+      updated_n_attrs_id++;
+
+      break;
+    }
+
+  /* exactly one attribute should be changed */
+  assert (updated_n_attrs_id == 1);
+
+  if (updated_n_attrs_id != 1 || attr_info->read_classrepr == NULL || attr_info->last_classrepr == NULL
+      || attr_info->read_classrepr->id >= attr_info->last_classrepr->id)
+    {
+      error = ER_UNEXPECTED;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, "Incorrect attribute information.");
+      goto exit;
+    }
+
+  /* the class has XCH_M_LOCK */
+  error =
+    locator_attribute_info_force (thread_p, &upd_scancache->node.hfid, oid, attr_info, atts_id, updated_n_attrs_id,
+				  LC_FLUSH_UPDATE, SINGLE_ROW_UPDATE, upd_scancache, &force_count, false,
+				  REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL, NULL,
+				  UPDATE_INPLACE_OLD_MVCCID, NULL, false);
+  if (error != NO_ERROR)
+    {
+      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+	{
+	  error = NO_ERROR;
+	}
+
+      goto exit;
+    }
+
+exit:
+  pr_clear_value (&orig_value);
+  return error;
+}
+
+/*
+ * heap_eval_function_index - evaluate the result of the expression used in
+ *			      a function index.
+ *
+ *    thread_p(in) : thread context
+ *    func_index_info(in): function index information
+ *    n_atts(in): number of attributes involved
+ *    att_ids(in): attribute identifiers
+ *    attr_info(in): attribute info structure
+ *    recdes(in): record descriptor
+ *    btid_index(in): id of the function index used
+ *    func_pred_cache(in): cached function index expressions
+ *    result(out): result of the function expression
+ *    fi_domain(out): domain of function index (from regu_var)
+ *    return: error code
+ */
+static int
+heap_eval_function_index (THREAD_ENTRY * thread_p, FUNCTION_INDEX_INFO * func_index_info, int n_atts, int *att_ids,
+			  HEAP_CACHE_ATTRINFO * attr_info, RECDES * recdes, int btid_index, DB_VALUE * result,
+			  FUNC_PRED_UNPACK_INFO * func_pred_cache, TP_DOMAIN ** fi_domain)
+{
+  int error = NO_ERROR;
+  OR_INDEX *index = NULL;
+  char *expr_stream = NULL;
+  int expr_stream_size = 0;
+  FUNC_PRED *func_pred = NULL;
+  XASL_UNPACK_INFO *unpack_info = NULL;
+  DB_VALUE *res = NULL;
+  int i, nr_atts;
+  ATTR_ID *atts = NULL;
+  bool atts_free = false, attrinfo_clear = false, attrinfo_end = false;
+  HEAP_CACHE_ATTRINFO *cache_attr_info = NULL;
+
+  if (func_index_info == NULL && btid_index > -1 && n_atts == -1)
+    {
+      index = &(attr_info->last_classrepr->indexes[btid_index]);
+      if (func_pred_cache)
+	{
+	  func_pred = func_pred_cache->func_pred;
+	  cache_attr_info = func_pred->cache_attrinfo;
+	  nr_atts = index->n_atts;
+	}
+      else
+	{
+	  expr_stream = index->func_index_info->expr_stream;
+	  expr_stream_size = index->func_index_info->expr_stream_size;
+	  nr_atts = index->n_atts;
+	  atts = (ATTR_ID *) malloc (nr_atts * sizeof (ATTR_ID));
+	  if (atts == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, nr_atts * sizeof (ATTR_ID));
+	      error = ER_FAILED;
+	      goto end;
+	    }
+	  atts_free = true;
+	  for (i = 0; i < nr_atts; i++)
+	    {
+	      atts[i] = index->atts[i]->id;
+	    }
+	  cache_attr_info = attr_info;
+	}
+    }
+  else
+    {
+      /* load index case */
+      expr_stream = func_index_info->expr_stream;
+      expr_stream_size = func_index_info->expr_stream_size;
+      nr_atts = n_atts;
+      atts = att_ids;
+      cache_attr_info = func_index_info->expr->cache_attrinfo;
+      func_pred = func_index_info->expr;
+    }
+
+  if (func_index_info == NULL)
+    {
+      /* insert case, read the values */
+      if (func_pred == NULL)
+	{
+	  if (stx_map_stream_to_func_pred (thread_p, &func_pred, expr_stream, expr_stream_size, &unpack_info))
+	    {
+	      error = ER_FAILED;
+	      goto end;
+	    }
+	  cache_attr_info = func_pred->cache_attrinfo;
+
+	  if (heap_attrinfo_start (thread_p, &attr_info->class_oid, nr_atts, atts, cache_attr_info) != NO_ERROR)
+	    {
+	      error = ER_FAILED;
+	      goto end;
+	    }
+	  attrinfo_end = true;
+	}
+
+      if (heap_attrinfo_read_dbvalues (thread_p, &attr_info->inst_oid, recdes, NULL, cache_attr_info) != NO_ERROR)
+	{
+	  error = ER_FAILED;
+	  goto end;
+	}
+      attrinfo_clear = true;
+    }
+
+  error = fetch_peek_dbval (thread_p, func_pred->func_regu, NULL, &cache_attr_info->class_oid,
+			    &cache_attr_info->inst_oid, NULL, &res);
+  if (error == NO_ERROR)
+    {
+      if (DB_IS_NULL (res) && func_pred->func_regu->domain != NULL)
+	{
+	  /* Set expected domain in case of null values, just to be sure. The callers expects the domain to be set. */
+	  db_value_domain_init (res, TP_DOMAIN_TYPE (func_pred->func_regu->domain),
+				func_pred->func_regu->domain->precision, func_pred->func_regu->domain->scale);
+	}
+      pr_clone_value (res, result);
+    }
+
+  if (fi_domain != NULL)
+    {
+      *fi_domain = tp_domain_cache (func_pred->func_regu->domain);
+    }
+
+  if (res != NULL && res->need_clear == true)
+    {
+      pr_clear_value (res);
+    }
+
+end:
+  if (attrinfo_clear && cache_attr_info)
+    {
+      heap_attrinfo_clear_dbvalues (cache_attr_info);
+    }
+  if (attrinfo_end && cache_attr_info)
+    {
+      heap_attrinfo_end (thread_p, cache_attr_info);
+    }
+  if (atts_free && atts)
+    {
+      free_and_init (atts);
+    }
+  if (unpack_info)
+    {
+      (void) qexec_clear_func_pred (thread_p, func_pred);
+      free_xasl_unpack_info (thread_p, unpack_info);
+    }
+
+  return error;
+}
+
+/*
+ * heap_init_func_pred_unpack_info () - if function indexes are found,
+ *			each function expression is unpacked and cached
+ *			in order to be used during bulk inserts
+ *			(insert ... select).
+ *   return: NO_ERROR, or ER_FAILED
+ *   thread_p(in): thread entry
+ *   attr_info(in): heap_cache_attrinfo
+ *   class_oid(in): the class oid
+ *   func_indx_preds(out):
+ */
+int
+heap_init_func_pred_unpack_info (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info, const OID * class_oid,
+				 FUNC_PRED_UNPACK_INFO ** func_indx_preds)
+{
+  OR_FUNCTION_INDEX *fi_info = NULL;
+  int n_indexes;
+  int i, j;
+  int *att_ids = NULL;
+  int error_status = NO_ERROR;
+  OR_INDEX *idx;
+  FUNC_PRED_UNPACK_INFO *fi_preds = NULL;
+  int *attr_info_started = NULL;
+  size_t size;
+
+  if (attr_info == NULL || class_oid == NULL || func_indx_preds == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  *func_indx_preds = NULL;
+
+  n_indexes = attr_info->last_classrepr->n_indexes;
+  for (i = 0; i < n_indexes; i++)
+    {
+      idx = &(attr_info->last_classrepr->indexes[i]);
+      fi_info = idx->func_index_info;
+      if (fi_info)
+	{
+	  if (fi_preds == NULL)
+	    {
+	      size = n_indexes * sizeof (FUNC_PRED_UNPACK_INFO);
+	      fi_preds = (FUNC_PRED_UNPACK_INFO *) db_private_alloc (thread_p, size);
+	      if (!fi_preds)
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+		  error_status = ER_FAILED;
+		  goto error;
+		}
+	      for (j = 0; j < n_indexes; j++)
+		{
+		  fi_preds[j].func_pred = NULL;
+		  fi_preds[j].unpack_info = NULL;
+		}
+
+	      size = n_indexes * sizeof (int);
+	      attr_info_started = (int *) db_private_alloc (thread_p, size);
+	      if (attr_info_started == NULL)
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+		  error_status = ER_FAILED;
+		  goto error;
+		}
+	      for (j = 0; j < n_indexes; j++)
+		{
+		  attr_info_started[j] = 0;
+		}
+	    }
+
+	  if (stx_map_stream_to_func_pred (thread_p, &fi_preds[i].func_pred, fi_info->expr_stream,
+					   fi_info->expr_stream_size, &fi_preds[i].unpack_info))
+	    {
+	      error_status = ER_FAILED;
+	      goto error;
+	    }
+
+	  size = idx->n_atts * sizeof (ATTR_ID);
+	  att_ids = (ATTR_ID *) db_private_alloc (thread_p, size);
+	  if (!att_ids)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+	      error_status = ER_FAILED;
+	      goto error;
+	    }
+
+	  for (j = 0; j < idx->n_atts; j++)
+	    {
+	      att_ids[j] = idx->atts[j]->id;
+	    }
+
+	  if (heap_attrinfo_start (thread_p, class_oid, idx->n_atts, att_ids,
+				   fi_preds[i].func_pred->cache_attrinfo) != NO_ERROR)
+	    {
+	      error_status = ER_FAILED;
+	      goto error;
+	    }
+
+	  attr_info_started[i] = 1;
+
+	  if (att_ids)
+	    {
+	      db_private_free_and_init (thread_p, att_ids);
+	    }
+	}
+    }
+
+  if (attr_info_started != NULL)
+    {
+      db_private_free_and_init (thread_p, attr_info_started);
+    }
+
+  *func_indx_preds = fi_preds;
+
+  return NO_ERROR;
+
+error:
+  if (att_ids)
+    {
+      db_private_free_and_init (thread_p, att_ids);
+    }
+  heap_free_func_pred_unpack_info (thread_p, n_indexes, fi_preds, attr_info_started);
+  if (attr_info_started != NULL)
+    {
+      db_private_free_and_init (thread_p, attr_info_started);
+    }
+
+  return error_status;
+}
+
+/*
+ * heap_free_func_pred_unpack_info () -
+ *   return:
+ *   thread_p(in): thread entry
+ *   n_indexes(in): number of indexes
+ *   func_indx_preds(in):
+ *   attr_info_started(in): array of int (1 if corresponding cache_attrinfo
+ *					  must be cleaned, 0 otherwise)
+ *			    if null all cache_attrinfo must be cleaned
+ */
+void
+heap_free_func_pred_unpack_info (THREAD_ENTRY * thread_p, int n_indexes, FUNC_PRED_UNPACK_INFO * func_indx_preds,
+				 int *attr_info_started)
+{
+  int i;
+
+  if (func_indx_preds == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < n_indexes; i++)
+    {
+      if (func_indx_preds[i].func_pred)
+	{
+	  if (attr_info_started == NULL || attr_info_started[i])
+	    {
+	      assert (func_indx_preds[i].func_pred->cache_attrinfo);
+	      (void) heap_attrinfo_end (thread_p, func_indx_preds[i].func_pred->cache_attrinfo);
+	    }
+	  (void) qexec_clear_func_pred (thread_p, func_indx_preds[i].func_pred);
+	}
+
+      if (func_indx_preds[i].unpack_info)
+	{
+	  free_xasl_unpack_info (thread_p, func_indx_preds[i].unpack_info);
+	}
+    }
+  db_private_free_and_init (thread_p, func_indx_preds);
+}
+
+/*
+ * heap_header_capacity_start_scan () - start scan function for 'show heap ...'
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in): thread entry
+ *   show_type(in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out): 'show heap' context
+ */
+int
+heap_header_capacity_start_scan (THREAD_ENTRY * thread_p, int show_type, DB_VALUE ** arg_values, int arg_cnt,
+				 void **ptr)
+{
+  int error = NO_ERROR;
+  const char *class_name = NULL;
+  DB_CLASS_PARTITION_TYPE partition_type = DB_NOT_PARTITIONED_CLASS;
+  OID class_oid;
+  LC_FIND_CLASSNAME status;
+  HEAP_SHOW_SCAN_CTX *ctx = NULL;
+  OR_PARTITION *parts = NULL;
+  int i = 0;
+  int parts_count = 0;
+  bool is_all = false;
+
+  assert (arg_cnt == 2);
+  assert (DB_VALUE_TYPE (arg_values[0]) == DB_TYPE_CHAR);
+  assert (DB_VALUE_TYPE (arg_values[1]) == DB_TYPE_INTEGER);
+
+  *ptr = NULL;
+
+  class_name = db_get_string (arg_values[0]);
+
+  partition_type = (DB_CLASS_PARTITION_TYPE) db_get_int (arg_values[1]);
+
+  ctx = (HEAP_SHOW_SCAN_CTX *) db_private_alloc (thread_p, sizeof (HEAP_SHOW_SCAN_CTX));
+  if (ctx == NULL)
+    {
+      ASSERT_ERROR ();
+      error = er_errid ();
+      goto cleanup;
+    }
+  memset (ctx, 0, sizeof (HEAP_SHOW_SCAN_CTX));
+
+  status = xlocator_find_class_oid (thread_p, class_name, &class_oid, S_LOCK);
+  if (status == LC_CLASSNAME_ERROR || status == LC_CLASSNAME_DELETED)
+    {
+      error = ER_LC_UNKNOWN_CLASSNAME;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, class_name);
+      goto cleanup;
+    }
+
+  is_all = (show_type == SHOWSTMT_ALL_HEAP_HEADER || show_type == SHOWSTMT_ALL_HEAP_CAPACITY);
+
+  if (is_all && partition_type == DB_PARTITIONED_CLASS)
+    {
+      error = heap_get_class_partitions (thread_p, &class_oid, &parts, &parts_count);
+      if (error != NO_ERROR)
+	{
+	  goto cleanup;
+	}
+
+      ctx->hfids = (HFID *) db_private_alloc (thread_p, parts_count * sizeof (HFID));
+      if (ctx->hfids == NULL)
+	{
+	  ASSERT_ERROR ();
+	  error = er_errid ();
+	  goto cleanup;
+	}
+
+      for (i = 0; i < parts_count; i++)
+	{
+	  HFID_COPY (&ctx->hfids[i], &parts[i].class_hfid);
+	}
+
+      ctx->hfids_count = parts_count;
+    }
+  else
+    {
+      ctx->hfids = (HFID *) db_private_alloc (thread_p, sizeof (HFID));
+      if (ctx->hfids == NULL)
+	{
+	  ASSERT_ERROR ();
+	  error = er_errid ();
+	  goto cleanup;
+	}
+
+      error = heap_get_class_info (thread_p, &class_oid, &ctx->hfids[0], NULL, NULL);
+      if (error != NO_ERROR)
+	{
+	  goto cleanup;
+	}
+
+      ctx->hfids_count = 1;
+    }
+
+  *ptr = ctx;
+  ctx = NULL;
+
+cleanup:
+
+  if (parts != NULL)
+    {
+      heap_clear_partition_info (thread_p, parts, parts_count);
+    }
+
+  if (ctx != NULL)
+    {
+      if (ctx->hfids != NULL)
+	{
+	  db_private_free (thread_p, ctx->hfids);
+	}
+
+      db_private_free_and_init (thread_p, ctx);
+    }
+
+  return error;
+}
+
+/*
+ * heap_header_next_scan () - next scan function for
+ *                            'show (all) heap header'
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   cursor(in):
+ *   out_values(in/out):
+ *   out_cnt(in):
+ *   ptr(in): 'show heap' context
+ */
+SCAN_CODE
+heap_header_next_scan (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** out_values, int out_cnt, void *ptr)
+{
+  int error = NO_ERROR;
+  HEAP_SHOW_SCAN_CTX *ctx = NULL;
+  VPID vpid;
+  HEAP_HDR_STATS *heap_hdr = NULL;
+  RECDES hdr_recdes;
+  int i = 0;
+  int idx = 0;
+  PAGE_PTR pgptr = NULL;
+  HFID *hfid_p;
+  char *class_name = NULL;
+  int avg_length = 0;
+  char buf[512] = { 0 };
+  char temp[64] = { 0 };
+  char *buf_p, *end;
+
+  ctx = (HEAP_SHOW_SCAN_CTX *) ptr;
+
+  if (cursor >= ctx->hfids_count)
+    {
+      return S_END;
+    }
+
+  hfid_p = &ctx->hfids[cursor];
+
+  vpid.volid = hfid_p->vfid.volid;
+  vpid.pageid = hfid_p->hpgid;
+
+  pgptr = heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE, S_LOCK, NULL, NULL);
+  if (pgptr == NULL)
+    {
+      ASSERT_ERROR ();
+      error = er_errid ();
+      goto cleanup;
+    }
+
+  if (spage_get_record (thread_p, pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &hdr_recdes, PEEK) != S_SUCCESS)
+    {
+      error = ER_SP_INVALID_HEADER;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 3, vpid.pageid, fileio_get_volume_label (vpid.volid, PEEK), 0);
+      goto cleanup;
+    }
+
+  heap_hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
+
+  if (heap_get_class_name (thread_p, &(heap_hdr->class_oid), &class_name) != NO_ERROR || class_name == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto cleanup;
+    }
+
+  idx = 0;
+
+  /* Class_name */
+  error = db_make_string_copy (out_values[idx], class_name);
+  idx++;
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
+
+  /* Class_oid */
+  oid_to_string (buf, sizeof (buf), &heap_hdr->class_oid);
+  error = db_make_string_copy (out_values[idx], buf);
+  idx++;
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
+
+  /* HFID */
+  db_make_int (out_values[idx], hfid_p->vfid.volid);
+  idx++;
+
+  db_make_int (out_values[idx], hfid_p->vfid.fileid);
+  idx++;
+
+  db_make_int (out_values[idx], hfid_p->hpgid);
+  idx++;
+
+  /* Overflow_vfid */
+  vfid_to_string (buf, sizeof (buf), &heap_hdr->ovf_vfid);
+  error = db_make_string_copy (out_values[idx], buf);
+  idx++;
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
+
+  /* Next_vpid */
+  vpid_to_string (buf, sizeof (buf), &heap_hdr->next_vpid);
+  error = db_make_string_copy (out_values[idx], buf);
+  idx++;
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
+
+  /* Unfill space */
+  db_make_int (out_values[idx], heap_hdr->unfill_space);
+  idx++;
+
+  /* Estimated */
+  db_make_bigint (out_values[idx], heap_hdr->estimates.num_pages);
+  idx++;
+
+  db_make_bigint (out_values[idx], heap_hdr->estimates.num_recs);
+  idx++;
+
+  avg_length = ((heap_hdr->estimates.num_recs > 0)
+		? (int) ((heap_hdr->estimates.recs_sumlen / (float) heap_hdr->estimates.num_recs) + 0.9) : 0);
+  db_make_int (out_values[idx], avg_length);
+  idx++;
+
+  db_make_int (out_values[idx], heap_hdr->estimates.num_high_best);
+  idx++;
+
+  db_make_int (out_values[idx], heap_hdr->estimates.num_other_high_best);
+  idx++;
+
+  db_make_int (out_values[idx], heap_hdr->estimates.head);
+  idx++;
+
+  /* Estimates_best_list */
+  buf_p = buf;
+  end = buf + sizeof (buf);
+  for (i = 0; i < HEAP_NUM_BEST_SPACESTATS; i++)
+    {
+      if (i > 0)
+	{
+	  if (fill_string_to_buffer (&buf_p, end, ", ") == -1)
+	    {
+	      break;
+	    }
+	}
+
+      heap_bestspace_to_string (temp, sizeof (temp), heap_hdr->estimates.best + i);
+      if (fill_string_to_buffer (&buf_p, end, temp) == -1)
+	{
+	  break;
 	}
+    }
+
+  error = db_make_string_copy (out_values[idx], buf);
+  idx++;
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
 
-      if (!DB_IS_NULL (&orig_value))
-	{
-	  assert (!DB_IS_NULL (&(value->dbvalue)));
-	}
+  db_make_int (out_values[idx], heap_hdr->estimates.num_second_best);
+  idx++;
 
-      if (log_warning)
-	{
-	  assert (warning_code != NO_ERROR);
+  db_make_int (out_values[idx], heap_hdr->estimates.head_second_best);
+  idx++;
 
-	  /* Since we don't like to bother callers with the following warning which is just for a logging, it will be
-	   * poped once it is set. */
-	  er_stack_push ();
+  db_make_int (out_values[idx], heap_hdr->estimates.tail_second_best);
+  idx++;
 
-	  if (warning_code == ER_QPROC_SIZE_STRING_TRUNCATED)
-	    {
-	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, warning_code, 1, "ALTER TABLE .. CHANGE");
-	    }
-	  else
+  db_make_int (out_values[idx], heap_hdr->estimates.num_substitutions);
+  idx++;
+
+  /* Estimates_second_best */
+  buf_p = buf;
+  end = buf + sizeof (buf);
+  for (i = 0; i < HEAP_NUM_BEST_SPACESTATS; i++)
+    {
+      if (i > 0)
+	{
+	  if (fill_string_to_buffer (&buf_p, end, ", ") == -1)
 	    {
-	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, warning_code, 0);
+	      break;
 	    }
-
-	  /* forget the warning */
-	  er_stack_pop ();
 	}
 
-      value->state = HEAP_WRITTEN_ATTRVALUE;
-      atts_id[updated_n_attrs_id] = value->attrid;
-      updated_n_attrs_id++;
-
-      break;
+      vpid_to_string (temp, sizeof (temp), heap_hdr->estimates.second_best + i);
+      if (fill_string_to_buffer (&buf_p, end, temp) == -1)
+	{
+	  break;
+	}
     }
 
-  /* exactly one attribute should be changed */
-  assert (updated_n_attrs_id == 1);
+  error = db_make_string_copy (out_values[idx], buf);
+  idx++;
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
 
-  if (updated_n_attrs_id != 1 || attr_info->read_classrepr == NULL || attr_info->last_classrepr == NULL
-      || attr_info->read_classrepr->id >= attr_info->last_classrepr->id)
+  vpid_to_string (buf, sizeof (buf), &heap_hdr->estimates.last_vpid);
+  error = db_make_string_copy (out_values[idx], buf);
+  idx++;
+  if (error != NO_ERROR)
     {
-      error = ER_UNEXPECTED;
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, "Incorrect attribute information.");
-      goto exit;
+      goto cleanup;
     }
 
-  /* the class has XCH_M_LOCK */
-  error =
-    locator_attribute_info_force (thread_p, &upd_scancache->node.hfid, oid, attr_info, atts_id, updated_n_attrs_id,
-				  LC_FLUSH_UPDATE, SINGLE_ROW_UPDATE, upd_scancache, &force_count, false,
-				  REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL, NULL,
-				  UPDATE_INPLACE_OLD_MVCCID, NULL, false);
+  vpid_to_string (buf, sizeof (buf), &heap_hdr->estimates.full_search_vpid);
+  error = db_make_string_copy (out_values[idx], buf);
+  idx++;
   if (error != NO_ERROR)
     {
-      if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
-	{
-	  error = NO_ERROR;
-	}
+      goto cleanup;
+    }
 
-      goto exit;
+  assert (idx == out_cnt);
+
+cleanup:
+
+  if (pgptr != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, pgptr);
     }
 
-exit:
-  pr_clear_value (&orig_value);
-  return error;
+  if (class_name != NULL)
+    {
+      free_and_init (class_name);
+    }
+
+  return (error == NO_ERROR) ? S_SUCCESS : S_ERROR;
 }
 
 /*
- * heap_eval_function_index - evaluate the result of the expression used in
- *			      a function index.
- *
- *    thread_p(in) : thread context
- *    func_index_info(in): function index information
- *    n_atts(in): number of attributes involved
- *    att_ids(in): attribute identifiers
- *    attr_info(in): attribute info structure
- *    recdes(in): record descriptor
- *    btid_index(in): id of the function index used
- *    func_pred_cache(in): cached function index expressions
- *    result(out): result of the function expression
- *    fi_domain(out): domain of function index (from regu_var)
- *    return: error code
+ * heap_capacity_next_scan () - next scan function for
+ *                              'show (all) heap capacity'
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   cursor(in):
+ *   out_values(in/out):
+ *   out_cnt(in):
+ *   ptr(in): 'show heap' context
  */
-static int
-heap_eval_function_index (THREAD_ENTRY * thread_p, FUNCTION_INDEX_INFO * func_index_info, int n_atts, int *att_ids,
-			  HEAP_CACHE_ATTRINFO * attr_info, RECDES * recdes, int btid_index, DB_VALUE * result,
-			  FUNC_PRED_UNPACK_INFO * func_pred_cache, TP_DOMAIN ** fi_domain)
+SCAN_CODE
+heap_capacity_next_scan (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** out_values, int out_cnt, void *ptr)
 {
   int error = NO_ERROR;
-  OR_INDEX *index = NULL;
-  char *expr_stream = NULL;
-  int expr_stream_size = 0;
-  FUNC_PRED *func_pred = NULL;
-  XASL_UNPACK_INFO *unpack_info = NULL;
-  DB_VALUE *res = NULL;
-  int i, nr_atts;
-  ATTR_ID *atts = NULL;
-  bool atts_free = false, attrinfo_clear = false, attrinfo_end = false;
-  HEAP_CACHE_ATTRINFO *cache_attr_info = NULL;
+  HEAP_SHOW_SCAN_CTX *ctx = NULL;
+  HFID *hfid_p = NULL;
+  HEAP_CACHE_ATTRINFO attr_info;
+  OR_CLASSREP *repr = NULL;
+  char *classname = NULL;
+  char class_oid_str[64] = { 0 };
+  bool is_heap_attrinfo_started = false;
+  INT64 num_recs = 0;
+  INT64 num_relocated_recs = 0;
+  INT64 num_overflowed_recs = 0;
+  INT64 num_pages = 0;
+  int avg_rec_len = 0;
+  int avg_free_space_per_page = 0;
+  int avg_free_space_without_last_page = 0;
+  int avg_overhead_per_page = 0;
+  int val = 0;
+  int idx = 0;
+  FILE_DESCRIPTORS fdes;
 
-  if (func_index_info == NULL && btid_index > -1 && n_atts == -1)
+  ctx = (HEAP_SHOW_SCAN_CTX *) ptr;
+
+  if (cursor >= ctx->hfids_count)
     {
-      index = &(attr_info->last_classrepr->indexes[btid_index]);
-      if (func_pred_cache)
-	{
-	  func_pred = func_pred_cache->func_pred;
-	  cache_attr_info = func_pred->cache_attrinfo;
-	  nr_atts = index->n_atts;
-	}
-      else
-	{
-	  expr_stream = index->func_index_info->expr_stream;
-	  expr_stream_size = index->func_index_info->expr_stream_size;
-	  nr_atts = index->n_atts;
-	  atts = (ATTR_ID *) malloc (nr_atts * sizeof (ATTR_ID));
-	  if (atts == NULL)
-	    {
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, nr_atts * sizeof (ATTR_ID));
-	      error = ER_FAILED;
-	      goto end;
-	    }
-	  atts_free = true;
-	  for (i = 0; i < nr_atts; i++)
-	    {
-	      atts[i] = index->atts[i]->id;
-	    }
-	  cache_attr_info = attr_info;
-	}
+      return S_END;
     }
-  else
+
+  hfid_p = &ctx->hfids[cursor];
+
+  error =
+    heap_get_capacity (thread_p, hfid_p, &num_recs, &num_relocated_recs, &num_overflowed_recs, &num_pages,
+		       &avg_free_space_per_page, &avg_free_space_without_last_page, &avg_rec_len,
+		       &avg_overhead_per_page);
+  if (error != NO_ERROR)
     {
-      /* load index case */
-      expr_stream = func_index_info->expr_stream;
-      expr_stream_size = func_index_info->expr_stream_size;
-      nr_atts = n_atts;
-      atts = att_ids;
-      cache_attr_info = func_index_info->expr->cache_attrinfo;
-      func_pred = func_index_info->expr;
+      goto cleanup;
     }
 
-  if (func_index_info == NULL)
+  error = file_descriptor_get (thread_p, &hfid_p->vfid, &fdes);
+  if (error != NO_ERROR)
     {
-      /* insert case, read the values */
-      if (func_pred == NULL)
-	{
-	  if (stx_map_stream_to_func_pred (thread_p, &func_pred, expr_stream, expr_stream_size, &unpack_info))
-	    {
-	      error = ER_FAILED;
-	      goto end;
-	    }
-	  cache_attr_info = func_pred->cache_attrinfo;
-
-	  if (heap_attrinfo_start (thread_p, &attr_info->class_oid, nr_atts, atts, cache_attr_info) != NO_ERROR)
-	    {
-	      error = ER_FAILED;
-	      goto end;
-	    }
-	  attrinfo_end = true;
-	}
-
-      if (heap_attrinfo_read_dbvalues (thread_p, &attr_info->inst_oid, recdes, NULL, cache_attr_info) != NO_ERROR)
-	{
-	  error = ER_FAILED;
-	  goto end;
-	}
-      attrinfo_clear = true;
+      ASSERT_ERROR ();
+      goto cleanup;
     }
 
-  error = fetch_peek_dbval (thread_p, func_pred->func_regu, NULL, &cache_attr_info->class_oid,
-			    &cache_attr_info->inst_oid, NULL, &res);
-  if (error == NO_ERROR)
+  error = heap_attrinfo_start (thread_p, &fdes.heap.class_oid, -1, NULL, &attr_info);
+  if (error != NO_ERROR)
     {
-      if (DB_IS_NULL (res) && func_pred->func_regu->domain != NULL)
-	{
-	  /* Set expected domain in case of null values, just to be sure. The callers expects the domain to be set. */
-	  db_value_domain_init (res, TP_DOMAIN_TYPE (func_pred->func_regu->domain),
-				func_pred->func_regu->domain->precision, func_pred->func_regu->domain->scale);
-	}
-      pr_clone_value (res, result);
+      goto cleanup;
     }
 
-  if (fi_domain != NULL)
+  is_heap_attrinfo_started = true;
+
+  repr = attr_info.last_classrepr;
+  if (repr == NULL)
     {
-      *fi_domain = tp_domain_cache (func_pred->func_regu->domain);
+      error = ER_HEAP_UNKNOWN_OBJECT;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 3, fdes.heap.class_oid.volid, fdes.heap.class_oid.pageid,
+	      fdes.heap.class_oid.slotid);
+      goto cleanup;
     }
 
-  if (res != NULL && res->need_clear == true)
+  if (heap_get_class_name (thread_p, &fdes.heap.class_oid, &classname) != NO_ERROR || classname == NULL)
     {
-      pr_clear_value (res);
+      ASSERT_ERROR_AND_SET (error);
+      goto cleanup;
     }
 
-end:
-  if (attrinfo_clear && cache_attr_info)
-    {
-      heap_attrinfo_clear_dbvalues (cache_attr_info);
-    }
-  if (attrinfo_end && cache_attr_info)
-    {
-      heap_attrinfo_end (thread_p, cache_attr_info);
-    }
-  if (atts_free && atts)
+  idx = 0;
+
+  error = db_make_string_copy (out_values[idx], classname);
+  idx++;
+  if (error != NO_ERROR)
     {
-      free_and_init (atts);
+      goto cleanup;
     }
-  if (unpack_info)
+
+  oid_to_string (class_oid_str, sizeof (class_oid_str), &fdes.heap.class_oid);
+  error = db_make_string_copy (out_values[idx], class_oid_str);
+  idx++;
+  if (error != NO_ERROR)
     {
-      (void) qexec_clear_func_pred (thread_p, func_pred);
-      free_xasl_unpack_info (thread_p, unpack_info);
+      goto cleanup;
     }
 
-  return error;
-}
+  db_make_int (out_values[idx], hfid_p->vfid.volid);
+  idx++;
 
-/*
- * heap_init_func_pred_unpack_info () - if function indexes are found,
- *			each function expression is unpacked and cached
- *			in order to be used during bulk inserts
- *			(insert ... select).
- *   return: NO_ERROR, or ER_FAILED
- *   thread_p(in): thread entry
- *   attr_info(in): heap_cache_attrinfo
- *   class_oid(in): the class oid
- *   func_indx_preds(out):
- */
-int
-heap_init_func_pred_unpack_info (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info, const OID * class_oid,
-				 FUNC_PRED_UNPACK_INFO ** func_indx_preds)
-{
-  OR_FUNCTION_INDEX *fi_info = NULL;
-  int n_indexes;
-  int i, j;
-  int *att_ids = NULL;
-  int error_status = NO_ERROR;
-  OR_INDEX *idx;
-  FUNC_PRED_UNPACK_INFO *fi_preds = NULL;
-  int *attr_info_started = NULL;
-  size_t size;
+  db_make_int (out_values[idx], hfid_p->vfid.fileid);
+  idx++;
 
-  if (attr_info == NULL || class_oid == NULL || func_indx_preds == NULL)
-    {
-      return ER_FAILED;
-    }
+  db_make_int (out_values[idx], hfid_p->hpgid);
+  idx++;
 
-  *func_indx_preds = NULL;
+  db_make_bigint (out_values[idx], num_recs);
+  idx++;
 
-  n_indexes = attr_info->last_classrepr->n_indexes;
-  for (i = 0; i < n_indexes; i++)
-    {
-      idx = &(attr_info->last_classrepr->indexes[i]);
-      fi_info = idx->func_index_info;
-      if (fi_info)
-	{
-	  if (fi_preds == NULL)
-	    {
-	      size = n_indexes * sizeof (FUNC_PRED_UNPACK_INFO);
-	      fi_preds = (FUNC_PRED_UNPACK_INFO *) db_private_alloc (thread_p, size);
-	      if (!fi_preds)
-		{
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
-		  error_status = ER_FAILED;
-		  goto error;
-		}
-	      for (j = 0; j < n_indexes; j++)
-		{
-		  fi_preds[j].func_pred = NULL;
-		  fi_preds[j].unpack_info = NULL;
-		}
+  db_make_bigint (out_values[idx], num_relocated_recs);
+  idx++;
 
-	      size = n_indexes * sizeof (int);
-	      attr_info_started = (int *) db_private_alloc (thread_p, size);
-	      if (attr_info_started == NULL)
-		{
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
-		  error_status = ER_FAILED;
-		  goto error;
-		}
-	      for (j = 0; j < n_indexes; j++)
-		{
-		  attr_info_started[j] = 0;
-		}
-	    }
+  db_make_bigint (out_values[idx], num_overflowed_recs);
+  idx++;
 
-	  if (stx_map_stream_to_func_pred (thread_p, &fi_preds[i].func_pred, fi_info->expr_stream,
-					   fi_info->expr_stream_size, &fi_preds[i].unpack_info))
-	    {
-	      error_status = ER_FAILED;
-	      goto error;
-	    }
+  db_make_bigint (out_values[idx], num_pages);
+  idx++;
 
-	  size = idx->n_atts * sizeof (ATTR_ID);
-	  att_ids = (ATTR_ID *) db_private_alloc (thread_p, size);
-	  if (!att_ids)
-	    {
-	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
-	      error_status = ER_FAILED;
-	      goto error;
-	    }
+  db_make_int (out_values[idx], avg_rec_len);
+  idx++;
 
-	  for (j = 0; j < idx->n_atts; j++)
-	    {
-	      att_ids[j] = idx->atts[j]->id;
-	    }
+  db_make_int (out_values[idx], avg_free_space_per_page);
+  idx++;
 
-	  if (heap_attrinfo_start (thread_p, class_oid, idx->n_atts, att_ids,
-				   fi_preds[i].func_pred->cache_attrinfo) != NO_ERROR)
-	    {
-	      error_status = ER_FAILED;
-	      goto error;
-	    }
+  db_make_int (out_values[idx], avg_free_space_without_last_page);
+  idx++;
 
-	  attr_info_started[i] = 1;
+  db_make_int (out_values[idx], avg_overhead_per_page);
+  idx++;
 
-	  if (att_ids)
-	    {
-	      db_private_free_and_init (thread_p, att_ids);
-	    }
-	}
-    }
+  db_make_int (out_values[idx], repr->id);
+  idx++;
 
-  if (attr_info_started != NULL)
-    {
-      db_private_free_and_init (thread_p, attr_info_started);
-    }
+  db_make_int (out_values[idx], repr->n_attributes);
+  idx++;
 
-  *func_indx_preds = fi_preds;
+  val = repr->n_attributes - repr->n_variable - repr->n_shared_attrs - repr->n_class_attrs;
+  db_make_int (out_values[idx], val);
+  idx++;
 
-  return NO_ERROR;
+  db_make_int (out_values[idx], repr->n_variable);
+  idx++;
 
-error:
-  if (att_ids)
-    {
-      db_private_free_and_init (thread_p, att_ids);
-    }
-  heap_free_func_pred_unpack_info (thread_p, n_indexes, fi_preds, attr_info_started);
-  if (attr_info_started != NULL)
-    {
-      db_private_free_and_init (thread_p, attr_info_started);
-    }
+  db_make_int (out_values[idx], repr->n_shared_attrs);
+  idx++;
 
-  return error_status;
-}
+  db_make_int (out_values[idx], repr->n_class_attrs);
+  idx++;
 
-/*
- * heap_free_func_pred_unpack_info () -
- *   return:
- *   thread_p(in): thread entry
- *   n_indexes(in): number of indexes
- *   func_indx_preds(in):
- *   attr_info_started(in): array of int (1 if corresponding cache_attrinfo
- *					  must be cleaned, 0 otherwise)
- *			    if null all cache_attrinfo must be cleaned
- */
-void
-heap_free_func_pred_unpack_info (THREAD_ENTRY * thread_p, int n_indexes, FUNC_PRED_UNPACK_INFO * func_indx_preds,
-				 int *attr_info_started)
-{
-  int i;
+  db_make_int (out_values[idx], repr->fixed_length);
+  idx++;
 
-  if (func_indx_preds == NULL)
+  assert (idx == out_cnt);
+
+cleanup:
+
+  if (classname != NULL)
     {
-      return;
+      free_and_init (classname);
     }
 
-  for (i = 0; i < n_indexes; i++)
+  if (is_heap_attrinfo_started)
     {
-      if (func_indx_preds[i].func_pred)
-	{
-	  if (attr_info_started == NULL || attr_info_started[i])
-	    {
-	      assert (func_indx_preds[i].func_pred->cache_attrinfo);
-	      (void) heap_attrinfo_end (thread_p, func_indx_preds[i].func_pred->cache_attrinfo);
-	    }
-	  (void) qexec_clear_func_pred (thread_p, func_indx_preds[i].func_pred);
-	}
-
-      if (func_indx_preds[i].unpack_info)
-	{
-	  free_xasl_unpack_info (thread_p, func_indx_preds[i].unpack_info);
-	}
+      heap_attrinfo_end (thread_p, &attr_info);
     }
-  db_private_free_and_init (thread_p, func_indx_preds);
+
+  return (error == NO_ERROR) ? S_SUCCESS : S_ERROR;
 }
 
 /*
- * heap_header_capacity_start_scan () - start scan function for 'show heap ...'
+ *  heap_header_capacity_end_scan() - end scan function of
+ *                                    'show (all) heap ...'
  *   return: NO_ERROR, or ER_code
- *   thread_p(in): thread entry
- *   show_type(in):
- *   arg_values(in):
- *   arg_cnt(in):
+ *   thread_p(in):
  *   ptr(in/out): 'show heap' context
  */
 int
-heap_header_capacity_start_scan (THREAD_ENTRY * thread_p, int show_type, DB_VALUE ** arg_values, int arg_cnt,
-				 void **ptr)
+heap_header_capacity_end_scan (THREAD_ENTRY * thread_p, void **ptr)
 {
-  int error = NO_ERROR;
-  const char *class_name = NULL;
-  DB_CLASS_PARTITION_TYPE partition_type = DB_NOT_PARTITIONED_CLASS;
-  OID class_oid;
-  LC_FIND_CLASSNAME status;
-  HEAP_SHOW_SCAN_CTX *ctx = NULL;
-  OR_PARTITION *parts = NULL;
-  int i = 0;
-  int parts_count = 0;
-  bool is_all = false;
-
-  assert (arg_cnt == 2);
-  assert (DB_VALUE_TYPE (arg_values[0]) == DB_TYPE_CHAR);
-  assert (DB_VALUE_TYPE (arg_values[1]) == DB_TYPE_INTEGER);
-
-  *ptr = NULL;
-
-  class_name = db_get_string (arg_values[0]);
+  HEAP_SHOW_SCAN_CTX *ctx;
 
-  partition_type = (DB_CLASS_PARTITION_TYPE) db_get_int (arg_values[1]);
+  ctx = (HEAP_SHOW_SCAN_CTX *) (*ptr);
 
-  ctx = (HEAP_SHOW_SCAN_CTX *) db_private_alloc (thread_p, sizeof (HEAP_SHOW_SCAN_CTX));
   if (ctx == NULL)
     {
-      ASSERT_ERROR ();
-      error = er_errid ();
-      goto cleanup;
+      return NO_ERROR;
     }
-  memset (ctx, 0, sizeof (HEAP_SHOW_SCAN_CTX));
 
-  status = xlocator_find_class_oid (thread_p, class_name, &class_oid, S_LOCK);
-  if (status == LC_CLASSNAME_ERROR || status == LC_CLASSNAME_DELETED)
+  if (ctx->hfids != NULL)
     {
-      error = ER_LC_UNKNOWN_CLASSNAME;
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, class_name);
-      goto cleanup;
+      db_private_free (thread_p, ctx->hfids);
     }
 
-  is_all = (show_type == SHOWSTMT_ALL_HEAP_HEADER || show_type == SHOWSTMT_ALL_HEAP_CAPACITY);
-
-  if (is_all && partition_type == DB_PARTITIONED_CLASS)
-    {
-      error = heap_get_class_partitions (thread_p, &class_oid, &parts, &parts_count);
-      if (error != NO_ERROR)
-	{
-	  goto cleanup;
-	}
+  db_private_free (thread_p, ctx);
+  *ptr = NULL;
 
-      ctx->hfids = (HFID *) db_private_alloc (thread_p, parts_count * sizeof (HFID));
-      if (ctx->hfids == NULL)
-	{
-	  ASSERT_ERROR ();
-	  error = er_errid ();
-	  goto cleanup;
-	}
+  return NO_ERROR;
+}
 
-      for (i = 0; i < parts_count; i++)
-	{
-	  HFID_COPY (&ctx->hfids[i], &parts[i].class_hfid);
-	}
+static char *
+heap_bestspace_to_string (char *buf, int buf_size, const HEAP_BESTSPACE * hb)
+{
+  snprintf (buf, buf_size, "((%d|%d), %d)", hb->vpid.volid, hb->vpid.pageid, hb->freespace);
+  buf[buf_size - 1] = '\0';
 
-      ctx->hfids_count = parts_count;
-    }
-  else
-    {
-      ctx->hfids = (HFID *) db_private_alloc (thread_p, sizeof (HFID));
-      if (ctx->hfids == NULL)
-	{
-	  ASSERT_ERROR ();
-	  error = er_errid ();
-	  goto cleanup;
-	}
+  return buf;
+}
 
-      error = heap_get_class_info (thread_p, &class_oid, &ctx->hfids[0], NULL, NULL);
-      if (error != NO_ERROR)
-	{
-	  goto cleanup;
-	}
+/*
+ * fill_string_to_buffer () - fill string into buffer
+ *
+ *   -----------------------------
+ *   |        buffer             |
+ *   -----------------------------
+ *   ^                           ^
+ *   |                           |
+ *   start                       end
+ *
+ *   return: the count of characters (not include '\0') which has been
+ *           filled into buffer; -1 means error.
+ *   start(in/out): After filling, start move to the '\0' position.
+ *   end(in): The first unavailble position.
+ *   str(in):
+ */
+static int
+fill_string_to_buffer (char **start, char *end, const char *str)
+{
+  int len = (int) strlen (str);
 
-      ctx->hfids_count = 1;
+  if (*start + len >= end)
+    {
+      return -1;
     }
 
-  *ptr = ctx;
-  ctx = NULL;
+  memcpy (*start, str, len);
+  *start += len;
+  **start = '\0';
 
-cleanup:
+  return len;
+}
 
-  if (parts != NULL)
+/*
+ * heap_get_page_info () - Obtain page information.
+ *
+ * return	  : SCAN_CODE.
+ * thread_p (in)  : Thread entry.
+ * cls_oid (in)	  : Class object identifier.
+ * hfid (in)	  : Heap file identifier.
+ * vpid (in)	  : Page identifier.
+ * pgptr (in)	  : Pointer to the cached page.
+ * page_info (in) : Pointers to DB_VALUES where page information is stored.
+ */
+static SCAN_CODE
+heap_get_page_info (THREAD_ENTRY * thread_p, const OID * cls_oid, const HFID * hfid, const VPID * vpid,
+		    const PAGE_PTR pgptr, DB_VALUE ** page_info)
+{
+  RECDES recdes;
+
+  if (page_info == NULL)
     {
-      heap_clear_partition_info (thread_p, parts, parts_count);
+      /* no need to get page info */
+      return S_SUCCESS;
     }
 
-  if (ctx != NULL)
+  if (spage_get_record (thread_p, pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK) != S_SUCCESS)
     {
-      if (ctx->hfids != NULL)
-	{
-	  db_private_free (thread_p, ctx->hfids);
-	}
+      /* Error obtaining header slot */
+      return S_ERROR;
+    }
 
-      db_private_free_and_init (thread_p, ctx);
+  db_make_oid (page_info[HEAP_PAGE_INFO_CLASS_OID], cls_oid);
+
+  if (hfid->hpgid == vpid->pageid && hfid->vfid.volid == vpid->volid)
+    {
+      HEAP_HDR_STATS *hdr_stats = (HEAP_HDR_STATS *) recdes.data;
+      db_make_null (page_info[HEAP_PAGE_INFO_PREV_PAGE]);
+      db_make_int (page_info[HEAP_PAGE_INFO_NEXT_PAGE], hdr_stats->next_vpid.pageid);
+    }
+  else
+    {
+      HEAP_CHAIN *chain = (HEAP_CHAIN *) recdes.data;
+      db_make_int (page_info[HEAP_PAGE_INFO_PREV_PAGE], chain->prev_vpid.pageid);
+      db_make_int (page_info[HEAP_PAGE_INFO_NEXT_PAGE], chain->next_vpid.pageid);
     }
 
-  return error;
+  /* Obtain information from spage header */
+  return spage_get_page_header_info (pgptr, page_info);
 }
 
 /*
- * heap_header_next_scan () - next scan function for
- *                            'show (all) heap header'
- *   return: NO_ERROR, or ER_code
- *   thread_p(in):
- *   cursor(in):
- *   out_values(in/out):
- *   out_cnt(in):
- *   ptr(in): 'show heap' context
+ * heap_page_next () - Advance to next page in chain and obtain information.
+ *
+ * return	       : SCAN_CODE.
+ * thread_p (in)       : Thread entry.
+ * class_oid (in)      : Class object identifier.
+ * hfid (in)	       : Heap file identifier.
+ * next_vpid (in)      : Next page identifier.
+ * cache_pageinfo (in) : Pointers to DB_VALUEs where page information is
+ *			 stored.
  */
 SCAN_CODE
-heap_header_next_scan (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** out_values, int out_cnt, void *ptr)
+heap_page_next (THREAD_ENTRY * thread_p, const OID * class_oid, const HFID * hfid, VPID * next_vpid,
+		DB_VALUE ** cache_pageinfo)
 {
-  int error = NO_ERROR;
-  HEAP_SHOW_SCAN_CTX *ctx = NULL;
-  VPID vpid;
-  HEAP_HDR_STATS *heap_hdr = NULL;
-  RECDES hdr_recdes;
-  int i = 0;
-  int idx = 0;
-  PAGE_PTR pgptr = NULL;
-  HFID *hfid_p;
-  char *class_name = NULL;
-  int avg_length = 0;
-  char buf[512] = { 0 };
-  char temp[64] = { 0 };
-  char *buf_p, *end;
+  PGBUF_WATCHER pg_watcher;
+  PGBUF_WATCHER old_pg_watcher;
+  SCAN_CODE scan = S_SUCCESS;
 
-  ctx = (HEAP_SHOW_SCAN_CTX *) ptr;
+  PGBUF_INIT_WATCHER (&pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
+  PGBUF_INIT_WATCHER (&old_pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
 
-  if (cursor >= ctx->hfids_count)
+  /* get next page */
+  if (VPID_ISNULL (next_vpid))
     {
-      return S_END;
+      /* set to first page */
+      next_vpid->pageid = hfid->hpgid;
+      next_vpid->volid = hfid->vfid.volid;
     }
-
-  hfid_p = &ctx->hfids[cursor];
-
-  vpid.volid = hfid_p->vfid.volid;
-  vpid.pageid = hfid_p->hpgid;
-
-  pgptr = heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE, S_LOCK, NULL, NULL);
-  if (pgptr == NULL)
+  else
     {
-      ASSERT_ERROR ();
-      error = er_errid ();
-      goto cleanup;
+      pg_watcher.pgptr = heap_scan_pb_lock_and_fetch (thread_p, next_vpid, OLD_PAGE, S_LOCK, NULL, &pg_watcher);
+      if (pg_watcher.pgptr == NULL)
+	{
+	  return S_ERROR;
+	}
+      /* get next page */
+      heap_vpid_next (thread_p, hfid, pg_watcher.pgptr, next_vpid);
+      if (OID_ISNULL (next_vpid))
+	{
+	  /* no more pages to scan */
+	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
+	  return S_END;
+	}
+      pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
     }
 
-  if (spage_get_record (thread_p, pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &hdr_recdes, PEEK) != S_SUCCESS)
+  /* get page pointer to next page */
+  pg_watcher.pgptr =
+    heap_scan_pb_lock_and_fetch (thread_p, next_vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, NULL, &pg_watcher);
+  if (old_pg_watcher.pgptr != NULL)
     {
-      error = ER_SP_INVALID_HEADER;
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 3, vpid.pageid, fileio_get_volume_label (vpid.volid, PEEK), 0);
-      goto cleanup;
+      pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
     }
-
-  heap_hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
-
-  if (heap_get_class_name (thread_p, &(heap_hdr->class_oid), &class_name) != NO_ERROR || class_name == NULL)
+  if (pg_watcher.pgptr == NULL)
     {
-      ASSERT_ERROR_AND_SET (error);
-      goto cleanup;
+      return S_ERROR;
     }
 
-  idx = 0;
+  /* read page information and return scan code */
+  scan = heap_get_page_info (thread_p, class_oid, hfid, next_vpid, pg_watcher.pgptr, cache_pageinfo);
+
+  pgbuf_ordered_unfix (thread_p, &pg_watcher);
+  return scan;
+}
+
+/*
+ * heap_page_prev () - Advance to previous page in chain and obtain
+ *		       information.
+ *
+ * return	       : SCAN_CODE.
+ * thread_p (in)       : Thread entry.
+ * class_oid (in)      : Class object identifier.
+ * hfid (in)	       : Heap file identifier.
+ * prev_vpid (in)      : Previous page identifier.
+ * cache_pageinfo (in) : Pointers to DB_VALUEs where page information is
+ *			 stored.
+ */
+SCAN_CODE
+heap_page_prev (THREAD_ENTRY * thread_p, const OID * class_oid, const HFID * hfid, VPID * prev_vpid,
+		DB_VALUE ** cache_pageinfo)
+{
+  PGBUF_WATCHER pg_watcher;
+  PGBUF_WATCHER old_pg_watcher;
+  SCAN_CODE scan = S_SUCCESS;
+
+  PGBUF_INIT_WATCHER (&pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
+  PGBUF_INIT_WATCHER (&old_pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
 
-  /* Class_name */
-  error = db_make_string_copy (out_values[idx], class_name);
-  idx++;
-  if (error != NO_ERROR)
+  /* get next page */
+  if (VPID_ISNULL (prev_vpid))
     {
-      goto cleanup;
+      /* set to last page */
+      if (heap_get_last_vpid (thread_p, hfid, prev_vpid) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return S_ERROR;
+	}
     }
-
-  /* Class_oid */
-  oid_to_string (buf, sizeof (buf), &heap_hdr->class_oid);
-  error = db_make_string_copy (out_values[idx], buf);
-  idx++;
-  if (error != NO_ERROR)
+  else
     {
-      goto cleanup;
+      pg_watcher.pgptr = heap_scan_pb_lock_and_fetch (thread_p, prev_vpid, OLD_PAGE, S_LOCK, NULL, &pg_watcher);
+      if (pg_watcher.pgptr == NULL)
+	{
+	  return S_ERROR;
+	}
+      /* get next page */
+      heap_vpid_prev (thread_p, hfid, pg_watcher.pgptr, prev_vpid);
+      if (OID_ISNULL (prev_vpid))
+	{
+	  /* no more pages to scan */
+	  return S_END;
+	}
+      /* get next page */
+      pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
     }
 
-  /* HFID */
-  db_make_int (out_values[idx], hfid_p->vfid.volid);
-  idx++;
-
-  db_make_int (out_values[idx], hfid_p->vfid.fileid);
-  idx++;
-
-  db_make_int (out_values[idx], hfid_p->hpgid);
-  idx++;
-
-  /* Overflow_vfid */
-  vfid_to_string (buf, sizeof (buf), &heap_hdr->ovf_vfid);
-  error = db_make_string_copy (out_values[idx], buf);
-  idx++;
-  if (error != NO_ERROR)
+  pg_watcher.pgptr =
+    heap_scan_pb_lock_and_fetch (thread_p, prev_vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, NULL, &pg_watcher);
+  if (old_pg_watcher.pgptr != NULL)
     {
-      goto cleanup;
+      pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
     }
-
-  /* Next_vpid */
-  vpid_to_string (buf, sizeof (buf), &heap_hdr->next_vpid);
-  error = db_make_string_copy (out_values[idx], buf);
-  idx++;
-  if (error != NO_ERROR)
+  if (pg_watcher.pgptr == NULL)
     {
-      goto cleanup;
+      pgbuf_ordered_unfix (thread_p, &pg_watcher);
+      return S_ERROR;
     }
 
-  /* Unfill space */
-  db_make_int (out_values[idx], heap_hdr->unfill_space);
-  idx++;
-
-  /* Estimated */
-  db_make_bigint (out_values[idx], heap_hdr->estimates.num_pages);
-  idx++;
+  /* read page information and return scan code */
+  scan = heap_get_page_info (thread_p, class_oid, hfid, prev_vpid, pg_watcher.pgptr, cache_pageinfo);
 
-  db_make_bigint (out_values[idx], heap_hdr->estimates.num_recs);
-  idx++;
+  pgbuf_ordered_unfix (thread_p, &pg_watcher);
+  return scan;
+}
 
-  avg_length = ((heap_hdr->estimates.num_recs > 0)
-		? (int) ((heap_hdr->estimates.recs_sumlen / (float) heap_hdr->estimates.num_recs) + 0.9) : 0);
-  db_make_int (out_values[idx], avg_length);
-  idx++;
+/*
+ * heap_get_record_info () - Heap function to obtain record information and
+ *			     record data.
+ *
+ * return	       : SCAN CODE (S_SUCCESS or S_ERROR).
+ * thread_p (in)       : Thread entry.
+ * oid (in)	       : Object identifier.
+ * recdes (out)	       : Record descriptor (to save record data).
+ * forward_recdes (in) : Record descriptor used by REC_RELOCATION & REC_BIGONE
+ *			 records.
+ * pgptr (in/out)      : Pointer to the page this object belongs to.
+ * scan_cache (in)     : Heap scan cache.
+ * ispeeking (in)      : PEEK/COPY.
+ * record_info (out)   : Stores record information.
+ */
+static SCAN_CODE
+heap_get_record_info (THREAD_ENTRY * thread_p, const OID oid, RECDES * recdes, RECDES forward_recdes,
+		      PGBUF_WATCHER * page_watcher, HEAP_SCANCACHE * scan_cache, bool ispeeking,
+		      DB_VALUE ** record_info)
+{
+  SPAGE_SLOT *slot_p = NULL;
+  SCAN_CODE scan = S_SUCCESS;
+  OID forward_oid;
+  MVCC_REC_HEADER mvcc_header;
 
-  db_make_int (out_values[idx], heap_hdr->estimates.num_high_best);
-  idx++;
+  assert (page_watcher != NULL);
+  assert (record_info != NULL);
+  assert (recdes != NULL);
 
-  db_make_int (out_values[idx], heap_hdr->estimates.num_other_high_best);
-  idx++;
+  /* careful adding values in the right order */
+  db_make_int (record_info[HEAP_RECORD_INFO_T_VOLUMEID], oid.volid);
+  db_make_int (record_info[HEAP_RECORD_INFO_T_PAGEID], oid.pageid);
+  db_make_int (record_info[HEAP_RECORD_INFO_T_SLOTID], oid.slotid);
 
-  db_make_int (out_values[idx], heap_hdr->estimates.head);
-  idx++;
+  /* get slot info */
+  slot_p = spage_get_slot (page_watcher->pgptr, oid.slotid);
+  if (slot_p == NULL)
+    {
+      assert (0);
+    }
+  db_make_int (record_info[HEAP_RECORD_INFO_T_OFFSET], slot_p->offset_to_record);
+  db_make_int (record_info[HEAP_RECORD_INFO_T_LENGTH], slot_p->record_length);
+  db_make_int (record_info[HEAP_RECORD_INFO_T_REC_TYPE], slot_p->record_type);
 
-  /* Estimates_best_list */
-  buf_p = buf;
-  end = buf + sizeof (buf);
-  for (i = 0; i < HEAP_NUM_BEST_SPACESTATS; i++)
+  /* get record info */
+  switch (slot_p->record_type)
     {
-      if (i > 0)
+    case REC_NEWHOME:
+    case REC_HOME:
+      if (scan_cache != NULL && ispeeking == COPY && recdes->data == NULL)
 	{
-	  if (fill_string_to_buffer (&buf_p, end, ", ") == -1)
-	    {
-	      break;
-	    }
+	  scan_cache->assign_recdes_to_area (*recdes);
+	  /* The default allocated space is enough to save the instance. */
 	}
-
-      heap_bestspace_to_string (temp, sizeof (temp), heap_hdr->estimates.best + i);
-      if (fill_string_to_buffer (&buf_p, end, temp) == -1)
+      if (scan_cache != NULL && scan_cache->cache_last_fix_page == true)
 	{
-	  break;
+	  scan = spage_get_record (thread_p, page_watcher->pgptr, oid.slotid, recdes, ispeeking);
+	  pgbuf_replace_watcher (thread_p, page_watcher, &scan_cache->page_watcher);
 	}
-    }
+      else
+	{
+	  scan = spage_get_record (thread_p, page_watcher->pgptr, oid.slotid, recdes, COPY);
+	  pgbuf_ordered_unfix (thread_p, page_watcher);
+	}
+      db_make_int (record_info[HEAP_RECORD_INFO_T_REPRID], or_rep_id (recdes));
+      db_make_int (record_info[HEAP_RECORD_INFO_T_REPRID], or_chn (recdes));
+      or_mvcc_get_header (recdes, &mvcc_header);
+      db_make_bigint (record_info[HEAP_RECORD_INFO_T_MVCC_INSID], MVCC_GET_INSID (&mvcc_header));
+      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	{
+	  db_make_bigint (record_info[HEAP_RECORD_INFO_T_MVCC_DELID], MVCC_GET_DELID (&mvcc_header));
+	}
+      else
+	{
+	  db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_DELID]);
+	}
+      db_make_int (record_info[HEAP_RECORD_INFO_T_CHN], OR_GET_MVCC_CHN (&mvcc_header));
+      db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_FLAGS], MVCC_GET_FLAG (&mvcc_header));
+      if (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_PREV_VERSION))
+	{
+	  db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 1);
+	}
+      else
+	{
+	  db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 0);
+	}
+      break;
 
-  error = db_make_string_copy (out_values[idx], buf);
-  idx++;
-  if (error != NO_ERROR)
-    {
-      goto cleanup;
-    }
+    case REC_BIGONE:
+      /* Get the address of the content of the multiple page object */
+      COPY_OID (&forward_oid, (OID *) forward_recdes.data);
+      pgbuf_ordered_unfix (thread_p, page_watcher);
 
-  db_make_int (out_values[idx], heap_hdr->estimates.num_second_best);
-  idx++;
+      /* Now get the content of the multiple page object. */
+      /* Try to reuse the previously allocated area */
+      if (scan_cache != NULL && (ispeeking == PEEK || recdes->data == NULL))
+	{
+	  /* It is guaranteed that scan_cache is not NULL. */
+	  scan_cache->assign_recdes_to_area (*recdes);
 
-  db_make_int (out_values[idx], heap_hdr->estimates.head_second_best);
-  idx++;
+	  while ((scan = heap_ovf_get (thread_p, &forward_oid, recdes, NULL_CHN, NULL)) == S_DOESNT_FIT)
+	    {
+	      /* The object did not fit into such an area, reallocate a new area */
+	      assert (recdes->length < 0);
+	      scan_cache->assign_recdes_to_area (*recdes, (size_t) (-recdes->length));
+	    }
+	  if (scan != S_SUCCESS)
+	    {
+	      recdes->data = NULL;
+	    }
+	}
+      else
+	{
+	  scan = heap_ovf_get (thread_p, &forward_oid, recdes, NULL_CHN, NULL);
+	}
+      if (scan != S_SUCCESS)
+	{
+	  return S_ERROR;
+	}
+      db_make_int (record_info[HEAP_RECORD_INFO_T_REPRID], or_rep_id (recdes));
+      db_make_int (record_info[HEAP_RECORD_INFO_T_REPRID], or_chn (recdes));
 
-  db_make_int (out_values[idx], heap_hdr->estimates.tail_second_best);
-  idx++;
+      or_mvcc_get_header (recdes, &mvcc_header);
+      db_make_bigint (record_info[HEAP_RECORD_INFO_T_MVCC_INSID], MVCC_GET_INSID (&mvcc_header));
+      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	{
+	  db_make_bigint (record_info[HEAP_RECORD_INFO_T_MVCC_DELID], MVCC_GET_DELID (&mvcc_header));
+	}
+      else
+	{
+	  db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_DELID]);
+	}
+      db_make_int (record_info[HEAP_RECORD_INFO_T_CHN], OR_GET_MVCC_CHN (&mvcc_header));
+      db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_FLAGS], MVCC_GET_FLAG (&mvcc_header));
+      if (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_PREV_VERSION))
+	{
+	  db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 1);
+	}
+      else
+	{
+	  db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 0);
+	}
+      break;
+    case REC_RELOCATION:
+    case REC_MARKDELETED:
+    case REC_DELETED_WILL_REUSE:
+    case REC_ASSIGN_ADDRESS:
+    case REC_UNKNOWN:
+    default:
+      db_make_null (record_info[HEAP_RECORD_INFO_T_REPRID]);
+      db_make_null (record_info[HEAP_RECORD_INFO_T_CHN]);
+      db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_INSID]);
+      db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_DELID]);
+      db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_FLAGS]);
 
-  db_make_int (out_values[idx], heap_hdr->estimates.num_substitutions);
-  idx++;
+      db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 0);
 
-  /* Estimates_second_best */
-  buf_p = buf;
-  end = buf + sizeof (buf);
-  for (i = 0; i < HEAP_NUM_BEST_SPACESTATS; i++)
-    {
-      if (i > 0)
+      recdes->area_size = -1;
+      recdes->data = NULL;
+      if (scan_cache != NULL && scan_cache->cache_last_fix_page)
 	{
-	  if (fill_string_to_buffer (&buf_p, end, ", ") == -1)
+	  assert (PGBUF_IS_CLEAN_WATCHER (&(scan_cache->page_watcher)));
+	  if (page_watcher->pgptr != NULL)
 	    {
-	      break;
+	      pgbuf_replace_watcher (thread_p, page_watcher, &scan_cache->page_watcher);
 	    }
 	}
-
-      vpid_to_string (temp, sizeof (temp), heap_hdr->estimates.second_best + i);
-      if (fill_string_to_buffer (&buf_p, end, temp) == -1)
+      else if (page_watcher->pgptr != NULL)
 	{
-	  break;
+	  pgbuf_ordered_unfix (thread_p, page_watcher);
 	}
+      break;
     }
 
-  error = db_make_string_copy (out_values[idx], buf);
-  idx++;
-  if (error != NO_ERROR)
-    {
-      goto cleanup;
-    }
-
-  vpid_to_string (buf, sizeof (buf), &heap_hdr->estimates.last_vpid);
-  error = db_make_string_copy (out_values[idx], buf);
-  idx++;
-  if (error != NO_ERROR)
-    {
-      goto cleanup;
-    }
-
-  vpid_to_string (buf, sizeof (buf), &heap_hdr->estimates.full_search_vpid);
-  error = db_make_string_copy (out_values[idx], buf);
-  idx++;
-  if (error != NO_ERROR)
-    {
-      goto cleanup;
-    }
-
-  assert (idx == out_cnt);
-
-cleanup:
-
-  if (pgptr != NULL)
-    {
-      pgbuf_unfix_and_init (thread_p, pgptr);
-    }
-
-  if (class_name != NULL)
-    {
-      free_and_init (class_name);
-    }
-
-  return (error == NO_ERROR) ? S_SUCCESS : S_ERROR;
+  return scan;
 }
 
 /*
- * heap_capacity_next_scan () - next scan function for
- *                              'show (all) heap capacity'
- *   return: NO_ERROR, or ER_code
- *   thread_p(in):
- *   cursor(in):
- *   out_values(in/out):
- *   out_cnt(in):
- *   ptr(in): 'show heap' context
+ * heap_next () - Retrieve or peek next object
+ *   return: SCAN_CODE (Either of S_SUCCESS, S_DOESNT_FIT, S_END, S_ERROR)
+ *   hfid(in):
+ *   class_oid(in):
+ *   next_oid(in/out): Object identifier of current record.
+ *                     Will be set to next available record or NULL_OID when
+ *                     there is not one.
+ *   recdes(in/out): Pointer to a record descriptor. Will be modified to
+ *                   describe the new record.
+ *   scan_cache(in/out): Scan cache or NULL
+ *   ispeeking(in): PEEK when the object is peeked, scan_cache cannot be NULL
+ *                  COPY when the object is copied
+ *
  */
 SCAN_CODE
-heap_capacity_next_scan (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** out_values, int out_cnt, void *ptr)
+heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
+	   HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  int error = NO_ERROR;
-  HEAP_SHOW_SCAN_CTX *ctx = NULL;
-  HFID *hfid_p = NULL;
-  HEAP_CACHE_ATTRINFO attr_info;
-  OR_CLASSREP *repr = NULL;
-  char *classname = NULL;
-  char class_oid_str[64] = { 0 };
-  bool is_heap_attrinfo_started = false;
-  INT64 num_recs = 0;
-  INT64 num_relocated_recs = 0;
-  INT64 num_overflowed_recs = 0;
-  INT64 num_pages = 0;
-  int avg_rec_len = 0;
-  int avg_free_space_per_page = 0;
-  int avg_free_space_without_last_page = 0;
-  int avg_overhead_per_page = 0;
-  int val = 0;
-  int idx = 0;
-  FILE_DESCRIPTORS fdes;
-
-  ctx = (HEAP_SHOW_SCAN_CTX *) ptr;
-
-  if (cursor >= ctx->hfids_count)
-    {
-      return S_END;
-    }
-
-  hfid_p = &ctx->hfids[cursor];
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL);
+}
 
-  error =
-    heap_get_capacity (thread_p, hfid_p, &num_recs, &num_relocated_recs, &num_overflowed_recs, &num_pages,
-		       &avg_free_space_per_page, &avg_free_space_without_last_page, &avg_rec_len,
-		       &avg_overhead_per_page);
-  if (error != NO_ERROR)
-    {
-      goto cleanup;
-    }
+/*
+ * heap_next_in_page () - Retrieve or peek next object of one heap page
+ *   return: SCAN_CODE (Either of S_SUCCESS, S_END, S_ERROR)
+ *   vpid(in): heap page to scan
+ *   class_oid(in):
+ *   next_oid(in/out): Object identifier of current record. Use slotid NULL_SLOTID to get the first object of the page.
+ *                     Will be set to the next available record of the page.
+ *   recdes(in/out): Pointer to a record descriptor. Will be modified to describe the new record.
+ *   scan_cache(in/out): Scan cache
+ *   ispeeking(in): PEEK when the object is peeked, COPY when the object is copied
+ *
+ * Note: Unlike heap_next, the scan never follows the heap page chain; S_END is returned at the end of the page. The page
+ *       may be any page of the heap file in any order (e.g. page ranges of a parallel scan). Pages deallocated
+ *       meanwhile or not yet initialized as heap pages have no objects. The page stays fixed in scan_cache between
+ *       calls and is unfixed when S_END is returned.
+ */
+SCAN_CODE
+heap_next_in_page (THREAD_ENTRY * thread_p, const VPID * vpid, OID * class_oid, OID * next_oid, RECDES * recdes,
+		   HEAP_SCANCACHE * scan_cache, int ispeeking)
+{
+  PGBUF_WATCHER curr_page_watcher;
+  RECDES forward_recdes;
+  OID oid;
+  INT16 type;
+  SCAN_CODE scan;
+  int cache_last_fix_page_save;
+  bool is_null_recdata;
 
-  error = file_descriptor_get (thread_p, &hfid_p->vfid, &fdes);
-  if (error != NO_ERROR)
-    {
-      ASSERT_ERROR ();
-      goto cleanup;
-    }
+  assert (scan_cache != NULL && vpid != NULL && next_oid != NULL);
+  assert (next_oid->volid == vpid->volid && next_oid->pageid == vpid->pageid);
 
-  error = heap_attrinfo_start (thread_p, &fdes.heap.class_oid, -1, NULL, &attr_info);
-  if (error != NO_ERROR)
+  if (!OID_ISNULL (&scan_cache->node.class_oid))
     {
-      goto cleanup;
+      class_oid = &scan_cache->node.class_oid;
     }
 
-  is_heap_attrinfo_started = true;
-
-  repr = attr_info.last_classrepr;
-  if (repr == NULL)
-    {
-      error = ER_HEAP_UNKNOWN_OBJECT;
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 3, fdes.heap.class_oid.volid, fdes.heap.class_oid.pageid,
-	      fdes.heap.class_oid.slotid);
-      goto cleanup;
-    }
+  PGBUF_INIT_WATCHER (&curr_page_watcher, PGBUF_ORDERED_HEAP_NORMAL, &scan_cache->node.hfid);
 
-  if (heap_get_class_name (thread_p, &fdes.heap.class_oid, &classname) != NO_ERROR || classname == NULL)
+  /* use the page left fixed by the previous call */
+  if (scan_cache->page_watcher.pgptr != NULL)
     {
-      ASSERT_ERROR_AND_SET (error);
-      goto cleanup;
+      if (VPID_EQ (vpid, pgbuf_get_vpid_ptr (scan_cache->page_watcher.pgptr)))
+	{
+	  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &curr_page_watcher);
+	}
+      else
+	{
+	  pgbuf_ordered_unfix (thread_p, &scan_cache->page_watcher);
+	}
     }
 
-  idx = 0;
-
-  error = db_make_string_copy (out_values[idx], classname);
-  idx++;
-  if (error != NO_ERROR)
-    {
-      goto cleanup;
-    }
+  oid = *next_oid;
+  is_null_recdata = (recdes->data == NULL);
 
-  oid_to_string (class_oid_str, sizeof (class_oid_str), &fdes.heap.class_oid);
-  error = db_make_string_copy (out_values[idx], class_oid_str);
-  idx++;
-  if (error != NO_ERROR)
+  while (true)
     {
-      goto cleanup;
-    }
-
-  db_make_int (out_values[idx], hfid_p->vfid.volid);
-  idx++;
-
-  db_make_int (out_values[idx], hfid_p->vfid.fileid);
-  idx++;
-
-  db_make_int (out_values[idx], hfid_p->hpgid);
-  idx++;
-
-  db_make_bigint (out_values[idx], num_recs);
-  idx++;
-
-  db_make_bigint (out_values[idx], num_relocated_recs);
-  idx++;
-
-  db_make_bigint (out_values[idx], num_overflowed_recs);
-  idx++;
-
-  db_make_bigint (out_values[idx], num_pages);
-  idx++;
-
-  db_make_int (out_values[idx], avg_rec_len);
-  idx++;
-
-  db_make_int (out_values[idx], avg_free_space_per_page);
-  idx++;
-
-  db_make_int (out_values[idx], avg_free_space_without_last_page);
-  idx++;
-
-  db_make_int (out_values[idx], avg_overhead_per_page);
-  idx++;
-
-  db_make_int (out_values[idx], repr->id);
-  idx++;
-
-  db_make_int (out_values[idx], repr->n_attributes);
-  idx++;
-
-  val = repr->n_attributes - repr->n_variable - repr->n_shared_attrs - repr->n_class_attrs;
-  db_make_int (out_values[idx], val);
-  idx++;
-
-  db_make_int (out_values[idx], repr->n_variable);
-  idx++;
-
-  db_make_int (out_values[idx], repr->n_shared_attrs);
-  idx++;
+      if (curr_page_watcher.pgptr == NULL)
+	{
+	  curr_page_watcher.pgptr =
+	    heap_scan_pb_lock_and_fetch (thread_p, vpid, OLD_PAGE_MAYBE_DEALLOCATED, S_LOCK, scan_cache,
+					 &curr_page_watcher);
+	  if (curr_page_watcher.pgptr == NULL)
+	    {
+	      if (er_errid () == ER_PB_BAD_PAGEID)
+		{
+		  /* deallocated */
+		  er_clear ();
+		  return S_END;
+		}
+	      ASSERT_ERROR ();
+	      return S_ERROR;
+	    }
+	  if (pgbuf_get_page_ptype (thread_p, curr_page_watcher.pgptr) != PAGE_HEAP)
+	    {
+	      pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+	      return S_END;
+	    }
+	}
 
-  db_make_int (out_values[idx], repr->n_class_attrs);
-  idx++;
+      /* Find the next object. Skip header and relocated records (i.e., new_home records). These records must be
+       * accessed through the relocation record (i.e., the object). */
+      scan = spage_next_record (curr_page_watcher.pgptr, &oid.slotid, &forward_recdes, PEEK);
+      if (scan != S_SUCCESS)
+	{
+	  break;
+	}
+      if (oid.slotid == HEAP_HEADER_AND_CHAIN_SLOTID)
+	{
+	  continue;
+	}
+      type = spage_get_record_type (curr_page_watcher.pgptr, oid.slotid);
+      if (type == REC_NEWHOME || type == REC_ASSIGN_ADDRESS || type == REC_UNKNOWN)
+	{
+	  continue;
+	}
 
-  db_make_int (out_values[idx], repr->fixed_length);
-  idx++;
+      cache_last_fix_page_save = scan_cache->cache_last_fix_page;
+      scan_cache->cache_last_fix_page = true;
+      pgbuf_replace_watcher (thread_p, &curr_page_watcher, &scan_cache->page_watcher);
 
-  assert (idx == out_cnt);
+      scan = heap_scan_get_visible_version (thread_p, &oid, class_oid, recdes, scan_cache, ispeeking, NULL_CHN);
 
-cleanup:
+      scan_cache->cache_last_fix_page = cache_last_fix_page_save;
+      if (scan_cache->page_watcher.pgptr != NULL)
+	{
+	  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &curr_page_watcher);
+	}
 
-  if (classname != NULL)
-    {
-      free_and_init (classname);
-    }
+      if (scan == S_SUCCESS)
+	{
+	  if (class_oid == NULL || OID_ISNULL (class_oid) || !OID_IS_ROOTOID (&oid))
+	    {
+	      /* keep the page fixed to resume the scan; a peeked record points into it */
+	      *next_oid = oid;
+	      if (curr_page_watcher.pgptr != NULL)
+		{
+		  pgbuf_replace_watcher (thread_p, &curr_page_watcher, &scan_cache->page_watcher);
+		}
+	      return S_SUCCESS;
+	    }
+	}
+      else if (scan != S_SNAPSHOT_NOT_SATISFIED && scan != S_DOESNT_EXIST)
+	{
+	  /* error, stop scanning */
+	  if (curr_page_watcher.pgptr != NULL)
+	    {
+	      pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+	    }
+	  return scan;
+	}
 
-  if (is_heap_attrinfo_started)
-    {
-      heap_attrinfo_end (thread_p, &attr_info);
+      /* the record does not satisfy snapshot or was deleted - continue */
+      if (is_null_recdata)
+	{
+	  /* reset recdes->data before getting next record */
+	  recdes->data = NULL;
+	}
     }
 
-  return (error == NO_ERROR) ? S_SUCCESS : S_ERROR;
+  pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+  *next_oid = oid;
+  return (scan == S_END) ? S_END : S_ERROR;
 }
 
 /*
- *  heap_header_capacity_end_scan() - end scan function of
- *                                    'show (all) heap ...'
- *   return: NO_ERROR, or ER_code
- *   thread_p(in):
- *   ptr(in/out): 'show heap' context
+ * heap_scan_batch_start () - Allocate a batch of heap records
+ *   return: NO_ERROR or error code
+ *   batch(out): batch of records
+ *   max_records(in): maximum number of records of one batch
  */
 int
-heap_header_capacity_end_scan (THREAD_ENTRY * thread_p, void **ptr)
+heap_scan_batch_start (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, int max_records)
 {
-  HEAP_SHOW_SCAN_CTX *ctx;
-
-  ctx = (HEAP_SHOW_SCAN_CTX *) (*ptr);
+  assert (batch != NULL && max_records > 0);
 
-  if (ctx == NULL)
-    {
-      return NO_ERROR;
-    }
+  memset (batch, 0, sizeof (*batch));
+  OID_SET_NULL (&batch->last_oid);
+  batch->current = -1;
 
-  if (ctx->hfids != NULL)
+  batch->oids = (OID *) db_private_alloc (thread_p, max_records * sizeof (OID));
+  batch->recdes = (RECDES *) db_private_alloc (thread_p, max_records * sizeof (RECDES));
+  /* copies of the records of one page, in most cases */
+  batch->area = (char *) db_private_alloc (thread_p, DB_PAGESIZE);
+  if (batch->oids == NULL || batch->recdes == NULL || batch->area == NULL)
     {
-      db_private_free (thread_p, ctx->hfids);
+      heap_scan_batch_end (thread_p, batch);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) max_records * (sizeof (OID) + sizeof (RECDES)) + DB_PAGESIZE);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
     }
-
-  db_private_free (thread_p, ctx);
-  *ptr = NULL;
+  batch->max_records = max_records;
+  batch->area_size = DB_PAGESIZE;
 
   return NO_ERROR;
 }
 
-static char *
-heap_bestspace_to_string (char *buf, int buf_size, const HEAP_BESTSPACE * hb)
-{
-  snprintf (buf, buf_size, "((%d|%d), %d)", hb->vpid.volid, hb->vpid.pageid, hb->freespace);
-  buf[buf_size - 1] = '\0';
-
-  return buf;
-}
-
 /*
- * fill_string_to_buffer () - fill string into buffer
- *
- *   -----------------------------
- *   |        buffer             |
- *   -----------------------------
- *   ^                           ^
- *   |                           |
- *   start                       end
- *
- *   return: the count of characters (not include '\0') which has been
- *           filled into buffer; -1 means error.
- *   start(in/out): After filling, start move to the '\0' position.
- *   end(in): The first unavailble position.
- *   str(in):
+ * heap_scan_batch_end () - Free a batch of heap records
+ *   return:
+ *   batch(in/out): batch of records
  */
-static int
-fill_string_to_buffer (char **start, char *end, const char *str)
+void
+heap_scan_batch_end (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch)
 {
-  int len = (int) strlen (str);
-
-  if (*start + len >= end)
+  if (batch->oids != NULL)
     {
-      return -1;
+      db_private_free_and_init (thread_p, batch->oids);
     }
+  if (batch->recdes != NULL)
+    {
+      db_private_free_and_init (thread_p, batch->recdes);
+    }
+  if (batch->area != NULL)
+    {
+      db_private_free_and_init (thread_p, batch->area);
+    }
+  batch->max_records = 0;
+  batch->area_size = 0;
+  heap_scan_batch_reset (batch);
+}
 
-  memcpy (*start, str, len);
-  *start += len;
-  **start = '\0';
-
-  return len;
+/*
+ * heap_scan_batch_reset () - Empty the batch and move the scan position to the start of the heap
+ *   return:
+ *   batch(in/out): batch of records
+ */
+void
+heap_scan_batch_reset (HEAP_SCAN_BATCH * batch)
+{
+  OID_SET_NULL (&batch->last_oid);
+  batch->n_records = 0;
+  batch->current = -1;
+  batch->area_used = 0;
+  batch->pgptr = NULL;
 }
 
 /*
- * heap_get_page_info () - Obtain page information.
+ * heap_scan_batch_resync () - Drop the records left in the batch when they can no longer be consumed in order
+ *   return: true if the batch was emptied
+ *   batch(in/out): batch of records
+ *   curr_oid(in): object the scan is positioned on; NULL OID at the start of the heap
+ *   scan_cache(in): scan cache of the batch
  *
- * return	  : SCAN_CODE.
- * thread_p (in)  : Thread entry.
- * cls_oid (in)	  : Class object identifier.
- * hfid (in)	  : Heap file identifier.
- * vpid (in)	  : Page identifier.
- * pgptr (in)	  : Pointer to the cached page.
- * page_info (in) : Pointers to DB_VALUES where page information is stored.
+ * Note: The scan moves back from the record consumed last when it re-evaluates a record with a copy (e.g. the page
+ *       changed while the predicate was evaluated on a peeked record). The peeked records left in the batch are also
+ *       lost once their page is released or modified. In both cases the batch is emptied and the next one starts
+ *       after curr_oid.
  */
-static SCAN_CODE
-heap_get_page_info (THREAD_ENTRY * thread_p, const OID * cls_oid, const HFID * hfid, const VPID * vpid,
-		    const PAGE_PTR pgptr, DB_VALUE ** page_info)
+bool
+heap_scan_batch_resync (HEAP_SCAN_BATCH * batch, const OID * curr_oid, HEAP_SCANCACHE * scan_cache)
 {
-  RECDES recdes;
-
-  if (page_info == NULL)
-    {
-      /* no need to get page info */
-      return S_SUCCESS;
-    }
+  PAGE_PTR pgptr = scan_cache->page_watcher.pgptr;
 
-  if (spage_get_record (thread_p, pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK) != S_SUCCESS)
+  if (batch->current < 0)
     {
-      /* Error obtaining header slot */
-      return S_ERROR;
+      /* nothing consumed from this batch */
+      return false;
     }
 
-  db_make_oid (page_info[HEAP_PAGE_INFO_CLASS_OID], cls_oid);
-
-  if (hfid->hpgid == vpid->pageid && hfid->vfid.volid == vpid->volid)
-    {
-      HEAP_HDR_STATS *hdr_stats = (HEAP_HDR_STATS *) recdes.data;
-      db_make_null (page_info[HEAP_PAGE_INFO_PREV_PAGE]);
-      db_make_int (page_info[HEAP_PAGE_INFO_NEXT_PAGE], hdr_stats->next_vpid.pageid);
-    }
-  else
+  if (OID_EQ (curr_oid, &batch->oids[batch->current])
+      && (batch->pgptr == NULL
+	  || (pgptr == batch->pgptr && !pgbuf_page_has_changed (pgptr, &batch->page_lsa))))
     {
-      HEAP_CHAIN *chain = (HEAP_CHAIN *) recdes.data;
-      db_make_int (page_info[HEAP_PAGE_INFO_PREV_PAGE], chain->prev_vpid.pageid);
-      db_make_int (page_info[HEAP_PAGE_INFO_NEXT_PAGE], chain->next_vpid.pageid);
+      return false;
     }
 
-  /* Obtain information from spage header */
-  return spage_get_page_header_info (pgptr, page_info);
+  heap_scan_batch_reset (batch);
+  batch->last_oid = *curr_oid;
+  return true;
 }
 
 /*
- * heap_page_next () - Advance to next page in chain and obtain information.
- *
- * return	       : SCAN_CODE.
- * thread_p (in)       : Thread entry.
- * class_oid (in)      : Class object identifier.
- * hfid (in)	       : Heap file identifier.
- * next_vpid (in)      : Next page identifier.
- * cache_pageinfo (in) : Pointers to DB_VALUEs where page information is
- *			 stored.
+ * heap_scan_batch_add () - Add a visible record to the batch
+ *   return: S_SUCCESS or S_DOESNT_FIT when the copy of the record does not fit the area
+ *   batch(in/out): batch of records
+ *   oid(in): object identifier
+ *   peek_recdes(in): record peeked from the page
+ *   ispeeking(in): PEEK to keep the peeked record, COPY to copy it
  */
-SCAN_CODE
-heap_page_next (THREAD_ENTRY * thread_p, const OID * class_oid, const HFID * hfid, VPID * next_vpid,
-		DB_VALUE ** cache_pageinfo)
+static SCAN_CODE
+heap_scan_batch_add (HEAP_SCAN_BATCH * batch, const OID * oid, const RECDES * peek_recdes, int ispeeking)
 {
-  PGBUF_WATCHER pg_watcher;
-  PGBUF_WATCHER old_pg_watcher;
-  SCAN_CODE scan = S_SUCCESS;
+  RECDES *recdes;
 
-  PGBUF_INIT_WATCHER (&pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
-  PGBUF_INIT_WATCHER (&old_pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
+  assert (batch->n_records < batch->max_records);
 
-  /* get next page */
-  if (VPID_ISNULL (next_vpid))
+  recdes = &batch->recdes[batch->n_records];
+  if (ispeeking == PEEK)
     {
-      /* set to first page */
-      next_vpid->pageid = hfid->hpgid;
-      next_vpid->volid = hfid->vfid.volid;
+      *recdes = *peek_recdes;
     }
   else
     {
-      pg_watcher.pgptr = heap_scan_pb_lock_and_fetch (thread_p, next_vpid, OLD_PAGE, S_LOCK, NULL, &pg_watcher);
-      if (pg_watcher.pgptr == NULL)
-	{
-	  return S_ERROR;
-	}
-      /* get next page */
-      heap_vpid_next (thread_p, hfid, pg_watcher.pgptr, next_vpid);
-      if (OID_ISNULL (next_vpid))
+      if (batch->area_used + peek_recdes->length > batch->area_size)
 	{
-	  /* no more pages to scan */
-	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
-	  return S_END;
+	  return S_DOESNT_FIT;
 	}
-      pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
-    }
-
-  /* get page pointer to next page */
-  pg_watcher.pgptr =
-    heap_scan_pb_lock_and_fetch (thread_p, next_vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, NULL, &pg_watcher);
-  if (old_pg_watcher.pgptr != NULL)
-    {
-      pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
-    }
-  if (pg_watcher.pgptr == NULL)
-    {
-      return S_ERROR;
+      recdes->data = batch->area + batch->area_used;
+      recdes->area_size = peek_recdes->length;
+      recdes->length = peek_recdes->length;
+      recdes->type = peek_recdes->type;
+      memcpy (recdes->data, peek_recdes->data, peek_recdes->length);
+      batch->area_used += DB_ALIGN (peek_recdes->length, MAX_ALIGNMENT);
     }
+  batch->oids[batch->n_records++] = *oid;
 
-  /* read page information and return scan code */
-  scan = heap_get_page_info (thread_p, class_oid, hfid, next_vpid, pg_watcher.pgptr, cache_pageinfo);
-
-  pgbuf_ordered_unfix (thread_p, &pg_watcher);
-  return scan;
+  return S_SUCCESS;
 }
 
 /*
- * heap_page_prev () - Advance to previous page in chain and obtain
- *		       information.
- *
- * return	       : SCAN_CODE.
- * thread_p (in)       : Thread entry.
- * class_oid (in)      : Class object identifier.
- * hfid (in)	       : Heap file identifier.
- * prev_vpid (in)      : Previous page identifier.
- * cache_pageinfo (in) : Pointers to DB_VALUEs where page information is
- *			 stored.
+ * heap_scan_batch_reserve_area () - Make sure the area of an empty batch can hold a record
+ *   return: NO_ERROR or error code
+ *   batch(in/out): empty batch of records
+ *   size(in): record size
  */
-SCAN_CODE
-heap_page_prev (THREAD_ENTRY * thread_p, const OID * class_oid, const HFID * hfid, VPID * prev_vpid,
-		DB_VALUE ** cache_pageinfo)
+static int
+heap_scan_batch_reserve_area (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, int size)
 {
-  PGBUF_WATCHER pg_watcher;
-  PGBUF_WATCHER old_pg_watcher;
-  SCAN_CODE scan = S_SUCCESS;
+  char *area;
 
-  PGBUF_INIT_WATCHER (&pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
-  PGBUF_INIT_WATCHER (&old_pg_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
+  assert (batch->n_records == 0);
 
-  /* get next page */
-  if (VPID_ISNULL (prev_vpid))
-    {
-      /* set to last page */
-      if (heap_get_last_vpid (thread_p, hfid, prev_vpid) != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	  return S_ERROR;
-	}
-    }
-  else
+  if (size <= batch->area_size)
     {
-      pg_watcher.pgptr = heap_scan_pb_lock_and_fetch (thread_p, prev_vpid, OLD_PAGE, S_LOCK, NULL, &pg_watcher);
-      if (pg_watcher.pgptr == NULL)
-	{
-	  return S_ERROR;
-	}
-      /* get next page */
-      heap_vpid_prev (thread_p, hfid, pg_watcher.pgptr, prev_vpid);
-      if (OID_ISNULL (prev_vpid))
-	{
-	  /* no more pages to scan */
-	  return S_END;
-	}
-      /* get next page */
-      pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
+      return NO_ERROR;
     }
 
-  pg_watcher.pgptr =
-    heap_scan_pb_lock_and_fetch (thread_p, prev_vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, NULL, &pg_watcher);
-  if (old_pg_watcher.pgptr != NULL)
-    {
-      pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
-    }
-  if (pg_watcher.pgptr == NULL)
+  area = (char *) db_private_alloc (thread_p, size);
+  if (area == NULL)
     {
-      pgbuf_ordered_unfix (thread_p, &pg_watcher);
-      return S_ERROR;
-    }
-
-  /* read page information and return scan code */
-  scan = heap_get_page_info (thread_p, class_oid, hfid, prev_vpid, pg_watcher.pgptr, cache_pageinfo);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  db_private_free (thread_p, batch->area);
+  batch->area = area;
+  batch->area_size = size;
 
-  pgbuf_ordered_unfix (thread_p, &pg_watcher);
-  return scan;
+  return NO_ERROR;
 }
 
 /*
- * heap_get_record_info () - Heap function to obtain record information and
- *			     record data.
+ * heap_next_batch () - Retrieve or peek the next visible objects of heap, from one page
+ *   return: SCAN_CODE (Either of S_SUCCESS, S_END, S_ERROR)
+ *   hfid(in):
+ *   class_oid(in):
+ *   batch(in/out): batch of records. Filled with the visible objects after batch->last_oid, all of them of the same
+ *                  page. batch->last_oid is moved to the last examined slot.
+ *   scan_cache(in/out): Scan cache
+ *   ispeeking(in): PEEK when the objects are peeked, COPY when the objects are copied
  *
- * return	       : SCAN CODE (S_SUCCESS or S_ERROR).
- * thread_p (in)       : Thread entry.
- * oid (in)	       : Object identifier.
- * recdes (out)	       : Record descriptor (to save record data).
- * forward_recdes (in) : Record descriptor used by REC_RELOCATION & REC_BIGONE
- *			 records.
- * pgptr (in/out)      : Pointer to the page this object belongs to.
- * scan_cache (in)     : Heap scan cache.
- * ispeeking (in)      : PEEK/COPY.
- * record_info (out)   : Stores record information.
+ * Note: heap_next fixes the page and checks the visibility of the record through the generic get path once per
+ *       object. This function fixes the page once and checks the MVCC header of home records in a tight loop; only
+ *       records out of the page (relocated, big or older versions from log) take the generic path. Such a record ends
+ *       the batch before it, because getting it may unfix the page the peeked records point to.
+ *
+ *       Peeked records are valid until the next call, when the page is left fixed in scan_cache, therefore PEEK
+ *       requires a scan_cache that caches the last page. Copies are kept in the area of the batch.
+ *       S_SUCCESS is returned with at least one object in batch.
  */
-static SCAN_CODE
-heap_get_record_info (THREAD_ENTRY * thread_p, const OID oid, RECDES * recdes, RECDES forward_recdes,
-		      PGBUF_WATCHER * page_watcher, HEAP_SCANCACHE * scan_cache, bool ispeeking,
-		      DB_VALUE ** record_info)
+SCAN_CODE
+heap_next_batch (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, HEAP_SCAN_BATCH * batch,
+		 HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  SPAGE_SLOT *slot_p = NULL;
-  SCAN_CODE scan = S_SUCCESS;
-  OID forward_oid;
+  PGBUF_WATCHER curr_page_watcher;
+  PGBUF_WATCHER old_page_watcher;
+  MVCC_SNAPSHOT *mvcc_snapshot = NULL;
   MVCC_REC_HEADER mvcc_header;
+  MVCC_SATISFIES_SNAPSHOT_RESULT snapshot_res;
+  RECDES peek_recdes;
+  RECDES *recdes;
+  VPID vpid;
+  OID oid;
+  PGSLOTID prev_slotid;
+  INT16 type;
+  SCAN_CODE scan;
+  int cache_last_fix_page_save;
 
-  assert (page_watcher != NULL);
-  assert (record_info != NULL);
-  assert (recdes != NULL);
+  assert (scan_cache != NULL && batch != NULL && batch->max_records > 0);
+  assert (ispeeking == COPY || scan_cache->cache_last_fix_page);
 
-  /* careful adding values in the right order */
-  db_make_int (record_info[HEAP_RECORD_INFO_T_VOLUMEID], oid.volid);
-  db_make_int (record_info[HEAP_RECORD_INFO_T_PAGEID], oid.pageid);
-  db_make_int (record_info[HEAP_RECORD_INFO_T_SLOTID], oid.slotid);
+  hfid = &scan_cache->node.hfid;
+  if (!OID_ISNULL (&scan_cache->node.class_oid))
+    {
+      class_oid = &scan_cache->node.class_oid;
+    }
 
-  /* get slot info */
-  slot_p = spage_get_slot (page_watcher->pgptr, oid.slotid);
-  if (slot_p == NULL)
+  if (scan_cache->mvcc_snapshot != NULL && scan_cache->mvcc_snapshot->snapshot_fnc != NULL
+      && (class_oid == NULL || !mvcc_is_mvcc_disabled_class (class_oid)))
     {
-      assert (0);
+      mvcc_snapshot = scan_cache->mvcc_snapshot;
     }
-  db_make_int (record_info[HEAP_RECORD_INFO_T_OFFSET], slot_p->offset_to_record);
-  db_make_int (record_info[HEAP_RECORD_INFO_T_LENGTH], slot_p->record_length);
-  db_make_int (record_info[HEAP_RECORD_INFO_T_REC_TYPE], slot_p->record_type);
 
-  /* get record info */
-  switch (slot_p->record_type)
+  PGBUF_INIT_WATCHER (&curr_page_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
+  PGBUF_INIT_WATCHER (&old_page_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
+
+  batch->n_records = 0;
+  batch->current = -1;
+  batch->area_used = 0;
+  batch->pgptr = NULL;
+
+  if (OID_ISNULL (&batch->last_oid))
     {
-    case REC_NEWHOME:
-    case REC_HOME:
-      if (scan_cache != NULL && ispeeking == COPY && recdes->data == NULL)
+      /* Retrieve the first objects of the heap */
+      oid.volid = hfid->vfid.volid;
+      oid.pageid = hfid->hpgid;
+      oid.slotid = 0;		/* i.e., will get slot 1 */
+    }
+  else
+    {
+      oid = batch->last_oid;
+    }
+
+  /* the page of the previous batch, if still fixed, is released here */
+  if (scan_cache->page_watcher.pgptr != NULL)
+    {
+      VPID_GET_FROM_OID (&vpid, &oid);
+      if (VPID_EQ (&vpid, pgbuf_get_vpid_ptr (scan_cache->page_watcher.pgptr)))
 	{
-	  scan_cache->assign_recdes_to_area (*recdes);
-	  /* The default allocated space is enough to save the instance. */
+	  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &curr_page_watcher);
 	}
-      if (scan_cache != NULL && scan_cache->cache_last_fix_page == true)
+      else
 	{
-	  scan = spage_get_record (thread_p, page_watcher->pgptr, oid.slotid, recdes, ispeeking);
-	  pgbuf_replace_watcher (thread_p, page_watcher, &scan_cache->page_watcher);
+	  pgbuf_ordered_unfix (thread_p, &scan_cache->page_watcher);
 	}
-      else
+    }
+
+  while (batch->n_records < batch->max_records)
+    {
+      if (curr_page_watcher.pgptr == NULL)
 	{
-	  scan = spage_get_record (thread_p, page_watcher->pgptr, oid.slotid, recdes, COPY);
-	  pgbuf_ordered_unfix (thread_p, page_watcher);
+	  VPID_GET_FROM_OID (&vpid, &oid);
+
+	  /* let page buffer load next pages ahead if the scan goes sequentially through the volume */
+	  pgbuf_read_ahead_notify (thread_p, &scan_cache->read_ahead, &vpid);
+	  curr_page_watcher.pgptr =
+	    heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, scan_cache,
+					 &curr_page_watcher);
+	  if (old_page_watcher.pgptr != NULL)
+	    {
+	      pgbuf_ordered_unfix (thread_p, &old_page_watcher);
+	    }
+	  if (curr_page_watcher.pgptr == NULL)
+	    {
+	      if (er_errid () == ER_PB_BAD_PAGEID)
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HEAP_UNKNOWN_OBJECT, 3, oid.volid, oid.pageid,
+			  oid.slotid);
+		}
+	      return S_ERROR;
+	    }
 	}
-      db_make_int (record_info[HEAP_RECORD_INFO_T_REPRID], or_rep_id (recdes));
-      db_make_int (record_info[HEAP_RECORD_INFO_T_REPRID], or_chn (recdes));
-      or_mvcc_get_header (recdes, &mvcc_header);
-      db_make_bigint (record_info[HEAP_RECORD_INFO_T_MVCC_INSID], MVCC_GET_INSID (&mvcc_header));
-      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+
+      /* Find the next object. Skip header and relocated records (i.e., new_home records). These records must be
+       * accessed through the relocation record (i.e., the object). */
+      prev_slotid = oid.slotid;
+      scan = spage_next_record (curr_page_watcher.pgptr, &oid.slotid, &peek_recdes, PEEK);
+      if (scan == S_END)
 	{
-	  db_make_bigint (record_info[HEAP_RECORD_INFO_T_MVCC_DELID], MVCC_GET_DELID (&mvcc_header));
+	  if (batch->n_records > 0)
+	    {
+	      /* the batch ends with the page */
+	      break;
+	    }
+
+	  /* Find next page of heap and continue scanning */
+	  (void) heap_vpid_next (thread_p, hfid, curr_page_watcher.pgptr, &vpid);
+	  pgbuf_replace_watcher (thread_p, &curr_page_watcher, &old_page_watcher);
+	  oid.volid = vpid.volid;
+	  oid.pageid = vpid.pageid;
+	  oid.slotid = -1;
+	  if (oid.pageid == NULL_PAGEID)
+	    {
+	      /* must be last page, end scanning */
+	      OID_SET_NULL (&batch->last_oid);
+	      pgbuf_ordered_unfix (thread_p, &old_page_watcher);
+	      return S_END;
+	    }
+	  continue;
 	}
-      else
+      else if (scan != S_SUCCESS)
 	{
-	  db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_DELID]);
+	  /* Error, stop scanning */
+	  pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+	  return S_ERROR;
 	}
-      db_make_int (record_info[HEAP_RECORD_INFO_T_CHN], OR_GET_MVCC_CHN (&mvcc_header));
-      db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_FLAGS], MVCC_GET_FLAG (&mvcc_header));
-      if (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_PREV_VERSION))
+
+      if (oid.slotid == HEAP_HEADER_AND_CHAIN_SLOTID)
 	{
-	  db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 1);
+	  continue;
 	}
-      else
+      type = spage_get_record_type (curr_page_watcher.pgptr, oid.slotid);
+      if (type == REC_NEWHOME || type == REC_ASSIGN_ADDRESS || type == REC_UNKNOWN)
 	{
-	  db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 0);
+	  continue;
+	}
+      if (class_oid != NULL && !OID_ISNULL (class_oid) && OID_IS_ROOTOID (&oid))
+	{
+	  /* not an instance of the class */
+	  continue;
 	}
-      break;
-
-    case REC_BIGONE:
-      /* Get the address of the content of the multiple page object */
-      COPY_OID (&forward_oid, (OID *) forward_recdes.data);
-      pgbuf_ordered_unfix (thread_p, page_watcher);
 
-      /* Now get the content of the multiple page object. */
-      /* Try to reuse the previously allocated area */
-      if (scan_cache != NULL && (ispeeking == PEEK || recdes->data == NULL))
+      if (type == REC_HOME)
 	{
-	  /* It is guaranteed that scan_cache is not NULL. */
-	  scan_cache->assign_recdes_to_area (*recdes);
+	  snapshot_res = SNAPSHOT_SATISFIED;
+	  if (mvcc_snapshot != NULL)
+	    {
+	      if (or_mvcc_get_header (&peek_recdes, &mvcc_header) != NO_ERROR)
+		{
+		  assert (false);
+		  pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+		  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+		  return S_ERROR;
+		}
+	      snapshot_res = mvcc_snapshot->snapshot_fnc (thread_p, &mvcc_header, mvcc_snapshot);
+	    }
 
-	  while ((scan = heap_ovf_get (thread_p, &forward_oid, recdes, NULL_CHN, NULL)) == S_DOESNT_FIT)
+	  if (snapshot_res == TOO_OLD_FOR_SNAPSHOT)
 	    {
-	      /* The object did not fit into such an area, reallocate a new area */
-	      assert (recdes->length < 0);
-	      scan_cache->assign_recdes_to_area (*recdes, (size_t) (-recdes->length));
+	      /* deleted */
+	      continue;
 	    }
-	  if (scan != S_SUCCESS)
+	  else if (snapshot_res == SNAPSHOT_SATISFIED)
 	    {
-	      recdes->data = NULL;
+	      if (heap_scan_batch_add (batch, &oid, &peek_recdes, ispeeking) == S_SUCCESS)
+		{
+		  continue;
+		}
+
+	      assert (ispeeking == COPY);
+	      if (batch->n_records > 0)
+		{
+		  /* the area is full; the object starts the next batch */
+		  oid.slotid = prev_slotid;
+		  break;
+		}
+	      if (heap_scan_batch_reserve_area (thread_p, batch, peek_recdes.length) != NO_ERROR)
+		{
+		  pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+		  return S_ERROR;
+		}
+	      oid.slotid = prev_slotid;
+	      continue;
 	    }
+	  /* else TOO_NEW_FOR_SNAPSHOT, an older version may be visible */
 	}
-      else
-	{
-	  scan = heap_ovf_get (thread_p, &forward_oid, recdes, NULL_CHN, NULL);
-	}
-      if (scan != S_SUCCESS)
+
+      /* The visible version is out of the page and getting it may unfix the page. */
+      if (batch->n_records > 0)
 	{
-	  return S_ERROR;
+	  /* the object starts the next batch */
+	  oid.slotid = prev_slotid;
+	  break;
 	}
-      db_make_int (record_info[HEAP_RECORD_INFO_T_REPRID], or_rep_id (recdes));
-      db_make_int (record_info[HEAP_RECORD_INFO_T_REPRID], or_chn (recdes));
 
-      or_mvcc_get_header (recdes, &mvcc_header);
-      db_make_bigint (record_info[HEAP_RECORD_INFO_T_MVCC_INSID], MVCC_GET_INSID (&mvcc_header));
-      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+      recdes = &batch->recdes[0];
+      recdes->data = batch->area;
+      recdes->area_size = batch->area_size;
+
+      cache_last_fix_page_save = scan_cache->cache_last_fix_page;
+      scan_cache->cache_last_fix_page = true;
+      pgbuf_replace_watcher (thread_p, &curr_page_watcher, &scan_cache->page_watcher);
+
+      scan = heap_scan_get_visible_version (thread_p, &oid, class_oid, recdes, scan_cache, COPY, NULL_CHN);
+
+      scan_cache->cache_last_fix_page = cache_last_fix_page_save;
+      if (scan_cache->page_watcher.pgptr != NULL)
 	{
-	  db_make_bigint (record_info[HEAP_RECORD_INFO_T_MVCC_DELID], MVCC_GET_DELID (&mvcc_header));
+	  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &curr_page_watcher);
 	}
-      else
+
+      if (scan == S_SUCCESS)
 	{
-	  db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_DELID]);
+	  batch->oids[0] = oid;
+	  batch->n_records = 1;
+	  batch->area_used = DB_ALIGN (recdes->length, MAX_ALIGNMENT);
 	}
-      db_make_int (record_info[HEAP_RECORD_INFO_T_CHN], OR_GET_MVCC_CHN (&mvcc_header));
-      db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_FLAGS], MVCC_GET_FLAG (&mvcc_header));
-      if (MVCC_IS_FLAG_SET (&mvcc_header, OR_MVCC_FLAG_VALID_PREV_VERSION))
+      else if (scan == S_DOESNT_FIT)
 	{
-	  db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 1);
+	  assert (recdes->length < 0);
+	  if (heap_scan_batch_reserve_area (thread_p, batch, -recdes->length) != NO_ERROR)
+	    {
+	      if (curr_page_watcher.pgptr != NULL)
+		{
+		  pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+		}
+	      return S_ERROR;
+	    }
+	  /* try again */
+	  oid.slotid = prev_slotid;
 	}
-      else
+      else if (scan != S_SNAPSHOT_NOT_SATISFIED && scan != S_DOESNT_EXIST)
 	{
-	  db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 0);
+	  /* error, stop scanning */
+	  if (curr_page_watcher.pgptr != NULL)
+	    {
+	      pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+	    }
+	  return scan;
 	}
-      break;
-    case REC_RELOCATION:
-    case REC_MARKDELETED:
-    case REC_DELETED_WILL_REUSE:
-    case REC_ASSIGN_ADDRESS:
-    case REC_UNKNOWN:
-    default:
-      db_make_null (record_info[HEAP_RECORD_INFO_T_REPRID]);
-      db_make_null (record_info[HEAP_RECORD_INFO_T_CHN]);
-      db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_INSID]);
-      db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_DELID]);
-      db_make_null (record_info[HEAP_RECORD_INFO_T_MVCC_FLAGS]);
+    }
 
-      db_make_int (record_info[HEAP_RECORD_INFO_T_MVCC_PREV_VERSION], 0);
+  assert (old_page_watcher.pgptr == NULL);
+  assert (batch->n_records > 0);
 
-      recdes->area_size = -1;
-      recdes->data = NULL;
-      if (scan_cache != NULL && scan_cache->cache_last_fix_page)
+  batch->last_oid = oid;
+  if (curr_page_watcher.pgptr != NULL)
+    {
+      if (ispeeking == PEEK)
 	{
-	  assert (PGBUF_IS_CLEAN_WATCHER (&(scan_cache->page_watcher)));
-	  if (page_watcher->pgptr != NULL)
-	    {
-	      pgbuf_replace_watcher (thread_p, page_watcher, &scan_cache->page_watcher);
-	    }
+	  /* keep the page of the peeked records fixed */
+	  pgbuf_replace_watcher (thread_p, &curr_page_watcher, &scan_cache->page_watcher);
+	  batch->pgptr = scan_cache->page_watcher.pgptr;
+	  LSA_COPY (&batch->page_lsa, pgbuf_get_lsa (batch->pgptr));
 	}
-      else if (page_watcher->pgptr != NULL)
+      else
 	{
-	  pgbuf_ordered_unfix (thread_p, page_watcher);
+	  pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
 	}
-      break;
     }
 
-  return scan;
-}
-
-/*
- * heap_next () - Retrieve or peek next object
- *   return: SCAN_CODE (Either of S_SUCCESS, S_DOESNT_FIT, S_END, S_ERROR)
- *   hfid(in):
- *   class_oid(in):
- *   next_oid(in/out): Object identifier of current record.
- *                     Will be set to next available record or NULL_OID when
- *                     there is not one.
- *   recdes(in/out): Pointer to a record descriptor. Will be modified to
- *                   describe the new record.
- *   scan_cache(in/out): Scan cache or NULL
- *   ispeeking(in): PEEK when the object is peeked, scan_cache cannot be NULL
- *                  COPY when the object is copied
- *
- */
-SCAN_CODE
-heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
-	   HEAP_SCANCACHE * scan_cache, int ispeeking)
-{
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL);
+  return S_SUCCESS;
 }
 
 /*
@@ -154,7 +154,7 @@ struct heap_scancache
     MVCC_SNAPSHOT *mvcc_snapshot;	/* mvcc snapshot */
     HEAP_SCANCACHE_NODE_LIST *partition_list;	/* list holding the heap file information for partition nodes involved
 						 * in the scan */
-
+    PGBUF_READ_AHEAD read_ahead;	/* sequential read-ahead state of scan */
 
     void start_area ();
     void end_area ();
@@ -182,6 +182,22 @@ struct heap_scanrange
   HEAP_SCANCACHE scan_cache;	/* Current cached information from previous scan */
 };
 
+typedef struct heap_scan_batch HEAP_SCAN_BATCH;
+struct heap_scan_batch
+{				/* Visible records of one heap page obtained with a single page fix */
+  OID last_oid;			/* Last slot examined; the next batch starts after it. NULL to start the heap */
+  OID *oids;			/* Object identifiers of the records */
+  RECDES *recdes;		/* Records; peeked from the page or copied into area */
+  int n_records;		/* Number of records in batch */
+  int max_records;		/* Capacity of oids and recdes */
+  int current;			/* Index of the record consumed last */
+  char *area;			/* Area of the copied records */
+  int area_size;		/* Size of area */
+  int area_used;		/* Used bytes of area */
+  PAGE_PTR pgptr;		/* Page the records were peeked from; NULL when they are copied */
+  LOG_LSA page_lsa;		/* LSA of pgptr when the records were peeked */
+};
+
 typedef struct heap_hfid_table HEAP_HFID_TABLE;
 struct heap_hfid_table
 {
@@ -417,6 +433,14 @@ extern void heap_scancache_end_modify (THREAD_ENTRY * thread_p, HEAP_SCANCACHE *
 extern SCAN_CODE heap_get_class_oid (THREAD_ENTRY * thread_p, const OID * oid, OID * class_oid);
 extern SCAN_CODE heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 			    RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking);
+extern int heap_scan_batch_start (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch, int max_records);
+extern void heap_scan_batch_end (THREAD_ENTRY * thread_p, HEAP_SCAN_BATCH * batch);
+extern void heap_scan_batch_reset (HEAP_SCAN_BATCH * batch);
+extern bool heap_scan_batch_resync (HEAP_SCAN_BATCH * batch, const OID * curr_oid, HEAP_SCANCACHE * scan_cache);
+extern SCAN_CODE heap_next_batch (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, HEAP_SCAN_BATCH * batch,
+				  HEAP_SCANCACHE * scan_cache, int ispeeking);
+extern SCAN_CODE heap_next_in_page (THREAD_ENTRY * thread_p, const VPID * vpid, OID * class_oid, OID * next_oid,
+				    RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking);
 extern SCAN_CODE heap_next_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 					RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking,
 					DB_VALUE ** cache_recordinfo);
@@ -472,6 +496,9 @@ extern void heap_attrinfo_end (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * at
 extern int heap_attrinfo_clear_dbvalues (HEAP_CACHE_ATTRINFO * attr_info);
 extern int heap_attrinfo_read_dbvalues (THREAD_ENTRY * thread_p, const OID * inst_oid, RECDES * recdes,
 					HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info);
+extern int heap_attrinfo_read_dbvalues_lazy (THREAD_ENTRY * thread_p, const OID * inst_oid, RECDES * recdes,
+					     HEAP_CACHE_ATTRINFO * attr_info);
+extern int heap_attrinfo_read_unread_dbvalue (HEAP_ATTRVALUE * value, HEAP_CACHE_ATTRINFO * attr_info);
 extern int heap_attrinfo_read_dbvalues_without_oid (THREAD_ENTRY * thread_p, RECDES * recdes,
 						    HEAP_CACHE_ATTRINFO * attr_info);
 extern int heap_attrinfo_delete_lob (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_CACHE_ATTRINFO * attr_info);
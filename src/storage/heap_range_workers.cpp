@@ -0,0 +1,359 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// heap_range_workers.cpp - implementation of threads processing the pages of heap files by ranges
+//
+
+#include "heap_range_workers.hpp"
+
+#include "error_manager.h"
+#include "file_manager.h"
+#include "log_impl.h"
+#include "memory_alloc.h"
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
+
+namespace cubheap
+{
+  //
+  // worker pool, shared by all owners. it is created when the server boots; its threads are started on demand and
+  // stop when idle.
+  //
+  class worker_context_manager : public cubthread::entry_manager
+  {
+    protected:
+      void on_create (context_type &context) override;
+      void on_retire (context_type &context) override;
+      void on_recycle (context_type &context) override;
+  };
+
+  static cubthread::entry_workpool *g_worker_pool = NULL;
+  static worker_context_manager *g_wp_context_manager = NULL;
+
+  class range_workers::worker_task : public cubthread::entry_task
+  {
+    public:
+      worker_task (range_workers &workers, int worker_index, int tran_index, css_conn_entry *conn)
+	: m_workers (workers)
+	, m_worker_index (worker_index)
+	, m_tran_index (tran_index)
+	, m_conn (conn)
+      {
+      }
+
+      void execute (cubthread::entry &thread_ref) override
+      {
+	thread_ref.tran_index = m_tran_index;
+	thread_ref.conn_entry = m_conn;
+
+	m_workers.execute_worker (thread_ref, m_worker_index);
+
+	er_clear ();
+	thread_ref.tran_index = LOG_SYSTEM_TRAN_INDEX;
+	thread_ref.conn_entry = NULL;
+
+	// the owner may end the work once this worker is retired
+	m_workers.retire_worker ();
+      }
+
+    private:
+      range_workers &m_workers;
+      int m_worker_index;
+      int m_tran_index;
+      css_conn_entry *m_conn;
+  };
+
+  //
+  // page_ranges
+  //
+  page_ranges::page_ranges ()
+    : m_pages ()
+    , m_ranges ()
+    , m_next_range (0)
+  {
+  }
+
+  int
+  page_ranges::collect (cubthread::entry &thread_ref, const HFID *hfids, int n_heaps)
+  {
+    VPID *vpids = NULL;
+    int n_vpids = 0;
+    int error_code;
+
+    clear ();
+
+    m_pages.resize (n_heaps);
+    for (int heap_index = 0; heap_index < n_heaps; heap_index++)
+      {
+	if (HFID_IS_NULL (&hfids[heap_index]))
+	  {
+	    continue;
+	  }
+
+	error_code = file_collect_user_pages (&thread_ref, &hfids[heap_index].vfid, &vpids, &n_vpids);
+	if (error_code != NO_ERROR)
+	  {
+	    ASSERT_ERROR ();
+	    return error_code;
+	  }
+	m_pages[heap_index].assign (vpids, vpids + n_vpids);
+	if (vpids != NULL)
+	  {
+	    db_private_free_and_init (&thread_ref, vpids);
+	  }
+
+	for (std::size_t first = 0; first < m_pages[heap_index].size (); first += RANGE_PAGES)
+	  {
+	    std::size_t last = std::min (first + RANGE_PAGES, m_pages[heap_index].size ());
+	    m_ranges.push_back ({ heap_index, first, last });
+	  }
+      }
+
+    return NO_ERROR;
+  }
+
+  bool
+  page_ranges::claim (range &claimed)
+  {
+    std::size_t index = m_next_range.fetch_add (1);
+
+    if (index >= m_ranges.size ())
+      {
+	return false;
+      }
+    claimed = m_ranges[index];
+    return true;
+  }
+
+  const VPID &
+  page_ranges::get_page (int heap_index, std::size_t index) const
+  {
+    return m_pages[heap_index][index];
+  }
+
+  std::size_t
+  page_ranges::get_range_count () const
+  {
+    return m_ranges.size ();
+  }
+
+  void
+  page_ranges::clear ()
+  {
+    m_pages.clear ();
+    m_ranges.clear ();
+    m_next_range = 0;
+  }
+
+  //
+  // range_workers
+  //
+  range_workers::range_workers ()
+    : m_ranges ()
+    , m_owner_tran_index (NULL_TRAN_INDEX)
+    , m_mutex ()
+    , m_ready_cv ()
+    , m_space_cv ()
+    , m_active_workers (0)
+    , m_stop (false)
+    , m_has_error (false)
+    , m_error_area ()
+  {
+  }
+
+  range_workers::~range_workers ()
+  {
+    assert (m_active_workers == 0);
+  }
+
+  int
+  range_workers::get_worker_limit (int worker_count) const
+  {
+    std::size_t range_count = m_ranges.get_range_count ();
+
+    if (g_worker_pool == NULL || range_count <= 1)
+      {
+	// the owner does all the work
+	return 0;
+      }
+    return (int) std::min ((std::size_t) std::min (worker_count, MAX_RANGE_WORKERS), range_count - 1);
+  }
+
+  int
+  range_workers::start_workers (cubthread::entry &owner, int worker_count, int worker_tran_index)
+  {
+    int started = 0;
+
+    assert (m_active_workers == 0);
+
+    m_owner_tran_index = owner.tran_index;
+    m_stop = false;
+    m_has_error = false;
+
+    if (g_worker_pool == NULL)
+      {
+	return 0;
+      }
+
+    for (int i = 1; i <= worker_count; i++)
+      {
+	worker_task *task = new worker_task (*this, i, worker_tran_index, owner.conn_entry);
+
+	{
+	  std::unique_lock<std::mutex> ulock (m_mutex);
+	  m_active_workers++;
+	}
+	if (!cubthread::get_manager ()->try_task (owner, g_worker_pool, task))
+	  {
+	    // the pool is busy; the work goes on with the workers already started
+	    delete task;
+
+	    std::unique_lock<std::mutex> ulock (m_mutex);
+	    m_active_workers--;
+	    break;
+	  }
+	started++;
+      }
+
+    return started;
+  }
+
+  void
+  range_workers::stop_workers ()
+  {
+    // tasks hold a reference to the workers
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    m_stop = true;
+    m_space_cv.notify_all ();
+    m_ready_cv.wait (ulock, [this] { return m_active_workers == 0; });
+  }
+
+  void
+  range_workers::wait_workers ()
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    m_ready_cv.wait (ulock, [this] { return m_active_workers == 0; });
+  }
+
+  bool
+  range_workers::is_stopped () const
+  {
+    return m_stop;
+  }
+
+  bool
+  range_workers::is_interrupted (cubthread::entry &thread_ref, bool &continue_checking) const
+  {
+    if (logtb_is_interrupted_tran (&thread_ref, false, &continue_checking, m_owner_tran_index))
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	return true;
+      }
+    return false;
+  }
+
+  void
+  range_workers::set_error ()
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+
+    if (!m_has_error)
+      {
+	int length = (int) sizeof (m_error_area);
+
+	(void) er_get_area_error (m_error_area, &length);
+	m_has_error = true;
+      }
+    m_stop = true;
+    m_space_cv.notify_all ();
+    m_ready_cv.notify_all ();
+  }
+
+  int
+  range_workers::raise_error ()
+  {
+    int error_code;
+
+    {
+      std::unique_lock<std::mutex> ulock (m_mutex);
+      if (!m_has_error)
+	{
+	  return NO_ERROR;
+	}
+    }
+
+    er_set_area_error (m_error_area);
+    error_code = er_errid ();
+    // some callers fail without setting an error
+    return (error_code != NO_ERROR) ? error_code : ER_FAILED;
+  }
+
+  void
+  range_workers::retire_worker ()
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    m_active_workers--;
+    m_ready_cv.notify_all ();
+  }
+
+  //
+  // worker pool
+  //
+  void
+  worker_context_manager::on_create (context_type &context)
+  {
+    context.claim_system_worker ();
+  }
+
+  void
+  worker_context_manager::on_retire (context_type &context)
+  {
+    context.retire_system_worker ();
+  }
+
+  void
+  worker_context_manager::on_recycle (context_type &context)
+  {
+    context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+    context.conn_entry = NULL;
+  }
+
+  void
+  initialize_range_workers ()
+  {
+#if defined (SERVER_MODE)
+    assert (g_worker_pool == NULL && g_wp_context_manager == NULL);
+
+    g_wp_context_manager = new worker_context_manager ();
+    g_worker_pool = cubthread::get_manager ()->create_worker_pool (MAX_RANGE_WORKERS, 2 * MAX_RANGE_WORKERS,
+		    "heap range workers", g_wp_context_manager, 1, false);
+#endif // SERVER_MODE
+  }
+
+  void
+  finalize_range_workers ()
+  {
+    if (g_worker_pool != NULL)
+      {
+	cubthread::get_manager ()->destroy_worker_pool (g_worker_pool);
+      }
+    delete g_wp_context_manager;
+    g_wp_context_manager = NULL;
+  }
+} // namespace cubheap
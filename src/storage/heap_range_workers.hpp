@@ -0,0 +1,367 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// heap_range_workers.hpp - threads processing the pages of heap files by ranges
+//
+//    The user pages of heap files are split into ranges of consecutive pages. The thread that owns the work and a few
+//    workers claim ranges one by one and process their pages (e.g. a parallel heap scan, the key extraction of an
+//    index load).
+//
+//    Workers are tasks of a pool shared by the whole server, created when it boots; its threads are started on demand
+//    and stop when idle. A worker is only started if a thread of the pool is free, therefore the owner processes
+//    ranges too and the work progresses even if no worker is available.
+//
+//    Workers check interrupts of the transaction of the owner once per page. The first error of a thread stops all
+//    workers and is raised again by the owner.
+//
+
+#ifndef _HEAP_RANGE_WORKERS_HPP_
+#define _HEAP_RANGE_WORKERS_HPP_
+
+#include "storage_common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// forward definitions
+// thread_entry.hpp
+namespace cubthread
+{
+  class entry;
+}
+
+namespace cubheap
+{
+  // maximum number of workers of one owner; also the number of threads of the worker pool
+  const int MAX_RANGE_WORKERS = 32;
+
+  // user pages of heap files, split into ranges claimed by the threads processing them
+  class page_ranges
+  {
+    public:
+      // pages of a range claimed at once by a thread
+      static const std::size_t RANGE_PAGES = 32;
+
+      struct range
+      {
+	int heap_index;                         // heap of the range in the array given to collect
+	std::size_t first;                      // first page of the range
+	std::size_t last;                       // page after the last page of the range
+      };
+
+      page_ranges ();
+
+      // collect the user pages of the heaps; null heaps have no pages
+      int collect (cubthread::entry &thread_ref, const HFID *hfids, int n_heaps);
+      // claim next range; false when all ranges were claimed
+      bool claim (range &claimed);
+      const VPID &get_page (int heap_index, std::size_t index) const;
+      std::size_t get_range_count () const;
+      void clear ();
+
+    private:
+      std::vector<std::vector<VPID>> m_pages;   // user pages of each heap
+      std::vector<range> m_ranges;
+      std::atomic<std::size_t> m_next_range;
+  };
+
+  // workers processing the page ranges of an owner thread
+  class range_workers
+  {
+    public:
+      range_workers ();
+      virtual ~range_workers ();
+
+      range_workers (const range_workers &) = delete;
+      range_workers &operator= (const range_workers &) = delete;
+
+      // get the number of workers that may help the owner; the owner processes one of the collected ranges
+      int get_worker_limit (int worker_count) const;
+      // start up to worker_count workers; fewer are started when the pool is busy. returns the number of workers
+      // started.
+      //
+      // owner (in)             : thread owning the work; workers use its connection and check its interrupts
+      // worker_tran_index (in) : transaction index of the workers
+      int start_workers (cubthread::entry &owner, int worker_count, int worker_tran_index);
+      // stop the workers and wait for them
+      void stop_workers ();
+      // wait for the workers to process the ranges left
+      void wait_workers ();
+
+      bool is_stopped () const;
+      // check interrupt of the transaction of the owner; ER_INTERRUPTED is set if it is interrupted
+      bool is_interrupted (cubthread::entry &thread_ref, bool &continue_checking) const;
+      // keep the error of this thread if it is the first one and stop the workers
+      void set_error ();
+      // set the first error of the workers on this thread; returns its code, NO_ERROR if none
+      int raise_error ();
+
+      // process ranges on a worker thread; worker_index starts at 1, zero is the owner
+      virtual void execute_worker (cubthread::entry &thread_ref, int worker_index) = 0;
+
+    protected:
+      page_ranges m_ranges;
+      int m_owner_tran_index;                   // transaction of the owner
+
+      std::mutex m_mutex;
+      std::condition_variable m_ready_cv;       // signaled when work is handed to the owner or a worker exits
+      std::condition_variable m_space_cv;       // signaled when the owner consumes work or the workers stop
+      int m_active_workers;
+      std::atomic<bool> m_stop;
+      bool m_has_error;
+      alignas (int) char m_error_area[1024];    // first error of a worker, see er_get_area_error
+
+    private:
+      // task of the worker pool running execute_worker; implementation in cpp file
+      class worker_task;
+
+      void retire_worker ();
+  };
+
+  // workers producing batches of a page range that are consumed by the owner
+  //
+  // Ready batches are handed to the owner through a bounded queue, so that workers do not run ahead of the owner.
+  // When no batch is ready, the owner produces one itself. Consumed batches are cleared and reused.
+  template <typename Batch>
+  class batch_producer : public range_workers
+  {
+    public:
+      // ready batches per worker
+      static const std::size_t READY_BATCHES_PER_WORKER = 2;
+
+      batch_producer ();
+      ~batch_producer () override;
+
+      // start up to worker_count workers; see start_workers
+      int start_producers (cubthread::entry &owner, int worker_count, int worker_tran_index);
+      // stop the workers and reuse all batches
+      void end_producers ();
+
+      // get the next batch for the owner; the batch got before is reused
+      //
+      // returns error code
+      //
+      // batch (out)        : next batch; NULL when all ranges were produced
+      // produce_range (in) : int (const page_ranges::range &, Batch &) filling a batch on the owner when none is
+      //                      ready
+      template <typename Func>
+      int next_batch (Batch *&batch, Func &&produce_range);
+
+    protected:
+      // produce the batches of the ranges claimed by a worker until all ranges are claimed or the workers stop
+      template <typename Func>
+      void produce_batches (Func &&produce_range);
+
+    private:
+      Batch *get_free_batch (bool wait_for_space);
+      void retire_batch (Batch *batch);
+
+      std::deque<Batch *> m_ready;              // batches ready to be consumed
+      std::vector<Batch *> m_free;              // consumed batches
+      std::size_t m_max_ready;
+      Batch *m_current;                         // batch consumed by the owner
+  };
+
+  // create the worker pool when the server boots; destroy it at shutdown, when no work runs
+  void initialize_range_workers ();
+  void finalize_range_workers ();
+
+  //
+  // batch_producer
+  //
+  template <typename Batch>
+  batch_producer<Batch>::batch_producer ()
+    : range_workers ()
+    , m_ready ()
+    , m_free ()
+    , m_max_ready (0)
+    , m_current (NULL)
+  {
+  }
+
+  template <typename Batch>
+  batch_producer<Batch>::~batch_producer ()
+  {
+    assert (m_ready.empty () && m_current == NULL);
+
+    for (Batch *batch : m_free)
+      {
+	delete batch;
+      }
+  }
+
+  template <typename Batch>
+  int
+  batch_producer<Batch>::start_producers (cubthread::entry &owner, int worker_count, int worker_tran_index)
+  {
+    m_max_ready = std::max (1, worker_count) * READY_BATCHES_PER_WORKER;
+    return start_workers (owner, worker_count, worker_tran_index);
+  }
+
+  template <typename Batch>
+  void
+  batch_producer<Batch>::end_producers ()
+  {
+    stop_workers ();
+
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    while (!m_ready.empty ())
+      {
+	m_ready.front ()->clear ();
+	m_free.push_back (m_ready.front ());
+	m_ready.pop_front ();
+      }
+    if (m_current != NULL)
+      {
+	m_current->clear ();
+	m_free.push_back (m_current);
+	m_current = NULL;
+      }
+  }
+
+  template <typename Batch>
+  template <typename Func>
+  int
+  batch_producer<Batch>::next_batch (Batch *&batch, Func &&produce_range)
+  {
+    page_ranges::range range;
+    int error_code;
+
+    if (m_current != NULL)
+      {
+	retire_batch (m_current);
+	m_current = NULL;
+      }
+    batch = NULL;
+
+    while (true)
+      {
+	{
+	  std::unique_lock<std::mutex> ulock (m_mutex);
+	  if (m_has_error)
+	    {
+	      ulock.unlock ();
+	      return raise_error ();
+	    }
+	  if (!m_ready.empty ())
+	    {
+	      m_current = m_ready.front ();
+	      m_ready.pop_front ();
+	      m_space_cv.notify_one ();
+	      batch = m_current;
+	      return NO_ERROR;
+	    }
+	}
+
+	// no batch is ready; produce one on this thread
+	if (m_ranges.claim (range))
+	  {
+	    m_current = get_free_batch (false);
+	    error_code = produce_range (range, *m_current);
+	    if (error_code != NO_ERROR)
+	      {
+		return error_code;
+	      }
+	    batch = m_current;
+	    return NO_ERROR;
+	  }
+
+	// all ranges are claimed; wait for the workers
+	std::unique_lock<std::mutex> ulock (m_mutex);
+	m_ready_cv.wait (ulock, [this] { return !m_ready.empty () || m_active_workers == 0 || m_has_error; });
+	if (m_ready.empty () && !m_has_error)
+	  {
+	    return NO_ERROR;
+	  }
+      }
+  }
+
+  template <typename Batch>
+  template <typename Func>
+  void
+  batch_producer<Batch>::produce_batches (Func &&produce_range)
+  {
+    page_ranges::range range;
+    Batch *batch;
+
+    while (!m_stop && m_ranges.claim (range))
+      {
+	batch = get_free_batch (true);
+	if (batch == NULL)
+	  {
+	    // stopped
+	    break;
+	  }
+	if (produce_range (range, *batch) != NO_ERROR)
+	  {
+	    retire_batch (batch);
+	    set_error ();
+	    break;
+	  }
+
+	std::unique_lock<std::mutex> ulock (m_mutex);
+	m_ready.push_back (batch);
+	m_ready_cv.notify_one ();
+      }
+  }
+
+  template <typename Batch>
+  Batch *
+  batch_producer<Batch>::get_free_batch (bool wait_for_space)
+  {
+    Batch *batch;
+    std::unique_lock<std::mutex> ulock (m_mutex);
+
+    if (wait_for_space)
+      {
+	// do not run ahead of the owner
+	m_space_cv.wait (ulock, [this] { return m_stop || m_ready.size () < m_max_ready; });
+	if (m_stop)
+	  {
+	    return NULL;
+	  }
+      }
+
+    if (m_free.empty ())
+      {
+	return new Batch ();
+      }
+    batch = m_free.back ();
+    m_free.pop_back ();
+    return batch;
+  }
+
+  template <typename Batch>
+  void
+  batch_producer<Batch>::retire_batch (Batch *batch)
+  {
+    batch->clear ();
+
+    std::unique_lock<std::mutex> ulock (m_mutex);
+    m_free.push_back (batch);
+  }
+} // namespace cubheap
+
+#endif // _HEAP_RANGE_WORKERS_HPP_
@@ -30,9 +30,12 @@
 #include "heap_file.h"
 #include "log_append.hpp"
 #include "log_manager.h"
+#include "lz4.h"
 #include "memory_alloc.h"
 #include "mvcc.h"
+#include "object_representation.h"
 #include "page_buffer.h"
+#include "perf_monitor.h"
 #include "slotted_page.h"
 #include "storage_common.h"
 
@@ -55,6 +58,20 @@ struct overflow_rest_part
   char data[1];			/* Really more than one */
 };
 
+/*
+ * Heap overflow records may be stored compressed with LZ4. The MVCC header is kept uncompressed at the start of the
+ * first page, since vacuum and heap update it in place. A compressed record stores its negated (uncompressed) length
+ * in the first part and the length of the compressed data right after the MVCC header:
+ *
+ *   ------------------------------------------------------------------------
+ *   |Next_vpid |-Length|MVCC header|Zip length|... LZ4 compressed data ...| ...
+ *   ------------------------------------------------------------------------
+ */
+#define OVERFLOW_ZIP_PREFIX_SIZE OR_MVCC_MAX_HEADER_SIZE
+#define OVERFLOW_ZIP_HEADER_SIZE (OVERFLOW_ZIP_PREFIX_SIZE + OR_INT_SIZE)
+
+#define OVERFLOW_IS_COMPRESSED(first_part) ((first_part)->length < 0)
+
 typedef enum
 {
   OVERFLOW_DO_DELETE,
@@ -66,6 +83,10 @@ static const VPID *overflow_traverse (THREAD_ENTRY * thread_p, const VFID * ovf_
 				      OVERFLOW_DO_FUNC func);
 static int overflow_delete_internal (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * vpid, PAGE_PTR pgptr);
 static int overflow_flush_internal (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
+static int overflow_get_stored_length (const OVERFLOW_FIRST_PART * first_part);
+static int overflow_compress (THREAD_ENTRY * thread_p, const RECDES * recdes, char **zip_data, int *zip_length);
+static int overflow_uncompress (THREAD_ENTRY * thread_p, const char *zip_data, int length, char *area,
+				int start_offset, int nbytes);
 
 /*
  * overflow_insert () - Insert an overflow record (multiple-pages size record).
@@ -76,6 +97,7 @@ static int overflow_flush_internal (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
  * ovf_vpid (out) : Output VPID of first page in multi-page data
  * recdes (in)    : Multi-page data
  * file_type (in) : Overflow file type
+ * compress (in)  : True to store the data LZ4 compressed (heap overflow files only)
  *
  * Note: Data in overflow is composed of several pages. Pages in the overflow
  *       area are not shared among other pieces of overflow data.
@@ -92,7 +114,8 @@ static int overflow_flush_internal (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
  *       relocation overflow record data which has been appropriately locked.
  */
 int
-overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid, RECDES * recdes, FILE_TYPE file_type)
+overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid, RECDES * recdes, FILE_TYPE file_type,
+		 bool compress)
 {
   OVERFLOW_FIRST_PART *first_part;
   OVERFLOW_REST_PART *rest_parts;
@@ -100,6 +123,8 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
   int length, copy_length;
   INT32 npages = 0;
   char *data;
+  char *zip_data = NULL;
+  int zip_length = 0;
   LOG_DATA_ADDR addr;
   int i;
   VPID *vpids = NULL;
@@ -115,18 +140,39 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
   assert (file_type == FILE_TEMP	/* sort files */
 	  || file_type == FILE_BTREE_OVERFLOW_KEY	/* b-tree overflow key */
 	  || file_type == FILE_MULTIPAGE_OBJECT_HEAP /* heap overflow file */ );
+  assert (!compress || file_type == FILE_MULTIPAGE_OBJECT_HEAP);
 
   addr.vfid = ovf_vfid;
   addr.offset = 0;
 
+  if (compress)
+    {
+      error_code = overflow_compress (thread_p, recdes, &zip_data, &zip_length);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  if (zip_data != NULL)
+    {
+      data = zip_data;
+      length = zip_length;
+    }
+  else
+    {
+      data = recdes->data;
+      length = recdes->length;
+    }
+
   /*
    * Guess the number of pages. The total number of pages is found by dividing length by page size - the smallest
    * header. Then, we make sure that this estimate is correct. */
-  length = recdes->length - (DB_PAGESIZE - (int) offsetof (OVERFLOW_FIRST_PART, data));
-  if (length > 0)
+  copy_length = length - (DB_PAGESIZE - (int) offsetof (OVERFLOW_FIRST_PART, data));
+  if (copy_length > 0)
     {
       i = DB_PAGESIZE - offsetof (OVERFLOW_REST_PART, data);
-      npages = 1 + CEIL_PTVDIV (length, i);
+      npages = 1 + CEIL_PTVDIV (copy_length, i);
     }
   else
     {
@@ -139,7 +185,8 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
       if (vpids == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (npages + 1) * sizeof (VPID));
-	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	  error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	  goto exit_on_error;
 	}
     }
   else
@@ -178,9 +225,6 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
 
   /* Copy the content of the data */
 
-  data = recdes->data;
-  length = recdes->length;
-
   for (i = 0; i < npages; i++)
     {
       addr.pgptr = pgbuf_fix (thread_p, &vpids[i], OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
@@ -198,7 +242,7 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
 	  first_part = (OVERFLOW_FIRST_PART *) addr.pgptr;
 
 	  first_part->next_vpid = vpids[i + 1];
-	  first_part->length = length;
+	  first_part->length = (zip_data != NULL) ? -recdes->length : length;
 	  copyto = (char *) first_part->data;
 
 	  copy_length = DB_PAGESIZE - offsetof (OVERFLOW_FIRST_PART, data);
@@ -260,6 +304,10 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
     {
       free_and_init (vpids);
     }
+  if (zip_data != NULL)
+    {
+      db_private_free_and_init (thread_p, zip_data);
+    }
   return NO_ERROR;
 
 exit_on_error:
@@ -269,10 +317,14 @@ exit_on_error:
       log_sysop_abort (thread_p);
     }
 
-  if (vpids != vpids_buffer)
+  if (vpids != NULL && vpids != vpids_buffer)
     {
       free_and_init (vpids);
     }
+  if (zip_data != NULL)
+    {
+      db_private_free_and_init (thread_p, zip_data);
+    }
   return error_code;
 }
 
@@ -372,6 +424,7 @@ exit_on_error:
  * ovf_vpid (in)  : VPID of first page in multi-page data
  * recdes (in)    : New multi-page data
  * file_type (in) : Overflow file type
+ * compress (in)  : True to store the new data LZ4 compressed
  *
  * Note: The function may allocate or deallocate several overflow pages if the multipage data increase/decrease in
  *       length.
@@ -381,7 +434,7 @@ exit_on_error:
  */
 int
 overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ovf_vpid, RECDES * recdes,
-		 FILE_TYPE file_type)
+		 FILE_TYPE file_type, bool compress)
 {
   OVERFLOW_FIRST_PART *first_part = NULL;
   OVERFLOW_REST_PART *rest_parts = NULL;
@@ -392,6 +445,8 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
   int old_length = 0;
   int length;
   char *data;
+  char *zip_data = NULL;
+  int zip_length = 0;
   VPID next_vpid;
   VPID *addr_vpid_ptr;
   LOG_DATA_ADDR addr;
@@ -410,8 +465,25 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
   addr.offset = 0;
   next_vpid = *ovf_vpid;
 
-  data = recdes->data;
-  length = recdes->length;
+  if (compress)
+    {
+      error_code = overflow_compress (thread_p, recdes, &zip_data, &zip_length);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  if (zip_data != NULL)
+    {
+      data = zip_data;
+      length = zip_length;
+    }
+  else
+    {
+      data = recdes->data;
+      length = recdes->length;
+    }
 
   log_sysop_start (thread_p);
 
@@ -434,7 +506,7 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
 	{
 	  /* This is the first part */
 	  first_part = (OVERFLOW_FIRST_PART *) addr.pgptr;
-	  old_length = first_part->length;
+	  old_length = overflow_get_stored_length (first_part);
 
 	  copyto = (char *) first_part->data;
 	  next_vpid = first_part->next_vpid;
@@ -462,7 +534,7 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
 	    }
 
 	  /* Modify the new length */
-	  first_part->length = length;
+	  first_part->length = (zip_data != NULL) ? -recdes->length : length;
 
 	  /* notify the first part of overflow recdes */
 	  log_append_empty_record (thread_p, LOG_DUMMY_OVF_RECORD, &addr);
@@ -598,12 +670,20 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
   /* done */
   log_sysop_attach_to_outer (thread_p);
 
+  if (zip_data != NULL)
+    {
+      db_private_free_and_init (thread_p, zip_data);
+    }
   return NO_ERROR;
 
 exit_on_error:
 
   log_sysop_abort (thread_p);
 
+  if (zip_data != NULL)
+    {
+      db_private_free_and_init (thread_p, zip_data);
+    }
   return error_code;
 }
 
@@ -714,6 +794,11 @@ overflow_get_length (THREAD_ENTRY * thread_p, const VPID * ovf_vpid)
   (void) pgbuf_check_page_ptype (thread_p, pgptr, PAGE_OVERFLOW);
 
   length = ((OVERFLOW_FIRST_PART *) pgptr)->length;
+  if (length < 0)
+    {
+      /* compressed; the length of the uncompressed data is stored negated */
+      length = -length;
+    }
 
   pgbuf_unfix_and_init (thread_p, pgptr);
 
@@ -749,6 +834,10 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
   VPID next_vpid;
   int copy_length;
   char *data;
+  char *zip_data = NULL;
+  int length;
+  int seek_offset, copy_nbytes;
+  SCAN_CODE scan = S_SUCCESS;
 
   /*
    * We don't need to lock the overflow pages since these pages are not
@@ -780,7 +869,8 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
 	}
     }
 
-  *remaining_length = first_part->length;
+  length = OVERFLOW_IS_COMPRESSED (first_part) ? -first_part->length : first_part->length;
+  *remaining_length = length;
 
   if (max_nbytes < 0)
     {
@@ -826,20 +916,42 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
 
   recdes->length = max_nbytes;
 
+  if (OVERFLOW_IS_COMPRESSED (first_part) && start_offset + max_nbytes > OVERFLOW_ZIP_PREFIX_SIZE)
+    {
+      /* The requested bytes are compressed. Copy all stored bytes and uncompress them at the end. */
+      copy_nbytes = overflow_get_stored_length (first_part);
+      zip_data = (char *) db_private_alloc (thread_p, copy_nbytes);
+      if (zip_data == NULL)
+	{
+	  pgbuf_unfix_and_init (thread_p, pgptr);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) copy_nbytes);
+	  recdes->length = 0;
+	  return S_ERROR;
+	}
+      data = zip_data;
+      seek_offset = 0;
+    }
+  else
+    {
+      /* Only the uncompressed prefix is requested, or the data is not compressed at all */
+      data = recdes->data;
+      seek_offset = start_offset;
+      copy_nbytes = max_nbytes;
+    }
+
   /* Start copying the object */
-  data = recdes->data;
   copyfrom = (char *) first_part->data;
   next_vpid = first_part->next_vpid;
 
-  while (max_nbytes > 0)
+  while (copy_nbytes > 0)
     {
       /* Continue seeking until the starting offset is reached (passed) */
-      if (start_offset > 0)
+      if (seek_offset > 0)
 	{
 	  /* Advance .. seek as much as you can */
-	  copy_length = (int) ((copyfrom + start_offset) > ((char *) pgptr + DB_PAGESIZE)
-			       ? DB_PAGESIZE - (copyfrom - (char *) pgptr) : start_offset);
-	  start_offset -= copy_length;
+	  copy_length = (int) ((copyfrom + seek_offset) > ((char *) pgptr + DB_PAGESIZE)
+			       ? DB_PAGESIZE - (copyfrom - (char *) pgptr) : seek_offset);
+	  seek_offset -= copy_length;
 	  copyfrom += copy_length;
 	}
 
@@ -848,15 +960,15 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
        * and there is something to copy in current page (i.e., not at end
        * of the page) and we are not located at the end of the overflow record.
        */
-      if (start_offset == 0)
+      if (seek_offset == 0)
 	{
-	  if (copyfrom + max_nbytes > (char *) pgptr + DB_PAGESIZE)
+	  if (copyfrom + copy_nbytes > (char *) pgptr + DB_PAGESIZE)
 	    {
 	      copy_length = DB_PAGESIZE - CAST_BUFLEN (copyfrom - (char *) pgptr);
 	    }
 	  else
 	    {
-	      copy_length = max_nbytes;
+	      copy_length = copy_nbytes;
 	    }
 
 	  /* If we were not at the end of the page, perform the copy */
@@ -864,25 +976,27 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
 	    {
 	      memcpy (data, copyfrom, copy_length);
 	      data += copy_length;
-	      max_nbytes -= copy_length;
+	      copy_nbytes -= copy_length;
 	    }
 	}
 
       pgbuf_unfix_and_init (thread_p, pgptr);
-      if (max_nbytes > 0)
+      if (copy_nbytes > 0)
 	{
 	  if (VPID_ISNULL (&next_vpid))
 	    {
 	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HEAP_OVFADDRESS_CORRUPTED, 3, ovf_vpid->volid,
 		      ovf_vpid->pageid, NULL_SLOTID);
-	      return S_ERROR;
+	      scan = S_ERROR;
+	      goto end;
 	    }
 
 	  pgptr = pgbuf_fix (thread_p, &next_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
 	  if (pgptr == NULL)
 	    {
 	      recdes->length = 0;
-	      return S_ERROR;
+	      scan = S_ERROR;
+	      goto end;
 	    }
 
 	  (void) pgbuf_check_page_ptype (thread_p, pgptr, PAGE_OVERFLOW);
@@ -893,7 +1007,22 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
 	}
     }
 
-  return S_SUCCESS;
+  if (zip_data != NULL)
+    {
+      if (overflow_uncompress (thread_p, zip_data, length, recdes->data, start_offset, max_nbytes) != NO_ERROR)
+	{
+	  recdes->length = 0;
+	  scan = S_ERROR;
+	}
+    }
+
+end:
+  if (zip_data != NULL)
+    {
+      db_private_free_and_init (thread_p, zip_data);
+    }
+
+  return scan;
 }
 
 /*
@@ -959,9 +1088,9 @@ overflow_get_capacity (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, int *ovf_
   (void) pgbuf_check_page_ptype (thread_p, pgptr, PAGE_OVERFLOW);
 
   first_part = (OVERFLOW_FIRST_PART *) pgptr;
-  remain_length = first_part->length;
+  remain_length = overflow_get_stored_length (first_part);
 
-  *ovf_size = first_part->length;
+  *ovf_size = OVERFLOW_IS_COMPRESSED (first_part) ? -first_part->length : first_part->length;
   *ovf_num_pages = 0;
   *ovf_overhead = 0;
   *ovf_free_space = 0;
@@ -1024,6 +1153,144 @@ exit_on_error:
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
 
+/*
+ * overflow_get_stored_length () - Get the number of bytes the overflow data occupies in its pages
+ *   return: stored length
+ *   first_part(in): First part of the overflow data
+ */
+static int
+overflow_get_stored_length (const OVERFLOW_FIRST_PART * first_part)
+{
+  if (OVERFLOW_IS_COMPRESSED (first_part))
+    {
+      return OVERFLOW_ZIP_HEADER_SIZE + OR_GET_INT (first_part->data + OVERFLOW_ZIP_PREFIX_SIZE);
+    }
+
+  return first_part->length;
+}
+
+/*
+ * overflow_compress () - Compress heap overflow data with LZ4
+ *   return: error code
+ *   recdes(in): Data to compress. It starts with the MVCC record header, which is kept uncompressed.
+ *   zip_data(out): Compressed data, or NULL if compression does not reduce the size
+ *   zip_length(out): Length of compressed data
+ *
+ * Note: zip_data is allocated with db_private_alloc and must be freed by the caller.
+ */
+static int
+overflow_compress (THREAD_ENTRY * thread_p, const RECDES * recdes, char **zip_data, int *zip_length)
+{
+  PERF_UTIME_TRACKER time_track;
+  char *buffer;
+  int body_length;
+  int bound;
+  int compressed_length;
+
+  *zip_data = NULL;
+  *zip_length = 0;
+
+  body_length = recdes->length - OVERFLOW_ZIP_PREFIX_SIZE;
+  if (body_length <= 0 || body_length > LZ4_MAX_INPUT_SIZE)
+    {
+      return NO_ERROR;
+    }
+
+  bound = LZ4_compressBound (body_length);
+  buffer = (char *) db_private_alloc (thread_p, OVERFLOW_ZIP_HEADER_SIZE + bound);
+  if (buffer == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) (OVERFLOW_ZIP_HEADER_SIZE + bound));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  PERF_UTIME_TRACKER_START (thread_p, &time_track);
+  compressed_length =
+    LZ4_compress_default (recdes->data + OVERFLOW_ZIP_PREFIX_SIZE, buffer + OVERFLOW_ZIP_HEADER_SIZE, body_length,
+			  bound);
+  PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_HEAP_LZ4_COMPRESS_TIME_COUNTERS);
+
+  if (compressed_length <= 0 || OVERFLOW_ZIP_HEADER_SIZE + compressed_length >= recdes->length)
+    {
+      /* not worth it; store the data as it is */
+      db_private_free_and_init (thread_p, buffer);
+      return NO_ERROR;
+    }
+
+  memcpy (buffer, recdes->data, OVERFLOW_ZIP_PREFIX_SIZE);
+  OR_PUT_INT (buffer + OVERFLOW_ZIP_PREFIX_SIZE, compressed_length);
+
+  *zip_data = buffer;
+  *zip_length = OVERFLOW_ZIP_HEADER_SIZE + compressed_length;
+
+  perfmon_add_stat (thread_p, PSTAT_HEAP_BIG_COMPRESSED_INPUT_BYTES, recdes->length);
+  perfmon_add_stat (thread_p, PSTAT_HEAP_BIG_COMPRESSED_OUTPUT_BYTES, *zip_length);
+
+  return NO_ERROR;
+}
+
+/*
+ * overflow_uncompress () - Uncompress heap overflow data and copy a portion of it
+ *   return: error code
+ *   zip_data(in): Stored (compressed) overflow data
+ *   length(in): Length of the uncompressed data
+ *   area(out): Where to copy the requested portion
+ *   start_offset(in): Start offset of the portion
+ *   nbytes(in): Length of the portion
+ */
+static int
+overflow_uncompress (THREAD_ENTRY * thread_p, const char *zip_data, int length, char *area, int start_offset,
+		     int nbytes)
+{
+  PERF_UTIME_TRACKER time_track;
+  char *buffer;
+  int zip_length;
+  int body_length;
+  int error_code = NO_ERROR;
+
+  assert (start_offset >= 0 && start_offset + nbytes <= length);
+
+  if (start_offset == 0 && nbytes == length)
+    {
+      /* uncompress directly in the caller area */
+      buffer = area;
+    }
+  else
+    {
+      buffer = (char *) db_private_alloc (thread_p, length);
+      if (buffer == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) length);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+    }
+
+  memcpy (buffer, zip_data, OVERFLOW_ZIP_PREFIX_SIZE);
+  zip_length = OR_GET_INT (zip_data + OVERFLOW_ZIP_PREFIX_SIZE);
+  body_length = length - OVERFLOW_ZIP_PREFIX_SIZE;
+
+  PERF_UTIME_TRACKER_START (thread_p, &time_track);
+  if (LZ4_decompress_safe (zip_data + OVERFLOW_ZIP_HEADER_SIZE, buffer + OVERFLOW_ZIP_PREFIX_SIZE, zip_length,
+			   body_length) != body_length)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_DECOMPRESS_FAIL, 0);
+      error_code = ER_IO_LZ4_DECOMPRESS_FAIL;
+    }
+  PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_HEAP_LZ4_DECOMPRESS_TIME_COUNTERS);
+
+  if (buffer != area)
+    {
+      if (error_code == NO_ERROR)
+	{
+	  memcpy (area, buffer + start_offset, nbytes);
+	}
+      db_private_free_and_init (thread_p, buffer);
+    }
+
+  return error_code;
+}
+
 #if defined (CUBRID_DEBUG)
 /*
  * overflow_dump () - Dump an overflow object in ascii
@@ -1056,7 +1323,7 @@ overflow_dump (THREAD_ENTRY * thread_p, FILE * fp, VPID * ovf_vpid)
     }
 
   first_part = (OVERFLOW_FIRST_PART *) pgptr;
-  remain_length = first_part->length;
+  remain_length = overflow_get_stored_length (first_part);
   dumpfrom = (char *) first_part->data;
   next_vpid = first_part->next_vpid;
 
@@ -28,6 +28,11 @@
 #include <stddef.h>
 #include <string.h>
 #include <assert.h>
+#if defined (LINUX)
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif /* LINUX */
 
 #include "page_buffer.h"
 
@@ -59,6 +64,7 @@
 #include "double_write_buffer.h"
 #include "resource_tracker.hpp"
 #include "tde.h"
+#include "changed_page_tracker.hpp"
 #include "show_scan.h"
 #include "numeric_opfunc.h"
 #include "dbtype.h"
@@ -129,7 +135,7 @@ static int rv;
   ((PGBUF_BCB *) ((char *) &(pgbuf_Pool.BCB_table[0]) + (PGBUF_BCB_SIZEOF * (i))))
 
 #define PGBUF_FIND_IOPAGE_PTR(i) \
-  ((PGBUF_IOPAGE_BUFFER *) ((char *) &(pgbuf_Pool.iopage_table[0]) + (PGBUF_IOPAGE_BUFFER_SIZE * (i))))
+  ((PGBUF_IOPAGE_BUFFER *) ((char *) &(pgbuf_Pool.iopage_table[0]) + (pgbuf_Pool.iopage_buffer_size * (i))))
 
 #define PGBUF_FIND_BUFFER_GUARD(bufptr) \
   (&bufptr->iopage_buffer->iopage.page[DB_PAGESIZE])
@@ -229,6 +235,9 @@ typedef enum
 #define PGBUF_BCB_TO_VACUUM_FLAG            ((int) 0x04000000)
 /* flag for asynchronous flush request */
 #define PGBUF_BCB_ASYNC_FLUSH_REQ           ((int) 0x02000000)
+/* flag for bcb's loaded by read-ahead that were not fixed by anyone yet. cleared by first fix (a prefetch hit) or by
+ * victimization (a wasted prefetch). */
+#define PGBUF_BCB_PREFETCHED_FLAG           ((int) 0x01000000)
 
 /* add all flags here */
 #define PGBUF_BCB_FLAGS_MASK \
@@ -238,7 +247,8 @@ typedef enum
    | PGBUF_BCB_INVALIDATE_DIRECT_VICTIM_FLAG \
    | PGBUF_BCB_MOVE_TO_LRU_BOTTOM_FLAG \
    | PGBUF_BCB_TO_VACUUM_FLAG \
-   | PGBUF_BCB_ASYNC_FLUSH_REQ)
+   | PGBUF_BCB_ASYNC_FLUSH_REQ \
+   | PGBUF_BCB_PREFETCHED_FLAG)
 
 /* add flags that invalidate a victim candidate here */
 /* 1. dirty bcb's cannot be victimized.
@@ -498,6 +508,10 @@ struct pgbuf_bcb
 
   LOG_LSA oldest_unflush_lsa;	/* The oldest LSA record of the page that has not been written to disk */
   PGBUF_IOPAGE_BUFFER *iopage_buffer;	/* pointer to iopage buffer structure */
+
+  volatile UINT64 version;	/* changed whenever page may change, for optimistic reads (see
+				 * pgbuf_optimistic_read_page). odd if BCB is not in hash chain, incremented by two
+				 * whenever write latch is granted. */
 };
 
 /* iopage buffer structure */
@@ -706,8 +720,77 @@ struct pgbuf_direct_victim
   /* *INDENT-ON* */
 };
 #define PGBUF_FLUSHED_BCBS_BUFFER_SIZE (8 * 1024)	/* 8k */
+#define PGBUF_PREFETCH_REQUESTS_BUFFER_SIZE (4 * 1024)	/* 4k */
+
+/* PGBUF_WARMUP - the hot page set of buffer is saved to a file next to database volumes when server goes down and is
+ * loaded back in background when server restarts.
+ */
+#define PGBUF_WARMUP_MAGIC 0x70627772	/* "pbwr" */
+#define PGBUF_WARMUP_VERSION 1
+#define PGBUF_WARMUP_MAX_RUN_PAGES 64	/* maximum number of consecutive pages read at once */
+
+typedef struct pgbuf_warmup_file_header PGBUF_WARMUP_FILE_HEADER;
+struct pgbuf_warmup_file_header
+{
+  INT32 magic;
+  INT32 version;
+  INT32 page_size;
+  INT32 count;			/* number of VPID's following header */
+  INT64 db_creation;		/* database creation time; the file is ignored if it does not match */
+};
+
+typedef enum
+{
+  PGBUF_WARMUP_NOT_STARTED,	/* waiting for server to restart */
+  PGBUF_WARMUP_LOADING,		/* pages are being loaded */
+  PGBUF_WARMUP_LOADED		/* loading is finished (or was not needed); hot set may be dumped */
+} PGBUF_WARMUP_STATUS;
+
+typedef struct pgbuf_warmup PGBUF_WARMUP;
+struct pgbuf_warmup
+{
+  char file_name[PATH_MAX];	/* empty if warmup is not enabled */
+  PGBUF_WARMUP_STATUS status;
+  VPID *vpids;			/* sorted pages to load */
+  int count;
+  int next;			/* next page to load */
+  char *io_pages_area;		/* allocated read buffer for PGBUF_WARMUP_MAX_RUN_PAGES */
+  char *io_pages;		/* io_pages_area aligned for direct I/O */
+  THREAD_ENTRY *run_reader;	/* thread loading the run read in io_pages; NULL if no run is read */
+  VPID run_first;		/* first page of the run */
+  int run_npages;		/* number of pages in the run */
+  time_t last_dump_time;
+};
 #endif /* SERVER_MODE */
 
+/* PGBUF_CHANGED_PAGES - pages written to disk since the last backups, so that incremental backups read only them.
+ * The state is saved at checkpoints and at shutdown; pages changed after a save are marked again by recovery redo.
+ */
+typedef struct pgbuf_changed_pages PGBUF_CHANGED_PAGES;
+struct pgbuf_changed_pages
+{
+  // *INDENT-OFF*
+  cubio::changed_page_tracker *tracker;	/* NULL if tracking is disabled */
+  // *INDENT-ON*
+  char file_name[PATH_MAX];
+  LOG_LSA rebuild_lsa;		/* the loaded state misses pages logged since this LSA */
+};
+
+#define PGBUF_NUMA_MAX_NODES 64	/* bits of mbind node masks */
+
+/* PGBUF_MEMORY_REGION - memory backing BCB table or io page table. the region is either allocated with malloc or
+ * mapped (explicit or transparent huge pages, or regular pages when a NUMA policy is applied).
+ */
+typedef struct pgbuf_memory_region PGBUF_MEMORY_REGION;
+struct pgbuf_memory_region
+{
+  void *ptr;
+  size_t map_size;		/* size of mapping; 0 if allocated with malloc */
+  size_t page_size;		/* size of memory pages backing the region */
+  PGBUF_HUGE_PAGES_MODE huge_pages;	/* effective huge pages mode */
+  size_t numa_chunk_size;	/* size of the range placed on each node by partition policy; 0 if not partitioned */
+};
+
 /* The buffer Pool */
 struct pgbuf_buffer_pool
 {
@@ -720,6 +803,12 @@ struct pgbuf_buffer_pool
   PGBUF_BUFFER_HASH *buf_hash_table;	/* buffer hash table */
   PGBUF_BUFFER_LOCK *buf_lock_table;	/* buffer lock table */
   PGBUF_IOPAGE_BUFFER *iopage_table;	/* IO page table */
+  size_t iopage_buffer_size;	/* distance between IO page buffers; pages are aligned for direct I/O */
+  PGBUF_MEMORY_REGION BCB_table_memory;	/* memory of BCB table */
+  PGBUF_MEMORY_REGION iopage_table_memory;	/* memory of IO page table */
+  PGBUF_NUMA_POLICY numa_policy;	/* effective NUMA policy of buffer memory */
+  int numa_node_count;		/* number of NUMA nodes buffer memory is spread on */
+  int numa_node_ids[PGBUF_NUMA_MAX_NODES];	/* identifiers of online nodes, by node index */
   int num_LRU_list;		/* number of shared LRU lists */
   float ratio_lru1;		/* ratio for lru 1 zone */
   float ratio_lru2;		/* ratio for lru 2 zone */
@@ -774,6 +863,7 @@ struct pgbuf_buffer_pool
 #if defined (SERVER_MODE)
   PGBUF_DIRECT_VICTIM direct_victims;	/* direct victim assignment */
   lockfree::circular_queue<PGBUF_BCB *> *flushed_bcbs;	/* post-flush processing */
+  lockfree::circular_queue<VPID> *prefetch_requests;	/* pages to be loaded by read-ahead */
 #endif				/* SERVER_MODE */
   lockfree::circular_queue<int> *private_lrus_with_victims;
   lockfree::circular_queue<int> *big_private_lrus_with_victims;
@@ -800,6 +890,10 @@ struct pgbuf_victim_candidate_list
 };
 
 static PGBUF_BUFFER_POOL pgbuf_Pool;	/* The buffer Pool */
+#if defined (SERVER_MODE)
+static PGBUF_WARMUP pgbuf_Warmup = { "", PGBUF_WARMUP_NOT_STARTED, NULL, 0, 0, NULL, NULL, NULL, VPID_INITIALIZER, 0, 0 };
+#endif /* SERVER_MODE */
+static PGBUF_CHANGED_PAGES pgbuf_Changed_pages = { NULL, "", LSA_INITIALIZER };
 static PGBUF_BATCH_FLUSH_HELPER pgbuf_Flush_helper;
 
 HFID *pgbuf_ordered_null_hfid = NULL;
@@ -971,6 +1065,12 @@ static INLINE unsigned int pgbuf_hash_func_mirror (const VPID * vpid) __attribut
 
 static INLINE bool pgbuf_is_temporary_volume (VOLID volid) __attribute__ ((ALWAYS_INLINE));
 static int pgbuf_initialize_bcb_table (void);
+static void *pgbuf_memory_alloc (PGBUF_MEMORY_REGION * region, size_t size);
+static void pgbuf_memory_free (PGBUF_MEMORY_REGION * region);
+static int pgbuf_numa_get_online_nodes (int *node_ids, int max_nodes);
+static void pgbuf_numa_apply_policy (PGBUF_MEMORY_REGION * region, size_t size);
+STATIC_INLINE int pgbuf_numa_get_bcb_node (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int pgbuf_numa_get_first_shared_lru (int node) __attribute__ ((ALWAYS_INLINE));
 static int pgbuf_initialize_hash_table (void);
 static int pgbuf_initialize_lock_table (void);
 static int pgbuf_initialize_lru_list (void);
@@ -1019,7 +1119,7 @@ static int pgbuf_bcb_safe_flush_force_unlock (THREAD_ENTRY * thread_p, PGBUF_BCB
 static PGBUF_BCB *pgbuf_get_bcb_from_invalid_list (THREAD_ENTRY * thread_p);
 static int pgbuf_put_bcb_into_invalid_list (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
 
-STATIC_INLINE int pgbuf_get_shared_lru_index_for_add (void) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int pgbuf_get_shared_lru_index_for_add (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 static int pgbuf_get_victim_candidates_from_lru (THREAD_ENTRY * thread_p, int check_count,
 						 float lru_sum_flush_priority, bool * assigned_directly);
 static PGBUF_BCB *pgbuf_get_victim (THREAD_ENTRY * thread_p);
@@ -1100,6 +1200,7 @@ STATIC_INLINE void pgbuf_set_dirty_buffer_ptr (THREAD_ENTRY * thread_p, PGBUF_BC
   __attribute__ ((ALWAYS_INLINE));
 static int pgbuf_compare_victim_list (const void *p1, const void *p2);
 static void pgbuf_wakeup_page_flush_daemon (THREAD_ENTRY * thread_p);
+STATIC_INLINE FILEIO_PAGE *pgbuf_get_copy_iopage (PAGE_PTR pgptr) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_check_page_ptype_internal (PAGE_PTR pgptr, PAGE_TYPE ptype, bool no_error)
   __attribute__ ((ALWAYS_INLINE));
 #if defined (SERVER_MODE)
@@ -1173,6 +1274,9 @@ STATIC_INLINE bool pgbuf_bcb_is_direct_victim (const PGBUF_BCB * bcb) __attribut
 STATIC_INLINE bool pgbuf_bcb_is_invalid_direct_victim (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_async_flush_request (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_to_vacuum (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_bcb_set_latch_mode (PGBUF_BCB * bcb, PGBUF_LATCH_MODE latch_mode)
+  __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE bool pgbuf_bcb_is_prefetched (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_should_be_moved_to_bottom_lru (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_avoid_victim (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_bcb_set_dirty (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
@@ -1220,7 +1324,15 @@ static cubthread::daemon *pgbuf_Page_maintenance_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_post_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Flush_control_daemon = NULL;
+static cubthread::daemon *pgbuf_Page_prefetch_daemon = NULL;
+static cubthread::daemon *pgbuf_Page_warmup_daemon = NULL;
 // *INDENT-ON*
+
+static int pgbuf_warmup_dump (THREAD_ENTRY * thread_p);
+static void pgbuf_warmup_load_prepare (THREAD_ENTRY * thread_p);
+static bool pgbuf_warmup_load_pages (THREAD_ENTRY * thread_p);
+static void pgbuf_warmup_load_end (void);
+static const FILEIO_PAGE *pgbuf_warmup_get_run_page (THREAD_ENTRY * thread_p, const VPID * vpid);
 #endif /* SERVER_MODE */
 
 static bool pgbuf_is_page_flush_daemon_available ();
@@ -1462,6 +1574,15 @@ pgbuf_initialize (void)
       ASSERT_ERROR ();
       goto error;
     }
+
+  /* *INDENT-OFF* */
+  pgbuf_Pool.prefetch_requests = new lockfree::circular_queue<VPID> (PGBUF_PREFETCH_REQUESTS_BUFFER_SIZE);
+  /* *INDENT-ON* */
+  if (pgbuf_Pool.prefetch_requests == NULL)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
 #endif /* SERVER_MODE */
 
   if (PGBUF_PAGE_QUOTA_IS_ENABLED)
@@ -1536,6 +1657,22 @@ pgbuf_finalize (void)
   pgbuf_dump_if_any_fixed ();
 #endif /* CUBRID_DEBUG */
 
+#if defined (SERVER_MODE)
+  /* save hot pages for next restart. if warmup did not finish, the previous file is kept. */
+  if (pgbuf_Warmup.status == PGBUF_WARMUP_LOADED)
+    {
+      (void) pgbuf_warmup_dump (thread_get_thread_entry_info ());
+      er_clear ();
+    }
+  pgbuf_Warmup.status = PGBUF_WARMUP_NOT_STARTED;
+#endif /* SERVER_MODE */
+
+  if (pgbuf_Changed_pages.tracker != NULL)
+    {
+      delete pgbuf_Changed_pages.tracker;
+      pgbuf_Changed_pages.tracker = NULL;
+    }
+
   /* final task for buffer hash table */
   if (pgbuf_Pool.buf_hash_table != NULL)
     {
@@ -1561,13 +1698,15 @@ pgbuf_finalize (void)
 	  bufptr = PGBUF_FIND_BCB_PTR (i);
 	  pthread_mutex_destroy (&bufptr->mutex);
 	}
-      free_and_init (pgbuf_Pool.BCB_table);
+      pgbuf_memory_free (&pgbuf_Pool.BCB_table_memory);
+      pgbuf_Pool.BCB_table = NULL;
       pgbuf_Pool.num_buffers = 0;
     }
 
   if (pgbuf_Pool.iopage_table != NULL)
     {
-      free_and_init (pgbuf_Pool.iopage_table);
+      pgbuf_memory_free (&pgbuf_Pool.iopage_table_memory);
+      pgbuf_Pool.iopage_table = NULL;
     }
 
   /* final task for LRU list */
@@ -1682,6 +1821,11 @@ pgbuf_finalize (void)
       delete pgbuf_Pool.flushed_bcbs;
       pgbuf_Pool.flushed_bcbs = NULL;
     }
+  if (pgbuf_Pool.prefetch_requests != NULL)
+    {
+      delete pgbuf_Pool.prefetch_requests;
+      pgbuf_Pool.prefetch_requests = NULL;
+    }
 #endif /* SERVER_MODE */
 
   if (pgbuf_Pool.private_lrus_with_victims != NULL)
@@ -1811,6 +1955,7 @@ pgbuf_fix_release (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MODE f
 #endif /* !NDEBUG */
   PGBUF_FIX_PERF perf;
   bool maybe_deallocated, force_set_vpid;
+  bool is_valid_vpid;
   int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   PGBUF_STATUS *show_status = &pgbuf_Pool.show_status[tran_index];
 
@@ -1833,8 +1978,9 @@ pgbuf_fix_release (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MODE f
   if (pgbuf_get_check_page_validation_level (PGBUF_DEBUG_PAGE_VALIDATION_FETCH))
     {
       /* Make sure that the page has been allocated (i.e., is a valid page) */
-      /* Suppress errors if fetch mode is OLD_PAGE_IF_IN_BUFFER. */
-      if (pgbuf_is_valid_page (thread_p, vpid, fetch_mode == OLD_PAGE_IF_IN_BUFFER, NULL, NULL) != DISK_VALID)
+      /* Suppress errors if fetch mode is OLD_PAGE_IF_IN_BUFFER or OLD_PAGE_PREFETCH. */
+      if (pgbuf_is_valid_page (thread_p, vpid, fetch_mode == OLD_PAGE_IF_IN_BUFFER || fetch_mode == OLD_PAGE_PREFETCH,
+			       NULL, NULL) != DISK_VALID)
 	{
 	  return NULL;
 	}
@@ -1887,6 +2033,12 @@ try_again:
 
   buf_lock_acquired = false;
   bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
+  if (bufptr != NULL && fetch_mode == OLD_PAGE_PREFETCH)
+    {
+      /* page is already in buffer, there is nothing to prefetch */
+      PGBUF_BCB_UNLOCK (bufptr);
+      return NULL;
+    }
   if (bufptr != NULL && pgbuf_bcb_is_direct_victim (bufptr))
     {
       /* we need to notify the thread that is waiting for this bcb to victimize that it cannot use it. */
@@ -1901,6 +2053,13 @@ try_again:
 
       show_status->num_hit++;
 
+      if (pgbuf_bcb_is_prefetched (bufptr))
+	{
+	  /* first fix after read-ahead loaded the page */
+	  pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_PREFETCHED_FLAG);
+	  perfmon_inc_stat (thread_p, PSTAT_PB_NUM_PREFETCH_HITS);
+	}
+
       if (fetch_mode == NEW_PAGE)
 	{
 	  /* Fix a page as NEW_PAGE, when oldest_unflush_lsa of the page is not NULL_LSA, it should be dirty. */
@@ -1931,6 +2090,11 @@ try_again:
 	}
       buf_lock_acquired = true;
 
+      if (fetch_mode == OLD_PAGE_PREFETCH)
+	{
+	  pgbuf_bcb_update_flags (thread_p, bufptr, PGBUF_BCB_PREFETCHED_FLAG, 0);
+	}
+
 #if defined(ENABLE_SYSTEMTAP)
       if (fetch_mode == NEW_PAGE && pgbuf_hit == false)
 	{
@@ -1954,7 +2118,17 @@ try_again:
   pgbuf_set_bcb_page_vpid (bufptr, force_set_vpid);
 
   maybe_deallocated = (fetch_mode == OLD_PAGE_MAYBE_DEALLOCATED);
-  if (pgbuf_check_bcb_page_vpid (bufptr, maybe_deallocated) != true)
+  if (fetch_mode == OLD_PAGE_PREFETCH)
+    {
+      /* read-ahead may go over pages that were never allocated; check without asserting */
+      is_valid_vpid = (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
+		       && bufptr->vpid.volid == bufptr->iopage_buffer->iopage.prv.volid);
+    }
+  else
+    {
+      is_valid_vpid = pgbuf_check_bcb_page_vpid (bufptr, maybe_deallocated);
+    }
+  if (!is_valid_vpid)
     {
       if (buf_lock_acquired)
 	{
@@ -2105,6 +2279,11 @@ try_again:
 	  PGBUF_BCB_CHECK_MUTEX_LEAKS ();
 	  pgbuf_unfix (thread_p, pgptr);
 	  return NULL;
+	case OLD_PAGE_PREFETCH:
+	  /* read-ahead went over a deallocated page. just leave it. */
+	  PGBUF_BCB_CHECK_MUTEX_LEAKS ();
+	  pgbuf_unfix (thread_p, pgptr);
+	  return NULL;
 	}
 
       /* note: maybe we could check this in an earlier stage, but would have been a lot more complicated. the only
@@ -2314,7 +2493,7 @@ pgbuf_promote_read_latch_release (THREAD_ENTRY * thread_p, PAGE_PTR * pgptr_p, P
 	}
 
       /* we're the single holder of the read latch, do an in-place promotion */
-      bufptr->latch_mode = PGBUF_LATCH_WRITE;
+      pgbuf_bcb_set_latch_mode (bufptr, PGBUF_LATCH_WRITE);
       holder->perf_stat.hold_has_write_latch = 1;
       /* NOTE: no need to set the promoted flag as long as we don't wait */
       PGBUF_BCB_UNLOCK (bufptr);
@@ -2427,7 +2606,7 @@ end:
   return rv;
 
 #else /* SERVER_MODE */
-  bufptr->latch_mode = PGBUF_LATCH_WRITE;
+  pgbuf_bcb_set_latch_mode (bufptr, PGBUF_LATCH_WRITE);
   return NO_ERROR;
 #endif
 }
@@ -4579,6 +4758,15 @@ void
 pgbuf_get_vpid (PAGE_PTR pgptr, VPID * vpid)
 {
   PGBUF_BCB *bufptr;
+  FILEIO_PAGE *io_copy;
+
+  io_copy = pgbuf_get_copy_iopage (pgptr);
+  if (io_copy != NULL)
+    {
+      vpid->volid = io_copy->prv.volid;
+      vpid->pageid = io_copy->prv.pageid;
+      return;
+    }
 
   if (pgbuf_get_check_page_validation_level (PGBUF_DEBUG_PAGE_VALIDATION_ALL))
     {
@@ -4657,6 +4845,13 @@ PAGEID
 pgbuf_get_page_id (PAGE_PTR pgptr)
 {
   PGBUF_BCB *bufptr;
+  FILEIO_PAGE *io_copy;
+
+  io_copy = pgbuf_get_copy_iopage (pgptr);
+  if (io_copy != NULL)
+    {
+      return io_copy->prv.pageid;
+    }
 
   /* NOTE: Does not need to hold mutex since the page is fixed */
 
@@ -4707,6 +4902,13 @@ VOLID
 pgbuf_get_volume_id (PAGE_PTR pgptr)
 {
   PGBUF_BCB *bufptr;
+  FILEIO_PAGE *io_copy;
+
+  io_copy = pgbuf_get_copy_iopage (pgptr);
+  if (io_copy != NULL)
+    {
+      return io_copy->prv.volid;
+    }
 
   if (pgbuf_get_check_page_validation_level (PGBUF_DEBUG_PAGE_VALIDATION_ALL))
     {
@@ -4731,6 +4933,13 @@ const char *
 pgbuf_get_volume_label (PAGE_PTR pgptr)
 {
   PGBUF_BCB *bufptr;
+  FILEIO_PAGE *io_copy;
+
+  io_copy = pgbuf_get_copy_iopage (pgptr);
+  if (io_copy != NULL)
+    {
+      return fileio_get_volume_label (io_copy->prv.volid, PEEK);
+    }
 
   /* NOTE: Does not need to hold mutex since the page is fixed */
 
@@ -4828,7 +5037,7 @@ pgbuf_set_bcb_page_vpid (PGBUF_BCB * bufptr, bool force_set_vpid)
 	  bufptr->iopage_buffer->iopage.prv.volid = bufptr->vpid.volid;
 
 	  bufptr->iopage_buffer->iopage.prv.ptype = '\0';
-	  bufptr->iopage_buffer->iopage.prv.p_reserve_1 = 0;
+	  bufptr->iopage_buffer->iopage.prv.checksum = 0;
 	  bufptr->iopage_buffer->iopage.prv.p_reserve_2 = 0;
 	  bufptr->iopage_buffer->iopage.prv.tde_nonce = 0;
 	}
@@ -4925,6 +5134,8 @@ pgbuf_initialize_bcb_table (void)
 {
   PGBUF_BCB *bufptr;
   PGBUF_IOPAGE_BUFFER *ioptr;
+  char *iopage_memory;
+  size_t iopage_alignment;
   int i;
   long long unsigned alloc_size;
 
@@ -4935,34 +5146,50 @@ pgbuf_initialize_bcb_table (void)
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_PRM_BAD_VALUE, 1, "data_buffer_pages");
       return ER_PRM_BAD_VALUE;
     }
-  pgbuf_Pool.BCB_table = (PGBUF_BCB *) malloc ((size_t) alloc_size);
+  pgbuf_Pool.numa_policy = (PGBUF_NUMA_POLICY) prm_get_integer_value (PRM_ID_PB_NUMA_POLICY);
+  pgbuf_Pool.numa_node_count = pgbuf_numa_get_online_nodes (pgbuf_Pool.numa_node_ids, PGBUF_NUMA_MAX_NODES);
+  if (pgbuf_Pool.numa_node_count <= 1)
+    {
+      pgbuf_Pool.numa_policy = PGBUF_NUMA_NONE;
+    }
+
+  pgbuf_Pool.BCB_table = (PGBUF_BCB *) pgbuf_memory_alloc (&pgbuf_Pool.BCB_table_memory, (size_t) alloc_size);
   if (pgbuf_Pool.BCB_table == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) alloc_size);
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
 
-  /* allocate space for io page buffers */
-  alloc_size = (long long unsigned) pgbuf_Pool.num_buffers * PGBUF_IOPAGE_BUFFER_SIZE;
+  /* allocate space for io page buffers. with direct I/O, every page must start at an address aligned for the device;
+   * the buffers are spaced by a multiple of the alignment and the table is shifted inside the allocated memory. */
+  if (prm_get_bool_value (PRM_ID_DATA_VOLUME_DIRECT_IO))
+    {
+      iopage_alignment = FILEIO_DIRECT_IO_MIN_ALIGNMENT;
+    }
+  else
+    {
+      iopage_alignment = 1;
+    }
+  pgbuf_Pool.iopage_buffer_size = DB_ALIGN (PGBUF_IOPAGE_BUFFER_SIZE, iopage_alignment);
+  alloc_size = (long long unsigned) pgbuf_Pool.num_buffers * pgbuf_Pool.iopage_buffer_size + iopage_alignment;
   if (!MEM_SIZE_IS_VALID (alloc_size))
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_PRM_BAD_VALUE, 1, "data_buffer_pages");
-      if (pgbuf_Pool.BCB_table != NULL)
-	{
-	  free_and_init (pgbuf_Pool.BCB_table);
-	}
+      pgbuf_memory_free (&pgbuf_Pool.BCB_table_memory);
+      pgbuf_Pool.BCB_table = NULL;
       return ER_PRM_BAD_VALUE;
     }
-  pgbuf_Pool.iopage_table = (PGBUF_IOPAGE_BUFFER *) malloc ((size_t) alloc_size);
-  if (pgbuf_Pool.iopage_table == NULL)
+  iopage_memory = (char *) pgbuf_memory_alloc (&pgbuf_Pool.iopage_table_memory, (size_t) alloc_size);
+  if (iopage_memory == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) alloc_size);
-      if (pgbuf_Pool.BCB_table != NULL)
-	{
-	  free_and_init (pgbuf_Pool.BCB_table);
-	}
+      pgbuf_memory_free (&pgbuf_Pool.BCB_table_memory);
+      pgbuf_Pool.BCB_table = NULL;
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
+  pgbuf_Pool.iopage_table =
+    (PGBUF_IOPAGE_BUFFER *) (DB_ALIGN ((UINTPTR) iopage_memory + offsetof (PGBUF_IOPAGE_BUFFER, iopage),
+				       iopage_alignment) - offsetof (PGBUF_IOPAGE_BUFFER, iopage));
 
   /* initialize each entry of the buffer BCB table */
   for (i = 0; i < pgbuf_Pool.num_buffers; i++)
@@ -4999,6 +5226,7 @@ pgbuf_initialize_bcb_table (void)
 
       bufptr->tick_lru3 = 0;
       bufptr->tick_lru_list = 0;
+      bufptr->version = 1;	/* not in hash chain */
 
       /* link BCB and iopage buffer */
       ioptr = PGBUF_FIND_IOPAGE_PTR (i);
@@ -5011,7 +5239,7 @@ pgbuf_initialize_bcb_table (void)
 
       ioptr->iopage.prv.ptype = '\0';
       ioptr->iopage.prv.pflag = '\0';
-      ioptr->iopage.prv.p_reserve_1 = 0;
+      ioptr->iopage.prv.checksum = 0;
       ioptr->iopage.prv.p_reserve_2 = 0;
       ioptr->iopage.prv.tde_nonce = 0;
 
@@ -5028,6 +5256,302 @@ pgbuf_initialize_bcb_table (void)
   return NO_ERROR;
 }
 
+#if defined (LINUX)
+#if !defined (MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+#define PGBUF_MEMORY_HUGE_2M ((size_t) 2 * 1024 * 1024)
+#define PGBUF_MEMORY_HUGE_1G ((size_t) 1024 * 1024 * 1024)
+
+/* memory policies of mbind (see numaif.h); defined here to avoid depending on libnuma */
+#define PGBUF_MPOL_PREFERRED 1
+#define PGBUF_MPOL_INTERLEAVE 3
+#endif /* LINUX */
+
+/*
+ * pgbuf_memory_alloc () - allocate memory for page buffer tables according to data_buffer_huge_pages and
+ *			   data_buffer_numa_policy.
+ *
+ * return      : allocated memory or NULL
+ * region (out): allocated region
+ * size (in)   : size to allocate
+ *
+ * note: explicit huge pages must be reserved by administrator (vm.nr_hugepages). if not enough are available, the
+ *       next smaller page size is tried and finally transparent huge pages are advised. a NUMA policy requires a
+ *       fresh mapping, since policies only apply to pages not touched yet.
+ */
+static void *
+pgbuf_memory_alloc (PGBUF_MEMORY_REGION * region, size_t size)
+{
+  PGBUF_HUGE_PAGES_MODE mode = (PGBUF_HUGE_PAGES_MODE) prm_get_integer_value (PRM_ID_PB_HUGE_PAGES);
+
+  memset (region, 0, sizeof (*region));
+
+#if defined (LINUX)
+  void *ptr = MAP_FAILED;
+  size_t map_size;
+
+  if (mode == PGBUF_HUGE_PAGES_1G)
+    {
+      map_size = DB_ALIGN (size, PGBUF_MEMORY_HUGE_1G);
+      ptr = mmap (NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB
+		  | (30 << MAP_HUGE_SHIFT), -1, 0);
+      if (ptr != MAP_FAILED)
+	{
+	  region->page_size = PGBUF_MEMORY_HUGE_1G;
+	  region->huge_pages = PGBUF_HUGE_PAGES_1G;
+	}
+      else
+	{
+	  mode = PGBUF_HUGE_PAGES_2M;
+	}
+    }
+  if (ptr == MAP_FAILED && mode == PGBUF_HUGE_PAGES_2M)
+    {
+      map_size = DB_ALIGN (size, PGBUF_MEMORY_HUGE_2M);
+      ptr = mmap (NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB
+		  | (21 << MAP_HUGE_SHIFT), -1, 0);
+      if (ptr != MAP_FAILED)
+	{
+	  region->page_size = PGBUF_MEMORY_HUGE_2M;
+	  region->huge_pages = PGBUF_HUGE_PAGES_2M;
+	}
+      else
+	{
+	  mode = PGBUF_HUGE_PAGES_TRANSPARENT;
+	}
+    }
+  if (ptr == MAP_FAILED && (mode == PGBUF_HUGE_PAGES_TRANSPARENT || pgbuf_Pool.numa_policy != PGBUF_NUMA_NONE))
+    {
+      map_size = DB_ALIGN (size, PGBUF_MEMORY_HUGE_2M);
+      ptr = mmap (NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (ptr != MAP_FAILED)
+	{
+	  region->page_size = (size_t) sysconf (_SC_PAGESIZE);
+	  region->huge_pages = PGBUF_HUGE_PAGES_NONE;
+	  if (mode == PGBUF_HUGE_PAGES_TRANSPARENT && madvise (ptr, map_size, MADV_HUGEPAGE) == 0)
+	    {
+	      region->page_size = PGBUF_MEMORY_HUGE_2M;
+	      region->huge_pages = PGBUF_HUGE_PAGES_TRANSPARENT;
+	    }
+	}
+    }
+
+  if (ptr != MAP_FAILED)
+    {
+      region->ptr = ptr;
+      region->map_size = map_size;
+      pgbuf_numa_apply_policy (region, size);
+      return region->ptr;
+    }
+#endif /* LINUX */
+
+  /* regular allocation */
+  region->ptr = malloc (size);
+  region->map_size = 0;
+  region->page_size = 4 * ONE_K;
+  region->huge_pages = PGBUF_HUGE_PAGES_NONE;
+  pgbuf_Pool.numa_policy = PGBUF_NUMA_NONE;
+  return region->ptr;
+}
+
+/*
+ * pgbuf_memory_free () - free memory allocated by pgbuf_memory_alloc
+ *
+ * return      : void
+ * region (in) : allocated region
+ */
+static void
+pgbuf_memory_free (PGBUF_MEMORY_REGION * region)
+{
+  if (region->ptr == NULL)
+    {
+      return;
+    }
+#if defined (LINUX)
+  if (region->map_size > 0)
+    {
+      (void) munmap (region->ptr, region->map_size);
+      region->ptr = NULL;
+      region->map_size = 0;
+      return;
+    }
+#endif /* LINUX */
+  free_and_init (region->ptr);
+}
+
+/*
+ * pgbuf_numa_get_online_nodes () - get the online NUMA nodes of the host
+ *
+ * return         : number of online nodes (1 if NUMA is not available)
+ * node_ids (out) : identifiers of online nodes, in ascending order
+ * max_nodes (in) : maximum number of nodes to get
+ *
+ * note: node identifiers may be sparse (e.g. "0,2" or "0-1,4" when nodes are offlined); buffer uses the index of node
+ *       in node_ids and maps it to the identifier only for mbind. nodes that cannot be set in a mbind mask of
+ *       PGBUF_NUMA_MAX_NODES bits are ignored.
+ */
+static int
+pgbuf_numa_get_online_nodes (int *node_ids, int max_nodes)
+{
+#if defined (LINUX)
+  FILE *fp;
+  char line[256];
+  char *p, *end;
+  long first, last, id;
+  int count = 0;
+
+  node_ids[0] = 0;
+  /* the file holds a list of ranges, e.g. "0-1" or "0,2-3" */
+  fp = fopen ("/sys/devices/system/node/online", "r");
+  if (fp == NULL)
+    {
+      return 1;
+    }
+  if (fgets (line, sizeof (line), fp) == NULL)
+    {
+      fclose (fp);
+      return 1;
+    }
+  fclose (fp);
+
+  for (p = line; *p != '\0' && *p != '\n';)
+    {
+      first = strtol (p, &end, 10);
+      if (end == p || first < 0)
+	{
+	  /* malformed list */
+	  break;
+	}
+      last = first;
+      p = end;
+      if (*p == '-')
+	{
+	  p++;
+	  last = strtol (p, &end, 10);
+	  if (end == p || last < first)
+	    {
+	      break;
+	    }
+	  p = end;
+	}
+      for (id = first; id <= last && id < PGBUF_NUMA_MAX_NODES && count < max_nodes; id++)
+	{
+	  node_ids[count++] = (int) id;
+	}
+      if (*p == ',')
+	{
+	  p++;
+	}
+    }
+
+  if (count == 0)
+    {
+      node_ids[0] = 0;
+      return 1;
+    }
+  return count;
+#else /* !LINUX */
+  node_ids[0] = 0;
+  return 1;
+#endif /* !LINUX */
+}
+
+/*
+ * pgbuf_numa_apply_policy () - apply data_buffer_numa_policy to a newly mapped region
+ *
+ * return      : void
+ * region (in) : mapped region
+ * size (in)   : used size of region
+ *
+ * note: interleave spreads memory pages round-robin on all online nodes. partition splits the region in one contiguous
+ *       range per online node (aligned to memory page size), so that BCB's and frames with close indexes share the
+ *       node; range i is placed on node pgbuf_Pool.numa_node_ids[i]. if the policy cannot be applied, the effective
+ *       policy falls back to none.
+ */
+static void
+pgbuf_numa_apply_policy (PGBUF_MEMORY_REGION * region, size_t size)
+{
+#if defined (LINUX) && defined (__NR_mbind)
+  unsigned long nodemask;
+  size_t chunk_size, offset;
+  int node;
+
+  if (pgbuf_Pool.numa_policy == PGBUF_NUMA_NONE)
+    {
+      return;
+    }
+
+  if (pgbuf_Pool.numa_policy == PGBUF_NUMA_INTERLEAVE)
+    {
+      nodemask = 0;
+      for (node = 0; node < pgbuf_Pool.numa_node_count; node++)
+	{
+	  nodemask |= 1UL << pgbuf_Pool.numa_node_ids[node];
+	}
+      if (syscall (__NR_mbind, region->ptr, region->map_size, PGBUF_MPOL_INTERLEAVE, &nodemask,
+		   PGBUF_NUMA_MAX_NODES + 1, 0) != 0)
+	{
+	  pgbuf_Pool.numa_policy = PGBUF_NUMA_NONE;
+	}
+      return;
+    }
+
+  assert (pgbuf_Pool.numa_policy == PGBUF_NUMA_PARTITION);
+  chunk_size = DB_ALIGN (size / pgbuf_Pool.numa_node_count, region->page_size);
+  region->numa_chunk_size = chunk_size;
+  for (node = 0, offset = 0; node < pgbuf_Pool.numa_node_count && offset < region->map_size;
+       node++, offset += chunk_size)
+    {
+      nodemask = 1UL << pgbuf_Pool.numa_node_ids[node];
+      /* preferred rather than bind, so a full node does not fail the allocation */
+      if (syscall (__NR_mbind, (char *) region->ptr + offset, MIN (chunk_size, region->map_size - offset),
+		   PGBUF_MPOL_PREFERRED, &nodemask, PGBUF_NUMA_MAX_NODES + 1, 0) != 0)
+	{
+	  pgbuf_Pool.numa_policy = PGBUF_NUMA_NONE;
+	  return;
+	}
+    }
+#else /* !LINUX || !__NR_mbind */
+  pgbuf_Pool.numa_policy = PGBUF_NUMA_NONE;
+#endif /* !LINUX || !__NR_mbind */
+}
+
+/*
+ * pgbuf_numa_get_bcb_node () - get NUMA node the frame of BCB is placed on by partition policy
+ *
+ * return   : index of node in pgbuf_Pool.numa_node_ids
+ * bcb (in) : BCB
+ */
+STATIC_INLINE int
+pgbuf_numa_get_bcb_node (const PGBUF_BCB * bcb)
+{
+  const PGBUF_MEMORY_REGION *region = &pgbuf_Pool.iopage_table_memory;
+  size_t offset;
+
+  assert (pgbuf_Pool.numa_policy == PGBUF_NUMA_PARTITION && region->numa_chunk_size > 0);
+
+  /* the same ranges as in pgbuf_numa_apply_policy */
+  offset = (size_t) ((char *) bcb->iopage_buffer - (char *) region->ptr);
+  return MIN ((int) (offset / region->numa_chunk_size), pgbuf_Pool.numa_node_count - 1);
+}
+
+/*
+ * pgbuf_numa_get_first_shared_lru () - get first shared LRU list of NUMA node
+ *
+ * return    : index of first shared list of node; for node count, the count of shared lists
+ * node (in) : index of node in pgbuf_Pool.numa_node_ids
+ *
+ * note: like frames, shared lists are split in one contiguous range per node. the lists of node are
+ *       [pgbuf_numa_get_first_shared_lru (node), pgbuf_numa_get_first_shared_lru (node + 1)).
+ */
+STATIC_INLINE int
+pgbuf_numa_get_first_shared_lru (int node)
+{
+  assert (PGBUF_SHARED_LRU_COUNT >= pgbuf_Pool.numa_node_count);
+  return (int) ((long long) node * PGBUF_SHARED_LRU_COUNT / pgbuf_Pool.numa_node_count);
+}
+
 /*
  * pgbuf_initialize_hash_table () - Initializes page buffer hash table
  *   return: NO_ERROR, or ER_code
@@ -5623,7 +6147,7 @@ pgbuf_latch_idle_page (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_
 
   buf_is_dirty = pgbuf_bcb_is_dirty (bufptr);
 
-  bufptr->latch_mode = request_mode;
+  pgbuf_bcb_set_latch_mode (bufptr, request_mode);
   bufptr->fcnt = 1;
 
   PGBUF_BCB_UNLOCK (bufptr);
@@ -5884,7 +6408,7 @@ pgbuf_latch_bcb_upon_fix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LAT
 
       if (bufptr->fcnt == holder->fix_count)
 	{
-	  bufptr->latch_mode = request_mode;	/* PGBUF_LATCH_WRITE */
+	  pgbuf_bcb_set_latch_mode (bufptr, request_mode);	/* PGBUF_LATCH_WRITE */
 	  bufptr->fcnt++;
 	  assert (0 < bufptr->fcnt);
 
@@ -6344,7 +6868,7 @@ pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int threa
       /* fall through to add to shared */
     }
   /* add to middle of shared list. */
-  pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, pgbuf_get_shared_lru_index_for_add ());
+  pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, pgbuf_get_shared_lru_index_for_add (bcb));
   perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_TO_SHARED_MID);
   if (!PGBUF_THREAD_SHOULD_IGNORE_UNFIX (thread_p))
     {
@@ -6840,7 +7364,7 @@ pgbuf_wakeup_reader_writer (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 	  if (thrd_entry->request_latch_mode != PGBUF_NO_LATCH)
 	    {
 	      /* grant the request */
-	      bufptr->latch_mode = (PGBUF_LATCH_MODE) thrd_entry->request_latch_mode;
+	      pgbuf_bcb_set_latch_mode (bufptr, (PGBUF_LATCH_MODE) thrd_entry->request_latch_mode);
 	      bufptr->fcnt += thrd_entry->request_fix_count;
 
 	      /* do not handle BCB holder entry, at here. refer pgbuf_latch_bcb_upon_fix () */
@@ -7079,6 +7603,7 @@ pgbuf_insert_into_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_
 
   bufptr->hash_next = hash_anchor->hash_next;
   hash_anchor->hash_next = bufptr;
+  ATOMIC_INC_64 (&bufptr->version, 1);
 
   /*
    * hash_anchor->hash_mutex is not released at this place.
@@ -7180,6 +7705,7 @@ pgbuf_delete_from_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 	}
 
       curr_bufptr->hash_next = NULL;
+      ATOMIC_INC_64 (&bufptr->version, 1);
       pthread_mutex_unlock (&hash_anchor->hash_mutex);
       VPID_SET_NULL (&(bufptr->vpid));
       pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
@@ -7623,6 +8149,9 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
   bool success;
   int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   PGBUF_STATUS *show_status = &pgbuf_Pool.show_status[tran_index];
+#if defined (SERVER_MODE)
+  const FILEIO_PAGE *run_page;
+#endif /* SERVER_MODE */
 
 #if defined (ENABLE_SYSTEMTAP)
   bool monitored = false;
@@ -7690,7 +8219,7 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
   bufptr->vpid = *vpid;
   assert (!pgbuf_bcb_avoid_victim (bufptr));
   bufptr->latch_mode = PGBUF_NO_LATCH;
-  pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_ASYNC_FLUSH_REQ);	/* todo: why this?? */
+  pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_ASYNC_FLUSH_REQ | PGBUF_BCB_PREFETCHED_FLAG);	/* todo: why this?? */
   pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
   LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
 
@@ -7699,6 +8228,10 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
       /* Record number of reads in statistics */
       perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOREADS);
       show_status->num_pages_read++;
+      if (fetch_mode == OLD_PAGE_PREFETCH)
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_PB_NUM_PREFETCH_IOREADS);
+	}
 
 #if defined(ENABLE_SYSTEMTAP)
       query_id = qmgr_get_current_query_id (thread_p);
@@ -7719,6 +8252,13 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	{
 	  /* Nothing to do, copied from DWB */
 	}
+#if defined (SERVER_MODE)
+      else if ((run_page = pgbuf_warmup_get_run_page (thread_p, vpid)) != NULL)
+	{
+	  /* already read with its run by warmup loader */
+	  memcpy (&bufptr->iopage_buffer->iopage, run_page, IO_PAGESIZE);
+	}
+#endif /* SERVER_MODE */
       else if (fileio_read (thread_p, fileio_get_volume_descriptor (vpid->volid), &bufptr->iopage_buffer->iopage,
 			    vpid->pageid, IO_PAGESIZE) == NULL)
 	{
@@ -7746,6 +8286,16 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	  return NULL;
 	}
 
+      if (fileio_check_page_checksum (thread_p, &bufptr->iopage_buffer->iopage, vpid) != NO_ERROR)
+	{
+	  /* Torn or corrupted page. */
+	  ASSERT_ERROR ();
+	  pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+	  (void) pgbuf_unlock_page (thread_p, hash_anchor, vpid, true);
+	  PGBUF_BCB_CHECK_MUTEX_LEAKS ();
+	  return NULL;
+	}
+
       CAST_IOPGPTR_TO_PGPTR (pgptr, &bufptr->iopage_buffer->iopage);
       tde_algo = pgbuf_get_tde_algorithm (pgptr);
       if (tde_algo != TDE_ALGORITHM_NONE)
@@ -7866,6 +8416,12 @@ pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
     {
       pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_TO_VACUUM_FLAG);
     }
+  if (pgbuf_bcb_is_prefetched (bufptr))
+    {
+      /* read-ahead loaded this page for nothing */
+      pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_PREFETCHED_FLAG);
+      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_PREFETCH_WASTED);
+    }
   assert (bufptr->latch_mode == PGBUF_NO_LATCH);
 
   /* a safe victim */
@@ -8160,10 +8716,13 @@ pgbuf_put_bcb_into_invalid_list (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
  * pgbuf_get_shared_lru_index_for_add () - get a shared index to add a new bcb. we'll use a round-robin way to choose
  *                                         next list, but we'll avoid biggest list (just to keep things balanced).
  *
- * return : shared lru index
+ * return   : shared lru index
+ * bcb (in) : bcb to add
+ *
+ * note: with partition NUMA policy, the list is chosen among the lists of the node the frame of bcb is on.
  */
 STATIC_INLINE int
-pgbuf_get_shared_lru_index_for_add (void)
+pgbuf_get_shared_lru_index_for_add (const PGBUF_BCB * bcb)
 {
 #define PAGE_ADD_REFRESH_STAT \
   MAX (2 * pgbuf_Pool.num_buffers / PGBUF_SHARED_LRU_COUNT, 10000)
@@ -8231,6 +8790,28 @@ pgbuf_get_shared_lru_index_for_add (void)
       lru_idx = lru_idx % PGBUF_SHARED_LRU_COUNT;
     }
 
+  if (pgbuf_Pool.numa_policy == PGBUF_NUMA_PARTITION && PGBUF_SHARED_LRU_COUNT >= pgbuf_Pool.numa_node_count)
+    {
+      /* keep the lists of a node holding only frames of that node */
+      int node = pgbuf_numa_get_bcb_node (bcb);
+      int first_lru = pgbuf_numa_get_first_shared_lru (node);
+      int node_lru_count = pgbuf_numa_get_first_shared_lru (node + 1) - first_lru;
+      int avoid_lru_idx = pgbuf_Pool.quota.avoid_shared_lru_idx;
+      int node_lru_idx;
+
+      assert (node_lru_count > 0);
+      node_lru_idx = first_lru + (int) (lru_idx % node_lru_count);
+      if (node_lru_idx == avoid_lru_idx)
+	{
+	  node_lru_idx = (node_lru_count > 1) ? first_lru + (node_lru_idx - first_lru + 1) % node_lru_count : -1;
+	}
+      if (node_lru_idx >= 0)
+	{
+	  lru_idx = node_lru_idx;
+	}
+      /* else the only list of the node is avoided; keep the list chosen above */
+    }
+
   return lru_idx;
 #undef PAGE_ADD_REFRESH_STAT
 }
@@ -9513,7 +10094,7 @@ pgbuf_lru_move_from_private_to_shared (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
   pgbuf_lru_remove_bcb (thread_p, bcb);
 
   /* add bcb to middle of shared list */
-  pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, pgbuf_get_shared_lru_index_for_add ());
+  pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, pgbuf_get_shared_lru_index_for_add (bcb));
 
   pgbuf_bcb_register_hit_for_lru (bcb);
 }
@@ -9607,7 +10188,7 @@ pgbuf_move_bcb_to_bottom_lru (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
 	}
       else
 	{
-	  lru_idx = pgbuf_get_shared_lru_index_for_add ();
+	  lru_idx = pgbuf_get_shared_lru_index_for_add (bcb);
 	}
       pgbuf_lru_add_new_bcb_to_bottom (thread_p, bcb, lru_idx);
     }
@@ -9896,7 +10477,8 @@ pgbuf_remove_private_from_aout_list (const int lru_idx)
 STATIC_INLINE int
 pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_page_flush_thread, bool * is_bcb_locked)
 {
-  char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  /* aligned for direct I/O when the page is written from the copy */
+  char page_buf[IO_MAX_PAGE_SIZE + FILEIO_DIRECT_IO_ALIGNMENT];
   FILEIO_PAGE *iopage = NULL;
   PAGE_PTR pgptr = NULL;
   LOG_LSA oldest_unflush_lsa;
@@ -9905,7 +10487,7 @@ pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_p
   QUERY_ID query_id = NULL_QUERY_ID;
   bool monitored = false;
 #endif /* ENABLE_SYSTEMTAP */
-  bool was_dirty = false, uses_dwb;
+  bool was_dirty = false, uses_dwb, is_atomic_write;
   DWB_SLOT *dwb_slot = NULL;
   LOG_LSA lsa;
   FILEIO_WRITE_MODE write_mode;
@@ -9965,10 +10547,11 @@ pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_p
 
   was_dirty = pgbuf_bcb_mark_is_flushing (thread_p, bufptr);
 
-  uses_dwb = dwb_is_created () && !is_temp;
+  is_atomic_write = !is_temp && fileio_is_atomic_write_volume (bufptr->vpid.volid);
+  uses_dwb = dwb_is_created () && !is_temp && !is_atomic_write;
 
 start_copy_page:
-  iopage = (FILEIO_PAGE *) PTR_ALIGN (page_buf, MAX_ALIGNMENT);
+  iopage = (FILEIO_PAGE *) PTR_ALIGN (page_buf, FILEIO_DIRECT_IO_ALIGNMENT);
   CAST_BFPTR_TO_PGPTR (pgptr, bufptr);
   tde_algo = pgbuf_get_tde_algorithm (pgptr);
   if (tde_algo != TDE_ALGORITHM_NONE)
@@ -9984,6 +10567,20 @@ start_copy_page:
     {
       memcpy ((void *) iopage, (void *) (&bufptr->iopage_buffer->iopage), IO_PAGESIZE);
     }
+  if (!is_temp && prm_get_bool_value (PRM_ID_PB_PAGE_CHECKSUM))
+    {
+      (void) fileio_set_page_checksum (thread_p, iopage);
+    }
+  else
+    {
+      /* checksum read with the page is not valid anymore */
+      iopage->prv.pflag &= ~FILEIO_PAGE_FLAG_CHECKSUM;
+    }
+  if (!is_temp)
+    {
+      /* must be marked before the page may reach the disk */
+      pgbuf_changed_pages_mark (&bufptr->vpid);
+    }
   if (uses_dwb)
     {
       error = dwb_set_data_on_next_slot (thread_p, iopage, false, &dwb_slot);
@@ -10053,7 +10650,15 @@ copy_unflushed_lsa:
       show_status->num_pages_written++;
 
       /* Record number of writes in statistics */
-      write_mode = (dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE);
+      if (is_atomic_write)
+	{
+	  /* the page can't be torn, no need of DWB */
+	  write_mode = FILEIO_WRITE_ATOMIC_WRITE;
+	}
+      else
+	{
+	  write_mode = (dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE);
+	}
 
       perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOWRITES);
       if (fileio_write (thread_p, fileio_get_volume_descriptor (bufptr->vpid.volid), iopage, bufptr->vpid.pageid,
@@ -10344,18 +10949,35 @@ pgbuf_check_page_type_no_error (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, PAGE_TY
 }
 
 /*
- * pgbuf_check_page_ptype_internal () -
- *   return: true/false
- *   bufptr(in): pointer to buffer page
- *   ptype(in): page type
+ * pgbuf_get_copy_iopage () - Get the io page of a copy made by pgbuf_optimistic_read_page
+ *   return: io page of the copy, or NULL if pgptr is a page in buffer
+ *   pgptr(in): Page pointer
  *
- * Note: Verify if the given page's ptype is valid.
+ * Note: The copy has no bcb, but its header keeps the identifier of the page it was copied from.
+ */
+STATIC_INLINE FILEIO_PAGE *
+pgbuf_get_copy_iopage (PAGE_PTR pgptr)
+{
+  PGBUF_IOPAGE_BUFFER *iopage_buffer;
+
+  iopage_buffer = (PGBUF_IOPAGE_BUFFER *) ((char *) pgptr - offsetof (PGBUF_IOPAGE_BUFFER, iopage.page));
+  return (iopage_buffer->bcb == NULL) ? &iopage_buffer->iopage : NULL;
+}
+
+/*
+ * pgbuf_check_page_ptype_internal () -
+ *   return: true/false
+ *   bufptr(in): pointer to buffer page
+ *   ptype(in): page type
+ *
+ * Note: Verify if the given page's ptype is valid.
  *       This function is used for debugging purposes.
  */
 STATIC_INLINE bool
 pgbuf_check_page_ptype_internal (PAGE_PTR pgptr, PAGE_TYPE ptype, bool no_error)
 {
   PGBUF_BCB *bufptr;
+  FILEIO_PAGE *io_copy;
 
   if (pgptr == NULL)
     {
@@ -10363,6 +10985,18 @@ pgbuf_check_page_ptype_internal (PAGE_PTR pgptr, PAGE_TYPE ptype, bool no_error)
       return false;
     }
 
+  io_copy = pgbuf_get_copy_iopage (pgptr);
+  if (io_copy != NULL)
+    {
+      /* copy made by pgbuf_optimistic_read_page */
+      if (io_copy->prv.ptype != PAGE_UNKNOWN && io_copy->prv.ptype != ptype)
+	{
+	  assert_release (no_error);
+	  return false;
+	}
+      return true;
+    }
+
 #if 1				/* TODO - do not delete me */
 #if defined(NDEBUG)
   if (log_is_in_crash_recovery ())
@@ -10429,7 +11063,6 @@ pgbuf_check_bcb_page_vpid (PGBUF_BCB * bufptr, bool maybe_deallocated)
 	      || (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
 		  && bufptr->vpid.volid == bufptr->iopage_buffer->iopage.prv.volid));
 
-      assert (bufptr->iopage_buffer->iopage.prv.p_reserve_1 == 0);
       assert (bufptr->iopage_buffer->iopage.prv.p_reserve_2 == 0);
 
       return (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
@@ -10464,7 +11097,7 @@ pgbuf_scramble (FILEIO_PAGE * iopage)
 
   iopage->prv.ptype = '\0';
   iopage->prv.pflag = '\0';
-  iopage->prv.p_reserve_1 = 0;
+  iopage->prv.checksum = 0;
   iopage->prv.p_reserve_2 = 0;
   iopage->prv.tde_nonce = 0;
 }
@@ -10541,6 +11174,9 @@ pgbuf_dump (void)
   (void) fflush (stdout);
   (void) fprintf (stdout, "\n\n");
   (void) fprintf (stdout, "Num buffers = %d\n", pgbuf_Pool.num_buffers);
+  (void) fprintf (stdout, "Buffer memory page size = %lluK (huge pages = %d), NUMA policy = %d, NUMA nodes = %d\n",
+		  (unsigned long long) (pgbuf_Pool.iopage_table_memory.page_size / ONE_K),
+		  pgbuf_Pool.iopage_table_memory.huge_pages, pgbuf_Pool.numa_policy, pgbuf_Pool.numa_node_count);
 
   /* Dump info cached about perm and tmp volume identifiers */
   rv = pthread_mutex_lock (&pgbuf_Pool.volinfo_mutex);
@@ -13517,6 +14153,20 @@ pgbuf_has_any_non_vacuum_waiters (PAGE_PTR pgptr)
 #endif
 }
 
+/*
+ * pgbuf_peek_memory_stats () - get memory layout of page buffer
+ *
+ * return                   : void
+ * memory_page_kbytes (out) : size in KB of memory pages backing buffer frames (e.g. 2048 for 2MB huge pages)
+ * numa_nodes (out)         : number of NUMA nodes frames are spread on; 1 if no NUMA policy is effective
+ */
+void
+pgbuf_peek_memory_stats (UINT64 * memory_page_kbytes, UINT64 * numa_nodes)
+{
+  *memory_page_kbytes = pgbuf_Pool.iopage_table_memory.page_size / ONE_K;
+  *numa_nodes = pgbuf_Pool.numa_policy == PGBUF_NUMA_NONE ? 1 : pgbuf_Pool.numa_node_count;
+}
+
 /*
  * pgbuf_has_prevent_dealloc () - Quick check if page has any scanners.
  *
@@ -15004,6 +15654,38 @@ pgbuf_bcb_is_to_vacuum (const PGBUF_BCB * bcb)
   return (bcb->flags & PGBUF_BCB_TO_VACUUM_FLAG) != 0;
 }
 
+/*
+ * pgbuf_bcb_is_prefetched () - was page loaded by read-ahead and not fixed since?
+ *
+ * return   : true/false
+ * bcb (in) : bcb
+ */
+STATIC_INLINE bool
+pgbuf_bcb_is_prefetched (const PGBUF_BCB * bcb)
+{
+  return (bcb->flags & PGBUF_BCB_PREFETCHED_FLAG) != 0;
+}
+
+/*
+ * pgbuf_bcb_set_latch_mode () - set latch mode of bcb. granting a write latch changes bcb version, which invalidates
+ *				 concurrent optimistic reads.
+ *
+ * return          : void
+ * bcb (in)        : bcb
+ * latch_mode (in) : new latch mode
+ *
+ * note: version is changed before the page can be modified; the atomic increment is a full barrier.
+ */
+STATIC_INLINE void
+pgbuf_bcb_set_latch_mode (PGBUF_BCB * bcb, PGBUF_LATCH_MODE latch_mode)
+{
+  bcb->latch_mode = latch_mode;
+  if (latch_mode == PGBUF_LATCH_WRITE)
+    {
+      ATOMIC_INC_64 (&bcb->version, 2);
+    }
+}
+
 /*
  * pgbuf_bcb_avoid_victim () - should bcb be avoid for victimization?
  *
@@ -15401,233 +16083,959 @@ pgbuf_bcb_register_hit_for_lru (PGBUF_BCB * bcb)
 }
 
 /*
- * pgbuf_is_io_stressful () - is io stressful (are pages waiting for victims?)
+ * pgbuf_changed_pages_load () - start tracking changed pages; load the state saved before last shutdown or crash
  *
- * return    : true/false
- */
-bool
-pgbuf_is_io_stressful (void)
-{
-#if defined (SERVER_MODE)
-  /* we consider the IO stressful if threads end up waiting for victims */
-  return !pgbuf_Pool.direct_victims.waiter_threads_low_priority->is_empty ();
-#else /* !SERVER_MODE */
-  return false;
-#endif /* !SERVER_MODE */
-}
-
-/*
- * pgbuf_is_hit_ratio_low () - is page buffer hit ratio low? currently target is set to 99.9%.
+ * return             : void
+ * thread_p (in)      : thread entry
+ * is_media_crash (in): true if database is restored from backup
  *
- * return : true/false
+ * note: the loaded state is only trusted after pgbuf_changed_pages_check_restart.
  */
-STATIC_INLINE bool
-pgbuf_is_hit_ratio_low (void)
+void
+pgbuf_changed_pages_load (THREAD_ENTRY * thread_p, bool is_media_crash)
 {
-#define PGBUF_MIN_VICTIM_REQ                10	/* set a minimum number of requests */
-#define PGBUF_DESIRED_HIT_VS_MISS_RATE      1000	/* 99.9% hit ratio */
+  fileio_make_changed_pages_name (pgbuf_Changed_pages.file_name, boot_db_full_name ());
+  LSA_SET_NULL (&pgbuf_Changed_pages.rebuild_lsa);
 
-  return (pgbuf_Pool.monitor.lru_victim_req_cnt > PGBUF_MIN_VICTIM_REQ
-	  && pgbuf_Pool.monitor.lru_victim_req_cnt * PGBUF_DESIRED_HIT_VS_MISS_RATE > pgbuf_Pool.monitor.fix_req_cnt);
+  if (!prm_get_bool_value (PRM_ID_IO_BACKUP_CHANGED_PAGE_TRACKING) || is_media_crash)
+    {
+      /* the saved state does not match the volumes anymore, or it would miss the changes made while tracking is
+       * disabled */
+      (void) remove (pgbuf_Changed_pages.file_name);
+      if (!prm_get_bool_value (PRM_ID_IO_BACKUP_CHANGED_PAGE_TRACKING))
+	{
+	  return;
+	}
+    }
 
-#undef PGBUF_DESIRED_HIT_VS_MISS_RATE
-#undef PGBUF_MIN_VICTIM_REQ
+  if (pgbuf_Changed_pages.tracker == NULL)
+    {
+      // *INDENT-OFF*
+      pgbuf_Changed_pages.tracker = new (std::nothrow) cubio::changed_page_tracker ();
+      // *INDENT-ON*
+      if (pgbuf_Changed_pages.tracker == NULL)
+	{
+	  /* not fatal; incremental backups scan all pages */
+	  return;
+	}
+    }
+
+  if (is_media_crash
+      || !pgbuf_Changed_pages.tracker->load (pgbuf_Changed_pages.file_name, log_Gl.hdr.db_creation,
+					     pgbuf_Changed_pages.rebuild_lsa))
+    {
+      /* incremental backups scan all pages until next backup of lower level */
+      pgbuf_Changed_pages.tracker->invalidate ();
+      LSA_SET_NULL (&pgbuf_Changed_pages.rebuild_lsa);
+    }
 }
 
-#if defined (SERVER_MODE)
 /*
- * pgbuf_bcbmon_lock () - monitor and lock bcb mutex
+ * pgbuf_changed_pages_check_restart () - check the loaded state is complete
  *
- * return           : void
- * bcb (in)         : BCB to lock
- * caller_line (in) : caller line
+ * return          : void
+ * restart_lsa (in): start of recovery redo, or end of log if there is no recovery
+ *
+ * note: pages written after the state was saved were changed by log records after the saved rebuild LSA; recovery
+ *       marks them again (see log_rv_redo_fix_page). if redo starts later than that, some of them are lost.
  */
-static void
-pgbuf_bcbmon_lock (PGBUF_BCB * bcb, int caller_line)
+void
+pgbuf_changed_pages_check_restart (const LOG_LSA * restart_lsa)
 {
-  int index = thread_get_current_entry_index ();
-  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
-
-  assert_release (pgbuf_Monitor_locks);
-
-  if (monitor_bcb_mutex->bcb != NULL)
-    {
-      /* already have a bcb mutex. we cannot lock another one unless try lock is used. */
-      PGBUF_ABORT_RELEASE ();
-    }
-  if (monitor_bcb_mutex->bcb_second != NULL)
-    {
-      /* already have a bcb mutex. we cannot lock another one unless try lock is used. */
-      PGBUF_ABORT_RELEASE ();
-    }
-  if (bcb->owner_mutex == index)
+  if (pgbuf_Changed_pages.tracker == NULL)
     {
-      /* double lock */
-      PGBUF_ABORT_RELEASE ();
+      return;
     }
-  /* ok, we can lock */
-  (void) pthread_mutex_lock (&bcb->mutex);
-  if (bcb->owner_mutex >= 0)
+
+  if (LSA_ISNULL (&pgbuf_Changed_pages.rebuild_lsa) || LSA_LT (&pgbuf_Changed_pages.rebuild_lsa, restart_lsa))
     {
-      /* somebody else has mutex? */
-      PGBUF_ABORT_RELEASE ();
+      pgbuf_Changed_pages.tracker->invalidate ();
     }
-  monitor_bcb_mutex->bcb = bcb;
-  monitor_bcb_mutex->line = caller_line;
-  bcb->owner_mutex = index;
+  LSA_SET_NULL (&pgbuf_Changed_pages.rebuild_lsa);
 }
 
 /*
- * pgbuf_bcbmon_trylock () - monitor and try locking bcb mutex. do not wait if it is already locked
+ * pgbuf_changed_pages_mark () - mark page as changed since last backups
  *
- * return           : try lock result
- * bcb (in)         : BCB to lock
- * caller_line (in) : caller line
+ * return    : void
+ * vpid (in) : permanent page about to be written to disk
  */
-static int
-pgbuf_bcbmon_trylock (PGBUF_BCB * bcb, int caller_line)
+void
+pgbuf_changed_pages_mark (const VPID * vpid)
 {
-  int index = thread_get_current_entry_index ();
-  int rv;
-  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
-
-  assert_release (pgbuf_Monitor_locks);
-
-  if (bcb->owner_mutex == index)
-    {
-      /* double lock */
-      PGBUF_ABORT_RELEASE ();
-    }
-  if (monitor_bcb_mutex->bcb != NULL && monitor_bcb_mutex->bcb_second != NULL)
-    {
-      /* two bcb's are already locked. */
-      PGBUF_ABORT_RELEASE ();
-    }
-  if (monitor_bcb_mutex->bcb != NULL && monitor_bcb_mutex->bcb == bcb)
-    {
-      /* same bcb is already locked?? */
-      PGBUF_ABORT_RELEASE ();
-    }
-  /* try lock */
-  rv = pthread_mutex_trylock (&bcb->mutex);
-  if (rv == 0)
-    {
-      /* success. monitor it. */
-      if (monitor_bcb_mutex->bcb == NULL)
-	{
-	  monitor_bcb_mutex->bcb = bcb;
-	  monitor_bcb_mutex->line = caller_line;
-	}
-      else
-	{
-	  monitor_bcb_mutex->bcb_second = bcb;
-	  monitor_bcb_mutex->line_second = caller_line;
-	}
-      bcb->owner_mutex = index;
-    }
-  else
+  if (pgbuf_Changed_pages.tracker != NULL)
     {
-      /* failed */
+      pgbuf_Changed_pages.tracker->mark (vpid->volid, vpid->pageid);
     }
-  return rv;
 }
 
 /*
- * pgbuf_bcbmon_unlock () - monitor and unlock BCB mutex
+ * pgbuf_changed_pages_save () - save the tracking state
  *
- * return   : void
- * bcb (in) : BCB to unlock
+ * return          : void
+ * thread_p (in)   : thread entry
+ * rebuild_lsa (in): all pages changed by log records before this LSA and not marked yet are already on disk
  */
-static void
-pgbuf_bcbmon_unlock (PGBUF_BCB * bcb)
+void
+pgbuf_changed_pages_save (THREAD_ENTRY * thread_p, const LOG_LSA * rebuild_lsa)
 {
-  int index = thread_get_current_entry_index ();
-  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
-
-  assert_release (pgbuf_Monitor_locks);
-
-  /* should be monitored */
-  if (bcb->owner_mutex != index)
+  if (pgbuf_Changed_pages.tracker == NULL)
     {
-      /* I did not lock it?? */
-      PGBUF_ABORT_RELEASE ();
+      return;
     }
-  bcb->owner_mutex = -1;
 
-  if (monitor_bcb_mutex->bcb == bcb)
-    {
-      /* remove bcb from monitor. */
-      monitor_bcb_mutex->bcb = NULL;
-    }
-  else if (monitor_bcb_mutex->bcb_second == bcb)
-    {
-      /* remove bcb from monitor */
-      monitor_bcb_mutex->bcb_second = NULL;
-    }
-  else
+  if (!pgbuf_Changed_pages.tracker->save (pgbuf_Changed_pages.file_name, log_Gl.hdr.db_creation, *rebuild_lsa))
     {
-      /* I did not monitor it?? */
-      PGBUF_ABORT_RELEASE ();
+      /* not fatal; the previous file is kept, and it is rejected on restart since it is too old */
+      er_set_with_oserror (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, 0, pgbuf_Changed_pages.file_name);
+      er_clear ();
     }
-
-  pthread_mutex_unlock (&bcb->mutex);
 }
 
 /*
- * pgbuf_bcbmon_check_own () - check current thread owns bcb mutex.
+ * pgbuf_changed_pages_start_backup () - backup of given level is starting; tracking for next backups restarts
  *
- * return   : void
- * bcb (in) : BCB
+ * return     : void
+ * level (in) : backup level
  *
- * note: monitoring page buffer locks must be activated
+ * note: must be called before volumes are read.
  */
-static void
-pgbuf_bcbmon_check_own (PGBUF_BCB * bcb)
+void
+pgbuf_changed_pages_start_backup (int level)
 {
-  int index = thread_get_current_entry_index ();
-  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
-
-  assert_release (pgbuf_Monitor_locks);
-
-  if (bcb->owner_mutex != index)
+  if (pgbuf_Changed_pages.tracker != NULL)
     {
-      /* not owned */
-      PGBUF_ABORT_RELEASE ();
+      pgbuf_Changed_pages.tracker->start_backup (level);
     }
-  if (monitor_bcb_mutex->bcb != bcb && monitor_bcb_mutex->bcb_second != bcb)
+}
+
+/*
+ * pgbuf_changed_pages_end_backup () - backup of given level is finished
+ *
+ * return       : void
+ * level (in)   : backup level
+ * success (in) : true if backup succeeded
+ */
+void
+pgbuf_changed_pages_end_backup (int level, bool success)
+{
+  if (pgbuf_Changed_pages.tracker != NULL)
     {
-      /* not monitored? */
-      PGBUF_ABORT_RELEASE ();
+      pgbuf_Changed_pages.tracker->end_backup (level, success);
     }
 }
 
 /*
- * pgbuf_bcbmon_check_mutex_leaks () - check for mutex leaks. must be called on exit points where no BCB should be
- *                                     locked.
+ * pgbuf_changed_pages_is_tracked () - are the pages changed since the base of a backup of given level known?
  *
- * note: only works if page buffer lock monitoring is enabled.
+ * return     : true if pgbuf_changed_pages_is_changed can be used to skip pages
+ * level (in) : backup level
  */
-static void
-pgbuf_bcbmon_check_mutex_leaks (void)
+bool
+pgbuf_changed_pages_is_tracked (int level)
 {
-  int index = thread_get_current_entry_index ();
-  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
+  return (pgbuf_Changed_pages.tracker != NULL && pgbuf_Changed_pages.tracker->get_backup_bitmap (level) != NULL);
+}
 
-  assert_release (pgbuf_Monitor_locks);
+/*
+ * pgbuf_changed_pages_is_changed () - may the page be changed since the base of a backup of given level?
+ *
+ * return     : false only if the page on disk is the same as in the base backup
+ * level (in) : backup level
+ * vpid (in)  : page
+ */
+bool
+pgbuf_changed_pages_is_changed (int level, const VPID * vpid)
+{
+  // *INDENT-OFF*
+  const cubio::changed_page_bitmap *bitmap;
+  // *INDENT-ON*
 
-  if (monitor_bcb_mutex->bcb != NULL)
-    {
-      PGBUF_ABORT_RELEASE ();
-    }
-  if (monitor_bcb_mutex->bcb_second != NULL)
+  if (pgbuf_Changed_pages.tracker == NULL)
     {
-      PGBUF_ABORT_RELEASE ();
+      return true;
     }
+
+  bitmap = pgbuf_Changed_pages.tracker->get_backup_bitmap (level);
+  return bitmap == NULL || bitmap->test (vpid->volid, vpid->pageid);
 }
-#endif /* SERVER_MODE */
 
 /*
- * pgbuf_flags_mask_sanity_check () - check flags mask do not overlap!
+ * pgbuf_is_io_stressful () - is io stressful (are pages waiting for victims?)
+ *
+ * return    : true/false
+ */
+bool
+pgbuf_is_io_stressful (void)
+{
+#if defined (SERVER_MODE)
+  /* we consider the IO stressful if threads end up waiting for victims */
+  return !pgbuf_Pool.direct_victims.waiter_threads_low_priority->is_empty ();
+#else /* !SERVER_MODE */
+  return false;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * pgbuf_read_ahead_init () - initialize read-ahead state of a scan
+ *
+ * return          : void
+ * read_ahead (in) : read-ahead state
+ */
+void
+pgbuf_read_ahead_init (PGBUF_READ_AHEAD * read_ahead)
+{
+  VPID_SET_NULL (&read_ahead->last_vpid);
+  read_ahead->prefetch_upto = NULL_PAGEID;
+  read_ahead->window = 0;
+}
+
+/*
+ * pgbuf_read_ahead_notify () - notify read-ahead that a scan is about to fix a page. if the scan is sequential, next
+ *                              pages are requested to the prefetch daemon.
+ *
+ * return          : void
+ * thread_p (in)   : thread entry
+ * read_ahead (in) : read-ahead state of scan
+ * vpid (in)       : page about to be fixed
+ *
+ * note: the read-ahead window starts small and doubles on every sequential access, up to
+ *       data_buffer_read_ahead_max_pages. pages are never requested past the end of the current sector, since the
+ *       sector is the unit of file allocation and the next sector may belong to another file.
+ */
+void
+pgbuf_read_ahead_notify (THREAD_ENTRY * thread_p, PGBUF_READ_AHEAD * read_ahead, const VPID * vpid)
+{
+#if defined (SERVER_MODE)
+#define PGBUF_READ_AHEAD_MIN_WINDOW 4
+
+  int max_window;
+  PAGEID first_pageid, last_pageid, pageid;
+  VPID prefetch_vpid;
+  bool is_sequential;
+
+  assert (read_ahead != NULL && vpid != NULL);
+
+  is_sequential = (!VPID_ISNULL (&read_ahead->last_vpid) && read_ahead->last_vpid.volid == vpid->volid
+		   && read_ahead->last_vpid.pageid + 1 == vpid->pageid);
+  read_ahead->last_vpid = *vpid;
+
+  max_window = prm_get_integer_value (PRM_ID_PB_READ_AHEAD_MAX_PAGES);
+  if (!is_sequential || max_window <= 0 || pgbuf_Page_prefetch_daemon == NULL)
+    {
+      read_ahead->window = 0;
+      read_ahead->prefetch_upto = NULL_PAGEID;
+      return;
+    }
+
+  /* grow window */
+  if (read_ahead->window == 0)
+    {
+      read_ahead->window = MIN (PGBUF_READ_AHEAD_MIN_WINDOW, max_window);
+    }
+  else
+    {
+      read_ahead->window = MIN (read_ahead->window * 2, max_window);
+    }
+
+  if (pgbuf_is_io_stressful ())
+    {
+      /* don't add more pressure on victimization */
+      return;
+    }
+
+  first_pageid = vpid->pageid + 1;
+  if (read_ahead->prefetch_upto != NULL_PAGEID && read_ahead->prefetch_upto >= first_pageid)
+    {
+      first_pageid = read_ahead->prefetch_upto + 1;
+    }
+  last_pageid = MIN (vpid->pageid + read_ahead->window, SECTOR_LAST_PAGEID (SECTOR_FROM_PAGEID (vpid->pageid)));
+  if (first_pageid > last_pageid)
+    {
+      /* nothing new to request */
+      return;
+    }
+
+  prefetch_vpid.volid = vpid->volid;
+  for (pageid = first_pageid; pageid <= last_pageid; pageid++)
+    {
+      prefetch_vpid.pageid = pageid;
+      if (!pgbuf_Pool.prefetch_requests->produce (prefetch_vpid))
+	{
+	  /* queue is full; prefetch daemon is behind */
+	  break;
+	}
+      read_ahead->prefetch_upto = pageid;
+      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_PREFETCH_REQUESTS);
+    }
+
+  pgbuf_Page_prefetch_daemon->wakeup ();
+
+#undef PGBUF_READ_AHEAD_MIN_WINDOW
+#endif /* SERVER_MODE */
+}
+
+/*
+ * pgbuf_prefetch_page () - request a page to be loaded into buffer by the prefetch daemon. used by scans that know the
+ *                          next page they will fix, but do not access pages sequentially (e.g. next b-tree leaf).
+ *
+ * return        : true if page was requested, false otherwise
+ * thread_p (in) : thread entry
+ * vpid (in)     : page to load
+ *
+ * note: prefetch is best effort. nothing is requested while threads wait for victims or when the request queue is full.
+ */
+bool
+pgbuf_prefetch_page (THREAD_ENTRY * thread_p, const VPID * vpid)
+{
+#if defined (SERVER_MODE)
+  assert (vpid != NULL);
+
+  if (pgbuf_Page_prefetch_daemon == NULL || VPID_ISNULL (vpid) || pgbuf_is_io_stressful ())
+    {
+      return false;
+    }
+
+  if (!pgbuf_Pool.prefetch_requests->produce (*vpid))
+    {
+      /* queue is full; prefetch daemon is behind */
+      return false;
+    }
+  perfmon_inc_stat (thread_p, PSTAT_PB_NUM_PREFETCH_REQUESTS);
+
+  pgbuf_Page_prefetch_daemon->wakeup ();
+  return true;
+#else /* !SERVER_MODE */
+  return false;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * pgbuf_optimistic_read_page () - copy a page from buffer without fixing or latching it
+ *
+ * return           : pointer to page in copy, or NULL if the copy could not be done
+ * thread_p (in)    : thread entry
+ * vpid (in)        : page identifier
+ * copy_buffer (in) : buffer where page is copied
+ * read (out)       : optimistic read state, used to validate later that the page was not changed since the copy
+ *
+ * note: the copy is consistent; it is made only if the page is in buffer and not write latched, and it is discarded
+ *       if a write latch was granted or the bcb was replaced while copying. no errors are set when NULL is returned;
+ *       the caller should then fix the page the regular way.
+ *
+ *       the copy is laid out like a buffered page without bcb; page type checks and page identifier getters (used
+ *       when errors are reported) work on it, but it must not be passed to functions that reach the bcb (unfix,
+ *       set dirty, latch mode...).
+ */
+PAGE_PTR
+pgbuf_optimistic_read_page (THREAD_ENTRY * thread_p, const VPID * vpid, pgbuf_optimistic_buffer & copy_buffer,
+			    PGBUF_OPTIMISTIC_READ * read)
+{
+#if defined (SERVER_MODE)
+  PGBUF_BUFFER_HASH *hash_anchor;
+  PGBUF_BCB *bufptr;
+  PGBUF_IOPAGE_BUFFER *iopage_copy = (PGBUF_IOPAGE_BUFFER *) copy_buffer.get_ptr ();
+  FILEIO_PAGE *io_page = &iopage_copy->iopage;
+  UINT64 version;
+  int loop_cnt = 0;
+
+  static_assert (offsetof (PGBUF_IOPAGE_BUFFER, iopage) + IO_MAX_PAGE_SIZE <= pgbuf_optimistic_buffer::SIZE,
+		 "optimistic buffer is too small");
+  assert (vpid != NULL && read != NULL);
+
+  /* search hash chain without holding mutexes, like first phase of pgbuf_search_hash_chain. bcb's are never freed, so
+   * the chain can be followed safely; the bcb is checked again below. */
+  hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)];
+  for (bufptr = hash_anchor->hash_next; bufptr != NULL; bufptr = bufptr->hash_next)
+    {
+      if (VPID_EQ (&bufptr->vpid, vpid))
+	{
+	  break;
+	}
+      if (++loop_cnt > pgbuf_Pool.num_buffers)
+	{
+	  /* chain is being changed */
+	  bufptr = NULL;
+	  break;
+	}
+    }
+  if (bufptr == NULL)
+    {
+      /* not in buffer */
+      return NULL;
+    }
+
+  version = bufptr->version;
+  MEMORY_BARRIER ();
+  if ((version & 1) != 0 || bufptr->latch_mode == PGBUF_LATCH_WRITE || !VPID_EQ (&bufptr->vpid, vpid))
+    {
+      /* page is being replaced or modified */
+      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_OPTIMISTIC_READ_FAILS);
+      return NULL;
+    }
+
+  memcpy (io_page, &bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+
+  MEMORY_BARRIER ();
+  if (bufptr->version != version || !VPID_EQ (&bufptr->vpid, vpid))
+    {
+      /* page was changed while copying */
+      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_OPTIMISTIC_READ_FAILS);
+      return NULL;
+    }
+
+  iopage_copy->bcb = NULL;
+
+  read->vpid = *vpid;
+  read->bcb = bufptr;
+  read->version = version;
+  read->ptype = (PAGE_TYPE) io_page->prv.ptype;
+
+  perfmon_inc_stat (thread_p, PSTAT_PB_NUM_OPTIMISTIC_READS);
+  return (PAGE_PTR) io_page->page;
+#else /* !SERVER_MODE */
+  /* no concurrency; use regular fix */
+  return NULL;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * pgbuf_optimistic_validate () - check that page was not changed since it was read by pgbuf_optimistic_read_page
+ *
+ * return        : true if page was not changed
+ * thread_p (in) : thread entry
+ * read (in)     : optimistic read state
+ */
+bool
+pgbuf_optimistic_validate (THREAD_ENTRY * thread_p, const PGBUF_OPTIMISTIC_READ * read)
+{
+#if defined (SERVER_MODE)
+  PGBUF_BCB *bufptr = (PGBUF_BCB *) read->bcb;
+
+  assert (bufptr != NULL);
+
+  MEMORY_BARRIER ();
+  if (bufptr->version == read->version && VPID_EQ (&bufptr->vpid, &read->vpid))
+    {
+      return true;
+    }
+  perfmon_inc_stat (thread_p, PSTAT_PB_NUM_OPTIMISTIC_READ_FAILS);
+  return false;
+#else /* !SERVER_MODE */
+  return false;
+#endif /* !SERVER_MODE */
+}
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_warmup_dump () - save the VPID's of hottest pages in buffer to warmup file
+ *
+ * return        : error code
+ * thread_p (in) : thread entry
+ *
+ * note: pages in the hot zones of all LRU lists are saved first, then the rest of lists top to bottom, up to
+ *       data_buffer_warmup_pages. temporary pages are not saved. the file is written aside and renamed, so a crash
+ *       while dumping never leaves a partial file behind.
+ */
+static int
+pgbuf_warmup_dump (THREAD_ENTRY * thread_p)
+{
+  PGBUF_WARMUP_FILE_HEADER header;
+  PGBUF_LRU_LIST *lru_list;
+  PGBUF_BCB *bufptr;
+  VPID *vpids = NULL;
+  char tmp_file_name[PATH_MAX];
+  FILE *fp = NULL;
+  int max_pages, count = 0;
+  int pass, i;
+  int error_code = NO_ERROR;
+
+  max_pages = MIN (prm_get_integer_value (PRM_ID_PB_WARMUP_PAGES), pgbuf_Pool.num_buffers);
+  if (max_pages <= 0 || pgbuf_Warmup.file_name[0] == '\0' || pgbuf_Pool.buf_LRU_list == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  vpids = (VPID *) malloc (max_pages * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, max_pages * sizeof (VPID));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  /* first pass collects hot zones, second pass collects the rest */
+  for (pass = 0; pass < 2 && count < max_pages; pass++)
+    {
+      for (i = 0; i < PGBUF_TOTAL_LRU_COUNT && count < max_pages; i++)
+	{
+	  lru_list = PGBUF_GET_LRU_LIST (i);
+
+	  pthread_mutex_lock (&lru_list->mutex);
+	  if (pass == 0)
+	    {
+	      bufptr = lru_list->bottom_1 != NULL ? lru_list->top : NULL;
+	    }
+	  else
+	    {
+	      bufptr = lru_list->bottom_1 != NULL ? lru_list->bottom_1->next_BCB : lru_list->top;
+	    }
+	  for (; bufptr != NULL && count < max_pages; bufptr = bufptr->next_BCB)
+	    {
+	      if (VPID_ISNULL (&bufptr->vpid) || pgbuf_is_temp_lsa (bufptr->iopage_buffer->iopage.prv.lsa))
+		{
+		  /* skip */
+		}
+	      else
+		{
+		  vpids[count++] = bufptr->vpid;
+		}
+	      if (pass == 0 && bufptr == lru_list->bottom_1)
+		{
+		  /* end of hot zone */
+		  break;
+		}
+	    }
+	  pthread_mutex_unlock (&lru_list->mutex);
+	}
+    }
+
+  header.magic = PGBUF_WARMUP_MAGIC;
+  header.version = PGBUF_WARMUP_VERSION;
+  header.page_size = IO_PAGESIZE;
+  header.count = count;
+  header.db_creation = (INT64) log_Gl.hdr.db_creation;
+
+  snprintf (tmp_file_name, sizeof (tmp_file_name), "%s%s", pgbuf_Warmup.file_name, FILEIO_VOLTMP_PREFIX);
+  fp = fopen (tmp_file_name, "wb");
+  if (fp == NULL)
+    {
+      er_set_with_oserror (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_IO_MOUNT_FAIL, 1, tmp_file_name);
+      error_code = ER_IO_MOUNT_FAIL;
+      goto exit;
+    }
+  if (fwrite (&header, sizeof (header), 1, fp) != 1
+      || (count > 0 && fwrite (vpids, sizeof (VPID), count, fp) != (size_t) count) || fflush (fp) != 0)
+    {
+      er_set_with_oserror (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, 0, tmp_file_name);
+      error_code = ER_IO_WRITE;
+      goto exit;
+    }
+  fclose (fp);
+  fp = NULL;
+
+  if (os_rename_file (tmp_file_name, pgbuf_Warmup.file_name) != NO_ERROR)
+    {
+      er_set_with_oserror (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, 0, pgbuf_Warmup.file_name);
+      error_code = ER_IO_WRITE;
+      goto exit;
+    }
+
+  perfmon_add_stat (thread_p, PSTAT_PB_NUM_WARMUP_PAGES_DUMPED, count);
+
+exit:
+  if (fp != NULL)
+    {
+      fclose (fp);
+      (void) remove (tmp_file_name);
+    }
+  free_and_init (vpids);
+  return error_code;
+}
+
+/*
+ * pgbuf_warmup_load_prepare () - read the warmup file and sort its pages for loading
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ *
+ * note: a missing, damaged or foreign file is simply ignored; warmup is best effort.
+ */
+static void
+pgbuf_warmup_load_prepare (THREAD_ENTRY * thread_p)
+{
+  PGBUF_WARMUP_FILE_HEADER header;
+  FILE *fp;
+
+  assert (pgbuf_Warmup.vpids == NULL);
+
+  pgbuf_Warmup.count = 0;
+  pgbuf_Warmup.next = 0;
+
+  fp = fopen (pgbuf_Warmup.file_name, "rb");
+  if (fp == NULL)
+    {
+      return;
+    }
+
+  if (fread (&header, sizeof (header), 1, fp) != 1 || header.magic != PGBUF_WARMUP_MAGIC
+      || header.version != PGBUF_WARMUP_VERSION || header.page_size != IO_PAGESIZE
+      || header.db_creation != (INT64) log_Gl.hdr.db_creation || header.count <= 0)
+    {
+      fclose (fp);
+      return;
+    }
+
+  header.count = MIN (header.count, pgbuf_Pool.num_buffers);
+  pgbuf_Warmup.vpids = (VPID *) malloc (header.count * sizeof (VPID));
+  pgbuf_Warmup.io_pages_area = (char *) malloc (PGBUF_WARMUP_MAX_RUN_PAGES * IO_PAGESIZE + FILEIO_DIRECT_IO_ALIGNMENT);
+  if (pgbuf_Warmup.vpids == NULL || pgbuf_Warmup.io_pages_area == NULL)
+    {
+      fclose (fp);
+      pgbuf_warmup_load_end ();
+      return;
+    }
+  pgbuf_Warmup.io_pages = PTR_ALIGN (pgbuf_Warmup.io_pages_area, FILEIO_DIRECT_IO_ALIGNMENT);
+
+  pgbuf_Warmup.count = (int) fread (pgbuf_Warmup.vpids, sizeof (VPID), header.count, fp);
+  fclose (fp);
+
+  /* sort pages so that consecutive pages can be read together */
+  qsort (pgbuf_Warmup.vpids, pgbuf_Warmup.count, sizeof (VPID), pgbuf_compare_vpid);
+}
+
+/*
+ * pgbuf_warmup_load_pages () - load pages from warmup file into buffer
+ *
+ * return        : true if loading is finished, false if it should be resumed later
+ * thread_p (in) : thread entry
+ *
+ * note: runs of consecutive pages are read from disk with one request. each page of the run is then fixed through the
+ *       regular path as a prefetched page, which skips pages already in buffer, checks the double write buffer for
+ *       newer images and decrypts TDE pages; instead of reading the page again, the claimed bcb is filled from the
+ *       run (see pgbuf_warmup_get_run_page).
+ *
+ *       foreground transactions have priority: loading is paused while threads are waiting for victims and is stopped
+ *       when no free buffers are left, so warmup never victimizes pages.
+ */
+static bool
+pgbuf_warmup_load_pages (THREAD_ENTRY * thread_p)
+{
+  VPID *first_vpid;
+  PAGE_PTR pgptr;
+  int vol_fd;
+  int npages, i;
+
+  while (pgbuf_Warmup.next < pgbuf_Warmup.count)
+    {
+      if (thread_p->shutdown || pgbuf_is_io_stressful ())
+	{
+	  /* resume later */
+	  return false;
+	}
+      if (pgbuf_Pool.buf_invalid_list.invalid_cnt <= 0)
+	{
+	  /* buffer is full */
+	  return true;
+	}
+
+      /* find run of consecutive pages */
+      first_vpid = &pgbuf_Warmup.vpids[pgbuf_Warmup.next];
+      for (npages = 1; npages < PGBUF_WARMUP_MAX_RUN_PAGES && pgbuf_Warmup.next + npages < pgbuf_Warmup.count;
+	   npages++)
+	{
+	  if (first_vpid[npages].volid != first_vpid->volid || first_vpid[npages].pageid != first_vpid->pageid + npages)
+	    {
+	      break;
+	    }
+	}
+      pgbuf_Warmup.next += npages;
+
+      vol_fd = fileio_get_volume_descriptor (first_vpid->volid);
+      if (vol_fd == NULL_VOLDES
+	  || fileio_read_pages (thread_p, vol_fd, pgbuf_Warmup.io_pages, first_vpid->pageid, npages,
+				IO_PAGESIZE) == NULL)
+	{
+	  /* volume was removed or shrunk since the file was saved */
+	  er_clear ();
+	  continue;
+	}
+
+      pgbuf_Warmup.run_first = *first_vpid;
+      pgbuf_Warmup.run_npages = npages;
+      pgbuf_Warmup.run_reader = thread_p;
+
+      for (i = 0; i < npages; i++)
+	{
+	  pgptr = pgbuf_fix (thread_p, &first_vpid[i], OLD_PAGE_PREFETCH, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+	  if (pgptr != NULL)
+	    {
+	      pgbuf_unfix (thread_p, pgptr);
+	      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_WARMUP_PAGES_LOADED);
+	    }
+	  else
+	    {
+	      /* already in buffer, deallocated or latched */
+	      er_clear ();
+	    }
+	}
+
+      pgbuf_Warmup.run_reader = NULL;
+    }
+
+  return true;
+}
+
+/*
+ * pgbuf_warmup_load_end () - free warmup loading resources
+ *
+ * return : void
+ */
+static void
+pgbuf_warmup_load_end (void)
+{
+  if (pgbuf_Warmup.vpids != NULL)
+    {
+      free_and_init (pgbuf_Warmup.vpids);
+    }
+  if (pgbuf_Warmup.io_pages_area != NULL)
+    {
+      free_and_init (pgbuf_Warmup.io_pages_area);
+    }
+  pgbuf_Warmup.io_pages = NULL;
+  pgbuf_Warmup.run_reader = NULL;
+  pgbuf_Warmup.count = 0;
+  pgbuf_Warmup.next = 0;
+}
+
+/*
+ * pgbuf_warmup_get_run_page () - get the image of a page read by warmup loader with its run
+ *
+ * return        : page image, or NULL if the page must be read from disk
+ * thread_p (in) : thread entry
+ * vpid (in)     : page identifier
+ *
+ * note: only the loader thread uses the run; any other thread reads pages the regular way.
+ */
+static const FILEIO_PAGE *
+pgbuf_warmup_get_run_page (THREAD_ENTRY * thread_p, const VPID * vpid)
+{
+  if (pgbuf_Warmup.run_reader != thread_p || thread_p == NULL)
+    {
+      return NULL;
+    }
+  if (vpid->volid != pgbuf_Warmup.run_first.volid || vpid->pageid < pgbuf_Warmup.run_first.pageid
+      || vpid->pageid >= pgbuf_Warmup.run_first.pageid + pgbuf_Warmup.run_npages)
+    {
+      return NULL;
+    }
+
+  return (const FILEIO_PAGE *) (pgbuf_Warmup.io_pages
+				+ (size_t) (vpid->pageid - pgbuf_Warmup.run_first.pageid) * IO_PAGESIZE);
+}
+#endif /* SERVER_MODE */
+
+/*
+ * pgbuf_is_hit_ratio_low () - is page buffer hit ratio low? currently target is set to 99.9%.
+ *
+ * return : true/false
+ */
+STATIC_INLINE bool
+pgbuf_is_hit_ratio_low (void)
+{
+#define PGBUF_MIN_VICTIM_REQ                10	/* set a minimum number of requests */
+#define PGBUF_DESIRED_HIT_VS_MISS_RATE      1000	/* 99.9% hit ratio */
+
+  return (pgbuf_Pool.monitor.lru_victim_req_cnt > PGBUF_MIN_VICTIM_REQ
+	  && pgbuf_Pool.monitor.lru_victim_req_cnt * PGBUF_DESIRED_HIT_VS_MISS_RATE > pgbuf_Pool.monitor.fix_req_cnt);
+
+#undef PGBUF_DESIRED_HIT_VS_MISS_RATE
+#undef PGBUF_MIN_VICTIM_REQ
+}
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_bcbmon_lock () - monitor and lock bcb mutex
+ *
+ * return           : void
+ * bcb (in)         : BCB to lock
+ * caller_line (in) : caller line
+ */
+static void
+pgbuf_bcbmon_lock (PGBUF_BCB * bcb, int caller_line)
+{
+  int index = thread_get_current_entry_index ();
+  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
+
+  assert_release (pgbuf_Monitor_locks);
+
+  if (monitor_bcb_mutex->bcb != NULL)
+    {
+      /* already have a bcb mutex. we cannot lock another one unless try lock is used. */
+      PGBUF_ABORT_RELEASE ();
+    }
+  if (monitor_bcb_mutex->bcb_second != NULL)
+    {
+      /* already have a bcb mutex. we cannot lock another one unless try lock is used. */
+      PGBUF_ABORT_RELEASE ();
+    }
+  if (bcb->owner_mutex == index)
+    {
+      /* double lock */
+      PGBUF_ABORT_RELEASE ();
+    }
+  /* ok, we can lock */
+  (void) pthread_mutex_lock (&bcb->mutex);
+  if (bcb->owner_mutex >= 0)
+    {
+      /* somebody else has mutex? */
+      PGBUF_ABORT_RELEASE ();
+    }
+  monitor_bcb_mutex->bcb = bcb;
+  monitor_bcb_mutex->line = caller_line;
+  bcb->owner_mutex = index;
+}
+
+/*
+ * pgbuf_bcbmon_trylock () - monitor and try locking bcb mutex. do not wait if it is already locked
+ *
+ * return           : try lock result
+ * bcb (in)         : BCB to lock
+ * caller_line (in) : caller line
+ */
+static int
+pgbuf_bcbmon_trylock (PGBUF_BCB * bcb, int caller_line)
+{
+  int index = thread_get_current_entry_index ();
+  int rv;
+  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
+
+  assert_release (pgbuf_Monitor_locks);
+
+  if (bcb->owner_mutex == index)
+    {
+      /* double lock */
+      PGBUF_ABORT_RELEASE ();
+    }
+  if (monitor_bcb_mutex->bcb != NULL && monitor_bcb_mutex->bcb_second != NULL)
+    {
+      /* two bcb's are already locked. */
+      PGBUF_ABORT_RELEASE ();
+    }
+  if (monitor_bcb_mutex->bcb != NULL && monitor_bcb_mutex->bcb == bcb)
+    {
+      /* same bcb is already locked?? */
+      PGBUF_ABORT_RELEASE ();
+    }
+  /* try lock */
+  rv = pthread_mutex_trylock (&bcb->mutex);
+  if (rv == 0)
+    {
+      /* success. monitor it. */
+      if (monitor_bcb_mutex->bcb == NULL)
+	{
+	  monitor_bcb_mutex->bcb = bcb;
+	  monitor_bcb_mutex->line = caller_line;
+	}
+      else
+	{
+	  monitor_bcb_mutex->bcb_second = bcb;
+	  monitor_bcb_mutex->line_second = caller_line;
+	}
+      bcb->owner_mutex = index;
+    }
+  else
+    {
+      /* failed */
+    }
+  return rv;
+}
+
+/*
+ * pgbuf_bcbmon_unlock () - monitor and unlock BCB mutex
+ *
+ * return   : void
+ * bcb (in) : BCB to unlock
+ */
+static void
+pgbuf_bcbmon_unlock (PGBUF_BCB * bcb)
+{
+  int index = thread_get_current_entry_index ();
+  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
+
+  assert_release (pgbuf_Monitor_locks);
+
+  /* should be monitored */
+  if (bcb->owner_mutex != index)
+    {
+      /* I did not lock it?? */
+      PGBUF_ABORT_RELEASE ();
+    }
+  bcb->owner_mutex = -1;
+
+  if (monitor_bcb_mutex->bcb == bcb)
+    {
+      /* remove bcb from monitor. */
+      monitor_bcb_mutex->bcb = NULL;
+    }
+  else if (monitor_bcb_mutex->bcb_second == bcb)
+    {
+      /* remove bcb from monitor */
+      monitor_bcb_mutex->bcb_second = NULL;
+    }
+  else
+    {
+      /* I did not monitor it?? */
+      PGBUF_ABORT_RELEASE ();
+    }
+
+  pthread_mutex_unlock (&bcb->mutex);
+}
+
+/*
+ * pgbuf_bcbmon_check_own () - check current thread owns bcb mutex.
+ *
+ * return   : void
+ * bcb (in) : BCB
+ *
+ * note: monitoring page buffer locks must be activated
+ */
+static void
+pgbuf_bcbmon_check_own (PGBUF_BCB * bcb)
+{
+  int index = thread_get_current_entry_index ();
+  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
+
+  assert_release (pgbuf_Monitor_locks);
+
+  if (bcb->owner_mutex != index)
+    {
+      /* not owned */
+      PGBUF_ABORT_RELEASE ();
+    }
+  if (monitor_bcb_mutex->bcb != bcb && monitor_bcb_mutex->bcb_second != bcb)
+    {
+      /* not monitored? */
+      PGBUF_ABORT_RELEASE ();
+    }
+}
+
+/*
+ * pgbuf_bcbmon_check_mutex_leaks () - check for mutex leaks. must be called on exit points where no BCB should be
+ *                                     locked.
+ *
+ * note: only works if page buffer lock monitoring is enabled.
+ */
+static void
+pgbuf_bcbmon_check_mutex_leaks (void)
+{
+  int index = thread_get_current_entry_index ();
+  PGBUF_MONITOR_BCB_MUTEX *monitor_bcb_mutex = &pgbuf_Pool.monitor.bcb_locks[index];
+
+  assert_release (pgbuf_Monitor_locks);
+
+  if (monitor_bcb_mutex->bcb != NULL)
+    {
+      PGBUF_ABORT_RELEASE ();
+    }
+  if (monitor_bcb_mutex->bcb_second != NULL)
+    {
+      PGBUF_ABORT_RELEASE ();
+    }
+}
+#endif /* SERVER_MODE */
+
+/*
+ * pgbuf_flags_mask_sanity_check () - check flags mask do not overlap!
  *
  */
 static void
@@ -15878,6 +17286,83 @@ pgbuf_page_post_flush_execute (cubthread::entry & thread_ref)
 }
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+static void
+pgbuf_page_prefetch_execute (cubthread::entry & thread_ref)
+{
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      // wait for boot to finish
+      return;
+    }
+
+  VPID vpid;
+  PAGE_PTR pgptr;
+
+  /* load requested pages into buffer */
+  while (pgbuf_Pool.prefetch_requests->consume (vpid))
+    {
+      pgptr = pgbuf_fix (&thread_ref, &vpid, OLD_PAGE_PREFETCH, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+      if (pgptr != NULL)
+	{
+	  pgbuf_unfix (&thread_ref, pgptr);
+	}
+      else
+	{
+	  /* page was already in buffer, was not allocated or could not be latched. read-ahead is best effort */
+	  er_clear ();
+	}
+    }
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+static void
+pgbuf_page_warmup_execute (cubthread::entry & thread_ref)
+{
+  int dump_interval;
+  time_t now;
+
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      // wait for boot to finish
+      return;
+    }
+
+  switch (pgbuf_Warmup.status)
+    {
+    case PGBUF_WARMUP_NOT_STARTED:
+      pgbuf_warmup_load_prepare (&thread_ref);
+      pgbuf_Warmup.status = PGBUF_WARMUP_LOADING;
+      /* fall through */
+
+    case PGBUF_WARMUP_LOADING:
+      if (pgbuf_warmup_load_pages (&thread_ref))
+	{
+	  pgbuf_warmup_load_end ();
+	  pgbuf_Warmup.last_dump_time = time (NULL);
+	  pgbuf_Warmup.status = PGBUF_WARMUP_LOADED;
+	}
+      break;
+
+    case PGBUF_WARMUP_LOADED:
+      dump_interval = prm_get_integer_value (PRM_ID_PB_WARMUP_DUMP_INTERVAL);
+      now = time (NULL);
+      if (dump_interval > 0 && now - pgbuf_Warmup.last_dump_time >= dump_interval)
+	{
+	  (void) pgbuf_warmup_dump (&thread_ref);
+	  er_clear ();
+	  pgbuf_Warmup.last_dump_time = now;
+	}
+      break;
+
+    default:
+      assert (false);
+      break;
+    }
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 // class pgbuf_flush_control_daemon_task
 //
@@ -16016,6 +17501,48 @@ pgbuf_flush_control_daemon_init ()
 }
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_page_prefetch_daemon_init () - initialize page prefetch (read-ahead) daemon thread
+ */
+void
+pgbuf_page_prefetch_daemon_init ()
+{
+  assert (pgbuf_Page_prefetch_daemon == NULL);
+
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (100));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (pgbuf_page_prefetch_execute);
+
+  pgbuf_Page_prefetch_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task,
+                                                                         "pgbuf_page_prefetch");
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_page_warmup_daemon_init () - initialize page buffer warmup daemon thread
+ */
+void
+pgbuf_page_warmup_daemon_init ()
+{
+  assert (pgbuf_Page_warmup_daemon == NULL);
+
+  if (prm_get_integer_value (PRM_ID_PB_WARMUP_PAGES) <= 0)
+    {
+      // warmup is disabled
+      return;
+    }
+
+  fileio_make_pgbuf_warmup_name (pgbuf_Warmup.file_name, boot_db_full_name ());
+  pgbuf_Warmup.status = PGBUF_WARMUP_NOT_STARTED;
+
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (100));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (pgbuf_page_warmup_execute);
+
+  pgbuf_Page_warmup_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "pgbuf_page_warmup");
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * pgbuf_daemons_init () - initialize page buffer daemon threads
@@ -16027,6 +17554,8 @@ pgbuf_daemons_init ()
   pgbuf_page_flush_daemon_init ();
   pgbuf_page_post_flush_daemon_init ();
   pgbuf_flush_control_daemon_init ();
+  pgbuf_page_prefetch_daemon_init ();
+  pgbuf_page_warmup_daemon_init ();
 }
 #endif /* SERVER_MODE */
 
@@ -16041,6 +17570,9 @@ pgbuf_daemons_destroy ()
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_post_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Flush_control_daemon);
+  cubthread::get_manager ()->destroy_daemon (pgbuf_Page_prefetch_daemon);
+  cubthread::get_manager ()->destroy_daemon (pgbuf_Page_warmup_daemon);
+  pgbuf_warmup_load_end ();
 }
 #endif /* SERVER_MODE */
 
@@ -16275,7 +17807,7 @@ pgbuf_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int
   db_make_int (&vals[idx], pgbuf_Pool.num_buffers);
   idx++;
 
-  db_make_int (&vals[idx], PGBUF_IOPAGE_BUFFER_SIZE);
+  db_make_int (&vals[idx], (int) pgbuf_Pool.iopage_buffer_size);
   idx++;
 
   db_make_int (&vals[idx], status_snapshot->free_pages);
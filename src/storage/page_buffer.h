@@ -170,6 +170,8 @@ typedef enum
   OLD_PAGE_PREVENT_DEALLOC,	/* Fetch existing page and mark its memory buffer, to prevent deallocation. */
   OLD_PAGE_DEALLOCATED,		/* Fetch page that has been deallocated. */
   OLD_PAGE_MAYBE_DEALLOCATED,	/* Fetch page that maybe was deallocated. */
+  OLD_PAGE_PREFETCH,		/* Load page into buffer on behalf of read-ahead. Nothing is fixed if page is already in
+				 * buffer. Page may not be allocated; it is then silently discarded and no error is set. */
 } PAGE_FETCH_MODE;
 
 /* public page latch mode */
@@ -234,9 +236,31 @@ struct pgbuf_watcher
 #endif
 };
 
+/* sequential read-ahead state. one is kept by each scan that wants its next pages loaded in background. */
+typedef struct pgbuf_read_ahead PGBUF_READ_AHEAD;
+struct pgbuf_read_ahead
+{
+  VPID last_vpid;		/* last page fixed by scan */
+  PAGEID prefetch_upto;		/* pages up to this one were already requested */
+  int window;			/* current read-ahead window (in pages). grows on sequential access, collapses to
+				 * zero when access is not sequential */
+};
+
+/* optimistic (latch-free) read of a page. see pgbuf_optimistic_read_page. */
+typedef struct pgbuf_optimistic_read PGBUF_OPTIMISTIC_READ;
+struct pgbuf_optimistic_read
+{
+  VPID vpid;			/* page identifier */
+  void *bcb;			/* buffer the page was copied from */
+  UINT64 version;		/* buffer version when page was copied */
+  PAGE_TYPE ptype;		/* page type of copy */
+};
+
 // *INDENT-OFF*
 using pgbuf_aligned_buffer = cubmem::stack_block<(size_t) IO_MAX_PAGE_SIZE>;
 using pgbuf_resizable_buffer = cubmem::extensible_stack_block<(size_t) IO_MAX_PAGE_SIZE>;
+/* buffer for pgbuf_optimistic_read_page; room for page and for the header that precedes buffered pages */
+using pgbuf_optimistic_buffer = cubmem::stack_block<(size_t) IO_MAX_PAGE_SIZE + 2 * sizeof (void *)>;
 // *INDENT-ON*
 
 extern HFID *pgbuf_ordered_null_hfid;
@@ -410,6 +434,7 @@ extern void pgbuf_peek_stats (UINT64 * fixed_cnt, UINT64 * dirty_cnt, UINT64 * l
 			      UINT64 * alloc_bcb_waiter_high, UINT64 * alloc_bcb_waiter_med,
 			      UINT64 * alloc_bcb_waiter_low, UINT64 * lfcq_big_prv_num, UINT64 * lfcq_prv_num,
 			      UINT64 * lfcq_shr_num);
+extern void pgbuf_peek_memory_stats (UINT64 * memory_page_kbytes, UINT64 * numa_nodes);
 extern void pgbuf_daemons_get_stats (UINT64 * stats_out);
 
 extern int pgbuf_flush_control_from_dirty_ratio (void);
@@ -454,11 +479,30 @@ extern bool pgbuf_assign_flushed_pages (THREAD_ENTRY * thread_p);
 extern void pgbuf_notify_vacuum_follows (THREAD_ENTRY * thread_p, PAGE_PTR page);
 extern bool pgbuf_is_io_stressful (void);
 
+extern void pgbuf_changed_pages_load (THREAD_ENTRY * thread_p, bool is_media_crash);
+extern void pgbuf_changed_pages_check_restart (const LOG_LSA * restart_lsa);
+extern void pgbuf_changed_pages_mark (const VPID * vpid);
+extern void pgbuf_changed_pages_save (THREAD_ENTRY * thread_p, const LOG_LSA * rebuild_lsa);
+extern void pgbuf_changed_pages_start_backup (int level);
+extern void pgbuf_changed_pages_end_backup (int level, bool success);
+extern bool pgbuf_changed_pages_is_tracked (int level);
+extern bool pgbuf_changed_pages_is_changed (int level, const VPID * vpid);
+
 #if defined (SERVER_MODE)
 extern void pgbuf_daemons_init ();
 extern void pgbuf_daemons_destroy ();
 #endif /* SERVER_MODE */
 
+extern void pgbuf_read_ahead_init (PGBUF_READ_AHEAD * read_ahead);
+extern void pgbuf_read_ahead_notify (THREAD_ENTRY * thread_p, PGBUF_READ_AHEAD * read_ahead, const VPID * vpid);
+extern bool pgbuf_prefetch_page (THREAD_ENTRY * thread_p, const VPID * vpid);
+
+// *INDENT-OFF*
+extern PAGE_PTR pgbuf_optimistic_read_page (THREAD_ENTRY * thread_p, const VPID * vpid,
+					    pgbuf_optimistic_buffer & copy_buffer, PGBUF_OPTIMISTIC_READ * read);
+// *INDENT-ON*
+extern bool pgbuf_optimistic_validate (THREAD_ENTRY * thread_p, const PGBUF_OPTIMISTIC_READ * read);
+
 extern int pgbuf_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr);
 
 #endif /* _PAGE_BUFFER_H_ */
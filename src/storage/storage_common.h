@@ -1256,7 +1256,24 @@ typedef enum
 {
   HS_NONE = 0,			/* no hash aggregation */
   HS_ACCEPT_ALL,		/* accept tuples in hash table */
-  HS_REJECT_ALL			/* reject tuples, use normal sort-based aggregation */
+  HS_REJECT_ALL,		/* reject tuples, use normal sort-based aggregation */
+  HS_SPILL			/* hash table is full, spill tuples of new groups to partitions */
 } AGGREGATE_HASH_STATE;
 
+/* page buffer memory (data_buffer_huge_pages and data_buffer_numa_policy) */
+typedef enum
+{
+  PGBUF_HUGE_PAGES_NONE = 0,	/* regular heap allocation */
+  PGBUF_HUGE_PAGES_TRANSPARENT,	/* transparent huge pages advised on an anonymous mapping */
+  PGBUF_HUGE_PAGES_2M,		/* explicit 2MB huge pages; falls back to transparent */
+  PGBUF_HUGE_PAGES_1G		/* explicit 1GB huge pages; falls back to 2MB, then to transparent */
+} PGBUF_HUGE_PAGES_MODE;
+
+typedef enum
+{
+  PGBUF_NUMA_NONE = 0,		/* default policy of the process */
+  PGBUF_NUMA_INTERLEAVE,	/* buffer pages are interleaved page by page across NUMA nodes */
+  PGBUF_NUMA_PARTITION		/* buffer is split in one contiguous range per node; shared LRU lists are mapped to nodes */
+} PGBUF_NUMA_POLICY;
+
 #endif /* _STORAGE_COMMON_H_ */
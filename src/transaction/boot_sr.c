@@ -73,6 +73,7 @@
 #include "event_log.h"
 #include "tz_support.h"
 #include "filter_pred_cache.h"
+#include "heap_range_workers.hpp"
 #include "scan_manager.h"
 #include "slotted_page.h"
 #include "thread_manager.hpp"
@@ -2494,6 +2495,9 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
 #if defined(SERVER_MODE)
   pgbuf_daemons_init ();
   dwb_daemons_init ();
+  /* *INDENT-OFF* */
+  cubheap::initialize_range_workers ();
+  /* *INDENT-ON* */
 #endif /* SERVER_MODE */
 
   // after recovery we can boot vacuum
@@ -2806,6 +2810,9 @@ error:
 #if defined(SERVER_MODE)
   pgbuf_daemons_destroy ();
   dwb_daemons_destroy ();
+  /* *INDENT-OFF* */
+  cubheap::finalize_range_workers ();
+  /* *INDENT-ON* */
 #endif
 
   log_final (thread_p);
@@ -3112,6 +3119,9 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
 
 #if defined(SERVER_MODE)
   pgbuf_daemons_destroy ();
+  /* *INDENT-OFF* */
+  cubheap::finalize_range_workers ();
+  /* *INDENT-ON* */
 #endif
 
 #if defined (SA_MODE)
@@ -8307,8 +8307,10 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 	  pk_btid_index = i;
 	}
 
-      /* check for specified update attributes */
-      if ((att_id != NULL) && ((use_mvcc == false) || (index->type == BTREE_PRIMARY_KEY && index->fk != NULL)))
+      /* check for specified update attributes. att_id is given only when the new record was built from old_recdes by
+       * changing these attributes, so an index that has none of them keeps its key and needs no work, with or without
+       * MVCC. The object keeps its OID on update (even when it is relocated), so its index entries stay valid. */
+      if (att_id != NULL)
 	{
 	  found_btid = false;	/* guess as not found */
 
@@ -8327,6 +8329,7 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 	   * checking */
 	  if (!found_btid && !index->filter_predicate && (index->type != BTREE_PRIMARY_KEY || index->fk == NULL))
 	    {
+	      perfmon_inc_stat (thread_p, PSTAT_BT_NUM_UPDATE_SKIPS);
 	      continue;		/* skip and go ahead */
 	    }
 	}
@@ -8373,6 +8376,7 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 		    {
 		      /* the old rec satisfied the filter predicate the new rec satisfied the filter predicate the
 		       * index does not contain updated attributes */
+		      perfmon_inc_stat (thread_p, PSTAT_BT_NUM_UPDATE_SKIPS);
 		      continue;
 		    }
 		  /* nothing to do - update operation */
@@ -465,6 +465,7 @@ static bool la_retry_on_error (int errid);
 static int la_init_recdes_pool (int page_size, int num_recdes);
 static RECDES *la_assign_recdes_from_pool (void);
 static int la_realloc_recdes_data (RECDES * recdes, int data_size);
+static int la_uncompress_overflow_recdes (RECDES * recdes, int length);
 static void la_clear_recdes_pool (void);
 
 static LA_CACHE_PB *la_init_cache_pb (void);
@@ -4239,6 +4240,7 @@ la_get_overflow_recdes (LOG_RECORD_HEADER * log_record, void *logs, RECDES * rec
   int area_offset;
   int error = NO_ERROR;
   int length = 0;
+  int ovf_length = 0;
 
   LSA_COPY (&current_lsa, &log_record->prev_tranlsa);
   prev_vpid.pageid = ((LOG_REC_UNDOREDO *) logs)->data.pageid;
@@ -4336,6 +4338,7 @@ la_get_overflow_recdes (LOG_RECORD_HEADER * log_record, void *logs, RECDES * rec
       if (first)
 	{
 	  area_offset = offsetof (LA_OVF_FIRST_PART, data);
+	  ovf_length = ((LA_OVF_FIRST_PART *) ovf_list_data->data)->length;
 	  first = false;
 	}
       else
@@ -4352,6 +4355,63 @@ la_get_overflow_recdes (LOG_RECORD_HEADER * log_record, void *logs, RECDES * rec
 
   recdes->length = length;
 
+  if (ovf_length < 0)
+    {
+      /* the heap stored the record compressed; its uncompressed length is kept negated */
+      error = la_uncompress_overflow_recdes (recdes, -ovf_length);
+    }
+
+  return error;
+}
+
+/*
+ * la_uncompress_overflow_recdes() - uncompress the data of a compressed heap overflow record
+ *   return: error code
+ *   recdes(in/out): stored overflow data, replaced by the uncompressed data
+ *   length(in): length of the uncompressed data
+ *
+ * Note: The MVCC header is not compressed. It is followed by the length of the LZ4 compressed data.
+ */
+static int
+la_uncompress_overflow_recdes (RECDES * recdes, int length)
+{
+  char *zip_data;
+  int zip_length;
+  int body_length;
+  int error = NO_ERROR;
+
+  zip_length = OR_GET_INT (recdes->data + OR_MVCC_MAX_HEADER_SIZE);
+  zip_data = (char *) malloc (OR_MVCC_MAX_HEADER_SIZE + OR_INT_SIZE + zip_length);
+  if (zip_data == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) (OR_MVCC_MAX_HEADER_SIZE + OR_INT_SIZE + zip_length));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memcpy (zip_data, recdes->data, OR_MVCC_MAX_HEADER_SIZE + OR_INT_SIZE + zip_length);
+
+  error = la_realloc_recdes_data (recdes, length);
+  if (error != NO_ERROR)
+    {
+      free_and_init (zip_data);
+      return error;
+    }
+
+  memcpy (recdes->data, zip_data, OR_MVCC_MAX_HEADER_SIZE);
+  body_length = length - OR_MVCC_MAX_HEADER_SIZE;
+  if (LZ4_decompress_safe (zip_data + OR_MVCC_MAX_HEADER_SIZE + OR_INT_SIZE, recdes->data + OR_MVCC_MAX_HEADER_SIZE,
+			   zip_length, body_length) != body_length)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_DECOMPRESS_FAIL, 0);
+      error = ER_IO_LZ4_DECOMPRESS_FAIL;
+    }
+  else
+    {
+      recdes->length = length;
+    }
+
+  free_and_init (zip_data);
+
   return error;
 }
 
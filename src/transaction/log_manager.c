@@ -1316,6 +1316,8 @@ log_initialize_internal (THREAD_ENTRY * thread_p, const char *db_fullname, const
       init_emergency = true;
     }
 
+  pgbuf_changed_pages_load (thread_p, ismedia_crash);
+
   /*
    * Was the database system shut down or was it involved in a crash ?
    */
@@ -1361,6 +1363,8 @@ log_initialize_internal (THREAD_ENTRY * thread_p, const char *db_fullname, const
       LSA_COPY (&log_Gl.flushed_lsa_lower_bound, &log_Gl.append.prev_lsa);
 #endif /* SERVER_MODE */
 
+      pgbuf_changed_pages_check_restart (&log_Gl.hdr.append_lsa);
+
       /*
        * Indicate that database system is UP,... flush the header so that we
        * we know that the system was running in the even of crashes
@@ -1752,6 +1756,9 @@ log_final (THREAD_ENTRY * thread_p)
   log_Gl.hdr.has_logging_been_skipped = false;
   if (anyloose_ends == false && error_code == NO_ERROR)
     {
+      /* all pages are flushed; saved before the header, which tells next restart there is nothing to recover */
+      pgbuf_changed_pages_save (thread_p, &log_Gl.hdr.append_lsa);
+
       log_Gl.hdr.is_shutdown = true;
       LSA_COPY (&log_Gl.hdr.chkpt_lsa, &log_Gl.hdr.append_lsa);
       LSA_COPY (&log_Gl.hdr.smallest_lsa_at_last_chkpt, &log_Gl.hdr.chkpt_lsa);
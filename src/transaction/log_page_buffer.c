@@ -103,6 +103,7 @@
 #include "thread_entry.hpp"
 #include "thread_manager.hpp"
 #include "crypt_opfunc.h"
+#include "crc32c.hpp"
 #include "object_representation.h"
 
 #if !defined(SERVER_MODE)
@@ -434,7 +435,7 @@ logpb_initialize_log_buffer (LOG_BUFFER * log_buffer_p, LOG_PAGE * log_pg)
  * thread_p (in) : thread entry
  * log_pgptr (in) : log page pointer
  * checksum_crc32(out): computed checksum
- *   Note: Currently CRC32 is used as checksum.
+ *   Note: CRC32C is used as checksum if LOG_HDRPAGE_FLAG_CHECKSUM_CRC32C is set, CRC32 otherwise.
  *   Note: any changes to this requires changes to logwr_check_page_checksum
  */
 static int
@@ -471,7 +472,14 @@ logpb_compute_page_checksum (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgptr, int
       p += sample_nbytes;
     }
 
-  crypt_crc32 ((char *) buf, (int) sizeof_buf, checksum_crc32);
+  if (log_pgptr->hdr.flags & LOG_HDRPAGE_FLAG_CHECKSUM_CRC32C)
+    {
+      *checksum_crc32 = (int) cubbase::crc32c (buf, sizeof_buf);
+    }
+  else
+    {
+      crypt_crc32 ((char *) buf, (int) sizeof_buf, checksum_crc32);
+    }
 
   /* Restores the saved checksum */
   log_pgptr->hdr.checksum = saved_checksum_crc32;
@@ -484,7 +492,7 @@ logpb_compute_page_checksum (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgptr, int
  * return: error code
  * thread_p (in) : thread entry
  * log_pgptr (in) : log page pointer
- *   Note: Currently CRC32 is used as checksum.
+ *   Note: CRC32C is used as checksum.
  */
 int
 logpb_set_page_checksum (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgptr)
@@ -493,6 +501,8 @@ logpb_set_page_checksum (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgptr)
 
   assert (log_pgptr != NULL);
 
+  log_pgptr->hdr.flags |= LOG_HDRPAGE_FLAG_CHECKSUM_CRC32C;
+
   /* Computes the page checksum. */
   error_code = logpb_compute_page_checksum (thread_p, log_pgptr, &checksum_crc32);
   if (error_code != NO_ERROR)
@@ -6865,6 +6875,9 @@ logpb_checkpoint (THREAD_ENTRY * thread_p)
       goto error_cannot_chkpt;
     }
 
+  /* save changed pages before the checkpoint becomes the start of recovery; changes since redo LSA are replayed */
+  pgbuf_changed_pages_save (thread_p, LSA_ISNULL (&tmp_chkpt.redo_lsa) ? &newchkpt_lsa : &tmp_chkpt.redo_lsa);
+
   LOG_CS_ENTER (thread_p);
 
   if (LSA_ISNULL (&tmp_chkpt.redo_lsa))
@@ -7668,6 +7681,9 @@ loop:
       break;
     }
 
+  /* pages written from now on are in the backups based on this one; the ones written before are in this backup */
+  pgbuf_changed_pages_start_backup (backup_level);
+
   /*
    * Check for existing backup volumes in this location, and warn
    * the user that they will be destroyed.
@@ -8079,6 +8095,7 @@ loop:
       error_code = ER_FAILED;
       goto error;
     }
+  pgbuf_changed_pages_end_backup (backup_level, true);
 
   if (delete_unneeded_logarchives != false)
     {
@@ -8144,6 +8161,7 @@ error:
    * Destroy the backup that has been created.
    */
   fileio_abort_backup (thread_p, &session, bkup_in_progress);
+  pgbuf_changed_pages_end_backup (backup_level, false);
 
 #if defined(SERVER_MODE)
   LOG_CS_ENTER (thread_p);
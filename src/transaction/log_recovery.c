@@ -734,6 +734,7 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
 	  start_redolsa.pageid, end_redo_lsa.pageid);
 
   LSA_COPY (&log_Gl.chkpt_redo_lsa, &start_redolsa);
+  pgbuf_changed_pages_check_restart (&start_redolsa);
 
   LOG_SET_CURRENT_TRAN_INDEX (thread_p, rcv_tran_index);
   if (logpb_fetch_start_append_page (thread_p) != NO_ERROR)
@@ -6398,6 +6399,9 @@ log_rv_redo_fix_page (THREAD_ENTRY * thread_p, const VPID * vpid_rcv, LOG_RCVIND
 
   assert (vpid_rcv != NULL && !VPID_ISNULL (vpid_rcv));
 
+  /* the page may have been written after changed pages were last saved, even if it does not need redo */
+  pgbuf_changed_pages_mark (vpid_rcv);
+
   /* how it works:
    * since we are during recovery, we don't know the current state of page. it may be unreserved (its file is destroyed)
    * or it may not be allocated. these are expected cases and we don't want to raise errors if it happens.
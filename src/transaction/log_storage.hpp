@@ -48,6 +48,11 @@
   ((log_page_p)->hdr.flags & LOG_HDRPAGE_FLAG_ENCRYPTED_AES \
    || (log_page_p)->hdr.flags & LOG_HDRPAGE_FLAG_ENCRYPTED_ARIA)
 
+/*
+ * Set if page checksum is CRC32C. Pages written by older versions use CRC32.
+ */
+#define LOG_HDRPAGE_FLAG_CHECKSUM_CRC32C 0x4
+
 const LOG_PAGEID LOGPB_HEADER_PAGE_ID = -9;     /* The first log page in the infinite log sequence. It is always kept
 						 * on the active portion of the log. Log records are not stored on this
 						 * page. This page is backed up in all archive logs */
@@ -68,7 +73,8 @@ struct log_hdrpage
 				 * log because of such bad page, we could salvage the log starting at the offset
 				 * address, that is, at the next log record */
   short flags;			/* flags */
-  int checksum;			/* checksum - currently CRC32 is used to check log page consistency. */
+  int checksum;			/* checksum - CRC32C (or CRC32, see LOG_HDRPAGE_FLAG_CHECKSUM_CRC32C) is used to check
+				 * log page consistency. */
 };
 
 /* WARNING:
@@ -47,6 +47,7 @@
 #include "log_storage.hpp"
 #include "log_volids.hpp"
 #include "crypt_opfunc.h"
+#include "crc32c.hpp"
 #ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
 #include "tde.h"
 #endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
@@ -1971,7 +1972,7 @@ logwr_copy_log_file (const char *db_name, const char *log_path, int mode, INT64
  * thread_p (in) : thread entry
  * log_pgptr (in) : log page pointer
  * checksum_crc32(out): computed checksum
- *   Note: Currently CRC32 is used as checksum.
+ *   Note: CRC32C is used as checksum if LOG_HDRPAGE_FLAG_CHECKSUM_CRC32C is set, CRC32 otherwise.
  *   Note: this is a copy of logpb_compute_page_checksum
  */
 static int
@@ -2013,7 +2014,14 @@ logwr_check_page_checksum (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgptr)
       p += sample_nbytes;
     }
 
-  crypt_crc32 ((char *) buf, (int) sizeof_buf, &checksum_crc32);
+  if (log_pgptr->hdr.flags & LOG_HDRPAGE_FLAG_CHECKSUM_CRC32C)
+    {
+      checksum_crc32 = (int) cubbase::crc32c (buf, sizeof_buf);
+    }
+  else
+    {
+      crypt_crc32 ((char *) buf, (int) sizeof_buf, &checksum_crc32);
+    }
 
   /* Restores the saved checksum */
   log_pgptr->hdr.checksum = saved_checksum_crc32;
@@ -0,0 +1,299 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/* own header */
+#include "test_async_io.hpp"
+
+/* headers in test common */
+#include "test_output.hpp"
+#include "test_perf_compare.hpp"
+
+/* headers from cubrid */
+#include "async_io.hpp"
+
+/* system headers */
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace test_async_io
+{
+  static const std::size_t PAGE_SIZE = 16 * 1024;
+  static const std::size_t BATCH_SIZE = 64;
+
+  enum class io_mode
+  {
+    ASYNC,
+    SYNC,
+    COUNT
+  };
+  static test_common::string_collection io_mode_names ("io_uring", "pread/pwrite");
+  static test_common::string_collection io_step_names ("Sequential writes", "Sequential reads", "Random reads");
+
+  //  test_file - temporary file removed on destruction
+  class test_file
+  {
+    public:
+      test_file ()
+      {
+	char name[] = "test_async_io_XXXXXX";
+
+	m_fd = mkstemp (name);
+	m_name = name;
+      }
+
+      ~test_file ()
+      {
+	if (m_fd >= 0)
+	  {
+	    close (m_fd);
+	    unlink (m_name.c_str ());
+	  }
+      }
+
+      int get_fd () const
+      {
+	return m_fd;
+      }
+
+    private:
+      int m_fd;
+      std::string m_name;
+  };
+
+  static void
+  fill_page (char *page, std::size_t pageid, unsigned seed)
+  {
+    for (std::size_t i = 0; i < PAGE_SIZE; i++)
+      {
+	page[i] = (char) ((pageid * 31 + i * 7 + seed) & 0xFF);
+      }
+  }
+
+  //  execute_pages - read or write pages [0, npages) (or the pages in order when given) in batches of BATCH_SIZE
+  static bool
+  execute_pages (int fd, std::vector<char> &buffer, const std::vector<std::size_t> &order, bool is_write,
+		 io_mode mode)
+  {
+    cubio::request requests[BATCH_SIZE];
+    std::size_t nreq;
+
+    for (std::size_t start = 0; start < order.size (); start += nreq)
+      {
+	for (nreq = 0; nreq < BATCH_SIZE && start + nreq < order.size (); nreq++)
+	  {
+	    std::size_t pageid = order[start + nreq];
+	    char *page = &buffer[pageid * PAGE_SIZE];
+
+	    if (is_write)
+	      {
+		requests[nreq].set_write (fd, page, PAGE_SIZE, (off_t) (pageid * PAGE_SIZE));
+	      }
+	    else
+	      {
+		requests[nreq].set_read (fd, page, PAGE_SIZE, (off_t) (pageid * PAGE_SIZE));
+	      }
+	  }
+	if (!cubio::execute_batch (requests, nreq, mode == io_mode::ASYNC))
+	  {
+	    return false;
+	  }
+      }
+    return true;
+  }
+
+  static std::vector<std::size_t>
+  sequential_order (std::size_t npages)
+  {
+    std::vector<std::size_t> order (npages);
+
+    for (std::size_t i = 0; i < npages; i++)
+      {
+	order[i] = i;
+      }
+    return order;
+  }
+
+  static std::vector<std::size_t>
+  random_order (std::size_t npages)
+  {
+    std::vector<std::size_t> order = sequential_order (npages);
+    std::mt19937 gen (npages);
+
+    std::shuffle (order.begin (), order.end (), gen);
+    return order;
+  }
+
+  static int
+  test_write_and_read_back (io_mode write_mode, io_mode read_mode)
+  {
+    const std::size_t npages = 300;	// not a multiple of batch size
+    test_file file;
+    std::vector<char> written (npages * PAGE_SIZE);
+    std::vector<char> read (npages * PAGE_SIZE, 0);
+
+    if (file.get_fd () < 0)
+      {
+	std::cout << "  failed to create file" << std::endl;
+	return 1;
+      }
+
+    for (std::size_t pageid = 0; pageid < npages; pageid++)
+      {
+	fill_page (&written[pageid * PAGE_SIZE], pageid, 1);
+      }
+    if (!execute_pages (file.get_fd (), written, random_order (npages), true, write_mode))
+      {
+	std::cout << "  write failed" << std::endl;
+	return 1;
+      }
+    if (!execute_pages (file.get_fd (), read, sequential_order (npages), false, read_mode))
+      {
+	std::cout << "  read failed" << std::endl;
+	return 1;
+      }
+    if (std::memcmp (&written[0], &read[0], written.size ()) != 0)
+      {
+	std::cout << "  pages read are different than pages written" << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+
+  static int
+  test_read_past_end_of_file (io_mode mode)
+  {
+    test_file file;
+    std::vector<char> page (2 * PAGE_SIZE);
+    cubio::request requests[2];
+
+    fill_page (&page[0], 0, 2);
+    requests[0].set_write (file.get_fd (), &page[0], PAGE_SIZE, 0);
+    if (!cubio::execute_batch (requests, 1, mode == io_mode::ASYNC))
+      {
+	std::cout << "  write failed" << std::endl;
+	return 1;
+      }
+
+    requests[0].set_read (file.get_fd (), &page[0], PAGE_SIZE, 0);
+    requests[1].set_read (file.get_fd (), &page[PAGE_SIZE], PAGE_SIZE, PAGE_SIZE);
+    if (cubio::execute_batch (requests, 2, mode == io_mode::ASYNC))
+      {
+	std::cout << "  reading past end of file should fail" << std::endl;
+	return 1;
+      }
+    if (!requests[0].is_completed () || requests[1].is_completed ())
+      {
+	std::cout << "  unexpected request results " << requests[0].result << ", " << requests[1].result << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+
+  int
+  test_async_io_functional ()
+  {
+    int err = 0;
+
+    std::cout << "Start functional testing of asynchronous I/O; io_uring is "
+	      << (cubio::is_async_supported () ? "" : "not ") << "supported" << std::endl;
+
+    err |= test_write_and_read_back (io_mode::ASYNC, io_mode::SYNC);
+    err |= test_write_and_read_back (io_mode::SYNC, io_mode::ASYNC);
+    err |= test_write_and_read_back (io_mode::ASYNC, io_mode::ASYNC);
+    err |= test_read_past_end_of_file (io_mode::ASYNC);
+    err |= test_read_past_end_of_file (io_mode::SYNC);
+
+    std::cout << (err == 0 ? "  passed" : "  failed") << std::endl;
+    return err;
+  }
+
+  //  run_io_steps - time sequential writes, sequential reads and random reads of a file of npages, in given mode
+  static int
+  run_io_steps (test_common::perf_compare &result, io_mode mode, std::size_t npages)
+  {
+    test_file file;
+    std::vector<char> buffer (npages * PAGE_SIZE);
+    std::vector<std::size_t> seq_order = sequential_order (npages);
+    std::vector<std::size_t> rand_order = random_order (npages);
+    std::size_t step = 0;
+
+    test_common::sync_cout (std::string ("  ") + io_mode_names.get_name (static_cast<std::size_t> (mode)) + "\n");
+
+    for (std::size_t pageid = 0; pageid < npages; pageid++)
+      {
+	fill_page (&buffer[pageid * PAGE_SIZE], pageid, 3);
+      }
+
+    test_common::us_timer timer;
+
+    if (!execute_pages (file.get_fd (), buffer, seq_order, true, mode))
+      {
+	return 1;
+      }
+    if (fsync (file.get_fd ()) != 0)
+      {
+	return 1;
+      }
+    result.register_time (timer, static_cast<std::size_t> (mode), step++);
+
+    if (!execute_pages (file.get_fd (), buffer, seq_order, false, mode))
+      {
+	return 1;
+      }
+    result.register_time (timer, static_cast<std::size_t> (mode), step++);
+
+    if (!execute_pages (file.get_fd (), buffer, rand_order, false, mode))
+      {
+	return 1;
+      }
+    result.register_time (timer, static_cast<std::size_t> (mode), step++);
+
+    test_common::custom_assert (step == result.get_step_count ());
+    return 0;
+  }
+
+  int
+  test_async_io_performance ()
+  {
+    const std::size_t npages = 8 * 1024;	// 128MB
+    test_common::perf_compare compare_result (io_mode_names, io_step_names);
+    int err = 0;
+
+    std::cout << "Start performance testing of asynchronous I/O with " << npages << " pages of " << PAGE_SIZE
+	      << " bytes, in batches of " << BATCH_SIZE << std::endl;
+    if (!cubio::is_async_supported ())
+      {
+	std::cout << "  io_uring is not supported; both scenarios use pread/pwrite" << std::endl;
+      }
+
+    err |= run_io_steps (compare_result, io_mode::ASYNC, npages);
+    err |= run_io_steps (compare_result, io_mode::SYNC, npages);
+
+    std::cout << std::endl;
+    compare_result.print_results_and_warnings (std::cout);
+    return err;
+  }
+} // namespace test_async_io
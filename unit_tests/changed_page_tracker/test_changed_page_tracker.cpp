@@ -0,0 +1,264 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/* own header */
+#include "test_changed_page_tracker.hpp"
+
+/* headers from cubrid */
+#include "changed_page_tracker.hpp"
+
+/* system headers */
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test_changed_page_tracker
+{
+  static const std::int64_t DB_CREATION = 1234567;
+
+  static int
+  fail (const char *message)
+  {
+    std::cout << "  " << message << std::endl;
+    return 1;
+  }
+
+  static int
+  test_bitmap ()
+  {
+    cubio::changed_page_bitmap bitmap;
+    const int far_page = 3 * cubio::changed_page_bitmap::CHUNK_PAGES + 17;
+
+    if (bitmap.test (0, 0) || bitmap.count () != 0)
+      {
+	return fail ("new bitmap is not empty");
+      }
+
+    bitmap.set (0, 0);
+    bitmap.set (0, 63);
+    bitmap.set (0, 64);
+    bitmap.set (0, 64);
+    bitmap.set (5, far_page);
+    bitmap.set (cubio::changed_page_bitmap::MAX_VOLUMES - 1, 1);
+
+    if (!bitmap.test (0, 0) || !bitmap.test (0, 63) || !bitmap.test (0, 64) || bitmap.test (0, 65)
+	|| !bitmap.test (5, far_page) || bitmap.test (5, far_page - 1) || bitmap.test (4, far_page)
+	|| !bitmap.test (cubio::changed_page_bitmap::MAX_VOLUMES - 1, 1) || bitmap.count () != 5)
+      {
+	return fail ("unexpected bits after set");
+      }
+    if (!bitmap.has_volume (5) || bitmap.has_volume (4))
+      {
+	return fail ("unexpected volumes after set");
+      }
+
+    bitmap.clear ();
+    if (bitmap.test (0, 0) || bitmap.test (5, far_page) || bitmap.count () != 0)
+      {
+	return fail ("bitmap is not empty after clear");
+      }
+    return 0;
+  }
+
+  static int
+  test_concurrent_set ()
+  {
+    const int thread_count = 8;
+    const int pages_per_thread = 100000;
+    cubio::changed_page_bitmap bitmap;
+    std::vector<std::thread> threads;
+
+    // threads set interleaved pages, so they share words and chunks
+    for (int t = 0; t < thread_count; t++)
+      {
+	threads.emplace_back ([&bitmap, t] ()
+	{
+	  for (int i = 0; i < pages_per_thread; i++)
+	    {
+	      bitmap.set (1, i * thread_count + t);
+	    }
+	});
+      }
+    for (std::thread &th : threads)
+      {
+	th.join ();
+      }
+
+    if (bitmap.count () != (std::size_t) (thread_count * pages_per_thread))
+      {
+	return fail ("bits were lost by concurrent set");
+      }
+    return 0;
+  }
+
+  static int
+  test_backup_levels ()
+  {
+    cubio::changed_page_tracker tracker;
+
+    // nothing is known before first full backup
+    tracker.mark (0, 1);
+    if (tracker.get_backup_bitmap (1) != NULL || tracker.get_backup_bitmap (2) != NULL)
+      {
+	return fail ("tracker is complete before full backup");
+      }
+
+    // full backup
+    tracker.start_backup (0);
+    tracker.mark (0, 2);
+    tracker.end_backup (0, true);
+    tracker.mark (0, 3);
+
+    const cubio::changed_page_bitmap *level1 = tracker.get_backup_bitmap (1);
+    if (level1 == NULL || level1->test (0, 1) || !level1->test (0, 2) || !level1->test (0, 3))
+      {
+	return fail ("unexpected pages for level 1 after full backup");
+      }
+    if (tracker.get_backup_bitmap (2) == NULL || !tracker.get_backup_bitmap (2)->test (0, 3))
+      {
+	return fail ("unexpected pages for level 2 after full backup");
+      }
+
+    // failed level 1 backup changes nothing
+    tracker.start_backup (1);
+    tracker.mark (0, 4);
+    tracker.end_backup (1, false);
+    if (!tracker.get_backup_bitmap (2)->test (0, 3) || !tracker.get_backup_bitmap (2)->test (0, 4))
+      {
+	return fail ("failed backup changed tracking");
+      }
+
+    // level 1 backup restarts tracking for level 2 only
+    tracker.start_backup (1);
+    tracker.mark (0, 5);
+    tracker.end_backup (1, true);
+    tracker.mark (0, 6);
+    if (!tracker.get_backup_bitmap (1)->test (0, 3) || !tracker.get_backup_bitmap (1)->test (0, 6))
+      {
+	return fail ("level 1 backup changed tracking for level 1");
+      }
+    if (tracker.get_backup_bitmap (2)->test (0, 4) || !tracker.get_backup_bitmap (2)->test (0, 5)
+	|| !tracker.get_backup_bitmap (2)->test (0, 6))
+      {
+	return fail ("unexpected pages for level 2 after level 1 backup");
+      }
+
+    // level 2 backups do not restart anything
+    tracker.start_backup (2);
+    tracker.end_backup (2, true);
+    if (!tracker.get_backup_bitmap (2)->test (0, 5))
+      {
+	return fail ("level 2 backup changed tracking");
+      }
+
+    tracker.invalidate ();
+    if (tracker.get_backup_bitmap (1) != NULL || tracker.get_backup_bitmap (2) != NULL)
+      {
+	return fail ("tracker is complete after invalidate");
+      }
+    return 0;
+  }
+
+  static int
+  test_save_load ()
+  {
+    std::string file_name = "test_changed_page_tracker_file";
+    cubio::changed_page_tracker saved;
+    cubio::changed_page_tracker loaded;
+    log_lsa rebuild_lsa (100, 20);
+    log_lsa loaded_lsa;
+    FILE *fp;
+    int err = 0;
+
+    saved.start_backup (0);
+    saved.mark (0, 7);
+    saved.mark (2, cubio::changed_page_bitmap::CHUNK_PAGES + 7);
+    saved.end_backup (0, true);
+    saved.mark (1, 9);
+
+    if (!saved.save (file_name.c_str (), DB_CREATION, rebuild_lsa))
+      {
+	return fail ("save failed");
+      }
+
+    if (!loaded.load (file_name.c_str (), DB_CREATION, loaded_lsa) || !(loaded_lsa == rebuild_lsa)
+	|| loaded.get_backup_bitmap (1) == NULL || !loaded.get_backup_bitmap (1)->test (0, 7)
+	|| !loaded.get_backup_bitmap (1)->test (2, cubio::changed_page_bitmap::CHUNK_PAGES + 7)
+	|| !loaded.get_backup_bitmap (2)->test (1, 9) || loaded.get_backup_bitmap (1)->count () != 3)
+      {
+	err = fail ("loaded state does not match saved state");
+      }
+
+    if (err == 0 && loaded.load (file_name.c_str (), DB_CREATION + 1, loaded_lsa))
+      {
+	err = fail ("state of other database was loaded");
+      }
+    if (err == 0 && loaded.get_backup_bitmap (1) != NULL)
+      {
+	err = fail ("rejected load did not invalidate tracker");
+      }
+
+    // corrupt one byte of the bitmaps
+    fp = std::fopen (file_name.c_str (), "r+b");
+    if (err == 0 && fp != NULL)
+      {
+	int c;
+
+	std::fseek (fp, -64, SEEK_END);
+	c = std::fgetc (fp);
+	std::fseek (fp, -64, SEEK_END);
+	std::fputc (c ^ 0x10, fp);
+	std::fclose (fp);
+
+	if (loaded.load (file_name.c_str (), DB_CREATION, loaded_lsa))
+	  {
+	    err = fail ("corrupted state was loaded");
+	  }
+      }
+    else if (fp != NULL)
+      {
+	std::fclose (fp);
+      }
+
+    if (err == 0 && loaded.load ((file_name + "_missing").c_str (), DB_CREATION, loaded_lsa))
+      {
+	err = fail ("missing file was loaded");
+      }
+
+    std::remove (file_name.c_str ());
+    return err;
+  }
+
+  int
+  test_changed_page_tracker_functional ()
+  {
+    int err = 0;
+
+    std::cout << "Start functional testing of changed page tracker" << std::endl;
+
+    err |= test_bitmap ();
+    err |= test_concurrent_set ();
+    err |= test_backup_levels ();
+    err |= test_save_load ();
+
+    std::cout << (err == 0 ? "  passed" : "  failed") << std::endl;
+    return err;
+  }
+} // namespace test_changed_page_tracker
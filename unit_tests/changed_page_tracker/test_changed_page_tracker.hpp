@@ -0,0 +1,27 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_CHANGED_PAGE_TRACKER_HPP_
+#define _TEST_CHANGED_PAGE_TRACKER_HPP_
+
+namespace test_changed_page_tracker
+{
+  int test_changed_page_tracker_functional ();
+} // namespace test_changed_page_tracker
+
+#endif // !_TEST_CHANGED_PAGE_TRACKER_HPP_
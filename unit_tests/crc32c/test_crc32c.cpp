@@ -0,0 +1,217 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/* own header */
+#include "test_crc32c.hpp"
+
+/* headers in test common */
+#include "test_output.hpp"
+#include "test_perf_compare.hpp"
+
+/* headers from cubrid */
+#include "crc32c.hpp"
+#include "CRC.h"
+
+/* system headers */
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <cstring>
+
+namespace test_crc32c
+{
+  static const std::size_t PAGE_SIZE = 16 * 1024;
+
+  enum class crc_mode
+  {
+    CRC32C,
+    CRC32C_PORTABLE,
+    CRC32_LEGACY,
+    COUNT
+  };
+  static test_common::string_collection crc_mode_names ("crc32c", "crc32c portable", "crc32 (previous)");
+  static test_common::string_collection crc_step_names ("Checksum pages");
+
+  static void
+  fill_random (std::vector<unsigned char> &buffer, unsigned seed)
+  {
+    std::mt19937 gen (seed);
+
+    for (std::size_t i = 0; i < buffer.size (); i++)
+      {
+	buffer[i] = (unsigned char) (gen () & 0xFF);
+      }
+  }
+
+  static int
+  test_known_values ()
+  {
+    const char *digits = "123456789";
+    std::vector<unsigned char> zeros (32, 0);
+    std::vector<unsigned char> ones (32, 0xFF);
+
+    // check values from RFC 3720, B.4 and the usual "123456789" check value
+    if (cubbase::crc32c (digits, std::strlen (digits)) != 0xE3069283
+	|| cubbase::crc32c (&zeros[0], zeros.size ()) != 0x8A9136AA
+	|| cubbase::crc32c (&ones[0], ones.size ()) != 0x62A8AB43
+	|| cubbase::crc32c_portable_extend (0, digits, std::strlen (digits)) != 0xE3069283
+	|| cubbase::crc32c (digits, 0) != 0)
+      {
+	std::cout << "  unexpected checksum of known values" << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+
+  static int
+  test_accelerated_matches_portable ()
+  {
+    std::vector<unsigned char> buffer (PAGE_SIZE + 64);
+
+    fill_random (buffer, 1);
+
+    // all small sizes and all alignments, to cover head and tail handling
+    for (std::size_t offset = 0; offset < 16; offset++)
+      {
+	for (std::size_t size = 0; size < 64; size++)
+	  {
+	    if (cubbase::crc32c (&buffer[offset], size) != cubbase::crc32c_portable_extend (0, &buffer[offset], size))
+	      {
+		std::cout << "  checksum differs from portable checksum for offset " << offset << " and size " << size
+			  << std::endl;
+		return 1;
+	      }
+	  }
+      }
+    if (cubbase::crc32c (&buffer[1], PAGE_SIZE) != cubbase::crc32c_portable_extend (0, &buffer[1], PAGE_SIZE))
+      {
+	std::cout << "  page checksum differs from portable checksum" << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+
+  static int
+  test_extend ()
+  {
+    std::vector<unsigned char> buffer (PAGE_SIZE);
+    std::uint32_t whole;
+    std::uint32_t crc;
+
+    fill_random (buffer, 2);
+    whole = cubbase::crc32c (&buffer[0], PAGE_SIZE);
+
+    for (std::size_t split = 0; split <= PAGE_SIZE; split += 1021)
+      {
+	crc = cubbase::crc32c (&buffer[0], split);
+	crc = cubbase::crc32c_extend (crc, &buffer[split], PAGE_SIZE - split);
+	if (crc != whole)
+	  {
+	    std::cout << "  checksum computed in pieces split at " << split << " is different" << std::endl;
+	    return 1;
+	  }
+      }
+
+    // any changed bit must change the checksum
+    buffer[PAGE_SIZE / 2] ^= 0x10;
+    if (cubbase::crc32c (&buffer[0], PAGE_SIZE) == whole)
+      {
+	std::cout << "  checksum did not detect changed bit" << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+
+  int
+  test_crc32c_functional ()
+  {
+    int err = 0;
+
+    std::cout << "Start functional testing of CRC32C; CPU instructions are "
+	      << (cubbase::crc32c_is_accelerated () ? "" : "not ") << "used" << std::endl;
+
+    err |= test_known_values ();
+    err |= test_accelerated_matches_portable ();
+    err |= test_extend ();
+
+    std::cout << (err == 0 ? "  passed" : "  failed") << std::endl;
+    return err;
+  }
+
+  //  run_checksums - time checksums of all pages in buffer, in given mode
+  static int
+  run_checksums (test_common::perf_compare &result, crc_mode mode, const std::vector<unsigned char> &buffer,
+		 std::size_t repeat)
+  {
+    std::uint32_t sum = 0;
+    int crc32;
+
+    test_common::sync_cout (std::string ("  ") + crc_mode_names.get_name (static_cast<std::size_t> (mode)) + "\n");
+
+    test_common::us_timer timer;
+
+    for (std::size_t r = 0; r < repeat; r++)
+      {
+	for (std::size_t offset = 0; offset + PAGE_SIZE <= buffer.size (); offset += PAGE_SIZE)
+	  {
+	    switch (mode)
+	      {
+	      case crc_mode::CRC32C:
+		sum += cubbase::crc32c (&buffer[offset], PAGE_SIZE);
+		break;
+	      case crc_mode::CRC32C_PORTABLE:
+		sum += cubbase::crc32c_portable_extend (0, &buffer[offset], PAGE_SIZE);
+		break;
+	      default:
+		// as crypt_crc32 does
+		crc32 = CRC::Calculate (&buffer[offset], PAGE_SIZE, CRC::CRC_32 ());
+		sum += (std::uint32_t) crc32;
+		break;
+	      }
+	  }
+      }
+    result.register_time (timer, static_cast<std::size_t> (mode), 0);
+
+    // use the sum, so the loop is not optimized away
+    return sum == 0 ? 1 : 0;
+  }
+
+  int
+  test_crc32c_performance ()
+  {
+    const std::size_t npages = 1024;	// 16MB
+    const std::size_t repeat = 8;
+    test_common::perf_compare compare_result (crc_mode_names, crc_step_names);
+    std::vector<unsigned char> buffer (npages * PAGE_SIZE);
+    int err = 0;
+
+    std::cout << "Start performance testing of CRC32C with " << npages << " pages of " << PAGE_SIZE
+	      << " bytes, " << repeat << " times" << std::endl;
+
+    fill_random (buffer, 3);
+
+    err |= run_checksums (compare_result, crc_mode::CRC32C, buffer, repeat);
+    err |= run_checksums (compare_result, crc_mode::CRC32C_PORTABLE, buffer, repeat);
+    err |= run_checksums (compare_result, crc_mode::CRC32_LEGACY, buffer, repeat);
+
+    std::cout << std::endl;
+    compare_result.print_results_and_warnings (std::cout);
+    return err;
+  }
+} // namespace test_crc32c
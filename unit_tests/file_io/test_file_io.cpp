@@ -0,0 +1,157 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/* own header */
+#include "test_file_io.hpp"
+
+/* headers from cubrid */
+#include "file_io.h"
+#include "storage_common.h"
+#include "system_parameter.h"
+#include "thread_manager.hpp"
+
+/* system headers */
+#include <iostream>
+#include <string>
+
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace test_file_io
+{
+  static const VOLID VOL_ID = 0;
+  static const DKNPAGES FORMAT_NPAGES = 250;
+  static const DKNPAGES EXPAND_NPAGES = 400;
+
+  static int
+  fail (const std::string &message)
+  {
+    std::cout << "  " << message << std::endl;
+    return 1;
+  }
+
+  //  check_pages - every page of the volume must have the content of a formatted page
+  static int
+  check_pages (THREAD_ENTRY *thread_p, int vol_fd, DKNPAGES npages)
+  {
+    void *expected_p = NULL;
+    void *page_p = NULL;
+    int err = 0;
+
+    if (posix_memalign (&expected_p, FILEIO_DIRECT_IO_ALIGNMENT, IO_PAGESIZE) != 0
+	|| posix_memalign (&page_p, FILEIO_DIRECT_IO_ALIGNMENT, IO_PAGESIZE) != 0)
+      {
+	free (expected_p);
+	return fail ("out of memory");
+      }
+
+    std::memset (expected_p, 0, IO_PAGESIZE);
+    fileio_initialize_res (thread_p, (FILEIO_PAGE *) expected_p, IO_PAGESIZE);
+
+    if (fileio_get_number_of_volume_pages (vol_fd, IO_PAGESIZE) != npages)
+      {
+	err = fail ("unexpected number of pages in volume");
+      }
+    for (PAGEID page_id = 0; page_id < npages && err == 0; page_id++)
+      {
+	if (fileio_read (thread_p, vol_fd, page_p, page_id, IO_PAGESIZE) == NULL)
+	  {
+	    err = fail ("page " + std::to_string (page_id) + " cannot be read");
+	  }
+	else if (std::memcmp (page_p, expected_p, IO_PAGESIZE) != 0)
+	  {
+	    err = fail ("page " + std::to_string (page_id) + " is not formatted");
+	  }
+      }
+
+    free (expected_p);
+    free (page_p);
+    return err;
+  }
+
+  //  format_and_expand - format a volume with direct I/O, check it, expand it and check it again. pages are written
+  //                      from buffers allocated by malloc, that direct I/O refuses.
+  static int
+  format_and_expand (THREAD_ENTRY *thread_p, FILEIO_ATOMIC_WRITE_MODE atomic_write, const char *mode_name)
+  {
+    std::string vol_label = "test_file_io_volume";
+    int vol_fd;
+    int flags;
+    int err = 0;
+
+    std::cout << "  format with " << mode_name << std::endl;
+
+    prm_set_integer_value (PRM_ID_DWB_ATOMIC_WRITE, atomic_write);
+
+    vol_fd = fileio_format (thread_p, "test_file_io", vol_label.c_str (), VOL_ID, FORMAT_NPAGES, true, false, false,
+			    IO_PAGESIZE, 0, false);
+    if (vol_fd == NULL_VOLDES)
+      {
+	return fail ("volume cannot be formatted");
+      }
+
+    flags = fcntl (vol_fd, F_GETFL);
+    if (flags == -1 || !(flags & O_DIRECT))
+      {
+	std::cout << "  skipped: the file system does not support direct I/O" << std::endl;
+	fileio_dismount (thread_p, vol_fd);
+	fileio_unformat (thread_p, vol_label.c_str ());
+	return 0;
+      }
+
+    err = check_pages (thread_p, vol_fd, FORMAT_NPAGES);
+    if (err == 0)
+      {
+	if (fileio_expand_to (thread_p, VOL_ID, EXPAND_NPAGES, DB_PERMANENT_VOLTYPE) != NO_ERROR)
+	  {
+	    err = fail ("volume cannot be expanded");
+	  }
+	else
+	  {
+	    err = check_pages (thread_p, vol_fd, EXPAND_NPAGES);
+	  }
+      }
+
+    fileio_dismount (thread_p, vol_fd);
+    fileio_unformat (thread_p, vol_label.c_str ());
+    return err;
+  }
+
+  int
+  test_file_io_functional ()
+  {
+    THREAD_ENTRY *thread_p = NULL;
+    int err = 0;
+
+    std::cout << "Start functional testing of volume formatting with direct I/O" << std::endl;
+
+    cubthread::initialize (thread_p);
+    prm_set_bool_value (PRM_ID_DATA_VOLUME_DIRECT_IO, true);
+
+    err |= format_and_expand (thread_p, FILEIO_ATOMIC_WRITE_NEVER, "regular page writes");
+    err |= format_and_expand (thread_p, FILEIO_ATOMIC_WRITE_ALWAYS, "atomic page writes");
+
+    cubthread::finalize ();
+
+    std::cout << (err == 0 ? "  passed" : "  failed") << std::endl;
+    return err;
+  }
+} // namespace test_file_io
@@ -0,0 +1,429 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/* own header */
+#include "test_heap_attrinfo.hpp"
+
+/* headers in test common */
+#include "test_output.hpp"
+#include "test_perf_compare.hpp"
+
+/* headers from cubrid */
+#include "dbtype.h"
+#include "heap_attrinfo.h"
+#include "heap_file.h"
+#include "language_support.h"
+#include "object_domain.h"
+#include "object_primitive.h"
+#include "object_representation.h"
+
+/* system headers */
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cstring>
+
+namespace test_heap_attrinfo
+{
+  static const int N_ATTRS = 50;
+  static const REPR_ID REPR = 1;
+
+  // the predicate reads attributes in this order; the first term rejects nine rows out of ten
+  static const int PRED_ATTRS[] = { 0, 7, 16, 25, 34 };
+  static const int N_PRED_ATTRS = sizeof (PRED_ATTRS) / sizeof (PRED_ATTRS[0]);
+
+  enum class decode_mode
+  {
+    LAZY_PREDICATE_ATTRIBUTES,
+    PREDICATE_ATTRIBUTES,
+    ALL_ATTRIBUTES,
+    COUNT
+  };
+  static test_common::string_collection decode_mode_names ("lazy predicate attributes", "predicate attributes",
+      "all attributes");
+  static test_common::string_collection decode_step_names ("Filter rows");
+
+  // test_class - disk representation of a class with N_ATTRS attributes, alternately INTEGER and VARCHAR
+  class test_class
+  {
+    public:
+      test_class ()
+	: m_classrep ()
+	, m_attributes (N_ATTRS)
+      {
+	int fixed_length = 0;
+	int n_fixed = 0;
+	int n_variable = 0;
+
+	for (int i = 0; i < N_ATTRS; i++)
+	  {
+	    OR_ATTRIBUTE &att = m_attributes[i];
+
+	    att.id = i;
+	    att.def_order = i;
+	    if (i % 2 == 0)
+	      {
+		att.type = DB_TYPE_INTEGER;
+		att.domain = tp_domain_resolve_default (DB_TYPE_INTEGER);
+		att.is_fixed = 1;
+		att.location = fixed_length;
+		att.position = n_fixed++;
+		fixed_length += tp_domain_disk_size (att.domain);
+	      }
+	    else
+	      {
+		att.type = DB_TYPE_VARCHAR;
+		att.domain = tp_domain_resolve_default (DB_TYPE_VARCHAR);
+		att.is_fixed = 0;
+		att.location = n_variable++;
+		att.position = att.location;
+	      }
+	  }
+
+	m_classrep.attributes = &m_attributes[0];
+	m_classrep.id = REPR;
+	m_classrep.fixed_length = fixed_length;
+	m_classrep.n_attributes = N_ATTRS;
+	m_classrep.n_variable = n_variable;
+      }
+
+      //  make_record - build the disk record of the instance of given row
+      void
+      make_record (int row, std::vector<char> &record)
+      {
+	std::vector<DB_VALUE> values (N_ATTRS);
+	std::vector<std::string> strings (N_ATTRS);
+	int header[2];
+	int header_size;
+	int var_table_size = OR_VAR_TABLE_SIZE_INTERNAL (m_classrep.n_variable, BIG_VAR_OFFSET_SIZE);
+	int size;
+	int offset;
+	OR_BUF buf;
+
+	OR_PUT_INT (&header[0], REPR | OR_OFFSET_SIZE_4BYTE);
+	header_size = or_header_size ((char *) header);
+
+	size = header_size + var_table_size + m_classrep.fixed_length;
+	for (int i = 0; i < N_ATTRS; i++)
+	  {
+	    if (m_attributes[i].is_fixed)
+	      {
+		db_make_int (&values[i], row + i);
+	      }
+	    else
+	      {
+		strings[i] = "attribute " + std::to_string (i) + " of row " + std::to_string (row);
+		db_make_varchar (&values[i], DB_DEFAULT_PRECISION, strings[i].c_str (), (int) strings[i].size (),
+				 INTL_CODESET_ISO88591, LANG_COLL_ISO_BINARY);
+		size += m_attributes[i].domain->type->get_disk_size_of_value (&values[i]);
+	      }
+	  }
+
+	record.assign (size, 0);
+	OR_BUF_INIT (buf, &record[0], size);
+
+	// header
+	or_put_int (&buf, REPR | OR_OFFSET_SIZE_4BYTE);
+	or_put_int (&buf, 0);
+	buf.ptr = buf.buffer + header_size;
+
+	// variable offset table; offsets are relative to the end of header
+	offset = var_table_size + m_classrep.fixed_length;
+	for (int i = 0; i < N_ATTRS; i++)
+	  {
+	    if (!m_attributes[i].is_fixed)
+	      {
+		or_put_int (&buf, offset);
+		offset += m_attributes[i].domain->type->get_disk_size_of_value (&values[i]);
+	      }
+	  }
+	or_put_int (&buf, offset);
+	buf.ptr = buf.buffer + header_size + var_table_size;
+
+	// fixed attributes, then variable attributes
+	for (int i = 0; i < N_ATTRS; i++)
+	  {
+	    if (m_attributes[i].is_fixed)
+	      {
+		m_attributes[i].domain->type->data_writeval (&buf, &values[i]);
+	      }
+	  }
+	for (int i = 0; i < N_ATTRS; i++)
+	  {
+	    if (!m_attributes[i].is_fixed)
+	      {
+		m_attributes[i].domain->type->data_writeval (&buf, &values[i]);
+	      }
+	  }
+      }
+
+      //  start_attrinfo - initialize attribute info for given attributes, as heap_attrinfo_start does
+      void
+      start_attrinfo (HEAP_CACHE_ATTRINFO &attr_info, const std::vector<int> &attrs)
+      {
+	std::memset (&attr_info, 0, sizeof (attr_info));
+	attr_info.last_cacheindex = -1;
+	attr_info.read_cacheindex = -1;
+	attr_info.last_classrepr = &m_classrep;
+	attr_info.read_classrepr = &m_classrep;
+	OID_SET_NULL (&attr_info.inst_oid);
+	attr_info.inst_chn = NULL_CHN;
+	attr_info.num_values = (int) attrs.size ();
+	attr_info.values = new HEAP_ATTRVALUE[attrs.size ()];
+
+	for (std::size_t i = 0; i < attrs.size (); i++)
+	  {
+	    HEAP_ATTRVALUE &value = attr_info.values[i];
+
+	    value.attrid = attrs[i];
+	    value.state = HEAP_UNINIT_ATTRVALUE;
+	    value.do_increment = 0;
+	    value.attr_type = HEAP_INSTANCE_ATTR;
+	    value.last_attrepr = &m_attributes[attrs[i]];
+	    value.read_attrepr = &m_attributes[attrs[i]];
+	    db_make_null (&value.dbvalue);
+	  }
+      }
+
+      void
+      end_attrinfo (HEAP_CACHE_ATTRINFO &attr_info)
+      {
+	(void) heap_attrinfo_clear_dbvalues (&attr_info);
+	delete [] attr_info.values;
+	attr_info.values = NULL;
+      }
+
+    private:
+      OR_CLASSREP m_classrep;
+      std::vector<OR_ATTRIBUTE> m_attributes;
+  };
+
+  static bool
+  is_same_value (DB_VALUE *value1, DB_VALUE *value2)
+  {
+    if (value1 == NULL || value2 == NULL || DB_VALUE_TYPE (value1) != DB_VALUE_TYPE (value2))
+      {
+	return false;
+      }
+    if (DB_VALUE_TYPE (value1) == DB_TYPE_INTEGER)
+      {
+	return db_get_int (value1) == db_get_int (value2);
+      }
+    return db_get_string_size (value1) == db_get_string_size (value2)
+	   && std::memcmp (db_get_string (value1), db_get_string (value2), db_get_string_size (value1)) == 0;
+  }
+
+  static int
+  test_lazy_values_match ()
+  {
+    test_class cls;
+    std::vector<int> all_attrs;
+    std::vector<char> record;
+    HEAP_CACHE_ATTRINFO eager_info;
+    HEAP_CACHE_ATTRINFO lazy_info;
+    RECDES recdes;
+    OID oid = { 1, 1, 1 };
+    int err = 0;
+
+    for (int i = 0; i < N_ATTRS; i++)
+      {
+	all_attrs.push_back (i);
+      }
+    cls.start_attrinfo (eager_info, all_attrs);
+    cls.start_attrinfo (lazy_info, all_attrs);
+
+    for (int row = 0; row < 100 && err == 0; row++)
+      {
+	cls.make_record (row, record);
+	recdes.data = &record[0];
+	recdes.length = recdes.area_size = (int) record.size ();
+	recdes.type = REC_HOME;
+	oid.slotid = row + 1;
+
+	if (heap_attrinfo_read_dbvalues (NULL, &oid, &recdes, NULL, &eager_info) != NO_ERROR
+	    || heap_attrinfo_read_dbvalues_lazy (NULL, &oid, &recdes, &lazy_info) != NO_ERROR)
+	  {
+	    std::cout << "  failed to read values of row " << row << std::endl;
+	    err = 1;
+	    break;
+	  }
+
+	for (int i = 0; i < N_ATTRS; i++)
+	  {
+	    if (lazy_info.values[i].state != HEAP_UNREAD_ATTRVALUE)
+	      {
+		std::cout << "  value of attribute " << i << " was decoded before it was accessed" << std::endl;
+		err = 1;
+		break;
+	      }
+	  }
+
+	// access in reverse order, every other row only half of the values
+	for (int i = N_ATTRS - 1; i >= (row % 2 == 0 ? 0 : N_ATTRS / 2) && err == 0; i--)
+	  {
+	    if (!is_same_value (heap_attrinfo_access (i, &lazy_info), heap_attrinfo_access (i, &eager_info)))
+	      {
+		std::cout << "  lazy value of attribute " << i << " of row " << row << " is different" << std::endl;
+		err = 1;
+	      }
+	  }
+      }
+
+    cls.end_attrinfo (eager_info);
+    cls.end_attrinfo (lazy_info);
+    return err;
+  }
+
+  int
+  test_heap_attrinfo_functional ()
+  {
+    int err = 0;
+
+    std::cout << "Start functional testing of lazy attribute decoding" << std::endl;
+
+    err |= test_lazy_values_match ();
+
+    std::cout << (err == 0 ? "  passed" : "  failed") << std::endl;
+    return err;
+  }
+
+  //  filter_rows - time the evaluation of the predicate over all records, in given mode. the attributes that are not
+  //                read by the predicate are decoded for the rows that qualify
+  static int
+  filter_rows (test_common::perf_compare &result, decode_mode mode, test_class &cls,
+	       std::vector<std::vector<char>> &records, std::size_t repeat)
+  {
+    std::vector<int> pred_attrs (PRED_ATTRS, PRED_ATTRS + N_PRED_ATTRS);
+    std::vector<int> rest_attrs;
+    std::vector<int> all_attrs;
+    HEAP_CACHE_ATTRINFO pred_info;
+    HEAP_CACHE_ATTRINFO rest_info;
+    RECDES recdes;
+    OID oid = { 1, 1, 1 };
+    DB_VALUE *value;
+    std::size_t qualified = 0;
+    std::size_t mode_index;
+    int err = 0;
+
+    for (int i = 0; i < N_ATTRS; i++)
+      {
+	all_attrs.push_back (i);
+	if (std::find (pred_attrs.begin (), pred_attrs.end (), i) == pred_attrs.end ())
+	  {
+	    rest_attrs.push_back (i);
+	  }
+      }
+
+    mode_index = static_cast<std::size_t> (mode);
+    test_common::sync_cout (std::string ("  ") + decode_mode_names.get_name (mode_index) + "\n");
+
+    cls.start_attrinfo (pred_info, mode == decode_mode::ALL_ATTRIBUTES ? all_attrs : pred_attrs);
+    cls.start_attrinfo (rest_info, rest_attrs);
+
+    test_common::us_timer timer;
+
+    for (std::size_t r = 0; r < repeat && err == 0; r++)
+      {
+	for (std::size_t row = 0; row < records.size (); row++)
+	  {
+	    recdes.data = &records[row][0];
+	    recdes.length = recdes.area_size = (int) records[row].size ();
+	    recdes.type = REC_HOME;
+	    oid.slotid = (short) (row + 1);
+
+	    if (mode == decode_mode::LAZY_PREDICATE_ATTRIBUTES)
+	      {
+		err = heap_attrinfo_read_dbvalues_lazy (NULL, &oid, &recdes, &pred_info);
+	      }
+	    else
+	      {
+		err = heap_attrinfo_read_dbvalues (NULL, &oid, &recdes, NULL, &pred_info);
+	      }
+	    if (err != NO_ERROR)
+	      {
+		break;
+	      }
+
+	    // first term
+	    value = heap_attrinfo_access (PRED_ATTRS[0], &pred_info);
+	    if (value == NULL || db_get_int (value) % 10 != 0)
+	      {
+		continue;
+	      }
+	    // next terms
+	    for (int i = 1; i < N_PRED_ATTRS; i++)
+	      {
+		value = heap_attrinfo_access (PRED_ATTRS[i], &pred_info);
+		if (value == NULL || DB_IS_NULL (value))
+		  {
+		    err = 1;
+		    break;
+		  }
+	      }
+
+	    // the row qualifies; read the rest of the values
+	    if (mode != decode_mode::ALL_ATTRIBUTES
+		&& heap_attrinfo_read_dbvalues (NULL, &oid, &recdes, NULL, &rest_info) != NO_ERROR)
+	      {
+		err = 1;
+	      }
+	    qualified++;
+	  }
+      }
+    result.register_time (timer, mode_index, 0);
+
+    cls.end_attrinfo (pred_info);
+    cls.end_attrinfo (rest_info);
+
+    if (err == 0 && qualified != repeat * ((records.size () + 9) / 10))
+      {
+	std::cout << "  unexpected number of qualified rows " << qualified << std::endl;
+	err = 1;
+      }
+    return err == NO_ERROR ? 0 : 1;
+  }
+
+  int
+  test_heap_attrinfo_performance ()
+  {
+    const std::size_t nrows = 10000;
+    const std::size_t repeat = 20;
+    test_common::perf_compare compare_result (decode_mode_names, decode_step_names);
+    std::vector<std::vector<char>> records (nrows);
+    test_class cls;
+    int err = 0;
+
+    std::cout << "Start performance testing of attribute decoding with " << nrows << " rows of " << N_ATTRS
+	      << " attributes, " << repeat << " times" << std::endl;
+
+    for (std::size_t row = 0; row < nrows; row++)
+      {
+	cls.make_record ((int) row, records[row]);
+      }
+
+    err |= filter_rows (compare_result, decode_mode::LAZY_PREDICATE_ATTRIBUTES, cls, records, repeat);
+    err |= filter_rows (compare_result, decode_mode::PREDICATE_ATTRIBUTES, cls, records, repeat);
+    err |= filter_rows (compare_result, decode_mode::ALL_ATTRIBUTES, cls, records, repeat);
+
+    std::cout << std::endl;
+    compare_result.print_results_and_warnings (std::cout);
+    return err;
+  }
+} // namespace test_heap_attrinfo
@@ -0,0 +1,28 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_HEAP_ATTRINFO_HPP_
+#define _TEST_HEAP_ATTRINFO_HPP_
+
+namespace test_heap_attrinfo
+{
+  int test_heap_attrinfo_functional ();
+  int test_heap_attrinfo_performance ();
+} // namespace test_heap_attrinfo
+
+#endif // !_TEST_HEAP_ATTRINFO_HPP_
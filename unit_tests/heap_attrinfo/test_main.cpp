@@ -0,0 +1,55 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_heap_attrinfo.hpp"
+
+#include <string>
+#include <vector>
+
+int
+main (int argc, char **argv)
+{
+  size_t opt = 0;
+  std::vector<std::string> option_map =
+  {
+    "all",
+    "functional",
+    "performance"
+  };
+  if (argc >= 2)
+    {
+      for (size_t i = 0; i < option_map.size (); i++)
+	{
+	  if (option_map[i] == argv[1])
+	    {
+	      opt = i;
+	    }
+	}
+    }
+  int err = 0;
+  if (opt == 0 || opt == 1)
+    {
+      err = err | test_heap_attrinfo::test_heap_attrinfo_functional ();
+    }
+  if (opt == 0 || opt == 2)
+    {
+      err = err | test_heap_attrinfo::test_heap_attrinfo_performance ();
+    }
+
+  return err;
+}
@@ -0,0 +1,277 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/* own header */
+#include "test_heap_scan_batch.hpp"
+
+/* headers from cubrid */
+#include "file_io.h"
+#include "heap_file.h"
+#include "log_lsa.hpp"
+#include "oid.h"
+
+/* system headers */
+#include <iostream>
+#include <vector>
+
+#include <cstring>
+
+namespace test_heap_scan_batch
+{
+  static const int N_RECORDS = 4;
+  static const PGSLOTID FIRST_SLOT = 3;
+
+  // batch_fixture - a batch in the state heap_next_batch leaves it: the records of slots FIRST_SLOT and on of one
+  //                 page, peeked from the page fixed in the scan cache or copied
+  class batch_fixture
+  {
+    public:
+      batch_fixture (bool peek)
+	: m_page (sizeof (FILEIO_PAGE))
+	, m_oids (N_RECORDS)
+	, m_recdes (N_RECORDS)
+	, m_scan_cache (HEAP_SCANCACHE ())
+	, m_batch ()
+      {
+	LSA_SET_NULL (&io_page ()->prv.lsa);
+
+	std::memset (&m_batch, 0, sizeof (m_batch));
+	m_batch.oids = m_oids.data ();
+	m_batch.recdes = m_recdes.data ();
+	m_batch.max_records = N_RECORDS;
+	heap_scan_batch_reset (&m_batch);
+
+	for (int i = 0; i < N_RECORDS; i++)
+	  {
+	    m_batch.oids[i] = oid_of (i);
+	  }
+	m_batch.n_records = N_RECORDS;
+	m_batch.last_oid = m_batch.oids[N_RECORDS - 1];
+
+	m_scan_cache.page_watcher.pgptr = io_page ()->page;
+	if (peek)
+	  {
+	    m_batch.pgptr = m_scan_cache.page_watcher.pgptr;
+	    m_batch.page_lsa = io_page ()->prv.lsa;
+	  }
+      }
+
+      static OID
+      oid_of (int index)
+      {
+	OID oid;
+
+	oid.volid = 0;
+	oid.pageid = 1;
+	oid.slotid = FIRST_SLOT + index;
+	return oid;
+      }
+
+      // consume - the scan consumes the record at index, like scan_next_heap_batch_record
+      OID
+      consume (int index)
+      {
+	m_batch.current = index;
+	return m_batch.oids[index];
+      }
+
+      // resync - called before the next record is consumed, with the record the scan is positioned on
+      bool
+      resync (const OID &curr_oid)
+      {
+	return heap_scan_batch_resync (&m_batch, &curr_oid, &m_scan_cache);
+      }
+
+      // release_page - the page of the peeked records is unfixed
+      void
+      release_page ()
+      {
+	m_scan_cache.page_watcher.pgptr = NULL;
+      }
+
+      // change_page - a concurrent transaction updates the page
+      void
+      change_page ()
+      {
+	io_page ()->prv.lsa.offset++;
+      }
+
+      const HEAP_SCAN_BATCH &
+      batch () const
+      {
+	return m_batch;
+      }
+
+    private:
+      FILEIO_PAGE *
+      io_page ()
+      {
+	return reinterpret_cast<FILEIO_PAGE *> (m_page.data ());
+      }
+
+      std::vector<char> m_page;
+      std::vector<OID> m_oids;
+      std::vector<RECDES> m_recdes;
+      HEAP_SCANCACHE m_scan_cache;
+      HEAP_SCAN_BATCH m_batch;
+  };
+
+  static int
+  fail (const char *message)
+  {
+    std::cout << "  " << message << std::endl;
+    return 1;
+  }
+
+  // is_emptied_at - the batch was emptied and the next one starts after oid
+  static bool
+  is_emptied_at (const HEAP_SCAN_BATCH &batch, const OID &oid)
+  {
+    return batch.n_records == 0 && batch.current == -1 && batch.area_used == 0 && batch.pgptr == NULL
+	   && OID_EQ (&batch.last_oid, &oid);
+  }
+
+  static int
+  test_reset ()
+  {
+    batch_fixture fixture (true);
+    HEAP_SCAN_BATCH batch = fixture.batch ();
+    OID null_oid;
+
+    OID_SET_NULL (&null_oid);
+    batch.current = 1;
+    batch.area_used = 100;
+    heap_scan_batch_reset (&batch);
+
+    if (!is_emptied_at (batch, null_oid))
+      {
+	return fail ("reset did not move the batch to the start of the heap");
+      }
+    return 0;
+  }
+
+  // test_in_order - the records of the batch are consumed in order; it is never emptied
+  static int
+  test_in_order (bool peek)
+  {
+    batch_fixture fixture (peek);
+    OID curr_oid;
+
+    OID_SET_NULL (&curr_oid);
+    if (fixture.resync (curr_oid))
+      {
+	return fail ("batch was emptied before any record was consumed");
+      }
+    for (int i = 0; i < N_RECORDS; i++)
+      {
+	curr_oid = fixture.consume (i);
+	if (fixture.resync (curr_oid))
+	  {
+	    return fail ("batch was emptied while its records were consumed in order");
+	  }
+      }
+    if (fixture.batch ().n_records != N_RECORDS || !OID_EQ (&fixture.batch ().last_oid, &curr_oid))
+      {
+	return fail ("batch was changed while its records were consumed in order");
+      }
+    return 0;
+  }
+
+  // test_reevaluation - the scan moves back to the record before the one consumed last, to re-evaluate the latter
+  //                     with a copy
+  static int
+  test_reevaluation (bool peek)
+  {
+    int err = 0;
+
+    for (int i = 0; i < N_RECORDS; i++)
+      {
+	batch_fixture fixture (peek);
+	OID retry_oid;
+
+	// the scan moves back to the previous batch to re-evaluate the first record of the batch
+	retry_oid = (i == 0) ? batch_fixture::oid_of (-1) : fixture.consume (i - 1);
+	fixture.consume (i);
+
+	if (!fixture.resync (retry_oid) || !is_emptied_at (fixture.batch (), retry_oid))
+	  {
+	    err |= fail ("batch was not emptied for re-evaluation");
+	  }
+      }
+    return err;
+  }
+
+  // test_lost_page - the page of the peeked records is released or changed between two records
+  static int
+  test_lost_page (bool release_page)
+  {
+    batch_fixture fixture (true);
+    OID curr_oid = fixture.consume (1);
+
+    if (release_page)
+      {
+	fixture.release_page ();
+      }
+    else
+      {
+	fixture.change_page ();
+      }
+
+    if (!fixture.resync (curr_oid) || !is_emptied_at (fixture.batch (), curr_oid))
+      {
+	return fail ("batch was not emptied after the page was lost");
+      }
+    return 0;
+  }
+
+  // test_copied_lost_page - copied records do not depend on the page
+  static int
+  test_copied_lost_page ()
+  {
+    batch_fixture fixture (false);
+    OID curr_oid = fixture.consume (1);
+
+    fixture.change_page ();
+    fixture.release_page ();
+    if (fixture.resync (curr_oid))
+      {
+	return fail ("batch of copied records was emptied after the page was lost");
+      }
+    return 0;
+  }
+
+  int
+  test_heap_scan_batch_functional ()
+  {
+    int err = 0;
+
+    std::cout << "Start functional testing of batched heap scan positioning" << std::endl;
+
+    err |= test_reset ();
+    err |= test_in_order (true);
+    err |= test_in_order (false);
+    err |= test_reevaluation (true);
+    err |= test_reevaluation (false);
+    err |= test_lost_page (true);
+    err |= test_lost_page (false);
+    err |= test_copied_lost_page ();
+
+    std::cout << (err == 0 ? "  passed" : "  failed") << std::endl;
+    return err;
+  }
+} // namespace test_heap_scan_batch